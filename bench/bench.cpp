@@ -0,0 +1,949 @@
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <sjd/clustered_lights.h>
+#include <sjd/depth_sorter.h>
+#include <sjd/frame_arena.h>
+#include <sjd/frame_clock.h>
+#include <sjd/jobs.h>
+#include <sjd/normal_matrix.h>
+#include <sjd/occlusion.h>
+#include <sjd/profiler.h>
+#include <sjd/render_graph.h>
+#include <sjd/render_queue.h>
+
+#define SOKOL_DEBUG
+#define SOKOL_IMPL
+#define SOKOL_DUMMY_BACKEND
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_log.h>
+#include <sokol/sokol_time.h>
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+/* Headless benchmarks
+ * Runs the CPU side of the demos on sokol's dummy backend, so it needs no
+ * window or GL context and runs on machines without a GPU. Every sokol call
+ * is still made and validated, it just doesn't reach a driver, which leaves
+ * the work the demos do themselves: binning lights, occlusion culling,
+ * sorting, building uniforms and the render graph.
+ *
+ * Each scene is drawn from a scripted camera for a fixed number of frames
+ * on a sjd::FrameClock with a fixed step, so two runs do the same work.
+ * --record saves the clock's steps (of one --scene) and --replay runs from a
+ * recording instead, e.g. one made by a demo with AppDesc::recordPath. The
+ * CPU time of every frame (up to and including sg_commit) and
+ * sg_query_frame_stats() are written out as JSON:
+ *
+ *   bench --frames 600 --out bench.json
+ *   bench --scene sorted --threads 1
+ *   bench --trace trace.json       (sjd/profiler.h markers as well)
+ *
+ * Compare two results to catch a change that makes a frame slower or that
+ * issues more draws, applies or uniform bytes than it used to.
+ *
+ * The bench replaces the global operator new with one that counts, and the
+ * results have the heap allocations made inside the timed part of every
+ * frame. Once the warmup frames have grown every buffer and the FrameArena
+ * to size a frame shouldn't make any, so anything above zero is a per
+ * frame allocation that has crept in.
+ *
+ * Progress goes to stderr so the JSON can be piped, but the profiler and
+ * FrameClock print to stdout, so use --out along with --trace or --replay.
+ */
+
+namespace bench {
+// every operator new in the program, see the replacements at the bottom
+std::atomic<uint64_t> allocations {0};
+
+constexpr float FRAME_TIME {1.0f / 60.0f};
+constexpr float Z_NEAR {0.1f};
+constexpr float Z_FAR {100.0f};
+
+struct Options {
+    int frames {600};
+    int warmup {60};
+    int width {1280};
+    int height {720};
+    // binning and occlusion spread over this many of the JobSystem's threads
+    unsigned threads {sjd::JobSystem::instance().threadCount()};
+    std::string scene {"all"};
+    std::string out {};
+    std::string trace {};
+    std::string record {};
+    std::string replay {};
+};
+
+struct View {
+    // animation time
+    float time;
+    glm::vec3 position;
+    glm::mat4 view;
+    glm::mat4 projection;
+    float fovy;
+    float aspect;
+};
+
+// the same flight every run: a few laps around the origin, moving in and
+// out and up and down so the scenes are seen from every side and distance
+View scriptedView(double time, int width, int height) {
+    float t {static_cast<float>(time)};
+    float radius {14.0f + 6.0f * std::sin(t * 0.7f)};
+    float angle {t * 0.5f};
+    glm::vec3 position {std::cos(angle) * radius, 2.5f + 2.0f * std::sin(t * 0.3f), std::sin(angle) * radius};
+    View view {
+        .time = t,
+        .position = position,
+        .view = glm::lookAt(position, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+        .fovy = glm::radians(45.0f),
+        .aspect = static_cast<float>(width) / static_cast<float>(height),
+    };
+    view.projection = glm::perspective(view.fovy, view.aspect, Z_NEAR, Z_FAR);
+    return view;
+}
+
+// matches the demos' vs_params block
+struct VsParams {
+    glm::mat4 model;
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::mat4 normalMatrix;
+};
+
+struct FsParams {
+    glm::vec4 colour;
+    glm::vec4 viewPos;
+};
+
+class Scene {
+public:
+    virtual ~Scene() = default;
+    virtual const char* name() const = 0;
+    virtual void init(const Options& options) = 0;
+    virtual void frame(const View& view, const sg_swapchain& swapchain) = 0;
+    virtual void cleanup() = 0;
+    // the scene's own counts for the last frame, averaged over the run
+    virtual std::vector<std::pair<const char*, double>> counters() const {
+        return {};
+    }
+};
+
+// the dummy backend never compiles anything, so shaders only need what
+// sokol validates: the uniform blocks, images and vertex attributes
+sg_shader makeObjectShader() {
+    sg_shader_desc desc {};
+    desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+    desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+    desc.uniform_blocks[0].size = sizeof(VsParams);
+    desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+    desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+    desc.uniform_blocks[1].size = sizeof(FsParams);
+    desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+    desc.label = "bench-object-shader";
+    return sg_make_shader(desc);
+}
+
+sg_shader makePresentShader() {
+    sg_shader_desc desc {};
+    desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    desc.images[0].image_type = SG_IMAGETYPE_2D;
+    desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+    desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+    desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    desc.image_sampler_pairs[0].image_slot = 0;
+    desc.image_sampler_pairs[0].sampler_slot = 0;
+    desc.label = "bench-present-shader";
+    return sg_make_shader(desc);
+}
+
+// cube positions only, as a triangle list
+std::vector<float> cubePositions() {
+    std::vector<float> positions;
+    const glm::vec3 corners[8] {
+        {-0.5f, -0.5f, -0.5f}, {0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, -0.5f}, {-0.5f, 0.5f, -0.5f},
+        {-0.5f, -0.5f, 0.5f}, {0.5f, -0.5f, 0.5f}, {0.5f, 0.5f, 0.5f}, {-0.5f, 0.5f, 0.5f},
+    };
+    const int faces[6][4] {
+        {0, 3, 2, 1}, {4, 5, 6, 7}, {0, 4, 7, 3}, {1, 2, 6, 5}, {0, 1, 5, 4}, {3, 7, 6, 2},
+    };
+    for (const auto& face : faces) {
+        for (int corner : {face[0], face[1], face[2], face[2], face[3], face[0]}) {
+            positions.push_back(corners[corner].x);
+            positions.push_back(corners[corner].y);
+            positions.push_back(corners[corner].z);
+        }
+    }
+    return positions;
+}
+
+sg_buffer makeCubeBuffer(const std::vector<float>& positions) {
+    return sg_make_buffer(sg_buffer_desc {
+        .size = positions.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = positions.data(),
+            .size = positions.size() * sizeof(float),
+        },
+        .label = "bench-cube-positions"
+    });
+}
+
+sg_vertex_layout_state positionLayout() {
+    sg_vertex_layout_state layout {};
+    layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3;
+    return layout;
+}
+
+/* Clustered lights
+ * The frame of demos/2-6-multiple-lights/2-clustered-lights: 256 orbiting
+ * lights binned and uploaded, the cube grid and floor rasterised into the
+ * occlusion buffer, a depth pre-pass and a shading pass over the visible
+ * cubes, the visible light cubes, and a pass copying the scene into the
+ * swapchain.
+ */
+class ClusteredScene : public Scene {
+public:
+    static constexpr int NR_POINT_LIGHTS {256};
+    static constexpr int GRID_SIZE {11};
+
+    const char* name() const override {
+        return "clustered";
+    }
+
+    void init(const Options& options) override;
+    void frame(const View& view, const sg_swapchain& swapchain) override;
+    void cleanup() override;
+
+    std::vector<std::pair<const char*, double>> counters() const override {
+        return {
+            {"lights", static_cast<double>(m_clusters.lightCount())},
+            {"visible_cubes", static_cast<double>(m_visibleCubes)},
+            {"visible_light_cubes", static_cast<double>(m_visibleLights)},
+        };
+    }
+
+private:
+    void drawScene();
+
+    unsigned m_threads {1};
+    sjd::ClusteredLights m_clusters;
+    sjd::OcclusionCuller m_occlusion;
+    sjd::RenderGraph m_graph;
+    sjd::RenderGraph::Target m_color {};
+    sjd::RenderGraph::Target m_depth {};
+    sg_shader m_objectShader {};
+    sg_shader m_presentShader {};
+    sg_pipeline m_depthPipeline {};
+    sg_pipeline m_objectPipeline {};
+    sg_pipeline m_presentPipeline {};
+    sg_buffer m_cubeBuffer {};
+    sg_sampler m_sampler {};
+    sg_bindings m_cubeBindings {};
+    std::vector<glm::mat4> m_models;
+    std::vector<glm::mat4> m_normalMatrices;
+    std::vector<glm::vec3> m_occluder;
+    // this frame's occlusion results, made fresh on the FrameArena each frame
+    sjd::FrameVector<char> m_visible;
+    std::vector<glm::vec3> m_orbits;
+    std::vector<sjd::ClusterLight> m_lights;
+    View m_view {};
+    int m_visibleCubes {};
+    int m_visibleLights {};
+};
+
+void ClusteredScene::init(const Options& options) {
+    m_threads = options.threads;
+    m_clusters.setup();
+
+    m_models.push_back(glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -1.0f, 0.0f)),
+                                  glm::vec3(GRID_SIZE * 2.0f, 0.2f, GRID_SIZE * 2.0f)));
+    for (int x {0}; x < GRID_SIZE; x++) {
+        for (int z {0}; z < GRID_SIZE; z++) {
+            glm::vec3 position {(x - GRID_SIZE / 2) * 2.0f, -0.4f, (z - GRID_SIZE / 2) * 2.0f};
+            glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+            float angle = 20.0f * (x * GRID_SIZE + z);
+            m_models.push_back(glm::rotate(model, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f)));
+        }
+    }
+    m_normalMatrices.resize(m_models.size());
+    sjd::computeNormalMatrices(m_models.data(), m_normalMatrices.data(), m_models.size());
+
+    std::mt19937 rng {42};
+    std::uniform_real_distribution<float> unit {0.0f, 1.0f};
+    for (int i {0}; i < NR_POINT_LIGHTS; i++) {
+        m_orbits.push_back(glm::vec3(unit(rng) * GRID_SIZE, 0.2f + unit(rng) * 1.5f, unit(rng) * glm::two_pi<float>()));
+        glm::vec3 colour {unit(rng), unit(rng), unit(rng)};
+        m_lights.push_back(sjd::ClusterLight {
+            .position = glm::vec3(0.0f),
+            .range = 2.5f,
+            .colour = glm::normalize(colour) * 2.0f,
+        });
+    }
+
+    std::vector<float> positions {cubePositions()};
+    for (size_t i {0}; i + 2 < positions.size(); i += 3)
+        m_occluder.push_back(glm::vec3(positions[i], positions[i + 1], positions[i + 2]));
+    m_cubeBuffer = makeCubeBuffer(positions);
+    m_cubeBindings.vertex_buffers[0] = m_cubeBuffer;
+
+    m_objectShader = makeObjectShader();
+    m_presentShader = makePresentShader();
+    m_depthPipeline = sg_make_pipeline(sg_pipeline_desc {
+        .shader = m_objectShader,
+        .layout = positionLayout(),
+        .depth = {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = true,
+        },
+        .color_count = 1,
+        .colors = {{ .write_mask = SG_COLORMASK_NONE }},
+        .label = "bench-depth-pipeline"
+    });
+    m_objectPipeline = sg_make_pipeline(sg_pipeline_desc {
+        .shader = m_objectShader,
+        .layout = positionLayout(),
+        .depth = {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+        },
+        .label = "bench-object-pipeline"
+    });
+    m_presentPipeline = sg_make_pipeline(sg_pipeline_desc {
+        .shader = m_presentShader,
+        .label = "bench-present-pipeline"
+    });
+    m_sampler = sg_make_sampler(sg_sampler_desc {
+        .min_filter = SG_FILTER_LINEAR,
+        .mag_filter = SG_FILTER_LINEAR,
+        .label = "bench-present-sampler"
+    });
+
+    m_color = m_graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = SG_PIXELFORMAT_RGBA8,
+        .label = "bench-color"
+    });
+    m_depth = m_graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = SG_PIXELFORMAT_DEPTH,
+        .label = "bench-depth"
+    });
+    m_graph.addPass(sjd::RenderGraph::PassDesc {
+        .name = "scene-pass",
+        .colors = {m_color},
+        .depth = m_depth,
+        .action = sg_pass_action {
+            .colors = {{ .load_action = SG_LOADACTION_CLEAR }}
+        },
+    }, [this] { drawScene(); });
+    m_graph.addPass(sjd::RenderGraph::PassDesc {
+        .name = "present-pass",
+        .reads = {m_color},
+        .swapchain = true,
+        .action = sg_pass_action {
+            .colors = {{ .load_action = SG_LOADACTION_DONTCARE }}
+        },
+    }, [this] {
+        sg_bindings bindings {};
+        bindings.images[0] = m_graph.image(m_color);
+        bindings.samplers[0] = m_sampler;
+        sg_apply_pipeline(m_presentPipeline);
+        sg_apply_bindings(bindings);
+        sg_draw(0, 3, 1);
+    });
+}
+
+void ClusteredScene::frame(const View& view, const sg_swapchain& swapchain) {
+    m_view = view;
+    for (int i {0}; i < NR_POINT_LIGHTS; i++) {
+        glm::vec3 orbit {m_orbits[i]};
+        float angle {orbit.z + view.time * 0.3f};
+        m_lights[i].position = glm::vec3(glm::cos(angle) * orbit.x, orbit.y, glm::sin(angle) * orbit.x);
+    }
+
+    {
+        SJD_PROFILE_SCOPE("bin-lights");
+        m_clusters.setProjection(view.fovy, view.aspect, Z_NEAR, Z_FAR);
+        m_clusters.bin(view.view, m_lights, m_threads);
+        m_clusters.upload();
+    }
+
+    {
+        SJD_PROFILE_SCOPE("occlusion");
+        m_occlusion.begin(view.projection * view.view);
+        for (size_t i {m_models.size()}; i-- > 0;)
+            m_occlusion.addOccluder(m_occluder, m_models[i]);
+        m_occlusion.rasterize(m_threads);
+        // last frame's went with the arena reset, so a new one rather than
+        // reusing it. The floor (model 0) is always drawn.
+        m_visible = sjd::FrameVector<char>(m_models.size(), 1);
+        for (size_t i {1}; i < m_models.size(); i++)
+            m_visible[i] = m_occlusion.boxVisible(glm::vec3(-0.5f), glm::vec3(0.5f), m_models[i]);
+    }
+
+    m_graph.execute(swapchain);
+}
+
+void ClusteredScene::drawScene() {
+    VsParams vs_params {
+        .view = m_view.view,
+        .projection = m_view.projection,
+    };
+    FsParams fs_params {
+        .colour = glm::vec4(1.0f),
+        .viewPos = glm::vec4(m_view.position, 1.0f),
+    };
+
+    sg_apply_pipeline(m_depthPipeline);
+    sg_apply_bindings(m_cubeBindings);
+    m_visibleCubes = 0;
+    for (size_t i {0}; i < m_models.size(); i++) {
+        if (!m_visible[i])
+            continue;
+        vs_params.model = m_models[i];
+        sg_apply_uniforms(0, SG_RANGE(vs_params));
+        sg_draw(0, 36, 1);
+        ++m_visibleCubes;
+    }
+
+    sg_apply_pipeline(m_objectPipeline);
+    sg_apply_bindings(m_cubeBindings);
+    sg_apply_uniforms(1, SG_RANGE(fs_params));
+    for (size_t i {0}; i < m_models.size(); i++) {
+        if (!m_visible[i])
+            continue;
+        vs_params.model = m_models[i];
+        vs_params.normalMatrix = m_normalMatrices[i];
+        sg_apply_uniforms(0, SG_RANGE(vs_params));
+        sg_draw(0, 36, 1);
+    }
+
+    m_visibleLights = 0;
+    for (int i {0}; i < NR_POINT_LIGHTS; i++) {
+        glm::mat4 model = glm::scale(glm::translate(glm::mat4(1.0f), m_lights[i].position), glm::vec3(0.05f));
+        if (!m_occlusion.boxVisible(glm::vec3(-0.5f), glm::vec3(0.5f), model))
+            continue;
+        fs_params.colour = glm::vec4(m_lights[i].colour, 1.0f);
+        sg_apply_uniforms(1, SG_RANGE(fs_params));
+        vs_params.model = model;
+        sg_apply_uniforms(0, SG_RANGE(vs_params));
+        sg_draw(0, 36, 1);
+        ++m_visibleLights;
+    }
+}
+
+void ClusteredScene::cleanup() {
+    m_graph.shutdown();
+    m_clusters.shutdown();
+    sg_destroy_sampler(m_sampler);
+    sg_destroy_pipeline(m_presentPipeline);
+    sg_destroy_pipeline(m_objectPipeline);
+    sg_destroy_pipeline(m_depthPipeline);
+    sg_destroy_shader(m_presentShader);
+    sg_destroy_shader(m_objectShader);
+    sg_destroy_buffer(m_cubeBuffer);
+}
+
+/* Sorted
+ * A lot of small draws through the RenderQueue: opaque cubes spread over a
+ * handful of pipelines and bindings so state sorting has something to do,
+ * translucent cubes drawn back to front, and windows sorted with the
+ * DepthSorter and drawn directly like demos/4-3-blending/2-blending.
+ */
+class SortedScene : public Scene {
+public:
+    static constexpr int OPAQUE_CUBES {4000};
+    static constexpr int TRANSLUCENT_CUBES {1000};
+    static constexpr int WINDOWS {1000};
+    static constexpr int PIPELINES {4};
+    static constexpr int BINDINGS {8};
+
+    const char* name() const override {
+        return "sorted";
+    }
+
+    void init(const Options& options) override;
+    void frame(const View& view, const sg_swapchain& swapchain) override;
+    void cleanup() override;
+
+    std::vector<std::pair<const char*, double>> counters() const override {
+        const sjd::RenderQueue::Stats& stats {m_queue.stats()};
+        return {
+            {"queue_draws", static_cast<double>(stats.draws)},
+            {"queue_pipeline_skips", static_cast<double>(stats.pipelineSkips)},
+            {"queue_bindings_skips", static_cast<double>(stats.bindingsSkips)},
+            {"queue_uniform_skips", static_cast<double>(stats.uniformSkips)},
+        };
+    }
+
+private:
+    struct Object {
+        glm::mat4 model;
+        glm::vec4 colour;
+        int pipeline;
+        uint16_t bindings;
+    };
+
+    sjd::RenderQueue m_queue;
+    sjd::DepthSorter m_sorter;
+    sg_shader m_shader {};
+    sg_buffer m_cubeBuffer {};
+    std::vector<sg_pipeline> m_pipelines;
+    sg_pipeline m_windowPipeline {};
+    sg_bindings m_windowBindings {};
+    std::vector<Object> m_opaque;
+    std::vector<Object> m_translucent;
+    std::vector<glm::vec3> m_windows;
+};
+
+void SortedScene::init([[maybe_unused]] const Options& options) {
+    m_shader = makeObjectShader();
+    std::vector<float> positions {cubePositions()};
+    m_cubeBuffer = makeCubeBuffer(positions);
+
+    for (int i {0}; i < PIPELINES; i++) {
+        bool translucent {i == PIPELINES - 1};
+        sg_pipeline_desc desc {
+            .shader = m_shader,
+            .layout = positionLayout(),
+            .depth = {
+                .pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+                .compare = SG_COMPAREFUNC_LESS,
+                .write_enabled = !translucent,
+            },
+            .cull_mode = i % 2 == 0 ? SG_CULLMODE_BACK : SG_CULLMODE_NONE,
+            .label = "bench-sorted-pipeline"
+        };
+        if (translucent) {
+            desc.colors[0].blend = sg_blend_state {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            };
+        }
+        m_pipelines.push_back(sg_make_pipeline(desc));
+    }
+    m_windowPipeline = m_pipelines.back();
+
+    // the same cube at different offsets, so every bindings id is real
+    // state for the queue to sort by
+    for (int i {0}; i < BINDINGS; i++) {
+        sg_bindings bindings {};
+        bindings.vertex_buffers[0] = m_cubeBuffer;
+        bindings.vertex_buffer_offsets[0] = i * 3 * static_cast<int>(sizeof(float));
+        m_queue.addBindings(bindings);
+    }
+    m_windowBindings.vertex_buffers[0] = m_cubeBuffer;
+
+    std::mt19937 rng {7};
+    std::uniform_real_distribution<float> spread {-20.0f, 20.0f};
+    std::uniform_real_distribution<float> unit {0.0f, 1.0f};
+    auto random_object = [&](int pipeline) {
+        glm::vec3 position {spread(rng), spread(rng) * 0.25f, spread(rng)};
+        return Object {
+            .model = glm::rotate(glm::translate(glm::mat4(1.0f), position),
+                                 unit(rng) * glm::two_pi<float>(), glm::vec3(0.0f, 1.0f, 0.0f)),
+            .colour = glm::vec4(unit(rng), unit(rng), unit(rng), 0.5f),
+            .pipeline = pipeline,
+            .bindings = static_cast<uint16_t>(rng() % BINDINGS),
+        };
+    };
+    for (int i {0}; i < OPAQUE_CUBES; i++)
+        m_opaque.push_back(random_object(static_cast<int>(rng() % (PIPELINES - 1))));
+    for (int i {0}; i < TRANSLUCENT_CUBES; i++)
+        m_translucent.push_back(random_object(PIPELINES - 1));
+    for (int i {0}; i < WINDOWS; i++)
+        m_windows.push_back(glm::vec3(spread(rng), spread(rng) * 0.25f, spread(rng)));
+}
+
+void SortedScene::frame(const View& view, const sg_swapchain& swapchain) {
+    sg_begin_pass(sg_pass {
+        .action = sg_pass_action {
+            .colors = {{ .load_action = SG_LOADACTION_CLEAR }}
+        },
+        .swapchain = swapchain,
+    });
+
+    {
+        SJD_PROFILE_SCOPE("queue-submit");
+        m_queue.begin();
+        // submit() copies the uniforms, so they can be locals
+        auto submit = [&](const Object& object, bool translucent) {
+            glm::vec3 position {object.model[3]};
+            float depth {glm::length(position - view.position) / Z_FAR};
+            VsParams vs_params {
+                .model = object.model,
+                .view = view.view,
+                .projection = view.projection,
+                .normalMatrix = object.model,
+            };
+            FsParams fs_params {
+                .colour = object.colour,
+                .viewPos = glm::vec4(view.position, 1.0f),
+            };
+            m_queue.submit(0, translucent, m_pipelines[object.pipeline], object.bindings, depth,
+                           {{0, SG_RANGE(vs_params)}, {1, SG_RANGE(fs_params)}},
+                           0, 36);
+        };
+        for (const Object& object : m_opaque)
+            submit(object, false);
+        for (const Object& object : m_translucent)
+            submit(object, true);
+    }
+    {
+        SJD_PROFILE_SCOPE("queue-execute");
+        m_queue.execute(0);
+    }
+
+    {
+        SJD_PROFILE_SCOPE("windows");
+        m_sorter.clear();
+        for (size_t i {0}; i < m_windows.size(); i++) {
+            glm::vec3 offset {m_windows[i] - view.position};
+            m_sorter.add(glm::dot(offset, offset), static_cast<uint32_t>(i));
+        }
+        sg_apply_pipeline(m_windowPipeline);
+        sg_apply_bindings(m_windowBindings);
+        VsParams vs_params {
+            .view = view.view,
+            .projection = view.projection,
+        };
+        FsParams fs_params {
+            .colour = glm::vec4(1.0f, 1.0f, 1.0f, 0.5f),
+            .viewPos = glm::vec4(view.position, 1.0f),
+        };
+        sg_apply_uniforms(1, SG_RANGE(fs_params));
+        for (const sjd::SortItem32& sorted : m_sorter.sortBackToFront()) {
+            vs_params.model = glm::scale(glm::translate(glm::mat4(1.0f), m_windows[sorted.index]),
+                                         glm::vec3(1.0f, 1.0f, 0.01f));
+            sg_apply_uniforms(0, SG_RANGE(vs_params));
+            sg_draw(0, 36, 1);
+        }
+    }
+
+    sg_end_pass();
+}
+
+void SortedScene::cleanup() {
+    for (sg_pipeline pipeline : m_pipelines)
+        sg_destroy_pipeline(pipeline);
+    sg_destroy_shader(m_shader);
+    sg_destroy_buffer(m_cubeBuffer);
+}
+
+struct Result {
+    std::string name;
+    std::vector<double> frameMs;
+    std::vector<uint64_t> frameAllocations;
+    sg_frame_stats totals {};
+    std::vector<std::pair<const char*, double>> counters;
+};
+
+// nearest rank on an already sorted list
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty())
+        return 0.0;
+    size_t rank {static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()))};
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+void addStats(sg_frame_stats& totals, const sg_frame_stats& stats) {
+    totals.num_passes += stats.num_passes;
+    totals.num_apply_pipeline += stats.num_apply_pipeline;
+    totals.num_apply_bindings += stats.num_apply_bindings;
+    totals.num_apply_uniforms += stats.num_apply_uniforms;
+    totals.num_draw += stats.num_draw;
+    totals.num_update_buffer += stats.num_update_buffer;
+    totals.num_update_image += stats.num_update_image;
+    totals.size_apply_uniforms += stats.size_apply_uniforms;
+    totals.size_update_buffer += stats.size_update_buffer;
+    totals.size_update_image += stats.size_update_image;
+}
+
+Result run(Scene& scene, const Options& options) {
+    Result result {.name = scene.name()};
+    sg_swapchain swapchain {
+        .width = options.width,
+        .height = options.height,
+        .sample_count = 1,
+        .color_format = SG_PIXELFORMAT_RGBA8,
+        .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+    };
+    scene.init(options);
+
+    sjd::FrameClock clock {};
+    clock.setFixedStep(FRAME_TIME);
+    if (!options.replay.empty())
+        clock.replay(options.replay);
+    if (!options.record.empty())
+        clock.record(options.record);
+
+    result.frameMs.reserve(options.frames);
+    result.frameAllocations.reserve(options.frames);
+    sjd::Profiler& profiler {sjd::Profiler::instance()};
+    for (int i {0}; i < options.warmup + options.frames; i++) {
+        bool measured {i >= options.warmup};
+        if (measured && !options.trace.empty())
+            profiler.enable();
+        profiler.beginFrame();
+        uint64_t startAllocations {allocations.load(std::memory_order_relaxed)};
+        uint64_t start {stm_now()};
+        clock.tick();
+        View view {scriptedView(clock.time(), options.width, options.height)};
+        scene.frame(view, swapchain);
+        {
+            SJD_PROFILE_SCOPE("sg_commit");
+            sg_commit();
+        }
+        sjd::FrameArena::instance().reset();
+        double ms {stm_ms(stm_since(start))};
+        uint64_t frameAllocations {allocations.load(std::memory_order_relaxed) - startAllocations};
+        profiler.endFrame();
+
+        if (!measured)
+            continue;
+        result.frameMs.push_back(ms);
+        result.frameAllocations.push_back(frameAllocations);
+        // the frame just committed
+        addStats(result.totals, sg_query_frame_stats());
+        std::vector<std::pair<const char*, double>> counters {scene.counters()};
+        if (result.counters.empty())
+            result.counters.assign(counters.size(), {nullptr, 0.0});
+        for (size_t c {0}; c < counters.size(); c++) {
+            result.counters[c].first = counters[c].first;
+            result.counters[c].second += counters[c].second;
+        }
+    }
+
+    scene.cleanup();
+    return result;
+}
+
+void writeJson(std::ostream& out, const Options& options, const std::vector<Result>& results) {
+    out << "{\n"
+        << "  \"frames\": " << options.frames << ",\n"
+        << "  \"warmup\": " << options.warmup << ",\n"
+        << "  \"width\": " << options.width << ",\n"
+        << "  \"height\": " << options.height << ",\n"
+        << "  \"threads\": " << options.threads << ",\n"
+        << "  \"frame_arena_high_water\": " << sjd::FrameArena::instance().highWater() << ",\n"
+        << "  \"scenes\": [";
+    for (size_t r {0}; r < results.size(); r++) {
+        const Result& result {results[r]};
+        std::vector<double> sorted {result.frameMs};
+        std::sort(sorted.begin(), sorted.end());
+        double total {};
+        for (double ms : sorted)
+            total += ms;
+        double frames {static_cast<double>(std::max<size_t>(sorted.size(), 1))};
+        const sg_frame_stats& totals {result.totals};
+        uint64_t allocationTotal {};
+        uint64_t allocationMax {};
+        size_t allocatingFrames {};
+        for (uint64_t count : result.frameAllocations) {
+            allocationTotal += count;
+            allocationMax = std::max(allocationMax, count);
+            allocatingFrames += count > 0 ? 1 : 0;
+        }
+
+        out << (r == 0 ? "\n" : ",\n")
+            << "    {\n"
+            << "      \"name\": \"" << result.name << "\",\n"
+            << "      \"cpu_ms\": {"
+            << "\"mean\": " << total / frames
+            << ", \"p50\": " << percentile(sorted, 50.0)
+            << ", \"p90\": " << percentile(sorted, 90.0)
+            << ", \"p99\": " << percentile(sorted, 99.0)
+            << ", \"max\": " << (sorted.empty() ? 0.0 : sorted.back()) << "},\n"
+            << "      \"allocations\": {"
+            << "\"mean\": " << static_cast<double>(allocationTotal) / frames
+            << ", \"max\": " << allocationMax
+            << ", \"frames\": " << allocatingFrames << "},\n"
+            << "      \"per_frame\": {"
+            << "\"passes\": " << totals.num_passes / frames
+            << ", \"draws\": " << totals.num_draw / frames
+            << ", \"apply_pipeline\": " << totals.num_apply_pipeline / frames
+            << ", \"apply_bindings\": " << totals.num_apply_bindings / frames
+            << ", \"apply_uniforms\": " << totals.num_apply_uniforms / frames
+            << ", \"uniform_bytes\": " << totals.size_apply_uniforms / frames
+            << ", \"update_buffer\": " << totals.num_update_buffer / frames
+            << ", \"update_buffer_bytes\": " << totals.size_update_buffer / frames
+            << ", \"update_image\": " << totals.num_update_image / frames
+            << ", \"update_image_bytes\": " << totals.size_update_image / frames << "},\n"
+            << "      \"counters\": {";
+        for (size_t c {0}; c < result.counters.size(); c++) {
+            out << (c == 0 ? "" : ", ") << "\"" << result.counters[c].first << "\": "
+                << result.counters[c].second / frames;
+        }
+        out << "}\n"
+            << "    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i {1}; i < argc; i++) {
+        std::string arg {argv[i]};
+        bool hasValue {i + 1 < argc};
+        if (arg == "--frames" && hasValue)
+            options.frames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup" && hasValue)
+            options.warmup = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--width" && hasValue)
+            options.width = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--height" && hasValue)
+            options.height = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && hasValue)
+            options.threads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        else if (arg == "--scene" && hasValue)
+            options.scene = argv[++i];
+        else if (arg == "--out" && hasValue)
+            options.out = argv[++i];
+        else if (arg == "--trace" && hasValue)
+            options.trace = argv[++i];
+        else if (arg == "--record" && hasValue)
+            options.record = argv[++i];
+        else if (arg == "--replay" && hasValue)
+            options.replay = argv[++i];
+        else {
+            std::cerr << "Usage: bench [--frames N] [--warmup N] [--width N] [--height N]\n"
+                      << "             [--threads N] [--scene all|clustered|sorted]\n"
+                      << "             [--out results.json] [--trace trace.json]\n"
+                      << "             [--record clock.txt] [--replay clock.txt]\n";
+            return false;
+        }
+    }
+    return true;
+}
+}
+
+int main(int argc, char* argv[]) {
+    bench::Options options {};
+    if (!bench::parseOptions(argc, argv, options))
+        return 1;
+    // quietly falling back to the fixed step would compare the wrong runs
+    if (!options.replay.empty() && !std::ifstream {options.replay}) {
+        std::cerr << "ERROR::BENCH::REPLAY: couldn't read " << options.replay << "\n";
+        return 1;
+    }
+    // every scene would record over the one before it
+    if (!options.record.empty() && options.scene == "all") {
+        std::cerr << "ERROR::BENCH::RECORD: --record needs a single --scene\n";
+        return 1;
+    }
+
+    sg_setup(sg_desc {
+        .logger {
+            .func = slog_func
+        },
+        .environment {
+            .defaults {
+                .color_format = SG_PIXELFORMAT_RGBA8,
+                .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+                .sample_count = 1,
+            },
+        },
+    });
+    sg_enable_frame_stats();
+    stm_setup();
+
+    std::vector<std::unique_ptr<bench::Scene>> scenes;
+    scenes.push_back(std::make_unique<bench::ClusteredScene>());
+    scenes.push_back(std::make_unique<bench::SortedScene>());
+
+    std::vector<bench::Result> results;
+    for (const std::unique_ptr<bench::Scene>& scene : scenes) {
+        if (options.scene != "all" && options.scene != scene->name())
+            continue;
+        std::cerr << "Bench: " << scene->name() << ", " << options.frames << " frames\n";
+        results.push_back(bench::run(*scene, options));
+        const std::vector<uint64_t>& counts {results.back().frameAllocations};
+        size_t allocating {static_cast<size_t>(std::count_if(counts.begin(), counts.end(), [](uint64_t count) {
+            return count > 0;
+        }))};
+        if (allocating > 0)
+            std::cerr << "WARNING::BENCH::ALLOCATIONS: " << scene->name() << " allocated in "
+                      << allocating << " of " << counts.size() << " frames\n";
+    }
+    if (results.empty()) {
+        std::cerr << "ERROR::BENCH::SCENE: no scene called " << options.scene << "\n";
+        sg_shutdown();
+        return 1;
+    }
+
+    if (!options.trace.empty())
+        sjd::Profiler::instance().finish(options.trace);
+
+    if (options.out.empty()) {
+        bench::writeJson(std::cout, options, results);
+    }
+    else {
+        std::ofstream file {options.out};
+        if (!file) {
+            std::cerr << "ERROR::BENCH::OUT: couldn't write " << options.out << "\n";
+            sg_shutdown();
+            return 1;
+        }
+        bench::writeJson(file, options, results);
+        std::cerr << "Bench: wrote " << options.out << "\n";
+    }
+
+    sg_shutdown();
+    return 0;
+}
+
+// the counting allocator. Only new and delete have to be replaced, the
+// array and nothrow versions call these.
+void* operator new(size_t size) {
+    bench::allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size > 0 ? size : 1))
+        return memory;
+    throw std::bad_alloc {};
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    bench::allocations.fetch_add(1, std::memory_order_relaxed);
+    size_t align {static_cast<size_t>(alignment)};
+#ifdef _WIN32
+    void* memory {_aligned_malloc(size > 0 ? size : 1, align)};
+#else
+    // aligned_alloc wants the size to be a multiple of the alignment
+    void* memory {std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align)};
+#endif
+    if (memory)
+        return memory;
+    throw std::bad_alloc {};
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept {
+    operator delete(memory, std::align_val_t {});
+}
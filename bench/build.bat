@@ -0,0 +1,10 @@
+@echo off
+
+:: builds the headless benchmarks into build\bench.exe, optimised since the
+:: numbers are what it's for. No window or GL context is needed to run it.
+SET CODEDIR="%cd%"
+mkdir ..\build
+pushd ..\build
+cl %CODEDIR%/bench.cpp -I%HOME%/OpenGL/include /I../include -std:c++20 -EHsc -O2 /Fe:bench.exe
+cl %CODEDIR%/softrender.cpp -I%HOME%/OpenGL/include /I../include -std:c++20 -EHsc -O2 /Fe:softrender.exe
+popd
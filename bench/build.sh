@@ -0,0 +1,9 @@
+#!/bin/sh
+# builds the headless benchmarks into build/bench for the Linux CI hosts,
+# the dummy backend needs no GL or X11 libraries. softrender draws the demos
+# on the CPU, for thumbnails and image checks on hosts without a GPU
+CODEDIR="$(cd "$(dirname "$0")" && pwd)"
+mkdir -p "$CODEDIR/../build"
+cd "$CODEDIR/../build" || exit 1
+${CXX:-c++} "$CODEDIR/bench.cpp" -I"$HOME/OpenGL/include" -I../include -std=c++20 -O2 -pthread -o bench
+${CXX:-c++} "$CODEDIR/softrender.cpp" -I"$HOME/OpenGL/include" -I../include -std=c++20 -O2 -pthread -o softrender
@@ -0,0 +1,691 @@
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sjd/depth_sorter.h>
+#include <sjd/jobs.h>
+#include <sjd/softraster.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb/stb_image.h>
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+/* Software renders of the demos
+ * Draws some of the LearnOpenGL scenes with sjd::SoftRaster instead of
+ * sokol, so it needs no GPU, GL or window and runs on the CI hosts. Each
+ * scene is the demo's draws and pipeline state translated one to one, seen
+ * from the demo's starting camera:
+ *
+ *   softrender --out thumbs             (thumbs/<scene>.png at 800x600)
+ *   softrender --check                  (fast path against the reference)
+ *   softrender --scene lights --frames 300 --threads 1
+ *
+ * After the still it times --frames frames with the camera circling the
+ * scene and prints the mean and worst frame. --check renders the still a
+ * second time on the reference path and fails if any pixel is more than
+ * --tolerance apart, which is what CI runs after touching softraster.h.
+ * The PNGs are written uncompressed, run them through an optimiser before
+ * committing any to webdata/. Textures come from --data, ../data by
+ * default like the demos.
+ */
+
+namespace softrender {
+constexpr float Z_NEAR {0.1f};
+constexpr float Z_FAR {100.0f};
+
+using Raster = sjd::SoftRaster;
+using Vertex = sjd::SoftRaster::Vertex;
+
+struct Options {
+    int frames {120};
+    int width {800};
+    int height {600};
+    // the tiles are split into this many pieces on the JobSystem, at most
+    // one per thread it has
+    unsigned threads {sjd::JobSystem::instance().threadCount()};
+    int tolerance {0};
+    bool check {false};
+    std::string scene {"all"};
+    std::string data {"../data"};
+    std::string out {};
+};
+
+// the cube from the lighting demos, the 4-x demos have the same one without normals
+const std::vector<Vertex> CUBE {
+    // positions                       // normals                         // texture coords
+    {{-0.5f, -0.5f, -0.5f}, { 0.0f,  0.0f, -1.0f}, {0.0f, 0.0f}},
+    {{ 0.5f, -0.5f, -0.5f}, { 0.0f,  0.0f, -1.0f}, {1.0f, 0.0f}},
+    {{ 0.5f,  0.5f, -0.5f}, { 0.0f,  0.0f, -1.0f}, {1.0f, 1.0f}},
+    {{ 0.5f,  0.5f, -0.5f}, { 0.0f,  0.0f, -1.0f}, {1.0f, 1.0f}},
+    {{-0.5f,  0.5f, -0.5f}, { 0.0f,  0.0f, -1.0f}, {0.0f, 1.0f}},
+    {{-0.5f, -0.5f, -0.5f}, { 0.0f,  0.0f, -1.0f}, {0.0f, 0.0f}},
+
+    {{-0.5f, -0.5f,  0.5f}, { 0.0f,  0.0f,  1.0f}, {0.0f, 0.0f}},
+    {{ 0.5f, -0.5f,  0.5f}, { 0.0f,  0.0f,  1.0f}, {1.0f, 0.0f}},
+    {{ 0.5f,  0.5f,  0.5f}, { 0.0f,  0.0f,  1.0f}, {1.0f, 1.0f}},
+    {{ 0.5f,  0.5f,  0.5f}, { 0.0f,  0.0f,  1.0f}, {1.0f, 1.0f}},
+    {{-0.5f,  0.5f,  0.5f}, { 0.0f,  0.0f,  1.0f}, {0.0f, 1.0f}},
+    {{-0.5f, -0.5f,  0.5f}, { 0.0f,  0.0f,  1.0f}, {0.0f, 0.0f}},
+
+    {{-0.5f,  0.5f,  0.5f}, {-1.0f,  0.0f,  0.0f}, {1.0f, 0.0f}},
+    {{-0.5f,  0.5f, -0.5f}, {-1.0f,  0.0f,  0.0f}, {1.0f, 1.0f}},
+    {{-0.5f, -0.5f, -0.5f}, {-1.0f,  0.0f,  0.0f}, {0.0f, 1.0f}},
+    {{-0.5f, -0.5f, -0.5f}, {-1.0f,  0.0f,  0.0f}, {0.0f, 1.0f}},
+    {{-0.5f, -0.5f,  0.5f}, {-1.0f,  0.0f,  0.0f}, {0.0f, 0.0f}},
+    {{-0.5f,  0.5f,  0.5f}, {-1.0f,  0.0f,  0.0f}, {1.0f, 0.0f}},
+
+    {{ 0.5f,  0.5f,  0.5f}, { 1.0f,  0.0f,  0.0f}, {1.0f, 0.0f}},
+    {{ 0.5f,  0.5f, -0.5f}, { 1.0f,  0.0f,  0.0f}, {1.0f, 1.0f}},
+    {{ 0.5f, -0.5f, -0.5f}, { 1.0f,  0.0f,  0.0f}, {0.0f, 1.0f}},
+    {{ 0.5f, -0.5f, -0.5f}, { 1.0f,  0.0f,  0.0f}, {0.0f, 1.0f}},
+    {{ 0.5f, -0.5f,  0.5f}, { 1.0f,  0.0f,  0.0f}, {0.0f, 0.0f}},
+    {{ 0.5f,  0.5f,  0.5f}, { 1.0f,  0.0f,  0.0f}, {1.0f, 0.0f}},
+
+    {{-0.5f, -0.5f, -0.5f}, { 0.0f, -1.0f,  0.0f}, {0.0f, 1.0f}},
+    {{ 0.5f, -0.5f, -0.5f}, { 0.0f, -1.0f,  0.0f}, {1.0f, 1.0f}},
+    {{ 0.5f, -0.5f,  0.5f}, { 0.0f, -1.0f,  0.0f}, {1.0f, 0.0f}},
+    {{ 0.5f, -0.5f,  0.5f}, { 0.0f, -1.0f,  0.0f}, {1.0f, 0.0f}},
+    {{-0.5f, -0.5f,  0.5f}, { 0.0f, -1.0f,  0.0f}, {0.0f, 0.0f}},
+    {{-0.5f, -0.5f, -0.5f}, { 0.0f, -1.0f,  0.0f}, {0.0f, 1.0f}},
+
+    {{-0.5f,  0.5f, -0.5f}, { 0.0f,  1.0f,  0.0f}, {0.0f, 1.0f}},
+    {{ 0.5f,  0.5f, -0.5f}, { 0.0f,  1.0f,  0.0f}, {1.0f, 1.0f}},
+    {{ 0.5f,  0.5f,  0.5f}, { 0.0f,  1.0f,  0.0f}, {1.0f, 0.0f}},
+    {{ 0.5f,  0.5f,  0.5f}, { 0.0f,  1.0f,  0.0f}, {1.0f, 0.0f}},
+    {{-0.5f,  0.5f,  0.5f}, { 0.0f,  1.0f,  0.0f}, {0.0f, 0.0f}},
+    {{-0.5f,  0.5f, -0.5f}, { 0.0f,  1.0f,  0.0f}, {0.0f, 1.0f}},
+};
+
+const std::vector<Vertex> PLANE {
+    {{ 5.0f, -0.5f,  5.0f}, {0.0f, 1.0f, 0.0f}, {2.0f, 0.0f}},
+    {{-5.0f, -0.5f,  5.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f}},
+    {{-5.0f, -0.5f, -5.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 2.0f}},
+
+    {{ 5.0f, -0.5f,  5.0f}, {0.0f, 1.0f, 0.0f}, {2.0f, 0.0f}},
+    {{-5.0f, -0.5f, -5.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 2.0f}},
+    {{ 5.0f, -0.5f, -5.0f}, {0.0f, 1.0f, 0.0f}, {2.0f, 2.0f}},
+};
+
+// the grass and the windows
+const std::vector<Vertex> QUAD {
+    {{-0.5f, -0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}},
+    {{ 0.5f, -0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}},
+    {{ 0.5f,  0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 1.0f}},
+    {{ 0.5f,  0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 1.0f}},
+    {{-0.5f,  0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f}},
+    {{-0.5f, -0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}},
+};
+
+// where the 4-3 demos put the grass and the windows
+const std::vector<glm::vec3> QUAD_POSITIONS {
+    glm::vec3(-1.5f, 0.0f, -0.48f),
+    glm::vec3( 1.5f, 0.0f,  0.51f),
+    glm::vec3( 0.0f, 0.0f,  0.7f),
+    glm::vec3(-0.3f, 0.0f, -2.3f),
+    glm::vec3( 0.5f, 0.0f, -0.6f),
+};
+
+struct View {
+    glm::vec3 position;
+    glm::mat4 viewProjection;
+};
+
+// the demo's starting camera at time 0, then circling what it looks at
+View orbitView(const glm::vec3& start, const glm::vec3& focus, float time, float aspect) {
+    float angle {time * 0.3f};
+    glm::vec3 offset {start - focus};
+    glm::vec3 position {focus + glm::vec3(offset.x * std::cos(angle) - offset.z * std::sin(angle),
+                                          offset.y,
+                                          offset.x * std::sin(angle) + offset.z * std::cos(angle))};
+    glm::mat4 view {glm::lookAt(position, focus, glm::vec3(0.0f, 1.0f, 0.0f))};
+    glm::mat4 projection {glm::perspective(glm::radians(45.0f), aspect, Z_NEAR, Z_FAR)};
+    return View {position, projection * view};
+}
+
+// flipped like the demos' SokTextures
+bool loadTexture(const std::string& path, sjd::SoftTexture& texture,
+                 sjd::SoftTexture::Wrap wrap = sjd::SoftTexture::Wrap::REPEAT) {
+    stbi_set_flip_vertically_on_load(true);
+    int width {}, height {}, channels {};
+    stbi_uc* pixels {stbi_load(path.c_str(), &width, &height, &channels, 4)};
+    if (pixels == nullptr) {
+        std::cerr << "ERROR::SOFTRENDER::TEXTURE: couldn't load " << path << "\n";
+        return false;
+    }
+    texture = sjd::SoftTexture(width, height, pixels, wrap);
+    stbi_image_free(pixels);
+    return true;
+}
+
+class Scene {
+public:
+    virtual ~Scene() = default;
+    virtual const char* name() const = 0;
+    virtual bool init(const Options& options) = 0;
+    virtual void frame(Raster& raster, float time) = 0;
+};
+
+// demos/4-2-stencil-testing/1-stencil-testing
+class StencilScene : public Scene {
+public:
+    const char* name() const override {
+        return "stencil";
+    }
+
+    bool init(const Options& options) override;
+    void frame(Raster& raster, float time) override;
+
+private:
+    Raster::Pipeline m_plane;
+    Raster::Pipeline m_cubes;
+    Raster::Pipeline m_outlines;
+    sjd::SoftTexture m_marble;
+    sjd::SoftTexture m_metal;
+};
+
+bool StencilScene::init(const Options& options) {
+    m_plane = Raster::Pipeline {
+        .shader = Raster::Shader::TEXTURE,
+        .depthCompare = Raster::Compare::LESS,
+        .depthWrite = true,
+    };
+    // glStencilFunc(GL_ALWAYS, 1, 0xFF), glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE)
+    m_cubes = m_plane;
+    m_cubes.stencilEnabled = true;
+    m_cubes.stencilPass = Raster::StencilOp::REPLACE;
+    m_cubes.stencilReadMask = 0xFF;
+    m_cubes.stencilWriteMask = 0xFF;
+    m_cubes.stencilRef = 1;
+    // only outside the cubes, glStencilFunc(GL_NOTEQUAL, 1, 0xFF), glStencilMask(0x00)
+    m_outlines = Raster::Pipeline {
+        .shader = Raster::Shader::COLOUR,
+        .stencilEnabled = true,
+        .stencilCompare = Raster::Compare::NOT_EQUAL,
+        .stencilPass = Raster::StencilOp::REPLACE,
+        .stencilReadMask = 0xFF,
+        .stencilWriteMask = 0x00,
+        .stencilRef = 1,
+    };
+    return loadTexture(options.data + "/marble.jpg", m_marble)
+        && loadTexture(options.data + "/metal.png", m_metal);
+}
+
+void StencilScene::frame(Raster& raster, float time) {
+    View view {orbitView(glm::vec3(3.0f, 0.8f, 4.0f), glm::vec3(1.0f, 0.4f, 0.0f), time,
+                         static_cast<float>(raster.width()) / raster.height())};
+    raster.begin(glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+    raster.setViewProjection(view.viewProjection);
+
+    raster.draw(Raster::Draw {.pipeline = &m_plane, .vertices = PLANE.data(), .count = PLANE.size(), .texture = &m_metal});
+    glm::vec3 cubes[2] {glm::vec3(-1.0f, 0.0f, -1.0f), glm::vec3(2.0f, 0.0f, 0.0f)};
+    for (const glm::vec3& position : cubes) {
+        raster.draw(Raster::Draw {
+            .pipeline = &m_cubes,
+            .vertices = CUBE.data(),
+            .count = CUBE.size(),
+            .model = glm::translate(glm::mat4(1.0f), position),
+            .texture = &m_marble,
+        });
+    }
+    for (const glm::vec3& position : cubes) {
+        raster.draw(Raster::Draw {
+            .pipeline = &m_outlines,
+            .vertices = CUBE.data(),
+            .count = CUBE.size(),
+            .model = glm::scale(glm::translate(glm::mat4(1.0f), position), glm::vec3(1.2f)),
+            .colour = glm::vec4(0.04f, 0.28f, 0.26f, 1.0f),
+        });
+    }
+}
+
+// demos/4-3-blending/1-discarding
+class DiscardingScene : public Scene {
+public:
+    const char* name() const override {
+        return "discarding";
+    }
+
+    bool init(const Options& options) override;
+    void frame(Raster& raster, float time) override;
+
+private:
+    Raster::Pipeline m_opaque;
+    sjd::SoftTexture m_marble;
+    sjd::SoftTexture m_metal;
+    sjd::SoftTexture m_grass;
+};
+
+bool DiscardingScene::init(const Options& options) {
+    m_opaque = Raster::Pipeline {
+        .shader = Raster::Shader::TEXTURE,
+        .depthCompare = Raster::Compare::LESS,
+        .depthWrite = true,
+    };
+    // the grass sampler clamps so the tops of the blades don't pick up the roots
+    return loadTexture(options.data + "/marble.jpg", m_marble)
+        && loadTexture(options.data + "/metal.png", m_metal)
+        && loadTexture(options.data + "/grass.png", m_grass, sjd::SoftTexture::Wrap::CLAMP_TO_EDGE);
+}
+
+void DiscardingScene::frame(Raster& raster, float time) {
+    View view {orbitView(glm::vec3(3.0f, 0.8f, 4.0f), glm::vec3(1.0f, 0.4f, 0.0f), time,
+                         static_cast<float>(raster.width()) / raster.height())};
+    raster.begin(glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+    raster.setViewProjection(view.viewProjection);
+
+    for (const glm::vec3& position : {glm::vec3(-1.0f, 0.0f, -1.0f), glm::vec3(2.0f, 0.0f, 0.0f)}) {
+        raster.draw(Raster::Draw {
+            .pipeline = &m_opaque,
+            .vertices = CUBE.data(),
+            .count = CUBE.size(),
+            .model = glm::translate(glm::mat4(1.0f), position),
+            .texture = &m_marble,
+        });
+    }
+    raster.draw(Raster::Draw {.pipeline = &m_opaque, .vertices = PLANE.data(), .count = PLANE.size(), .texture = &m_metal});
+    for (const glm::vec3& position : QUAD_POSITIONS) {
+        raster.draw(Raster::Draw {
+            .pipeline = &m_opaque,
+            .vertices = QUAD.data(),
+            .count = QUAD.size(),
+            .model = glm::translate(glm::mat4(1.0f), position),
+            .texture = &m_grass,
+            .alphaCutoff = 0.1f,
+        });
+    }
+}
+
+// demos/4-3-blending/2-blending
+class BlendingScene : public Scene {
+public:
+    const char* name() const override {
+        return "blending";
+    }
+
+    bool init(const Options& options) override;
+    void frame(Raster& raster, float time) override;
+
+private:
+    Raster::Pipeline m_opaque;
+    Raster::Pipeline m_windows;
+    sjd::SoftTexture m_marble;
+    sjd::SoftTexture m_metal;
+    sjd::SoftTexture m_window;
+    sjd::DepthSorter m_sorter;
+};
+
+bool BlendingScene::init(const Options& options) {
+    m_opaque = Raster::Pipeline {
+        .shader = Raster::Shader::TEXTURE,
+        .depthCompare = Raster::Compare::LESS,
+        .depthWrite = true,
+    };
+    m_windows = m_opaque;
+    m_windows.blend = Raster::Blend::ALPHA;
+    return loadTexture(options.data + "/marble.jpg", m_marble)
+        && loadTexture(options.data + "/metal.png", m_metal)
+        && loadTexture(options.data + "/blending_transparent_window.png", m_window);
+}
+
+void BlendingScene::frame(Raster& raster, float time) {
+    View view {orbitView(glm::vec3(3.0f, 0.8f, 4.0f), glm::vec3(1.0f, 0.4f, 0.0f), time,
+                         static_cast<float>(raster.width()) / raster.height())};
+    raster.begin(glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+    raster.setViewProjection(view.viewProjection);
+
+    raster.draw(Raster::Draw {.pipeline = &m_opaque, .vertices = PLANE.data(), .count = PLANE.size(), .texture = &m_metal});
+    for (const glm::vec3& position : {glm::vec3(-1.0f, 0.0f, -1.0f), glm::vec3(2.0f, 0.0f, 0.0f)}) {
+        raster.draw(Raster::Draw {
+            .pipeline = &m_opaque,
+            .vertices = CUBE.data(),
+            .count = CUBE.size(),
+            .model = glm::translate(glm::mat4(1.0f), position),
+            .texture = &m_marble,
+        });
+    }
+
+    // back to front, as the demo sorts them
+    m_sorter.clear();
+    for (size_t i {0}; i < QUAD_POSITIONS.size(); i++) {
+        glm::vec3 offset {view.position - QUAD_POSITIONS[i]};
+        m_sorter.add(glm::dot(offset, offset), static_cast<uint32_t>(i));
+    }
+    for (const sjd::SortItem32& sorted : m_sorter.sortBackToFront()) {
+        raster.draw(Raster::Draw {
+            .pipeline = &m_windows,
+            .vertices = QUAD.data(),
+            .count = QUAD.size(),
+            .model = glm::translate(glm::mat4(1.0f), QUAD_POSITIONS[sorted.index]),
+            .texture = &m_window,
+        });
+    }
+}
+
+// demos/2-6-multiple-lights/1-multiple-lights, with the flashlight on
+class LightsScene : public Scene {
+public:
+    const char* name() const override {
+        return "lights";
+    }
+
+    bool init(const Options& options) override;
+    void frame(Raster& raster, float time) override;
+
+private:
+    Raster::Pipeline m_cubes;
+    Raster::Pipeline m_lightCubes;
+    sjd::SoftTexture m_diffuse;
+    sjd::SoftTexture m_specular;
+    std::vector<glm::mat4> m_models;
+    Raster::Lighting m_lighting;
+};
+
+bool LightsScene::init(const Options& options) {
+    m_cubes = Raster::Pipeline {
+        .shader = Raster::Shader::LIT,
+        .depthCompare = Raster::Compare::LESS,
+        .depthWrite = true,
+    };
+    m_lightCubes = Raster::Pipeline {
+        .shader = Raster::Shader::COLOUR,
+        .depthCompare = Raster::Compare::LESS_EQUAL,
+        .depthWrite = true,
+    };
+
+    const glm::vec3 positions[] {
+        glm::vec3( 0.0f,  0.0f,  0.0f),
+        glm::vec3( 2.0f,  5.0f, -15.0f),
+        glm::vec3(-1.5f, -2.2f, -2.5f),
+        glm::vec3(-3.8f, -2.0f, -12.3f),
+        glm::vec3( 2.4f, -0.4f, -3.5f),
+        glm::vec3(-1.7f,  3.0f, -7.5f),
+        glm::vec3( 1.3f, -2.0f, -2.5f),
+        glm::vec3( 1.5f,  2.0f, -2.5f),
+        glm::vec3( 1.5f,  0.2f, -1.5f),
+        glm::vec3(-1.3f,  1.0f, -1.5f),
+    };
+    for (size_t i {0}; i < std::size(positions); i++) {
+        // the demo's angle, which glm takes as radians
+        glm::mat4 model {glm::translate(glm::mat4(1.0f), positions[i])};
+        m_models.push_back(glm::rotate(model, 20.0f * i, glm::vec3(1.0f, 0.3f, 0.5f)));
+    }
+
+    glm::vec3 dirLight {0.2f};
+    m_lighting.directional = Raster::DirectionalLight {
+        .direction = glm::vec3(-0.2f, -1.0f, -0.3f),
+        .ambient = dirLight * 0.2f,
+        .diffuse = dirLight * 0.5f,
+        .specular = dirLight,
+    };
+    const glm::vec3 lightPositions[] {
+        glm::vec3( 0.7f,  0.2f,  2.0f),
+        glm::vec3( 2.3f, -3.3f, -4.0f),
+        glm::vec3(-4.0f,  2.0f, -12.0f),
+        glm::vec3( 0.0f,  0.0f, -3.0f),
+    };
+    const glm::vec3 lightColours[] {
+        glm::vec3(1.0f, 1.0f, 1.0f),
+        glm::vec3(1.0f, 0.1f, 0.1f),
+        glm::vec3(0.8f, 0.5f, 0.1f),
+        glm::vec3(0.9f, 0.9f, 0.1f),
+    };
+    for (size_t i {0}; i < std::size(lightPositions); i++) {
+        m_lighting.points.push_back(Raster::PointLight {
+            .position = lightPositions[i],
+            .ambient = lightColours[i] * 0.2f,
+            .diffuse = lightColours[i] * 0.5f,
+            .specular = lightColours[i],
+        });
+    }
+    m_lighting.spot = Raster::SpotLight {
+        .enabled = true,
+        .cutOff = std::cos(glm::radians(12.5f)),
+        .outerCutOff = std::cos(glm::radians(17.5f)),
+        .diffuse = glm::vec3(0.5f),
+        .specular = glm::vec3(1.0f),
+    };
+
+    return loadTexture(options.data + "/container2.png", m_diffuse)
+        && loadTexture(options.data + "/container2_specular.png", m_specular);
+}
+
+void LightsScene::frame(Raster& raster, float time) {
+    glm::vec3 focus {0.0f};
+    View view {orbitView(glm::vec3(0.2f, 0.8f, 4.0f), focus, time,
+                         static_cast<float>(raster.width()) / raster.height())};
+    raster.begin(glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+    raster.setViewProjection(view.viewProjection);
+
+    // the flashlight follows the camera
+    m_lighting.viewPos = view.position;
+    m_lighting.spot.position = view.position;
+    m_lighting.spot.direction = glm::normalize(focus - view.position);
+    raster.setLighting(m_lighting);
+
+    for (const glm::mat4& model : m_models) {
+        raster.draw(Raster::Draw {
+            .pipeline = &m_cubes,
+            .vertices = CUBE.data(),
+            .count = CUBE.size(),
+            .model = model,
+            .texture = &m_diffuse,
+            .texture2 = &m_specular,
+        });
+    }
+    for (const Raster::PointLight& light : m_lighting.points) {
+        raster.draw(Raster::Draw {
+            .pipeline = &m_lightCubes,
+            .vertices = CUBE.data(),
+            .count = CUBE.size(),
+            .model = glm::scale(glm::translate(glm::mat4(1.0f), light.position), glm::vec3(0.2f)),
+            .colour = glm::vec4(light.specular, 1.0f),
+        });
+    }
+}
+
+// an uncompressed PNG: zlib stored blocks, so there's no deflate to carry around
+bool writePng(const std::string& path, const Raster& raster) {
+    static uint32_t crcTable[256] {};
+    if (crcTable[1] == 0) {
+        for (uint32_t n {0}; n < 256; n++) {
+            uint32_t c {n};
+            for (int k {0}; k < 8; k++)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            crcTable[n] = c;
+        }
+    }
+
+    std::ofstream file {path, std::ios::binary};
+    if (!file)
+        return false;
+    auto put32 = [](std::vector<uint8_t>& bytes, uint32_t value) {
+        for (int shift {24}; shift >= 0; shift -= 8)
+            bytes.push_back(static_cast<uint8_t>(value >> shift));
+    };
+    auto chunk = [&](const char* type, const std::vector<uint8_t>& body) {
+        std::vector<uint8_t> bytes;
+        put32(bytes, static_cast<uint32_t>(body.size()));
+        bytes.insert(bytes.end(), type, type + 4);
+        bytes.insert(bytes.end(), body.begin(), body.end());
+        uint32_t crc {0xFFFFFFFFu};
+        for (size_t i {4}; i < bytes.size(); i++)
+            crc = crcTable[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+        put32(bytes, crc ^ 0xFFFFFFFFu);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    };
+
+    const uint8_t signature[8] {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    file.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+    std::vector<uint8_t> header;
+    put32(header, static_cast<uint32_t>(raster.width()));
+    put32(header, static_cast<uint32_t>(raster.height()));
+    // 8 bit RGBA, deflate, no interlacing
+    header.insert(header.end(), {8, 6, 0, 0, 0});
+    chunk("IHDR", header);
+
+    // every row starts with filter type 0
+    std::vector<uint8_t> raw;
+    raw.reserve(static_cast<size_t>(raster.width() * 4 + 1) * raster.height());
+    for (int y {0}; y < raster.height(); y++) {
+        raw.push_back(0);
+        const uint32_t* row {raster.colour() + static_cast<size_t>(y) * raster.stride()};
+        for (int x {0}; x < raster.width(); x++) {
+            for (int channel {0}; channel < 4; channel++)
+                raw.push_back(static_cast<uint8_t>(row[x] >> (channel * 8)));
+        }
+    }
+
+    std::vector<uint8_t> zlib {0x78, 0x01};
+    for (size_t offset {0}; offset < raw.size(); offset += 65535) {
+        size_t size {std::min<size_t>(65535, raw.size() - offset)};
+        bool last {offset + size == raw.size()};
+        zlib.push_back(last ? 1 : 0);
+        zlib.push_back(static_cast<uint8_t>(size));
+        zlib.push_back(static_cast<uint8_t>(size >> 8));
+        zlib.push_back(static_cast<uint8_t>(~size));
+        zlib.push_back(static_cast<uint8_t>(~size >> 8));
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + size);
+    }
+    uint32_t a {1}, b {0};
+    for (uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32(zlib, (b << 16) | a);
+    chunk("IDAT", zlib);
+    chunk("IEND", {});
+    return static_cast<bool>(file);
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i {1}; i < argc; i++) {
+        std::string arg {argv[i]};
+        bool hasValue {i + 1 < argc};
+        if (arg == "--frames" && hasValue)
+            options.frames = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--width" && hasValue)
+            options.width = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--height" && hasValue)
+            options.height = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && hasValue)
+            options.threads = std::min(static_cast<unsigned>(std::max(1, std::atoi(argv[++i]))),
+                                       sjd::JobSystem::instance().threadCount());
+        else if (arg == "--tolerance" && hasValue)
+            options.tolerance = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--check")
+            options.check = true;
+        else if (arg == "--scene" && hasValue)
+            options.scene = argv[++i];
+        else if (arg == "--data" && hasValue)
+            options.data = argv[++i];
+        else if (arg == "--out" && hasValue)
+            options.out = argv[++i];
+        else {
+            std::cerr << "Usage: softrender [--frames N] [--width N] [--height N] [--threads N]\n"
+                      << "                  [--scene all|stencil|discarding|blending|lights]\n"
+                      << "                  [--check] [--tolerance N] [--data dir] [--out dir]\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// the still, compared and saved, then the timed frames. false if anything failed
+bool run(Scene& scene, const Options& options) {
+    bool ok {true};
+    Raster raster;
+    raster.resize(options.width, options.height);
+    scene.frame(raster, 0.0f);
+    raster.end(options.threads);
+
+    if (options.check) {
+        Raster reference;
+        reference.resize(options.width, options.height);
+        reference.setReference(true);
+        scene.frame(reference, 0.0f);
+        reference.end();
+        Raster::Difference difference {Raster::compare(raster, reference, options.tolerance)};
+        if (difference.pixels > 0) {
+            std::cerr << "ERROR::SOFTRENDER::CHECK: " << scene.name() << " differs from the reference in "
+                      << difference.pixels << " pixels, by up to " << difference.maxError << "\n";
+            ok = false;
+        }
+        else {
+            std::cerr << "Softrender: " << scene.name() << " matches the reference (largest difference "
+                      << difference.maxError << ")\n";
+        }
+    }
+
+    if (!options.out.empty()) {
+        std::string path {options.out + "/" + scene.name() + ".png"};
+        if (writePng(path, raster)) {
+            std::cerr << "Softrender: wrote " << path << "\n";
+        }
+        else {
+            std::cerr << "ERROR::SOFTRENDER::OUT: couldn't write " << path << "\n";
+            ok = false;
+        }
+    }
+
+    if (options.frames == 0)
+        return ok;
+    double total {};
+    double worst {};
+    for (int i {0}; i < options.frames; i++) {
+        auto start {std::chrono::steady_clock::now()};
+        scene.frame(raster, static_cast<float>(i) / 60.0f);
+        raster.end(options.threads);
+        double ms {std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()};
+        total += ms;
+        worst = std::max(worst, ms);
+    }
+    double mean {total / options.frames};
+    std::cerr << "Softrender: " << scene.name() << " " << options.width << "x" << options.height << ", "
+              << options.threads << " threads, " << mean << " ms mean (" << 1000.0 / mean << " fps), "
+              << worst << " ms max, " << raster.triangleCount() << " triangles\n";
+    return ok;
+}
+}
+
+int main(int argc, char* argv[]) {
+    softrender::Options options {};
+    if (!softrender::parseOptions(argc, argv, options))
+        return 1;
+
+    std::vector<std::unique_ptr<softrender::Scene>> scenes;
+    scenes.push_back(std::make_unique<softrender::StencilScene>());
+    scenes.push_back(std::make_unique<softrender::DiscardingScene>());
+    scenes.push_back(std::make_unique<softrender::BlendingScene>());
+    scenes.push_back(std::make_unique<softrender::LightsScene>());
+
+    bool ok {true};
+    bool found {false};
+    for (const std::unique_ptr<softrender::Scene>& scene : scenes) {
+        if (options.scene != "all" && options.scene != scene->name())
+            continue;
+        found = true;
+        if (!scene->init(options)) {
+            ok = false;
+            continue;
+        }
+        ok = softrender::run(*scene, options) && ok;
+    }
+    if (!found) {
+        std::cerr << "ERROR::SOFTRENDER::SCENE: no scene called " << options.scene << "\n";
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
@@ -66,6 +66,7 @@ SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
     glm::mat4 model;
     glm::mat4 view;
     glm::mat4 projection;
+    glm::mat4 normalMatrix;
 } vs_params_t;
 #pragma pack(pop)
 #pragma pack(push,1)
@@ -113,7 +114,7 @@ SOKOL_SHDC_ALIGN(16) typedef struct light_sphere_fs_params_t {
 /*
     #version 430
 
-    uniform vec4 vs_params[12];
+    uniform vec4 vs_params[16];
     layout(location = 0) in vec3 aPos;
     layout(location = 0) out vec3 FragPos;
     layout(location = 1) out vec3 Normal;
@@ -126,16 +127,16 @@ SOKOL_SHDC_ALIGN(16) typedef struct light_sphere_fs_params_t {
         vec4 _39 = vec4(aPos, 1.0);
         gl_Position = ((mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7])) * _29) * _39;
         FragPos = vec3((_29 * _39).xyz);
-        mat4 _61 = transpose(inverse(_29));
+        mat4 _61 = mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15]);
         Normal = mat3(_61[0].xyz, _61[1].xyz, _61[2].xyz) * aNormal;
         color = _39;
     }
 
 */
-static const uint8_t vs_source_glsl430[677] = {
+static const uint8_t vs_source_glsl430[718] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
     0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
     0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,
     0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
@@ -168,14 +169,16 @@ static const uint8_t vs_source_glsl430[677] = {
     0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x20,0x3d,0x20,
     0x76,0x65,0x63,0x33,0x28,0x28,0x5f,0x32,0x39,0x20,0x2a,0x20,0x5f,0x33,0x39,0x29,
     0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,
-    0x5f,0x36,0x31,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,
-    0x69,0x6e,0x76,0x65,0x72,0x73,0x65,0x28,0x5f,0x32,0x39,0x29,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,
-    0x28,0x5f,0x36,0x31,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,
-    0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,0x5b,0x32,0x5d,0x2e,
-    0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x5f,0x33,0x39,0x3b,
-    0x0a,0x7d,0x0a,0x0a,0x00,
+    0x5f,0x36,0x31,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x31,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x35,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x5f,0x36,0x31,0x5b,0x30,0x5d,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x5f,0x36,0x31,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,
+    0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x5f,0x33,0x39,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 430
@@ -253,7 +256,7 @@ static const uint8_t fs_source_glsl430[805] = {
 /*
     #version 430
 
-    uniform vec4 vs_params[12];
+    uniform vec4 vs_params[16];
     layout(location = 0) in vec3 aPos;
 
     void main()
@@ -265,7 +268,7 @@ static const uint8_t fs_source_glsl430[805] = {
 static const uint8_t light_sphere_vs_source_glsl430[326] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
     0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
     0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x0a,0x76,0x6f,
     0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
@@ -313,7 +316,7 @@ static const uint8_t light_sphere_fs_source_glsl430[172] = {
 /*
     #version 300 es
 
-    uniform vec4 vs_params[12];
+    uniform vec4 vs_params[16];
     layout(location = 0) in vec3 aPos;
     out vec3 FragPos;
     out vec3 Normal;
@@ -326,16 +329,16 @@ static const uint8_t light_sphere_fs_source_glsl430[172] = {
         vec4 _39 = vec4(aPos, 1.0);
         gl_Position = ((mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7])) * _29) * _39;
         FragPos = vec3((_29 * _39).xyz);
-        mat4 _61 = transpose(inverse(_29));
+        mat4 _61 = mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15]);
         Normal = mat3(_61[0].xyz, _61[1].xyz, _61[2].xyz) * aNormal;
         color = _39;
     }
 
 */
-static const uint8_t vs_source_glsl300es[617] = {
+static const uint8_t vs_source_glsl300es[658] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
-    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
     0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
     0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
     0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,
@@ -364,14 +367,17 @@ static const uint8_t vs_source_glsl300es[617] = {
     0x20,0x5f,0x33,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,
     0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x28,0x5f,0x32,0x39,0x20,0x2a,0x20,
     0x5f,0x33,0x39,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,
-    0x61,0x74,0x34,0x20,0x5f,0x36,0x31,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,
-    0x6f,0x73,0x65,0x28,0x69,0x6e,0x76,0x65,0x72,0x73,0x65,0x28,0x5f,0x32,0x39,0x29,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,
-    0x6d,0x61,0x74,0x33,0x28,0x5f,0x36,0x31,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,
-    0x20,0x5f,0x36,0x31,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,
-    0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
-    0x5f,0x33,0x39,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x61,0x74,0x34,0x20,0x5f,0x36,0x31,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x35,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x5f,0x36,
+    0x31,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,0x5b,0x31,0x5d,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,
+    0x29,0x20,0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x5f,0x33,0x39,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
 };
 /*
     #version 300 es
@@ -454,7 +460,7 @@ static const uint8_t fs_source_glsl300es[854] = {
 /*
     #version 300 es
 
-    uniform vec4 vs_params[12];
+    uniform vec4 vs_params[16];
     layout(location = 0) in vec3 aPos;
 
     void main()
@@ -466,7 +472,7 @@ static const uint8_t fs_source_glsl300es[854] = {
 static const uint8_t light_sphere_vs_source_glsl300es[329] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
-    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
     0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
     0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
     0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
@@ -533,9 +539,9 @@ static inline const sg_shader_desc* darksun_shader_desc(sg_backend backend) {
             desc.attrs[1].glsl_name = "aNormal";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 256;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
@@ -580,9 +586,9 @@ static inline const sg_shader_desc* darksun_shader_desc(sg_backend backend) {
             desc.attrs[1].glsl_name = "aNormal";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 256;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
@@ -628,9 +634,9 @@ static inline const sg_shader_desc* light_sphere_shader_desc(sg_backend backend)
             desc.attrs[0].glsl_name = "aPos";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 256;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
@@ -655,9 +661,9 @@ static inline const sg_shader_desc* light_sphere_shader_desc(sg_backend backend)
             desc.attrs[0].glsl_name = "aPos";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 256;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
@@ -3,6 +3,7 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <sjd/icosahedron.h>
 #include <sjd/camera.h>
+#include <sjd/normal_matrix.h>
 
 #define SOKOL_IMPL
 #ifndef __EMSCRIPTEN__
@@ -145,6 +146,7 @@ void frame(void) {
                                   static_cast<float>(stm_sec(stm_now())),
                                   glm::vec3(0.5f, 1.0f, 0.0f));
     vs_params.model = model;
+    vs_params.normalMatrix = sjd::normalMatrix(model);
     sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
 
     fs_params_t fs_params = {
@@ -13,12 +13,13 @@ layout(binding = 0) uniform vs_params {
     mat4 model;
     mat4 view;
     mat4 projection;
+    mat4 normalMatrix;
 };
 
 void main() {
     gl_Position = projection * view * model * vec4(aPos, 1.0);
     FragPos = vec3(model * vec4(aPos, 1.0));
-    Normal = mat3(transpose(inverse(model))) * aNormal;
+    Normal = mat3(normalMatrix) * aNormal;
     color = vec4(aPos, 1.0);
 }
 @end
@@ -79,6 +80,7 @@ layout(binding = 0) uniform vs_params {
     mat4 model;
     mat4 view;
     mat4 projection;
+    mat4 normalMatrix;
 };
 
 void main() {
@@ -5,6 +5,8 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <sjd/icosahedron.h>
 #include <sjd/camera.h>
+#include <sjd/frame_clock.h>
+#include <sjd/normal_matrix.h>
 
 #define SOKOL_IMPL
 #ifndef __EMSCRIPTEN__
@@ -36,8 +38,7 @@ namespace state {
     glm::vec3 green_pos;
     glm::vec3 blue_pos;
     sjd::Camera camera {};
-    uint64_t last_time;
-    float deltaTime;
+    sjd::FrameClock clock;
 }
 
 void init(void) {
@@ -105,24 +106,28 @@ void init(void) {
 
 void frame(void) {
     
-    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
-    state::camera.moveCamera(state::deltaTime);
+    // one time for the whole frame, P pauses it and [ ] slow it down and
+    // speed it up. The camera runs on real time so it still moves while
+    // paused.
+    state::clock.tick();
+    float time {static_cast<float>(state::clock.time())};
+    state::camera.moveCamera(static_cast<float>(state::clock.realDeltaTime()));
 
     // rotate light source
-    state::red_pos = glm::vec3(1.3f * sinf(static_cast<float>(-stm_sec(stm_now()))),
+    state::red_pos = glm::vec3(1.3f * sinf(-time),
                                  0.2f,
-                                 1.3f * cosf(static_cast<float>(-stm_sec(stm_now()))));
-    state::green_pos = glm::vec3(1.3f * sinf(stm_sec(stm_now()) * 2.5f),
-                                 1.3f * sinf(stm_sec(stm_now()) * 2.5f + 3.0f),
-                                 1.3f * cosf(stm_sec(stm_now()) * -2.5f));
-    state::blue_pos = glm::vec3(1.3f * sinf((stm_sec(stm_now())+glm::pi<float>()/2) * -2.5f),
-                                 1.3f * sinf(stm_sec(stm_now()) * 2.5f),
-                                 1.3f * cosf(stm_sec(stm_now()) * -2.5f));
+                                 1.3f * cosf(-time));
+    state::green_pos = glm::vec3(1.3f * sinf(time * 2.5f),
+                                 1.3f * sinf(time * 2.5f + 3.0f),
+                                 1.3f * cosf(time * -2.5f));
+    state::blue_pos = glm::vec3(1.3f * sinf((time+glm::pi<float>()/2) * -2.5f),
+                                 1.3f * sinf(time * 2.5f),
+                                 1.3f * cosf(time * -2.5f));
 
     // change light colour
-    /*state::light_colour = 0.5f * glm::vec3(sinf((stm_sec(stm_now()) * 2.0f))+1,*/
-    /*                                sinf((stm_sec(stm_now()) * 0.7f))+1,*/
-    /*                                sinf((stm_sec(stm_now()) * 1.3f))+1);*/
+    /*state::light_colour = 0.5f * glm::vec3(sinf((time * 2.0f))+1,*/
+    /*                                sinf((time * 0.7f))+1,*/
+    /*                                sinf((time * 1.3f))+1);*/
 
     // Movements
 
@@ -148,9 +153,10 @@ void frame(void) {
 
     glm::mat4 model = glm::mat4(1.0f);
     model = glm::rotate(model, 
-                        static_cast<float>(stm_sec(stm_now())),
+                        time,
                         glm::vec3(0.0f, 1.0f, 0.0f));
     vs_params.model = model;
+    vs_params.normalMatrix = sjd::normalMatrix(model);
     sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
 
     fs_params_t fs_params = {
@@ -199,7 +205,7 @@ void frame(void) {
     model = glm::translate(glm::mat4(1.0f), state::red_pos);
     model = glm::scale(model, glm::vec3(0.2f));
     vs_params.model = glm::rotate(model, 
-                                  static_cast<float>(8*stm_sec(stm_now())),
+                                  8.0f * time,
                                   glm::vec3(0.1f, 1.0f, 0.5f));
     sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
 
@@ -213,7 +219,7 @@ void frame(void) {
     model = glm::translate(glm::mat4(1.0f), state::green_pos);
     model = glm::scale(model, glm::vec3(0.2f));
     vs_params.model = glm::rotate(model, 
-                                  static_cast<float>(8*stm_sec(stm_now())),
+                                  8.0f * time,
                                   glm::vec3(0.1f, 1.0f, 0.5f));
     sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
 
@@ -227,7 +233,7 @@ void frame(void) {
     model = glm::translate(glm::mat4(1.0f), state::blue_pos);
     model = glm::scale(model, glm::vec3(0.2f));
     vs_params.model = glm::rotate(model, 
-                                  static_cast<float>(8*stm_sec(stm_now())),
+                                  8.0f * time,
                                   glm::vec3(0.1f, 1.0f, 0.5f));
     sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
 
@@ -252,6 +258,12 @@ void event(const sapp_event* e) {
         if (e->key_code == SAPP_KEYCODE_ESCAPE) {
             sapp_request_quit();
         }
+        if (e->key_code == SAPP_KEYCODE_P)
+            state::clock.setPaused(!state::clock.paused());
+        if (e->key_code == SAPP_KEYCODE_LEFT_BRACKET)
+            state::clock.setScale(state::clock.scale() * 0.5);
+        if (e->key_code == SAPP_KEYCODE_RIGHT_BRACKET)
+            state::clock.setScale(state::clock.scale() * 2.0);
         if (e->key_code == SAPP_KEYCODE_SPACE)
             state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::PRESS);
         if (e->key_code == SAPP_KEYCODE_C)
@@ -0,0 +1,24 @@
+@echo off
+
+if [%1]==[] goto fail
+
+:usage
+SET CODEDIR="%cd%"
+mkdir ..\..\build
+if not exist ..\..\build\sjd_app.lib (
+    pushd ..\..\lib
+    call build.bat
+    popd
+)
+pushd ..\..\build
+:: demos on sjd/app.h need the runtime, the others don't pull anything from it
+cl %CODEDIR%/%1.cpp sjd_app.lib -I%HOME%/OpenGL/include /I../include -std:c++20 -EHsc -O2
+popd
+goto eof
+
+:fail
+@echo ERROR::BUILD::BAT: NO_FILE
+@echo Usage: ./shdc filename (do not inlcude extention)
+
+:eof
+
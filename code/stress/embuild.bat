@@ -0,0 +1,24 @@
+@echo off
+
+if [%1]==[] goto fail
+
+:usage
+SET CODEDIR="%cd%"
+
+mkdir ..\..\embuild
+if not exist ..\..\embuild\libsjd_app.a (
+    pushd ..\..\lib
+    call embuild.bat
+    popd
+)
+pushd ..\..\embuild
+:: counts go in the URL, e.g. stress.html?cubes=20000&lights=512
+em++ %CODEDIR%/%1.cpp libsjd_app.a -o %1.html -I%HOME%/myprojects/learn-sokol/sokol -I%HOME%/OpenGL/include -I../include -sUSE_WEBGL2 -std=c++20 -O2 --shell-file ..\code\shell.html --embed-file data\container2.png --embed-file data\container2_specular.png --embed-file data\blending_transparent_window.png
+popd
+goto eof
+
+:fail
+@echo ERROR::EMBUILD::BAT: NO_FILE
+@echo Usage: ./embuild filename (do not inlcude extention)
+
+:eof
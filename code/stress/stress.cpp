@@ -0,0 +1,465 @@
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <sjd/app.h>
+#include <sjd/camera.h>
+#include <sjd/clustered_lights.h>
+#include <sjd/depth_sorter.h>
+#include <sjd/jobs.h>
+#include <sjd/normal_matrix.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// incl before the sokol headers
+#include <sjd/sok_texture.h>
+
+// the implementations are in the runtime library, lib/sjd_app.cpp
+#include <sokol/sokol_app.h>
+#include <sokol/sokol_args.h>
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_glue.h>
+
+// add the shader after glm
+#include "stress.glsl.h"
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+/* Stress test: as many textured cubes, point lights and alpha blended
+ * windows as you ask for, to see how frame time grows with the object
+ * count. Every cube, light cube and window is its own draw with its own
+ * sg_apply_uniforms, the way the LearnOpenGL demos draw, so this is where
+ * the per-draw uniform path shows its limits. The lights go through
+ * sjd::ClusteredLights so the shading cost stays sensible as they grow.
+ *
+ * Arguments come from the command line, or the URL on the web:
+ *
+ *   stress cubes=20000 lights=512 quads=1000 layout=random seed=7
+ *   stress.html?cubes=20000&lights=512
+ *
+ * layout is grid (the default) or random, the field grows with the counts
+ * so the density stays the same. Every two seconds the average frame time
+ * is printed as
+ *
+ *   stress,<cubes>,<lights>,<quads>,<layout>,<ms per frame>
+ *
+ * to be collected into a CSV and plotted against the counts.
+ */
+
+struct StressParams {
+    int cubes {1000};
+    int lights {64};
+    int quads {200};
+    bool grid {true};
+    unsigned seed {1};
+
+    // sargs_setup() has to have been called
+    static StressParams fromArgs();
+};
+
+StressParams StressParams::fromArgs() {
+    StressParams params {};
+    params.cubes = std::max(0, std::atoi(sargs_value_def("cubes", "1000")));
+    params.lights = std::max(0, std::atoi(sargs_value_def("lights", "64")));
+    params.quads = std::max(0, std::atoi(sargs_value_def("quads", "200")));
+    params.grid = !sargs_equals("layout", "random");
+    params.seed = static_cast<unsigned>(std::atoi(sargs_value_def("seed", "1")));
+    if (params.lights > sjd::ClusteredLights::MAX_LIGHTS) {
+        std::cout << "WARNING::STRESS::LIGHTS: " << params.lights << " lights asked for, "
+                  << sjd::ClusteredLights::MAX_LIGHTS << " is the most the clusters take\n";
+        params.lights = sjd::ClusteredLights::MAX_LIGHTS;
+    }
+    return params;
+}
+
+class StressScene : public sjd::Scene {
+public:
+    // the same spacing as the clustered lights grid
+    static constexpr float SPACING {2.0f};
+    static constexpr float REPORT_SECONDS {2.0f};
+
+    explicit StressScene(const StressParams& params)
+        : m_params {params} {}
+
+    void init(sjd::App& app) override;
+    void update(sjd::App& app, float deltaTime) override;
+    void render(sjd::App& app) override;
+    void cleanup(sjd::App& app) override;
+
+private:
+    // count positions on the xz plane around height, a square grid or
+    // scattered over the same square
+    std::vector<glm::vec3> place(int count, float height, float jitter);
+    void report();
+
+    StressParams m_params;
+    std::mt19937 m_rng {};
+    // half the width of the field
+    float m_extent {};
+    float m_far {100.0f};
+    unsigned m_binThreads {1};
+
+    sjd::Camera m_camera {};
+    sjd::ClusteredLights m_clusters;
+    sjd::DepthSorter m_windowSorter;
+
+    sg_pipeline m_pipObject {};
+    sg_pipeline m_pipLight {};
+    sg_pipeline m_pipWindow {};
+    sg_bindings m_bindObject {};
+    sg_bindings m_bindLight {};
+    sg_bindings m_bindWindow {};
+    sg_pass_action m_passAction {};
+    // filled in by sfetch once the files have loaded
+    sg_image m_diffuseImage {};
+    sg_image m_specularImage {};
+    sg_image m_windowImage {};
+
+    std::vector<glm::mat4> m_cubeModels;
+    std::vector<glm::mat4> m_cubeNormalMatrices;
+    std::vector<glm::vec3> m_lightOrbits;
+    std::vector<sjd::ClusterLight> m_lights;
+    std::vector<glm::vec3> m_windows;
+
+    double m_reportTime {};
+    int m_reportFrames {};
+};
+
+std::vector<glm::vec3> StressScene::place(int count, float height, float jitter) {
+    std::vector<glm::vec3> positions;
+    positions.reserve(count);
+    int side {std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<float>(count)))))};
+    std::uniform_real_distribution<float> across {-m_extent, m_extent};
+    std::uniform_real_distribution<float> up {-jitter, jitter};
+    for (int i {0}; i < count; i++) {
+        if (m_params.grid) {
+            positions.push_back(glm::vec3((i % side - side / 2) * SPACING,
+                                          height,
+                                          (i / side - side / 2) * SPACING));
+        }
+        else {
+            positions.push_back(glm::vec3(across(m_rng), height + up(m_rng), across(m_rng)));
+        }
+    }
+    return positions;
+}
+
+void StressScene::init(sjd::App& app) {
+    m_rng.seed(m_params.seed);
+    int largest {std::max({m_params.cubes, m_params.quads, 1})};
+    m_extent = std::ceil(std::sqrt(static_cast<float>(largest))) * SPACING * 0.5f;
+    m_far = std::max(100.0f, m_extent * 3.0f);
+
+    m_camera = sjd::Camera(glm::vec3(0.0f, 6.0f, m_extent + 8.0f), glm::vec3(0.0f));
+    app.useCamera(&m_camera);
+
+    m_clusters.setup();
+    // the workers are already running, so every one of them can help
+    m_binThreads = sjd::JobSystem::instance().threadCount();
+
+    for (glm::vec3 position : place(m_params.cubes, 0.0f, 2.0f)) {
+        float angle {20.0f * static_cast<float>(m_cubeModels.size())};
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+        m_cubeModels.push_back(glm::rotate(model, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f)));
+    }
+    m_cubeNormalMatrices.resize(m_cubeModels.size());
+    sjd::computeNormalMatrices(m_cubeModels.data(), m_cubeNormalMatrices.data(), m_cubeModels.size());
+
+    // point lights circling the middle at random heights, x = radius,
+    // y = height, z = phase
+    std::uniform_real_distribution<float> unit {0.0f, 1.0f};
+    for (int i {0}; i < m_params.lights; i++) {
+        m_lightOrbits.push_back(glm::vec3(unit(m_rng) * m_extent,
+                                          0.8f + unit(m_rng) * 1.5f,
+                                          unit(m_rng) * glm::two_pi<float>()));
+        glm::vec3 colour {unit(m_rng), unit(m_rng), unit(m_rng)};
+        m_lights.push_back(sjd::ClusterLight {
+            .position = glm::vec3(0.0f),
+            .range = 3.0f,
+            .colour = glm::normalize(colour + glm::vec3(0.01f)) * 2.0f,
+        });
+    }
+
+    // windows sit between the cubes on the grid
+    for (glm::vec3 position : place(m_params.quads, 1.5f, 1.0f))
+        m_windows.push_back(m_params.grid ? position + glm::vec3(SPACING * 0.5f, 0.0f, SPACING * 0.5f) : position);
+
+    std::vector<float> cubeVertices {
+        // positions          // normals           // texture coords
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
+         0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
+
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
+
+        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+
+        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
+
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f
+    };
+    sg_buffer cube_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = cubeVertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = cubeVertices.data(),
+            .size = cubeVertices.size() * sizeof(float),
+        },
+        .label = "cube-vertices"
+    });
+    m_bindObject.vertex_buffers[0] = cube_buffer;
+    m_bindLight.vertex_buffers[0] = cube_buffer;
+
+    std::vector<float> windowVertices {
+        // positions          // texture coords
+        -0.5f, -0.5f,  0.0f,  0.0f,  0.0f,
+         0.5f, -0.5f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.0f,  0.0f,  0.0f,
+    };
+    m_bindWindow.vertex_buffers[0] = sg_make_buffer(sg_buffer_desc {
+        .size = windowVertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = windowVertices.data(),
+            .size = windowVertices.size() * sizeof(float),
+        },
+        .label = "window-vertices"
+    });
+
+    sg_shader phong_shd = sg_make_shader(phong_shader_desc(sg_query_backend()));
+    sg_vertex_layout_state object_layout {};
+    object_layout.attrs[ATTR_phong_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    object_layout.attrs[ATTR_phong_aNormal].format = SG_VERTEXFORMAT_FLOAT3;
+    object_layout.attrs[ATTR_phong_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
+    m_pipObject = sg_make_pipeline(sg_pipeline_desc {
+        .shader = phong_shd,
+        .layout = object_layout,
+        .depth {
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = true,
+        },
+        .label = "object-pipeline"
+    });
+
+    // the light cubes read the positions out of the same buffer
+    sg_shader light_cube_shd = sg_make_shader(light_cube_shader_desc(sg_query_backend()));
+    sg_vertex_layout_state light_layout {};
+    light_layout.buffers[0].stride = 8 * sizeof(float);
+    light_layout.attrs[ATTR_light_cube_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    m_pipLight = sg_make_pipeline(sg_pipeline_desc {
+        .shader = light_cube_shd,
+        .layout = light_layout,
+        .depth {
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = true,
+        },
+        .label = "light-cube-pipeline"
+    });
+
+    sg_shader window_shd = sg_make_shader(window_shader_desc(sg_query_backend()));
+    sg_vertex_layout_state window_layout {};
+    window_layout.attrs[ATTR_window_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    window_layout.attrs[ATTR_window_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
+    // sorted back to front, so they test against depth but don't write it
+    m_pipWindow = sg_make_pipeline(sg_pipeline_desc {
+        .shader = window_shd,
+        .layout = window_layout,
+        .depth {
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = false,
+        },
+        .color_count = 1,
+        .colors = {{
+            .blend = {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .op_rgb = SG_BLENDOP_ADD,
+                .src_factor_alpha = SG_BLENDFACTOR_SRC_ALPHA,
+                .dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .op_alpha = SG_BLENDOP_ADD
+            }
+        }},
+        .label = "window-pipeline"
+    });
+
+    m_passAction = sg_pass_action {
+        .colors = {{
+            .load_action = SG_LOADACTION_CLEAR,
+            .clear_value = {0.05f, 0.05f, 0.05f, 1.0f}
+        }}
+    };
+
+    m_clusters.applyBindings(m_bindObject,
+                             IMG__light_texture,
+                             IMG__cluster_texture,
+                             IMG__index_texture,
+                             SMP_cluster_smp);
+
+    // Load textures. (sfetch is set up by the runtime)
+    m_diffuseImage = SokTexture("../data/container2.png", m_bindObject, IMG__diffuse_texture, SMP_diffuse_texture_smp, true).image;
+    m_specularImage = SokTexture("../data/container2_specular.png", m_bindObject, IMG__specular_texture, SMP_specular_texture_smp, true).image;
+    m_windowImage = SokTexture("../data/blending_transparent_window.png", m_bindWindow, IMG__window_texture, SMP_window_texture_smp, true).image;
+
+    std::cout << "Stress: " << m_params.cubes << " cubes, " << m_params.lights << " lights, "
+              << m_params.quads << " windows, " << (m_params.grid ? "grid" : "random") << " layout\n";
+}
+
+void StressScene::update(sjd::App& app, [[maybe_unused]] float deltaTime) {
+    float time {static_cast<float>(app.time())};
+    for (size_t i {0}; i < m_lights.size(); i++) {
+        glm::vec3 orbit {m_lightOrbits[i]};
+        float angle {orbit.z + time * 0.3f};
+        m_lights[i].position = glm::vec3(glm::cos(angle) * orbit.x, orbit.y, glm::sin(angle) * orbit.x);
+    }
+
+    float fovy {glm::radians(m_camera.zoom)};
+    float aspect {static_cast<float>(sapp_width()) / sapp_height()};
+    m_clusters.setProjection(fovy, aspect, 0.1f, m_far);
+    m_clusters.bin(m_camera.getViewMatrix(), m_lights, m_binThreads);
+    m_clusters.upload();
+
+    // frame time is what the test measures, so it's the real clock's
+    m_reportTime += app.clock().realDeltaTime();
+    m_reportFrames += 1;
+    if (m_reportTime >= REPORT_SECONDS)
+        report();
+}
+
+void StressScene::render([[maybe_unused]] sjd::App& app) {
+    glm::mat4 view = m_camera.getViewMatrix();
+    glm::mat4 projection = glm::perspective(glm::radians(m_camera.zoom),
+                                            static_cast<float>(sapp_width()) / sapp_height(),
+                                            0.1f, m_far);
+
+    sg_begin_pass(sg_pass {
+        .action = m_passAction,
+        .swapchain = sglue_swapchain()
+    });
+
+    vs_params_t vs_params = {
+        .view = view,
+        .projection = projection
+    };
+
+    // one draw and one uniform upload per cube, on purpose
+    sg_apply_pipeline(m_pipObject);
+    sg_apply_bindings(m_bindObject);
+    fs_params_t fs_params = {
+        .viewPos = m_camera.pos,
+        .clusterParams = glm::vec4(m_clusters.sliceScale(),
+                                   m_clusters.sliceBias(),
+                                   static_cast<float>(sapp_width()),
+                                   static_cast<float>(sapp_height())),
+    };
+    sg_apply_uniforms(UB_fs_params, SG_RANGE(fs_params));
+    for (size_t i {0}; i < m_cubeModels.size(); i++) {
+        vs_params.model = m_cubeModels[i];
+        vs_params.normalMatrix = m_cubeNormalMatrices[i];
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        sg_draw(0, 36, 1);
+    }
+
+    sg_apply_pipeline(m_pipLight);
+    sg_apply_bindings(m_bindLight);
+    for (const sjd::ClusterLight& light : m_lights) {
+        vs_params.model = glm::scale(glm::translate(glm::mat4(1.0f), light.position), glm::vec3(0.1f));
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        light_cube_fs_params_t light_cube_fs_params = {
+            .lightColour = light.colour
+        };
+        sg_apply_uniforms(UB_light_cube_fs_params, SG_RANGE(light_cube_fs_params));
+        sg_draw(0, 36, 1);
+    }
+
+    // windows last and farthest first
+    m_windowSorter.clear();
+    for (size_t i {0}; i < m_windows.size(); i++) {
+        glm::vec3 offset {m_windows[i] - m_camera.pos};
+        m_windowSorter.add(glm::dot(offset, offset), static_cast<uint32_t>(i));
+    }
+    sg_apply_pipeline(m_pipWindow);
+    sg_apply_bindings(m_bindWindow);
+    window_vs_params_t window_vs_params = {
+        .view = view,
+        .projection = projection
+    };
+    for (const sjd::SortItem32& sorted : m_windowSorter.sortBackToFront()) {
+        window_vs_params.model = glm::translate(glm::mat4(1.0f), m_windows[sorted.index]);
+        sg_apply_uniforms(UB_window_vs_params, SG_RANGE(window_vs_params));
+        sg_draw(0, 6, 1);
+    }
+
+    sg_end_pass();
+}
+
+void StressScene::report() {
+    double ms {m_reportTime * 1000.0 / m_reportFrames};
+    std::cout << "stress," << m_params.cubes << "," << m_params.lights << "," << m_params.quads << ","
+              << (m_params.grid ? "grid" : "random") << "," << ms << "\n";
+    std::string title {"Stress - "};
+    title += std::to_string(m_params.cubes) + " cubes, " + std::to_string(m_params.lights) + " lights, "
+           + std::to_string(m_params.quads) + " windows - " + std::to_string(ms) + "ms";
+    sapp_set_window_title(title.c_str());
+    m_reportTime = 0.0;
+    m_reportFrames = 0;
+}
+
+void StressScene::cleanup([[maybe_unused]] sjd::App& app) {
+    sg_destroy_image(m_diffuseImage);
+    sg_destroy_image(m_specularImage);
+    sg_destroy_image(m_windowImage);
+    m_clusters.shutdown();
+    sargs_shutdown();
+}
+
+sapp_desc sokol_main(int argc, char* argv[]) {
+    // on the web sokol_args reads the URL query string instead
+    sargs_setup(sargs_desc {
+        .argc = argc,
+        .argv = argv,
+    });
+    static StressScene scene {StressParams::fromArgs()};
+    return sjd::run(scene, sjd::AppDesc {
+        .title = "Stress - LearnOpenGL",
+        .width = 800,
+        .height = 600,
+    });
+}
@@ -0,0 +1,183 @@
+@ctype mat4 glm::mat4
+@ctype vec3 glm::vec3
+@ctype vec4 glm::vec4
+
+// the cubes: container2 lit by a dim directional light and the clustered
+// point lights, the same lighting as demos/2-6-multiple-lights/2-clustered-lights
+@vs vs
+in vec3 aPos;
+in vec3 aNormal;
+in vec2 aTexCoords;
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoords;
+out float ViewDepth;
+
+layout(binding = 0) uniform vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+    mat4 normalMatrix;
+};
+
+void main() {
+    vec4 viewPos = view * model * vec4(aPos, 1.0);
+    gl_Position = projection * viewPos;
+    FragPos = vec3(model * vec4(aPos, 1.0));
+    Normal = mat3(normalMatrix) * aNormal;
+    TexCoords = aTexCoords;
+    ViewDepth = -viewPos.z;
+}
+@end
+
+@fs fs
+in vec3 FragPos;
+in vec3 Normal;
+in vec2 TexCoords;
+in float ViewDepth;
+
+out vec4 FragColor;
+
+layout(binding = 1) uniform fs_params {
+    vec3 viewPos;
+    // x = slice scale, y = slice bias, zw = framebuffer size
+    vec4 clusterParams;
+};
+
+// must match sjd::ClusteredLights
+const int TILES_X = 16;
+const int TILES_Y = 9;
+const int SLICES = 24;
+const int INDEX_TEXTURE_WIDTH = 1024;
+const float SHININESS = 32.0;
+
+layout(binding = 0) uniform texture2D _diffuse_texture;
+layout(binding = 0) uniform sampler diffuse_texture_smp;
+#define diffuse_texture sampler2D(_diffuse_texture, diffuse_texture_smp)
+layout(binding = 1) uniform texture2D _specular_texture;
+layout(binding = 1) uniform sampler specular_texture_smp;
+#define specular_texture sampler2D(_specular_texture, specular_texture_smp)
+
+// float data textures, only ever read with texelFetch
+@image_sample_type _light_texture unfilterable_float
+@image_sample_type _cluster_texture unfilterable_float
+@image_sample_type _index_texture unfilterable_float
+@sampler_type cluster_smp nonfiltering
+layout(binding = 2) uniform texture2D _light_texture;
+layout(binding = 3) uniform texture2D _cluster_texture;
+layout(binding = 4) uniform texture2D _index_texture;
+layout(binding = 2) uniform sampler cluster_smp;
+#define light_texture sampler2D(_light_texture, cluster_smp)
+#define cluster_texture sampler2D(_cluster_texture, cluster_smp)
+#define index_texture sampler2D(_index_texture, cluster_smp)
+
+vec3 calcClusterLight(int light, vec3 normal, vec3 fragPos, vec3 viewDir, vec3 diffuseColour, vec3 specularColour) {
+    vec4 positionRange = texelFetch(light_texture, ivec2(0, light), 0);
+    vec3 colour = texelFetch(light_texture, ivec2(1, light), 0).rgb;
+    vec3 lightDir = normalize(positionRange.xyz - fragPos);
+
+    float diff = max(dot(normal, lightDir), 0.0);
+    vec3 reflectDir = reflect(-lightDir, normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), SHININESS);
+
+    // windowed inverse square, reaches zero at the light's range
+    float distance = length(positionRange.xyz - fragPos);
+    float window = clamp(1.0 - pow(distance / positionRange.w, 4.0), 0.0, 1.0);
+    float attenuation = window * window / (1.0 + distance * distance);
+
+    return colour * (diff * diffuseColour + spec * specularColour) * attenuation;
+}
+
+void main() {
+    vec3 norm = normalize(Normal);
+    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 diffuseColour = texture(diffuse_texture, TexCoords).rgb;
+    vec3 specularColour = texture(specular_texture, TexCoords).rgb;
+
+    // enough directional light to see the cubes away from the point lights
+    vec3 lightDir = normalize(vec3(0.2, 1.0, 0.3));
+    vec3 result = diffuseColour * (0.05 + 0.1 * max(dot(norm, lightDir), 0.0));
+
+    vec2 tile = gl_FragCoord.xy / clusterParams.zw * vec2(TILES_X, TILES_Y);
+    int tileX = clamp(int(tile.x), 0, TILES_X - 1);
+    int tileY = clamp(int(tile.y), 0, TILES_Y - 1);
+    int slice = clamp(int(log(ViewDepth) * clusterParams.x - clusterParams.y), 0, SLICES - 1);
+    vec2 cluster = texelFetch(cluster_texture, ivec2(tileY * TILES_X + tileX, slice), 0).xy;
+
+    int offset = int(cluster.x);
+    int count = int(cluster.y);
+    for (int i = 0; i < count; i++) {
+        int index = offset + i;
+        int light = int(texelFetch(index_texture, ivec2(index % INDEX_TEXTURE_WIDTH, index / INDEX_TEXTURE_WIDTH), 0).r);
+        result += calcClusterLight(light, norm, FragPos, viewDir, diffuseColour, specularColour);
+    }
+
+    FragColor = vec4(result, 1.0);
+}
+@end
+
+// the light cubes, flat colour
+@vs light_cube_vs
+in vec3 aPos;
+
+layout(binding = 0) uniform vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+    mat4 normalMatrix;
+};
+
+void main() {
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
+}
+@end
+
+@fs light_cube_fs
+out vec4 FragColor;
+
+layout(binding = 1) uniform light_cube_fs_params {
+    vec3 lightColour;
+};
+
+void main() {
+    FragColor = vec4(lightColour, 1.0);
+}
+@end
+
+// the windows, blended over the rest back to front
+@vs window_vs
+in vec3 aPos;
+in vec2 aTexCoords;
+
+out vec2 TexCoords;
+
+layout(binding = 0) uniform window_vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+};
+
+void main() {
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    TexCoords = aTexCoords;
+}
+@end
+
+@fs window_fs
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+layout(binding = 0) uniform texture2D _window_texture;
+layout(binding = 0) uniform sampler window_texture_smp;
+#define window_texture sampler2D(_window_texture, window_texture_smp)
+
+void main() {
+    FragColor = texture(window_texture, TexCoords);
+}
+@end
+
+@program phong vs fs
+@program light_cube light_cube_vs light_cube_fs
+@program window window_vs window_fs
@@ -0,0 +1,1348 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i .\stress.glsl -o .\stress.glsl.h -l glsl430:glsl300es
+
+    Overview:
+    =========
+    Shader program: 'light_cube':
+        Get shader desc: light_cube_shader_desc(sg_query_backend());
+        Vertex Shader: light_cube_vs
+        Fragment Shader: light_cube_fs
+        Attributes:
+            ATTR_light_cube_aPos => 0
+    Shader program: 'phong':
+        Get shader desc: phong_shader_desc(sg_query_backend());
+        Vertex Shader: vs
+        Fragment Shader: fs
+        Attributes:
+            ATTR_phong_aPos => 0
+            ATTR_phong_aNormal => 1
+            ATTR_phong_aTexCoords => 2
+    Shader program: 'window':
+        Get shader desc: window_shader_desc(sg_query_backend());
+        Vertex Shader: window_vs
+        Fragment Shader: window_fs
+        Attributes:
+            ATTR_window_aPos => 0
+            ATTR_window_aTexCoords => 1
+    Bindings:
+        Uniform block 'vs_params':
+            C struct: vs_params_t
+            Bind slot: UB_vs_params => 0
+        Uniform block 'light_cube_fs_params':
+            C struct: light_cube_fs_params_t
+            Bind slot: UB_light_cube_fs_params => 1
+        Uniform block 'fs_params':
+            C struct: fs_params_t
+            Bind slot: UB_fs_params => 1
+        Uniform block 'window_vs_params':
+            C struct: window_vs_params_t
+            Bind slot: UB_window_vs_params => 0
+        Image '_light_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__light_texture => 2
+        Image '_diffuse_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__diffuse_texture => 0
+        Image '_specular_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__specular_texture => 1
+        Image '_cluster_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__cluster_texture => 3
+        Image '_index_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__index_texture => 4
+        Image '_window_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__window_texture => 0
+        Sampler 'cluster_smp':
+            Type: SG_SAMPLERTYPE_NONFILTERING
+            Bind slot: SMP_cluster_smp => 2
+        Sampler 'diffuse_texture_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_diffuse_texture_smp => 0
+        Sampler 'specular_texture_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_specular_texture_smp => 1
+        Sampler 'window_texture_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_window_texture_smp => 0
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before stress.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define ATTR_light_cube_aPos (0)
+#define ATTR_phong_aPos (0)
+#define ATTR_phong_aNormal (1)
+#define ATTR_phong_aTexCoords (2)
+#define ATTR_window_aPos (0)
+#define ATTR_window_aTexCoords (1)
+#define UB_vs_params (0)
+#define UB_light_cube_fs_params (1)
+#define UB_fs_params (1)
+#define UB_window_vs_params (0)
+#define IMG__light_texture (2)
+#define IMG__diffuse_texture (0)
+#define IMG__specular_texture (1)
+#define IMG__cluster_texture (3)
+#define IMG__index_texture (4)
+#define IMG__window_texture (0)
+#define SMP_cluster_smp (2)
+#define SMP_diffuse_texture_smp (0)
+#define SMP_specular_texture_smp (1)
+#define SMP_window_texture_smp (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
+    glm::mat4 model;
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::mat4 normalMatrix;
+} vs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct light_cube_fs_params_t {
+    glm::vec3 lightColour;
+    uint8_t _pad_12[4];
+} light_cube_fs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_params_t {
+    glm::vec3 viewPos;
+    uint8_t _pad_12[4];
+    glm::vec4 clusterParams;
+} fs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct window_vs_params_t {
+    glm::mat4 model;
+    glm::mat4 view;
+    glm::mat4 projection;
+} window_vs_params_t;
+#pragma pack(pop)
+/*
+    #version 430
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec3 aNormal;
+    layout(location = 2) in vec2 aTexCoords;
+    layout(location = 0) out vec3 FragPos;
+    layout(location = 1) out vec3 Normal;
+    layout(location = 2) out vec2 TexCoords;
+    layout(location = 3) out float ViewDepth;
+
+    void main()
+    {
+        vec4 viewPos = mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * viewPos;
+        FragPos = vec3(mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0));
+        Normal = mat3(mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15])) * aNormal;
+        TexCoords = aTexCoords;
+        ViewDepth = -viewPos.z;
+    }
+
+*/
+static const uint8_t vs_source_glsl430[840] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,
+    0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x56,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x6f,0x73,0x20,0x3d,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,
+    0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,
+    0x76,0x69,0x65,0x77,0x50,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,
+    0x67,0x50,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x34,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x35,0x5d,0x29,0x29,
+    0x20,0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x61,0x54,0x65,0x78,
+    0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x56,0x69,0x65,0x77,
+    0x44,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x2d,0x76,0x69,0x65,0x77,0x50,0x6f,0x73,
+    0x2e,0x7a,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 fs_params[2];
+    layout(binding = 16) uniform sampler2D _light_texture_cluster_smp;
+    layout(binding = 17) uniform sampler2D _diffuse_texture_diffuse_texture_smp;
+    layout(binding = 18) uniform sampler2D _specular_texture_specular_texture_smp;
+    layout(binding = 19) uniform sampler2D _cluster_texture_cluster_smp;
+    layout(binding = 20) uniform sampler2D _index_texture_cluster_smp;
+    layout(location = 0) in vec3 FragPos;
+    layout(location = 1) in vec3 Normal;
+    layout(location = 2) in vec2 TexCoords;
+    layout(location = 3) in float ViewDepth;
+    layout(location = 0) out vec4 FragColor;
+
+    const int TILES_X = 16;
+    const int TILES_Y = 9;
+    const int SLICES = 24;
+    const int INDEX_TEXTURE_WIDTH = 1024;
+    const float SHININESS = 32.0;
+
+    vec3 calcClusterLight(int light, vec3 normal, vec3 fragPos, vec3 viewDir, vec3 diffuseColour, vec3 specularColour)
+    {
+        vec4 positionRange = texelFetch(_light_texture_cluster_smp, ivec2(0, light), 0);
+        vec3 colour = texelFetch(_light_texture_cluster_smp, ivec2(1, light), 0).rgb;
+        vec3 lightDir = normalize(positionRange.xyz - fragPos);
+        float diff = max(dot(normal, lightDir), 0.0);
+        vec3 reflectDir = reflect(-lightDir, normal);
+        float spec = pow(max(dot(viewDir, reflectDir), 0.0), SHININESS);
+        float distance = length(positionRange.xyz - fragPos);
+        float window = clamp(1.0 - pow(distance / positionRange.w, 4.0), 0.0, 1.0);
+        float attenuation = window * window / (1.0 + distance * distance);
+        return colour * (diff * diffuseColour + spec * specularColour) * attenuation;
+    }
+
+    void main()
+    {
+        vec3 norm = normalize(Normal);
+        vec3 viewDir = normalize(fs_params[0].xyz - FragPos);
+        vec3 diffuseColour = texture(_diffuse_texture_diffuse_texture_smp, TexCoords).rgb;
+        vec3 specularColour = texture(_specular_texture_specular_texture_smp, TexCoords).rgb;
+        vec3 lightDir = normalize(vec3(0.2, 1.0, 0.3));
+        vec3 result = diffuseColour * (0.05 + 0.1 * max(dot(norm, lightDir), 0.0));
+        vec2 tile = gl_FragCoord.xy / fs_params[1].zw * vec2(TILES_X, TILES_Y);
+        int tileX = clamp(int(tile.x), 0, TILES_X - 1);
+        int tileY = clamp(int(tile.y), 0, TILES_Y - 1);
+        int slice = clamp(int(log(ViewDepth) * fs_params[1].x - fs_params[1].y), 0, SLICES - 1);
+        vec2 cluster = texelFetch(_cluster_texture_cluster_smp, ivec2(tileY * TILES_X + tileX, slice), 0).xy;
+        int offset = int(cluster.x);
+        int count = int(cluster.y);
+        for (int i = 0; i < count; i++)
+        {
+            int index = offset + i;
+            int light = int(texelFetch(_index_texture_cluster_smp, ivec2(index % INDEX_TEXTURE_WIDTH, index / INDEX_TEXTURE_WIDTH), 0).r);
+            result += calcClusterLight(light, norm, FragPos, viewDir, diffuseColour, specularColour);
+        }
+        FragColor = vec4(result, 1.0);
+    }
+
+*/
+static const uint8_t fs_source_glsl430[2756] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,
+    0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x37,0x29,
+    0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x32,0x44,0x20,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x38,0x29,0x20,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,
+    0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x39,0x29,0x20,0x75,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,
+    0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x32,0x30,
+    0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,
+    0x67,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,
+    0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,
+    0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x56,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x20,
+    0x54,0x49,0x4c,0x45,0x53,0x5f,0x58,0x20,0x3d,0x20,0x31,0x36,0x3b,0x0a,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x20,0x54,0x49,0x4c,0x45,0x53,0x5f,0x59,0x20,
+    0x3d,0x20,0x39,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x20,0x53,
+    0x4c,0x49,0x43,0x45,0x53,0x20,0x3d,0x20,0x32,0x34,0x3b,0x0a,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x69,0x6e,0x74,0x20,0x49,0x4e,0x44,0x45,0x58,0x5f,0x54,0x45,0x58,0x54,
+    0x55,0x52,0x45,0x5f,0x57,0x49,0x44,0x54,0x48,0x20,0x3d,0x20,0x31,0x30,0x32,0x34,
+    0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,0x48,
+    0x49,0x4e,0x49,0x4e,0x45,0x53,0x53,0x20,0x3d,0x20,0x33,0x32,0x2e,0x30,0x3b,0x0a,
+    0x0a,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6c,0x63,0x43,0x6c,0x75,0x73,0x74,0x65,
+    0x72,0x4c,0x69,0x67,0x68,0x74,0x28,0x69,0x6e,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x2c,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,
+    0x75,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x6c,0x69,0x67,0x68,0x74,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x30,0x2c,0x20,0x6c,
+    0x69,0x67,0x68,0x74,0x29,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x29,0x2c,0x20,0x30,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x66,
+    0x72,0x61,0x67,0x50,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x69,0x66,0x66,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,
+    0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,
+    0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x20,0x3d,
+    0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x6c,0x69,0x67,0x68,0x74,0x44,
+    0x69,0x72,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,
+    0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x76,0x69,0x65,0x77,0x44,0x69,
+    0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x2c,0x20,0x53,0x48,0x49,0x4e,0x49,0x4e,0x45,0x53,0x53,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x20,0x3d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x78,0x79,0x7a,0x20,
+    0x2d,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x3d,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x70,0x6f,0x77,0x28,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2f,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x77,0x2c,0x20,0x34,0x2e,0x30,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x2a,0x20,0x77,0x69,0x6e,
+    0x64,0x6f,0x77,0x20,0x2f,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x20,0x2a,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,
+    0x6c,0x6f,0x75,0x72,0x20,0x2a,0x20,0x28,0x64,0x69,0x66,0x66,0x20,0x2a,0x20,0x64,
+    0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2b,0x20,0x73,
+    0x70,0x65,0x63,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,
+    0x6c,0x6f,0x75,0x72,0x29,0x20,0x2a,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,
+    0x6f,0x72,0x6d,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,
+    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x28,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x75,
+    0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x70,0x65,
+    0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,
+    0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,
+    0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,
+    0x65,0x28,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x32,0x2c,0x20,0x31,0x2e,0x30,0x2c,
+    0x20,0x30,0x2e,0x33,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x64,0x69,0x66,0x66,0x75,0x73,
+    0x65,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2a,0x20,0x28,0x30,0x2e,0x30,0x35,0x20,
+    0x2b,0x20,0x30,0x2e,0x31,0x20,0x2a,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,
+    0x6e,0x6f,0x72,0x6d,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x74,0x69,0x6c,0x65,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x54,0x49,0x4c,0x45,0x53,0x5f,0x58,0x2c,0x20,0x54,0x49,0x4c,0x45,0x53,0x5f,
+    0x59,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x69,0x6c,0x65,
+    0x58,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x69,0x6e,0x74,0x28,0x74,0x69,
+    0x6c,0x65,0x2e,0x78,0x29,0x2c,0x20,0x30,0x2c,0x20,0x54,0x49,0x4c,0x45,0x53,0x5f,
+    0x58,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x74,0x69,0x6c,0x65,0x59,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x69,0x6e,
+    0x74,0x28,0x74,0x69,0x6c,0x65,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2c,0x20,0x54,0x49,
+    0x4c,0x45,0x53,0x5f,0x59,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x73,0x6c,0x69,0x63,0x65,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x69,0x6e,0x74,0x28,0x6c,0x6f,0x67,0x28,0x56,0x69,0x65,0x77,0x44,0x65,
+    0x70,0x74,0x68,0x29,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x5d,0x2e,0x78,0x20,0x2d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2c,0x20,0x53,0x4c,0x49,0x43,
+    0x45,0x53,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x74,0x69,0x6c,0x65,0x59,
+    0x20,0x2a,0x20,0x54,0x49,0x4c,0x45,0x53,0x5f,0x58,0x20,0x2b,0x20,0x74,0x69,0x6c,
+    0x65,0x58,0x2c,0x20,0x73,0x6c,0x69,0x63,0x65,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,
+    0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x2e,
+    0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,
+    0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x2e,
+    0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,
+    0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x63,0x6f,0x75,0x6e,
+    0x74,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x3d,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x69,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,
+    0x3d,0x20,0x69,0x6e,0x74,0x28,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,
+    0x28,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x76,0x65,
+    0x63,0x32,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x25,0x20,0x49,0x4e,0x44,0x45,0x58,
+    0x5f,0x54,0x45,0x58,0x54,0x55,0x52,0x45,0x5f,0x57,0x49,0x44,0x54,0x48,0x2c,0x20,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x2f,0x20,0x49,0x4e,0x44,0x45,0x58,0x5f,0x54,0x45,
+    0x58,0x54,0x55,0x52,0x45,0x5f,0x57,0x49,0x44,0x54,0x48,0x29,0x2c,0x20,0x30,0x29,
+    0x2e,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x63,0x61,0x6c,0x63,0x43,0x6c,0x75,0x73,0x74,
+    0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x28,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x6e,
+    0x6f,0x72,0x6d,0x2c,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x2c,0x20,0x76,0x69,
+    0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,
+    0x6c,0x6f,0x75,0x72,0x2c,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,
+    0x6c,0x6f,0x75,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+    }
+
+*/
+static const uint8_t light_cube_vs_source_glsl430[322] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 light_cube_fs_params[1];
+    layout(location = 0) out vec4 FragColor;
+
+    void main()
+    {
+        FragColor = vec4(light_cube_fs_params[0].xyz, 1.0);
+    }
+
+*/
+static const uint8_t light_cube_fs_source_glsl430[168] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,
+    0x5f,0x63,0x75,0x62,0x65,0x5f,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x6c,0x69,0x67,0x68,0x74,0x5f,0x63,0x75,0x62,0x65,0x5f,0x66,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 window_vs_params[12];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec2 aTexCoords;
+    layout(location = 0) out vec2 TexCoords;
+
+    void main()
+    {
+        gl_Position = mat4(window_vs_params[8], window_vs_params[9], window_vs_params[10], window_vs_params[11]) * mat4(window_vs_params[4], window_vs_params[5], window_vs_params[6], window_vs_params[7]) * mat4(window_vs_params[0], window_vs_params[1], window_vs_params[2], window_vs_params[3]) * vec4(aPos, 1.0);
+        TexCoords = aTexCoords;
+    }
+
+*/
+static const uint8_t window_vs_source_glsl430[523] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x77,0x69,0x6e,0x64,0x6f,
+    0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,
+    0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,
+    0x6f,0x72,0x64,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x77,0x69,0x6e,0x64,
+    0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,
+    0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x39,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,
+    0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,
+    0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x77,0x69,
+    0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,
+    0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,
+    0x61,0x74,0x34,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x77,0x69,
+    0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,
+    0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x61,
+    0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x61,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    layout(binding = 16) uniform sampler2D _window_texture_window_texture_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    void main()
+    {
+        FragColor = texture(_window_texture_window_texture_smp, TexCoords);
+    }
+
+*/
+static const uint8_t window_fs_source_glsl430[261] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,
+    0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x32,0x44,0x20,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec3 aNormal;
+    layout(location = 2) in vec2 aTexCoords;
+    out vec3 FragPos;
+    out vec3 Normal;
+    out vec2 TexCoords;
+    out float ViewDepth;
+
+    void main()
+    {
+        vec4 viewPos = mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * viewPos;
+        FragPos = vec3(mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0));
+        Normal = mat3(mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15])) * aNormal;
+        TexCoords = aTexCoords;
+        ViewDepth = -viewPos.z;
+    }
+
+*/
+static const uint8_t vs_source_glsl300es[759] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x4e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x3b,
+    0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,
+    0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x56,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x6f,0x73,0x20,0x3d,0x20,0x6d,0x61,0x74,
+    0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x76,
+    0x69,0x65,0x77,0x50,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
+    0x50,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x6d,0x61,0x74,0x34,0x28,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x61,
+    0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x34,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x35,0x5d,0x29,0x29,0x20,
+    0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x61,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x56,0x69,0x65,0x77,0x44,
+    0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x2d,0x76,0x69,0x65,0x77,0x50,0x6f,0x73,0x2e,
+    0x7a,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 fs_params[2];
+    uniform highp sampler2D _light_texture_cluster_smp;
+    uniform highp sampler2D _diffuse_texture_diffuse_texture_smp;
+    uniform highp sampler2D _specular_texture_specular_texture_smp;
+    uniform highp sampler2D _cluster_texture_cluster_smp;
+    uniform highp sampler2D _index_texture_cluster_smp;
+    in highp vec3 FragPos;
+    in highp vec3 Normal;
+    in highp vec2 TexCoords;
+    in highp float ViewDepth;
+    layout(location = 0) out highp vec4 FragColor;
+
+    const int TILES_X = 16;
+    const int TILES_Y = 9;
+    const int SLICES = 24;
+    const int INDEX_TEXTURE_WIDTH = 1024;
+    const highp float SHININESS = 32.0;
+
+    highp vec3 calcClusterLight(int light, highp vec3 normal, highp vec3 fragPos, highp vec3 viewDir, highp vec3 diffuseColour, highp vec3 specularColour)
+    {
+        highp vec4 positionRange = texelFetch(_light_texture_cluster_smp, ivec2(0, light), 0);
+        highp vec3 colour = texelFetch(_light_texture_cluster_smp, ivec2(1, light), 0).rgb;
+        highp vec3 lightDir = normalize(positionRange.xyz - fragPos);
+        highp float diff = max(dot(normal, lightDir), 0.0);
+        highp vec3 reflectDir = reflect(-lightDir, normal);
+        highp float spec = pow(max(dot(viewDir, reflectDir), 0.0), SHININESS);
+        highp float distance = length(positionRange.xyz - fragPos);
+        highp float window = clamp(1.0 - pow(distance / positionRange.w, 4.0), 0.0, 1.0);
+        highp float attenuation = window * window / (1.0 + distance * distance);
+        return colour * (diff * diffuseColour + spec * specularColour) * attenuation;
+    }
+
+    void main()
+    {
+        highp vec3 norm = normalize(Normal);
+        highp vec3 viewDir = normalize(fs_params[0].xyz - FragPos);
+        highp vec3 diffuseColour = texture(_diffuse_texture_diffuse_texture_smp, TexCoords).rgb;
+        highp vec3 specularColour = texture(_specular_texture_specular_texture_smp, TexCoords).rgb;
+        highp vec3 lightDir = normalize(vec3(0.2, 1.0, 0.3));
+        highp vec3 result = diffuseColour * (0.05 + 0.1 * max(dot(norm, lightDir), 0.0));
+        highp vec2 tile = gl_FragCoord.xy / fs_params[1].zw * vec2(TILES_X, TILES_Y);
+        int tileX = clamp(int(tile.x), 0, TILES_X - 1);
+        int tileY = clamp(int(tile.y), 0, TILES_Y - 1);
+        int slice = clamp(int(log(ViewDepth) * fs_params[1].x - fs_params[1].y), 0, SLICES - 1);
+        highp vec2 cluster = texelFetch(_cluster_texture_cluster_smp, ivec2(tileY * TILES_X + tileX, slice), 0).xy;
+        int offset = int(cluster.x);
+        int count = int(cluster.y);
+        for (int i = 0; i < count; i++)
+        {
+            int index = offset + i;
+            int light = int(texelFetch(_index_texture_cluster_smp, ivec2(index % INDEX_TEXTURE_WIDTH, index / INDEX_TEXTURE_WIDTH), 0).r);
+            result += calcClusterLight(light, norm, FragPos, viewDir, diffuseColour, specularColour);
+        }
+        FragColor = vec4(result, 1.0);
+    }
+
+*/
+static const uint8_t fs_source_glsl300es[2826] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,
+    0x6d,0x70,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x70,0x65,0x63,0x75,
+    0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,
+    0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x63,0x6c,0x75,0x73,0x74,
+    0x65,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6c,0x75,0x73,0x74,
+    0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x5f,0x69,0x6e,0x64,0x65,0x78,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,
+    0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,
+    0x73,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,
+    0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x56,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x69,0x6e,0x74,0x20,0x54,0x49,0x4c,0x45,0x53,0x5f,0x58,0x20,0x3d,0x20,
+    0x31,0x36,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x20,0x54,0x49,
+    0x4c,0x45,0x53,0x5f,0x59,0x20,0x3d,0x20,0x39,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x69,0x6e,0x74,0x20,0x53,0x4c,0x49,0x43,0x45,0x53,0x20,0x3d,0x20,0x32,0x34,
+    0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x20,0x49,0x4e,0x44,0x45,
+    0x58,0x5f,0x54,0x45,0x58,0x54,0x55,0x52,0x45,0x5f,0x57,0x49,0x44,0x54,0x48,0x20,
+    0x3d,0x20,0x31,0x30,0x32,0x34,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,0x48,0x49,0x4e,0x49,0x4e,
+    0x45,0x53,0x53,0x20,0x3d,0x20,0x33,0x32,0x2e,0x30,0x3b,0x0a,0x0a,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6c,0x63,0x43,0x6c,0x75,0x73,
+    0x74,0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x28,0x69,0x6e,0x74,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,
+    0x65,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,
+    0x75,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,
+    0x67,0x65,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,
+    0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,
+    0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x76,0x65,0x63,
+    0x32,0x28,0x30,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x29,0x2c,0x20,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+    0x74,0x63,0x68,0x28,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x29,0x2c,
+    0x20,0x30,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,
+    0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2d,
+    0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x66,0x66,0x20,
+    0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x72,
+    0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,
+    0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,0x65,0x63,0x20,
+    0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x76,0x69,
+    0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,
+    0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x53,0x48,0x49,0x4e,0x49,0x4e,
+    0x45,0x53,0x53,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x3d,
+    0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x52,0x61,0x6e,0x67,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x66,0x72,0x61,0x67,
+    0x50,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x3d,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x70,0x6f,0x77,0x28,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2f,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x77,0x2c,0x20,0x34,0x2e,0x30,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x65,
+    0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,
+    0x20,0x2a,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x2f,0x20,0x28,0x31,0x2e,0x30,
+    0x20,0x2b,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2a,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2a,0x20,0x28,0x64,0x69,
+    0x66,0x66,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,
+    0x75,0x72,0x20,0x2b,0x20,0x73,0x70,0x65,0x63,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,
+    0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x29,0x20,0x2a,0x20,0x61,0x74,
+    0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x20,
+    0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x46,0x72,0x61,0x67,0x50,
+    0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x75,
+    0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,0x67,0x62,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x70,0x65,0x63,0x75,
+    0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,
+    0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,0x67,0x62,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x32,0x2c,0x20,
+    0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x33,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x20,0x3d,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x75,
+    0x72,0x20,0x2a,0x20,0x28,0x30,0x2e,0x30,0x35,0x20,0x2b,0x20,0x30,0x2e,0x31,0x20,
+    0x2a,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x2c,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x74,0x69,0x6c,0x65,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x54,0x49,0x4c,0x45,0x53,0x5f,0x58,0x2c,0x20,0x54,0x49,0x4c,0x45,0x53,0x5f,
+    0x59,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x69,0x6c,0x65,
+    0x58,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x69,0x6e,0x74,0x28,0x74,0x69,
+    0x6c,0x65,0x2e,0x78,0x29,0x2c,0x20,0x30,0x2c,0x20,0x54,0x49,0x4c,0x45,0x53,0x5f,
+    0x58,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x74,0x69,0x6c,0x65,0x59,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x69,0x6e,
+    0x74,0x28,0x74,0x69,0x6c,0x65,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2c,0x20,0x54,0x49,
+    0x4c,0x45,0x53,0x5f,0x59,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x73,0x6c,0x69,0x63,0x65,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x69,0x6e,0x74,0x28,0x6c,0x6f,0x67,0x28,0x56,0x69,0x65,0x77,0x44,0x65,
+    0x70,0x74,0x68,0x29,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x5d,0x2e,0x78,0x20,0x2d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2c,0x20,0x53,0x4c,0x49,0x43,
+    0x45,0x53,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x63,0x6c,
+    0x75,0x73,0x74,0x65,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6c,
+    0x75,0x73,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,
+    0x28,0x74,0x69,0x6c,0x65,0x59,0x20,0x2a,0x20,0x54,0x49,0x4c,0x45,0x53,0x5f,0x58,
+    0x20,0x2b,0x20,0x74,0x69,0x6c,0x65,0x58,0x2c,0x20,0x73,0x6c,0x69,0x63,0x65,0x29,
+    0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x63,0x6c,
+    0x75,0x73,0x74,0x65,0x72,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x63,0x6c,
+    0x75,0x73,0x74,0x65,0x72,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,
+    0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,
+    0x3c,0x20,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,
+    0x20,0x69,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x74,0x65,0x78,0x65,
+    0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x25,
+    0x20,0x49,0x4e,0x44,0x45,0x58,0x5f,0x54,0x45,0x58,0x54,0x55,0x52,0x45,0x5f,0x57,
+    0x49,0x44,0x54,0x48,0x2c,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,0x2f,0x20,0x49,0x4e,
+    0x44,0x45,0x58,0x5f,0x54,0x45,0x58,0x54,0x55,0x52,0x45,0x5f,0x57,0x49,0x44,0x54,
+    0x48,0x29,0x2c,0x20,0x30,0x29,0x2e,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x63,0x61,0x6c,
+    0x63,0x43,0x6c,0x75,0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x28,0x6c,0x69,
+    0x67,0x68,0x74,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x2c,0x20,0x46,0x72,0x61,0x67,0x50,
+    0x6f,0x73,0x2c,0x20,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x2c,0x20,0x73,0x70,0x65,0x63,
+    0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+    }
+
+*/
+static const uint8_t light_cube_vs_source_glsl300es[325] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x38,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,
+    0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,
+    0x76,0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 light_cube_fs_params[1];
+    layout(location = 0) out highp vec4 FragColor;
+
+    void main()
+    {
+        FragColor = vec4(light_cube_fs_params[0].xyz, 1.0);
+    }
+
+*/
+static const uint8_t light_cube_fs_source_glsl300es[229] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x63,0x75,0x62,0x65,0x5f,0x66,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x63,0x75,0x62,0x65,0x5f,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 window_vs_params[12];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec2 aTexCoords;
+    out vec2 TexCoords;
+
+    void main()
+    {
+        gl_Position = mat4(window_vs_params[8], window_vs_params[9], window_vs_params[10], window_vs_params[11]) * mat4(window_vs_params[4], window_vs_params[5], window_vs_params[6], window_vs_params[7]) * mat4(window_vs_params[0], window_vs_params[1], window_vs_params[2], window_vs_params[3]) * vec4(aPos, 1.0);
+        TexCoords = aTexCoords;
+    }
+
+*/
+static const uint8_t window_vs_source_glsl300es[505] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x77,0x69,
+    0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,
+    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,
+    0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,0x20,0x77,
+    0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x39,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,
+    0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,
+    0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,
+    0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,
+    0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x36,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,
+    0x34,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x77,0x69,0x6e,0x64,
+    0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,
+    0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x50,0x6f,
+    0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x54,0x65,0x78,
+    0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp sampler2D _window_texture_window_texture_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    void main()
+    {
+        FragColor = texture(_window_texture_window_texture_smp, TexCoords);
+    }
+
+*/
+static const uint8_t window_fs_source_glsl300es[286] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x77,0x69,0x6e,0x64,0x6f,
+    0x77,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* light_cube_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)light_cube_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)light_cube_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "light_cube_fs_params";
+            desc.label = "light_cube_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)light_cube_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)light_cube_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "light_cube_fs_params";
+            desc.label = "light_cube_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* phong_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aNormal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 32;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_params";
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[4].image_type = SG_IMAGETYPE_2D;
+            desc.images[4].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.images[4].multisampled = false;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 2;
+            desc.image_sampler_pairs[0].sampler_slot = 2;
+            desc.image_sampler_pairs[0].glsl_name = "_light_texture_cluster_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 0;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_diffuse_texture_diffuse_texture_smp";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 1;
+            desc.image_sampler_pairs[2].sampler_slot = 1;
+            desc.image_sampler_pairs[2].glsl_name = "_specular_texture_specular_texture_smp";
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 2;
+            desc.image_sampler_pairs[3].glsl_name = "_cluster_texture_cluster_smp";
+            desc.image_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[4].image_slot = 4;
+            desc.image_sampler_pairs[4].sampler_slot = 2;
+            desc.image_sampler_pairs[4].glsl_name = "_index_texture_cluster_smp";
+            desc.label = "phong_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aNormal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 32;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_params";
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[4].image_type = SG_IMAGETYPE_2D;
+            desc.images[4].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.images[4].multisampled = false;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 2;
+            desc.image_sampler_pairs[0].sampler_slot = 2;
+            desc.image_sampler_pairs[0].glsl_name = "_light_texture_cluster_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 0;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_diffuse_texture_diffuse_texture_smp";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 1;
+            desc.image_sampler_pairs[2].sampler_slot = 1;
+            desc.image_sampler_pairs[2].glsl_name = "_specular_texture_specular_texture_smp";
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 2;
+            desc.image_sampler_pairs[3].glsl_name = "_cluster_texture_cluster_smp";
+            desc.image_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[4].image_slot = 4;
+            desc.image_sampler_pairs[4].sampler_slot = 2;
+            desc.image_sampler_pairs[4].glsl_name = "_index_texture_cluster_smp";
+            desc.label = "phong_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* window_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)window_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)window_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "window_vs_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_window_texture_window_texture_smp";
+            desc.label = "window_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)window_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)window_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "window_vs_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_window_texture_window_texture_smp";
+            desc.label = "window_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
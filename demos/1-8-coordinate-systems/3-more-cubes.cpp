@@ -3,6 +3,7 @@
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 #include <sjd/camera.h>
+#include <sjd/transforms.h>
 #include <array>
 
 // incl before defining SOKOL_IMPL
@@ -22,7 +23,7 @@
 #include <sokol/sokol_time.h>
 
 // add the shader after glm
-#include "shaders.glsl.h"
+#include "3-more-cubes.glsl.h"
 
 #ifdef __clang__
 // clangd doesn't like leaving struct elements value-initialised
@@ -34,6 +35,8 @@ static struct {
     sg_bindings bind;
     sg_pass_action pass_action;
     std::array<glm::vec3, 10> cube_positions;
+    sjd::Transforms cubes;
+    sg_buffer cube_instances;
 } state;
 
 static void init(void) {
@@ -68,6 +71,19 @@ static void init(void) {
         glm::vec3(-1.3f,  1.0f, -1.5f)  
     };
 
+    // the rotations don't change, so they're only worked out once
+    for (glm::vec3 cube_position : state.cube_positions) {
+        size_t i {state.cubes.add(cube_position)};
+        float angle = 20.f * i;
+        state.cubes.setRotation(i, glm::radians(angle), glm::vec3(1.0f, 0.3f, 0.5f));
+    }
+    state.cube_instances = sg_make_buffer(sg_buffer_desc {
+        .size = state.cubes.bytes(),
+        .usage = SG_USAGE_STREAM,
+        .label = "cube-instances"
+    });
+    state.bind.vertex_buffers[1] = state.cube_instances;
+
     std::array<float, 180> vertices {
         -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
         0.5f, -0.5f, -0.5f,  1.0f, 0.0f,
@@ -119,13 +135,23 @@ static void init(void) {
     });
 
     // create shader from code-generated sg_shader_desc
-    sg_shader shd = sg_make_shader(simple_shader_desc(sg_query_backend()));
+    sg_shader shd = sg_make_shader(instanced_shader_desc(sg_query_backend()));
 
     // we need to initialise layout seperately to the pipeline
     // because we cant do array initilisation of structs in C++
+    // per vertex data from buffer 0, the instances' mvp columns from buffer 1.
+    // sokol only works offsets out when none are given, so they all are.
     sg_vertex_layout_state layout {};
-    layout.attrs[ATTR_simple_aPos].format = SG_VERTEXFORMAT_FLOAT3;
-    layout.attrs[ATTR_simple_aTexCoord].format = SG_VERTEXFORMAT_FLOAT2;
+    layout.buffers[0].stride = 5 * sizeof(float);
+    layout.buffers[1].stride = sizeof(sjd::Transforms::Instance);
+    layout.buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+    layout.attrs[ATTR_instanced_aPos] = { .buffer_index = 0, .format = SG_VERTEXFORMAT_FLOAT3 };
+    layout.attrs[ATTR_instanced_aTexCoord] = { .buffer_index = 0, .offset = 3 * sizeof(float), .format = SG_VERTEXFORMAT_FLOAT2 };
+    int mvp_offset {static_cast<int>(offsetof(sjd::Transforms::Instance, mvp))};
+    layout.attrs[ATTR_instanced_aMvp0] = { .buffer_index = 1, .offset = mvp_offset, .format = SG_VERTEXFORMAT_FLOAT4 };
+    layout.attrs[ATTR_instanced_aMvp1] = { .buffer_index = 1, .offset = mvp_offset + 16, .format = SG_VERTEXFORMAT_FLOAT4 };
+    layout.attrs[ATTR_instanced_aMvp2] = { .buffer_index = 1, .offset = mvp_offset + 32, .format = SG_VERTEXFORMAT_FLOAT4 };
+    layout.attrs[ATTR_instanced_aMvp3] = { .buffer_index = 1, .offset = mvp_offset + 48, .format = SG_VERTEXFORMAT_FLOAT4 };
 
     // create a pipeline object (default render states are fine for triangle)
     state.pip = sg_make_pipeline(sg_pipeline_desc {
@@ -158,6 +184,13 @@ void frame(void) {
 
     glm::mat4 projection = glm::perspective(glm::radians(45.0f), static_cast<float>(sapp_width()) / sapp_height(), 0.1f, 100.0f);
 
+    // every cube's matrices in one go, ready to draw them all at once
+    state.cubes.update(projection * view);
+    sg_update_buffer(state.cube_instances, sg_range {
+        .ptr = state.cubes.data(),
+        .size = state.cubes.bytes(),
+    });
+
     sg_begin_pass(sg_pass { 
 	.action = state.pass_action,
 	.swapchain = sglue_swapchain()
@@ -165,23 +198,7 @@ void frame(void) {
     sg_apply_pipeline(state.pip);
     sg_apply_bindings(state.bind);
 
-    vs_params_t vs_params = {
-        .view = view,
-        .projection = projection
-    };
-
-    int i {0};
-    for (glm::vec3 cube_position : state.cube_positions) {
-        glm::mat4 model = glm::translate(glm::mat4(1.0f), cube_position);
-        float angle = 20.f * i;
-        model = glm::rotate(model, glm::radians(angle), glm::vec3(1.0f, 0.3f, 0.5f));
-        vs_params.model = model;
-
-        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-
-        sg_draw(0, 36, 1);
-        ++i;
-    }
+    sg_draw(0, 36, static_cast<int>(state.cubes.size()));
 
 
     sg_end_pass();
@@ -0,0 +1,39 @@
+@ctype mat4 glm::mat4
+
+// shaders.glsl with the matrices coming in per instance, sjd::Transforms
+// works them out for every cube at once so the cubes are one draw
+@vs vs
+in vec3 aPos;
+in vec2 aTexCoord;
+// the mvp columns of a sjd::Transforms::Instance
+in vec4 aMvp0;
+in vec4 aMvp1;
+in vec4 aMvp2;
+in vec4 aMvp3;
+
+out vec2 TexCoord;
+
+void main() {
+    gl_Position = mat4(aMvp0, aMvp1, aMvp2, aMvp3) * vec4(aPos, 1.0);
+    TexCoord = aTexCoord;
+}
+@end
+
+@fs fs
+out vec4 FragColor;
+
+in vec2 TexCoord;
+
+layout(binding = 0) uniform texture2D _texture1;
+layout(binding = 0) uniform sampler texture1_smp;
+#define texture1 sampler2D(_texture1, texture1_smp)
+layout(binding = 1) uniform texture2D _texture2;
+layout(binding = 1) uniform sampler texture2_smp;
+#define texture2 sampler2D(_texture2, texture2_smp)
+
+void main() {
+    FragColor = mix(texture(texture1, TexCoord), texture(texture2, TexCoord), 0.32);
+}
+@end
+
+@program instanced vs fs
@@ -7,7 +7,7 @@ SET CODEDIR="%cd%"
 
 mkdir ..\..\embuild
 pushd ..\..\embuild
-em++ %CODEDIR%/%1.cpp -o %1.html -I%HOME%/myprojects/learn-sokol/sokol -I%HOME%/OpenGL/include -I../include -sUSE_WEBGL2 -std=c++20 --shell-file ..\code\shell.html --embed-file data\container.jpg --embed-file data\ahhprofile.png
+em++ %CODEDIR%/%1.cpp -o %1.html -I%HOME%/myprojects/learn-sokol/sokol -I%HOME%/OpenGL/include -I../include -sUSE_WEBGL2 -std=c++20 -msse -msimd128 --shell-file ..\code\shell.html --embed-file data\container.jpg --embed-file data\ahhprofile.png
 popd
 goto eof
 
@@ -5,8 +5,14 @@ if [%1]==[] goto fail
 :usage
 SET CODEDIR="%cd%"
 mkdir ..\..\build
+if not exist ..\..\build\sjd_app.lib (
+    pushd ..\..\lib
+    call build.bat
+    popd
+)
 pushd ..\..\build
-cl %CODEDIR%/%1.cpp -I%HOME%/OpenGL/include /I../include -std:c++20 -EHsc
+:: demos on sjd/app.h need the runtime, the others don't pull anything from it
+cl %CODEDIR%/%1.cpp sjd_app.lib -I%HOME%/OpenGL/include /I../include -std:c++20 -EHsc
 popd
 goto eof
 
@@ -6,8 +6,14 @@ if [%1]==[] goto fail
 SET CODEDIR="%cd%"
 
 mkdir ..\..\embuild
+if not exist ..\..\embuild\libsjd_app.a (
+    pushd ..\..\lib
+    call embuild.bat
+    popd
+)
 pushd ..\..\embuild
-em++ %CODEDIR%/%1.cpp -o %1.html -I%HOME%/myprojects/learn-sokol/sokol -I%HOME%/OpenGL/include -I../include -sUSE_WEBGL2 -std=c++20 --shell-file ..\code\shell.html --embed-file data\container.jpg --embed-file data\ahhprofile.png
+:: demos on sjd/app.h need the runtime, the others don't pull anything from it
+em++ %CODEDIR%/%1.cpp libsjd_app.a -o %1.html -I%HOME%/myprojects/learn-sokol/sokol -I%HOME%/OpenGL/include -I../include -sUSE_WEBGL2 -std=c++20 --shell-file ..\code\shell.html --embed-file data\container.jpg --embed-file data\ahhprofile.png
 popd
 goto eof
 
@@ -54,6 +54,7 @@ SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
     glm::mat4 model;
     glm::mat4 view;
     glm::mat4 projection;
+    glm::mat4 normalMatrix;
 } vs_params_t;
 #pragma pack(pop)
 #pragma pack(push,1)
@@ -75,7 +76,7 @@ SOKOL_SHDC_ALIGN(16) typedef struct light_cube_fs_params_t {
 /*
     #version 430
 
-    uniform vec4 vs_params[12];
+    uniform vec4 vs_params[16];
     layout(location = 0) in vec3 aPos;
     layout(location = 0) out vec3 FragPos;
     layout(location = 1) out vec3 Normal;
@@ -87,15 +88,15 @@ SOKOL_SHDC_ALIGN(16) typedef struct light_cube_fs_params_t {
         vec4 _39 = vec4(aPos, 1.0);
         gl_Position = ((mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7])) * _29) * _39;
         FragPos = vec3((_29 * _39).xyz);
-        mat4 _61 = transpose(inverse(_29));
+        mat4 _61 = mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15]);
         Normal = mat3(_61[0].xyz, _61[1].xyz, _61[2].xyz) * aNormal;
     }
 
 */
-static const uint8_t vs_source_glsl430[623] = {
+static const uint8_t vs_source_glsl430[664] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
     0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
     0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,
     0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
@@ -126,12 +127,15 @@ static const uint8_t vs_source_glsl430[623] = {
     0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,
     0x28,0x5f,0x32,0x39,0x20,0x2a,0x20,0x5f,0x33,0x39,0x29,0x2e,0x78,0x79,0x7a,0x29,
     0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,0x5f,0x36,0x31,0x20,0x3d,
-    0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x69,0x6e,0x76,0x65,0x72,
-    0x73,0x65,0x28,0x5f,0x32,0x39,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x4e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x5f,0x36,0x31,0x5b,
-    0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,0x5b,0x31,0x5d,0x2e,0x78,
-    0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,
-    0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x33,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x34,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x35,0x5d,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,
+    0x6d,0x61,0x74,0x33,0x28,0x5f,0x36,0x31,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,
+    0x20,0x5f,0x36,0x31,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,
+    0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 430
@@ -176,7 +180,7 @@ static const uint8_t fs_source_glsl430[371] = {
 /*
     #version 430
 
-    uniform vec4 vs_params[12];
+    uniform vec4 vs_params[16];
     layout(location = 0) in vec3 aPos;
 
     void main()
@@ -188,7 +192,7 @@ static const uint8_t fs_source_glsl430[371] = {
 static const uint8_t light_cube_vs_source_glsl430[326] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
     0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
     0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x0a,0x76,0x6f,
     0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
@@ -236,7 +240,7 @@ static const uint8_t light_cube_fs_source_glsl430[168] = {
 /*
     #version 300 es
 
-    uniform vec4 vs_params[12];
+    uniform vec4 vs_params[16];
     layout(location = 0) in vec3 aPos;
     out vec3 FragPos;
     out vec3 Normal;
@@ -248,15 +252,15 @@ static const uint8_t light_cube_fs_source_glsl430[168] = {
         vec4 _39 = vec4(aPos, 1.0);
         gl_Position = ((mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7])) * _29) * _39;
         FragPos = vec3((_29 * _39).xyz);
-        mat4 _61 = transpose(inverse(_29));
+        mat4 _61 = mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15]);
         Normal = mat3(_61[0].xyz, _61[1].xyz, _61[2].xyz) * aNormal;
     }
 
 */
-static const uint8_t vs_source_glsl300es[584] = {
+static const uint8_t vs_source_glsl300es[625] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
-    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
     0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
     0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
     0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,
@@ -284,13 +288,16 @@ static const uint8_t vs_source_glsl300es[584] = {
     0x20,0x5f,0x33,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,
     0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x28,0x5f,0x32,0x39,0x20,0x2a,0x20,
     0x5f,0x33,0x39,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,
-    0x61,0x74,0x34,0x20,0x5f,0x36,0x31,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,
-    0x6f,0x73,0x65,0x28,0x69,0x6e,0x76,0x65,0x72,0x73,0x65,0x28,0x5f,0x32,0x39,0x29,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,
-    0x6d,0x61,0x74,0x33,0x28,0x5f,0x36,0x31,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,
-    0x20,0x5f,0x36,0x31,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,
-    0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x61,0x74,0x34,0x20,0x5f,0x36,0x31,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x35,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x5f,0x36,
+    0x31,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,0x5b,0x31,0x5d,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x36,0x31,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,
+    0x29,0x20,0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
 };
 /*
     #version 300 es
@@ -339,7 +346,7 @@ static const uint8_t fs_source_glsl300es[402] = {
 /*
     #version 300 es
 
-    uniform vec4 vs_params[12];
+    uniform vec4 vs_params[16];
     layout(location = 0) in vec3 aPos;
 
     void main()
@@ -351,7 +358,7 @@ static const uint8_t fs_source_glsl300es[402] = {
 static const uint8_t light_cube_vs_source_glsl300es[329] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
-    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
     0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
     0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
     0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
@@ -418,9 +425,9 @@ static inline const sg_shader_desc* diffuse_shader_desc(sg_backend backend) {
             desc.attrs[1].glsl_name = "aNormal";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 256;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
@@ -447,9 +454,9 @@ static inline const sg_shader_desc* diffuse_shader_desc(sg_backend backend) {
             desc.attrs[1].glsl_name = "aNormal";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 256;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
@@ -477,9 +484,9 @@ static inline const sg_shader_desc* light_cube_shader_desc(sg_backend backend) {
             desc.attrs[0].glsl_name = "aPos";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 256;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
@@ -504,9 +511,9 @@ static inline const sg_shader_desc* light_cube_shader_desc(sg_backend backend) {
             desc.attrs[0].glsl_name = "aPos";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 256;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
@@ -1,6 +1,7 @@
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 #include <sjd/camera.h>
+#include <sjd/normal_matrix.h>
 #include <sjd/sok_texture.h>
 #include <array>
 
@@ -219,6 +220,7 @@ void frame(void) {
     sg_apply_bindings(state::bind);
 
     vs_params.model = glm::mat4(1.0f);
+    vs_params.normalMatrix = sjd::normalMatrix(vs_params.model);
     sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
 
     fs_params_t fs_params = {
@@ -2,6 +2,7 @@
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 #include <sjd/camera.h>
+#include <sjd/normal_matrix.h>
 #include <sjd/sok_texture.h>
 
 #define SOKOL_DEBUG
@@ -247,6 +248,7 @@ void frame(void) {
         float angle = 20.0f * i;
         model = glm::rotate(model, angle, glm::vec3(1.0f, 0.3f, 0.5f));
         vs_params.model = model;
+        vs_params.normalMatrix = sjd::normalMatrix(model);
 
         sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
 
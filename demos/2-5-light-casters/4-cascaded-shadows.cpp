@@ -0,0 +1,414 @@
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <iostream>
+#include <random>
+#include <sjd/camera.h>
+#include <sjd/normal_matrix.h>
+#include <sjd/shadows.h>
+#include <sjd/sok_texture.h>
+#include <vector>
+
+#define SOKOL_DEBUG
+#define SOKOL_IMPL
+#ifndef __EMSCRIPTEN__
+#define SOKOL_GLCORE
+#else
+#define SOKOL_GLES3
+#endif
+#include <sokol/sokol_app.h>
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_log.h>
+#include <sokol/sokol_fetch.h>
+#include <sokol/sokol_glue.h>
+#include <sokol/sokol_time.h>
+
+// add the shader after glm
+#include "4-cascaded-shadows.glsl.h"
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+/* The directional light demo with shadows, over a field of boxes big enough
+ * that a single shadow map would be either blurry up close or cut off in
+ * the distance. See sjd/shadows.h.
+ */
+namespace state {
+    sg_pipeline pip;
+    sg_pipeline pip_shadow;
+    sg_bindings bind;
+    sg_bindings bind_shadow;
+    sg_pass_action pass_action;
+    sjd::ShadowSettings shadow_settings;
+    sjd::CascadedShadows shadows;
+    bool show_cascades {false};
+    std::vector<glm::mat4> cube_models;
+    std::vector<glm::mat4> cube_normal_matrices;
+    // world space bounding sphere of each cube, xyz = centre, w = radius
+    std::vector<glm::vec4> cube_bounds;
+    int caster_draws {};
+    glm::vec3 light_colour;
+    glm::vec3 light_direction {-0.4f, -1.0f, -0.3f};
+    sjd::Camera camera(glm::vec3(0.2f, 2.0f, 8.0f));
+    uint64_t last_time;
+    float deltaTime;
+}
+
+const int NR_CUBES {250};
+
+static void fail_callback() {
+    state::pass_action = sg_pass_action {
+        .colors = {{ .load_action=SG_LOADACTION_CLEAR,
+            .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f }
+        }}
+    };
+}
+
+static void apply_shadow_settings() {
+    state::shadows.setup(state::shadow_settings);
+    state::shadows.applyBindings(state::bind, IMG__shadow_map, SMP_shadow_smp);
+    std::cout << "shadows: " << state::shadows.settings().cascades << " cascades at "
+              << state::shadows.settings().resolution << "x" << state::shadows.settings().resolution
+              << ", " << state::caster_draws << " caster draws last frame\n";
+}
+
+static void init(void) {
+    sg_setup(sg_desc {
+        .logger {
+            .func = slog_func
+        },
+        .environment = sglue_environment(),
+    });
+
+    sfetch_setup(sfetch_desc_t {
+        .max_requests = 8,
+        .num_channels = 1,
+        .num_lanes = 1,
+        .logger {
+            .func = slog_func
+        },
+    });
+
+    stm_setup();
+
+    // a floor and a field of boxes, nothing moves so the matrices and
+    // bounds are worked out once
+    glm::vec3 floor_scale {120.0f, 1.0f, 120.0f};
+    state::cube_models.push_back(glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -1.0f, 0.0f)), floor_scale));
+    state::cube_bounds.push_back(glm::vec4(0.0f, -1.0f, 0.0f, 0.5f * glm::length(floor_scale)));
+
+    std::mt19937 rng {3};
+    std::uniform_real_distribution<float> unit {0.0f, 1.0f};
+    for (int i {0}; i < NR_CUBES; i++) {
+        glm::vec3 scale {0.5f + unit(rng), 0.5f + unit(rng) * 4.0f, 0.5f + unit(rng)};
+        glm::vec3 position {(unit(rng) - 0.5f) * 100.0f, -0.5f + scale.y * 0.5f, (unit(rng) - 0.5f) * 100.0f};
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+        model = glm::rotate(model, unit(rng) * glm::two_pi<float>(), glm::vec3(0.0f, 1.0f, 0.0f));
+        state::cube_models.push_back(glm::scale(model, scale));
+        state::cube_bounds.push_back(glm::vec4(position, 0.5f * glm::length(scale)));
+    }
+    state::cube_normal_matrices.resize(state::cube_models.size());
+    sjd::computeNormalMatrices(state::cube_models.data(),
+                               state::cube_normal_matrices.data(),
+                               state::cube_models.size());
+
+    // wound counter-clockwise throughout so the shadow pass can cull front faces
+    std::vector<float> vertices {
+        // positions          // normals           // texture coords
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  1.0f,
+
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
+
+        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
+
+        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
+
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  0.0f
+    };
+
+    sg_buffer cube_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = vertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = vertices.data(),
+            .size = vertices.size() * sizeof(float),
+        },
+        .label = "cube-vertices"
+    });
+
+    state::bind.vertex_buffers[0] = cube_buffer;
+    state::bind_shadow.vertex_buffers[0] = cube_buffer;
+
+    // create shader from code-generated sg_shader_desc
+    sg_shader phong_shd = sg_make_shader(phong_shader_desc(sg_query_backend()));
+    sg_shader shadow_shd = sg_make_shader(shadow_shader_desc(sg_query_backend()));
+
+    // we need to initialise layout seperately to the pipeline
+    // because we cant do array initilisation of structs in C++
+    sg_vertex_layout_state layout {};
+    layout.attrs[ATTR_phong_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    layout.attrs[ATTR_phong_aNormal].format = SG_VERTEXFORMAT_FLOAT3;
+    layout.attrs[ATTR_phong_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
+
+    state::pip = sg_make_pipeline(sg_pipeline_desc {
+        .shader = phong_shd,
+        .layout = layout,
+        .depth {
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+        },
+        .cull_mode = SG_CULLMODE_BACK,
+        .face_winding = SG_FACEWINDING_CCW,
+        .label = "object-pipeline"
+    });
+
+    // the shadow pass only needs positions, the stride skips the rest
+    sg_vertex_layout_state shadow_layout {};
+    shadow_layout.buffers[0].stride = 8 * sizeof(float);
+    shadow_layout.attrs[ATTR_shadow_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    state::pip_shadow = sg_make_pipeline(
+        sjd::CascadedShadows::depthPipelineDesc(shadow_shd, shadow_layout));
+
+    apply_shadow_settings();
+
+    // a pass action to clear framebuffer
+    state::pass_action = sg_pass_action {
+        .colors = {{
+            .load_action=SG_LOADACTION_CLEAR,
+            .clear_value={0.1f, 0.1f, 0.1f, 1.0f}
+        }}
+    };
+
+    SokTexture container2("../data/container2.png",
+                          state::bind,
+                          IMG__diffuse_texture,
+                          SMP_diffuse_texture_smp,
+                          true,
+                          fail_callback);
+
+    SokTexture container2_specular("../data/container2_specular.png",
+                                   state::bind,
+                                   IMG__specular_texture,
+                                   SMP_specular_texture_smp,
+                                   true,
+                                   fail_callback);
+}
+
+void frame(void) {
+    sfetch_dowork();
+
+    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
+
+    state::light_colour = glm::vec3(1.0f);
+
+    if (!sapp_mouse_locked()) {
+        sapp_lock_mouse(true);
+    }
+    state::camera.moveCamera(state::deltaTime);
+
+    float fovy {glm::radians(state::camera.zoom)};
+    float aspect {static_cast<float>(sapp_width()) / sapp_height()};
+    glm::mat4 view = state::camera.getViewMatrix();
+    glm::mat4 projection = glm::perspective(fovy, aspect, 0.1f, 100.0f);
+
+    state::shadows.update(view, fovy, aspect, 0.1f, state::light_direction);
+
+    // Shadow casters, each cascade only draws the cubes it can see
+    sg_begin_pass(sg_pass {
+        .action = sjd::CascadedShadows::passAction(),
+        .attachments = state::shadows.attachments
+    });
+    sg_apply_pipeline(state::pip_shadow);
+    sg_apply_bindings(state::bind_shadow);
+
+    state::caster_draws = 0;
+    for (int cascade {0}; cascade < state::shadows.settings().cascades; cascade++) {
+        state::shadows.applyViewport(cascade);
+        const glm::mat4& light_view_projection {state::shadows.lightViewProjection(cascade)};
+        for (size_t i {0}; i < state::cube_models.size(); i++) {
+            glm::vec4 bounds {state::cube_bounds[i]};
+            if (!state::shadows.casterVisible(cascade, glm::vec3(bounds), bounds.w))
+                continue;
+            vs_shadow_params_t vs_shadow_params = {
+                .lightModelViewProjection = light_view_projection * state::cube_models[i]
+            };
+            sg_apply_uniforms(UB_vs_shadow_params, SG_RANGE(vs_shadow_params));
+            sg_draw(0, 36, 1);
+            ++state::caster_draws;
+        }
+    }
+    sg_end_pass();
+
+    sg_begin_pass(sg_pass {
+        .action = state::pass_action,
+        .swapchain = sglue_swapchain()
+    });
+
+    vs_params_t vs_params = {
+        .view = view,
+        .projection = projection
+    };
+
+    sg_apply_pipeline(state::pip);
+    sg_apply_bindings(state::bind);
+
+    fs_params_t fs_params = {
+        .viewPos {state::camera.pos}
+    };
+    sg_apply_uniforms(UB_fs_params, SG_RANGE(fs_params));
+
+    fs_material_t fs_material = {
+        .shininess = 32.0f,
+    };
+    sg_apply_uniforms(UB_fs_material, SG_RANGE(fs_material));
+
+    fs_light_t fs_light = {
+        .direction = state::light_direction,
+        .ambient = state::light_colour * 0.2f,
+        .diffuse = state::light_colour * 0.5f,
+        .specular = state::light_colour * 1.0f,
+    };
+    sg_apply_uniforms(UB_fs_light, SG_RANGE(fs_light));
+
+    fs_shadows_t fs_shadows {};
+    fs_shadows.shadowParams.w = state::show_cascades ? 1.0f : 0.0f;
+    state::shadows.fillUniforms(fs_shadows);
+    sg_apply_uniforms(UB_fs_shadows, SG_RANGE(fs_shadows));
+
+    for (size_t i {0}; i < state::cube_models.size(); i++) {
+        vs_params.model = state::cube_models[i];
+        vs_params.normalMatrix = state::cube_normal_matrices[i];
+
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+
+        sg_draw(0, 36, 1);
+    }
+
+    sg_end_pass();
+    sg_commit();
+}
+
+void cleanup(void) {
+    state::shadows.shutdown();
+    sfetch_shutdown();
+    sg_shutdown();
+}
+
+void event(const sapp_event* e) {
+    if (e->type == SAPP_EVENTTYPE_KEY_DOWN) {
+        if (e->key_code == SAPP_KEYCODE_ESCAPE) {
+            sapp_request_quit();
+        }
+        // 1-4 picks the number of cascades, R the resolution, V tints them
+        if (e->key_code >= SAPP_KEYCODE_1 && e->key_code <= SAPP_KEYCODE_4) {
+            state::shadow_settings.cascades = e->key_code - SAPP_KEYCODE_1 + 1;
+            apply_shadow_settings();
+        }
+        if (e->key_code == SAPP_KEYCODE_R) {
+            int resolution {state::shadow_settings.resolution * 2};
+            state::shadow_settings.resolution = resolution > 2048 ? 512 : resolution;
+            apply_shadow_settings();
+        }
+        if (e->key_code == SAPP_KEYCODE_V) {
+            state::show_cascades = !state::show_cascades;
+        }
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::PRESS);
+    }
+
+    if (e->type == SAPP_EVENTTYPE_KEY_UP) {
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::RELEASE);
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_BEGAN) {
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_MOVED) {
+        float offsetX = e -> touches[0].pos_x - state::camera.lastX;
+        float offsetY = state::camera.lastY - e -> touches[0].pos_y;
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+        state::camera.processMouseMovement(offsetX, offsetY);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+        state::camera.processMouseMovement(e->mouse_dx, -e->mouse_dy);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_SCROLL) {
+        state::camera.processMouseScroll(e->scroll_y);
+    }
+
+}
+
+sapp_desc sokol_main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    return sapp_desc {
+        .init_cb = init,
+        .frame_cb = frame,
+        .cleanup_cb = cleanup,
+        .event_cb = event,
+        .width = 800,
+        .height = 600,
+        .high_dpi = true,
+        .window_title = "Cascaded Shadow Maps - LearnOpenGL",
+        .logger {
+            .func = slog_func
+        },
+#ifdef _WIN32
+        .win32_console_utf8 = true,
+        .win32_console_attach = true,
+#endif
+    };
+}
+
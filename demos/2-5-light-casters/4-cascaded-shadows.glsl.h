@@ -0,0 +1,1117 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i .\4-cascaded-shadows.glsl -o .\4-cascaded-shadows.glsl.h -l glsl430:glsl300es
+
+    Overview:
+    =========
+    Shader program: 'phong':
+        Get shader desc: phong_shader_desc(sg_query_backend());
+        Vertex Shader: vs
+        Fragment Shader: fs
+        Attributes:
+            ATTR_phong_aPos => 0
+            ATTR_phong_aNormal => 1
+            ATTR_phong_aTexCoords => 2
+    Shader program: 'shadow':
+        Get shader desc: shadow_shader_desc(sg_query_backend());
+        Vertex Shader: shadow_vs
+        Fragment Shader: shadow_fs
+        Attributes:
+            ATTR_shadow_aPos => 0
+    Bindings:
+        Uniform block 'vs_params':
+            C struct: vs_params_t
+            Bind slot: UB_vs_params => 0
+        Uniform block 'fs_shadows':
+            C struct: fs_shadows_t
+            Bind slot: UB_fs_shadows => 7
+        Uniform block 'fs_light':
+            C struct: fs_light_t
+            Bind slot: UB_fs_light => 3
+        Uniform block 'fs_params':
+            C struct: fs_params_t
+            Bind slot: UB_fs_params => 1
+        Uniform block 'fs_material':
+            C struct: fs_material_t
+            Bind slot: UB_fs_material => 2
+        Uniform block 'vs_shadow_params':
+            C struct: vs_shadow_params_t
+            Bind slot: UB_vs_shadow_params => 0
+        Image '_shadow_map':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_DEPTH
+            Multisampled: false
+            Bind slot: IMG__shadow_map => 7
+        Image '_diffuse_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__diffuse_texture => 0
+        Image '_specular_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__specular_texture => 1
+        Sampler 'shadow_smp':
+            Type: SG_SAMPLERTYPE_COMPARISON
+            Bind slot: SMP_shadow_smp => 7
+        Sampler 'diffuse_texture_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_diffuse_texture_smp => 0
+        Sampler 'specular_texture_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_specular_texture_smp => 1
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before 4-cascaded-shadows.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define ATTR_phong_aPos (0)
+#define ATTR_phong_aNormal (1)
+#define ATTR_phong_aTexCoords (2)
+#define ATTR_shadow_aPos (0)
+#define UB_vs_params (0)
+#define UB_fs_shadows (7)
+#define UB_fs_light (3)
+#define UB_fs_params (1)
+#define UB_fs_material (2)
+#define UB_vs_shadow_params (0)
+#define IMG__shadow_map (7)
+#define IMG__diffuse_texture (0)
+#define IMG__specular_texture (1)
+#define SMP_shadow_smp (7)
+#define SMP_diffuse_texture_smp (0)
+#define SMP_specular_texture_smp (1)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
+    glm::mat4 model;
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::mat4 normalMatrix;
+} vs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_shadows_t {
+    glm::mat4 shadowMatrices[4];
+    glm::vec4 cascadeRects[4];
+    glm::vec4 cascadeSplits;
+    glm::vec4 texelWorldSize;
+    glm::vec4 shadowParams;
+} fs_shadows_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_light_t {
+    glm::vec3 direction;
+    uint8_t _pad_12[4];
+    glm::vec3 ambient;
+    uint8_t _pad_28[4];
+    glm::vec3 diffuse;
+    uint8_t _pad_44[4];
+    glm::vec3 specular;
+    uint8_t _pad_60[4];
+} fs_light_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_params_t {
+    glm::vec3 viewPos;
+    uint8_t _pad_12[4];
+} fs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_material_t {
+    float shininess;
+    uint8_t _pad_4[12];
+} fs_material_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_shadow_params_t {
+    glm::mat4 lightModelViewProjection;
+} vs_shadow_params_t;
+#pragma pack(pop)
+/*
+    #version 430
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec3 aNormal;
+    layout(location = 2) in vec2 aTexCoords;
+    layout(location = 0) out vec3 FragPos;
+    layout(location = 1) out vec3 Normal;
+    layout(location = 2) out vec2 TexCoords;
+    layout(location = 3) out float ViewDepth;
+
+    void main()
+    {
+        vec4 viewPos = mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * viewPos;
+        FragPos = vec3(mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0));
+        Normal = mat3(mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15])) * aNormal;
+        TexCoords = aTexCoords;
+        ViewDepth = -viewPos.z;
+    }
+
+*/
+static const uint8_t vs_source_glsl430[840] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,
+    0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x56,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x6f,0x73,0x20,0x3d,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,
+    0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,
+    0x76,0x69,0x65,0x77,0x50,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,
+    0x67,0x50,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x34,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x35,0x5d,0x29,0x29,
+    0x20,0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x61,0x54,0x65,0x78,
+    0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x56,0x69,0x65,0x77,
+    0x44,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x2d,0x76,0x69,0x65,0x77,0x50,0x6f,0x73,
+    0x2e,0x7a,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 fs_shadows[23];
+    uniform vec4 fs_params[1];
+    uniform vec4 fs_material[1];
+    uniform vec4 fs_light[4];
+    layout(binding = 16) uniform sampler2DShadow _shadow_map_shadow_smp;
+    layout(binding = 17) uniform sampler2D _diffuse_texture_diffuse_texture_smp;
+    layout(binding = 18) uniform sampler2D _specular_texture_specular_texture_smp;
+    layout(location = 0) in vec3 FragPos;
+    layout(location = 1) in vec3 Normal;
+    layout(location = 2) in vec2 TexCoords;
+    layout(location = 3) in float ViewDepth;
+    layout(location = 0) out vec4 FragColor;
+
+    int shadowCascade(float viewDepth)
+    {
+        int count = int(fs_shadows[22].x);
+        for (int i = 0; i < 4; i++)
+        {
+            if (i < count && viewDepth < fs_shadows[20][i])
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    float shadowFactor(vec3 worldPos, vec3 normal, float viewDepth)
+    {
+        int cascade = shadowCascade(viewDepth);
+        if (cascade < 0)
+        {
+            return 1.0;
+        }
+        vec3 offsetPos = worldPos + normal * fs_shadows[21][cascade] * fs_shadows[22].z;
+        vec4 coords = mat4(fs_shadows[cascade * 4], fs_shadows[cascade * 4 + 1], fs_shadows[cascade * 4 + 2], fs_shadows[cascade * 4 + 3]) * vec4(offsetPos, 1.0);
+        vec4 rect = fs_shadows[16 + cascade];
+        vec2 texel = 1.0 / vec2(textureSize(_shadow_map_shadow_smp, 0));
+        float depth = coords.z - fs_shadows[22].y;
+        float lit = 0.0;
+        for (int x = -1; x <= 1; x++)
+        {
+            for (int y = -1; y <= 1; y++)
+            {
+                vec2 uv = clamp(coords.xy + vec2(x, y) * texel, rect.xy, rect.zw);
+                lit += texture(_shadow_map_shadow_smp, vec3(uv, depth));
+            }
+        }
+        return lit / 9.0;
+    }
+
+    vec3 cascadeTint(float viewDepth)
+    {
+        int cascade = shadowCascade(viewDepth);
+        if (fs_shadows[22].w < 0.5 || cascade < 0)
+        {
+            return vec3(1.0);
+        }
+        vec3 tints[4] = vec3[4](vec3(1.0, 0.6, 0.6), vec3(0.6, 1.0, 0.6),
+                                vec3(0.6, 0.6, 1.0), vec3(1.0, 1.0, 0.6));
+        return tints[cascade];
+    }
+
+    void main()
+    {
+        vec3 ambient = fs_light[1].xyz * vec3(texture(_diffuse_texture_diffuse_texture_smp, TexCoords));
+        vec3 norm = normalize(Normal);
+        vec3 lightDir = normalize(-fs_light[0].xyz);
+        float diff = max(dot(norm, lightDir), 0.0);
+        vec3 diffuse = fs_light[2].xyz * diff * vec3(texture(_diffuse_texture_diffuse_texture_smp, TexCoords));
+        vec3 viewDir = normalize(fs_params[0].xyz - FragPos);
+        vec3 reflectDir = reflect(-lightDir, norm);
+        float spec = pow(max(dot(viewDir, reflectDir), 0.0), fs_material[0].x);
+        vec3 specular = fs_light[3].xyz * spec * vec3(texture(_specular_texture_specular_texture_smp, TexCoords));
+        float shadow = shadowFactor(FragPos, norm, ViewDepth);
+        vec3 result = (ambient + shadow * (diffuse + specular)) * cascadeTint(ViewDepth);
+        FragColor = vec4(result, 1.0);
+    }
+
+*/
+static const uint8_t fs_source_glsl430[2815] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x73,0x68,
+    0x61,0x64,0x6f,0x77,0x73,0x5b,0x32,0x33,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x31,
+    0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x66,0x73,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x34,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,
+    0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x53,0x68,0x61,0x64,0x6f,0x77,0x20,0x5f,0x73,0x68,0x61,0x64,0x6f,
+    0x77,0x5f,0x6d,0x61,0x70,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x73,0x6d,0x70,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x20,0x3d,0x20,0x31,0x37,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,
+    0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,
+    0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+    0x31,0x38,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,0x67,0x50,
+    0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,
+    0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x43,0x61,
+    0x73,0x63,0x61,0x64,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,
+    0x44,0x65,0x70,0x74,0x68,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x66,0x73,0x5f,
+    0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x32,0x32,0x5d,0x2e,0x78,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,
+    0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x34,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x20,0x3c,0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x26,0x26,0x20,0x76,
+    0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x20,0x3c,0x20,0x66,0x73,0x5f,0x73,0x68,
+    0x61,0x64,0x6f,0x77,0x73,0x5b,0x32,0x30,0x5d,0x5b,0x69,0x5d,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x46,0x61,0x63,0x74,
+    0x6f,0x72,0x28,0x76,0x65,0x63,0x33,0x20,0x77,0x6f,0x72,0x6c,0x64,0x50,0x6f,0x73,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x73,0x63,0x61,0x64,
+    0x65,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x43,0x61,0x73,0x63,0x61,0x64,
+    0x65,0x28,0x76,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x20,0x3c,0x20,
+    0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x50,0x6f,0x73,0x20,0x3d,0x20,0x77,0x6f,0x72,0x6c,0x64,0x50,0x6f,0x73,
+    0x20,0x2b,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x2a,0x20,0x66,0x73,0x5f,0x73,
+    0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x32,0x31,0x5d,0x5b,0x63,0x61,0x73,0x63,0x61,
+    0x64,0x65,0x5d,0x20,0x2a,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,
+    0x5b,0x32,0x32,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x63,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x66,
+    0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x63,0x61,0x73,0x63,0x61,0x64,
+    0x65,0x20,0x2a,0x20,0x34,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,
+    0x77,0x73,0x5b,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x20,0x2a,0x20,0x34,0x20,0x2b,
+    0x20,0x31,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,
+    0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x32,0x5d,
+    0x2c,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x63,0x61,0x73,
+    0x63,0x61,0x64,0x65,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x33,0x5d,0x29,0x20,0x2a,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x50,0x6f,0x73,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x72,0x65,0x63,0x74,0x20,0x3d,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,
+    0x73,0x5b,0x31,0x36,0x20,0x2b,0x20,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,
+    0x3d,0x20,0x31,0x2e,0x30,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,
+    0x5f,0x6d,0x61,0x70,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,0x73,0x2e,0x7a,
+    0x20,0x2d,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x32,0x32,
+    0x5d,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,
+    0x69,0x74,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,
+    0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x2d,0x31,0x3b,0x20,0x78,
+    0x20,0x3c,0x3d,0x20,0x31,0x3b,0x20,0x78,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,
+    0x6e,0x74,0x20,0x79,0x20,0x3d,0x20,0x2d,0x31,0x3b,0x20,0x79,0x20,0x3c,0x3d,0x20,
+    0x31,0x3b,0x20,0x79,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x75,0x76,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x63,0x6f,
+    0x6f,0x72,0x64,0x73,0x2e,0x78,0x79,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x78,
+    0x2c,0x20,0x79,0x29,0x20,0x2a,0x20,0x74,0x65,0x78,0x65,0x6c,0x2c,0x20,0x72,0x65,
+    0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x69,0x74,
+    0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x68,0x61,
+    0x64,0x6f,0x77,0x5f,0x6d,0x61,0x70,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x75,0x76,0x2c,0x20,0x64,0x65,0x70,
+    0x74,0x68,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6c,0x69,0x74,0x20,0x2f,0x20,0x39,0x2e,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
+    0x65,0x63,0x33,0x20,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x54,0x69,0x6e,0x74,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x73,0x63,0x61,
+    0x64,0x65,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x43,0x61,0x73,0x63,0x61,
+    0x64,0x65,0x28,0x76,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,
+    0x73,0x5b,0x32,0x32,0x5d,0x2e,0x77,0x20,0x3c,0x20,0x30,0x2e,0x35,0x20,0x7c,0x7c,
+    0x20,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x20,0x3c,0x20,0x30,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x74,0x69,0x6e,
+    0x74,0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x5b,0x34,0x5d,0x28,
+    0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x36,0x2c,0x20,0x30,
+    0x2e,0x36,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x36,0x2c,0x20,0x31,
+    0x2e,0x30,0x2c,0x20,0x30,0x2e,0x36,0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x36,0x2c,0x20,
+    0x30,0x2e,0x36,0x2c,0x20,0x31,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,
+    0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x36,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x69,0x6e,0x74,
+    0x73,0x5b,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x5d,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,
+    0x66,0x73,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x20,
+    0x2a,0x20,0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x20,
+    0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x2d,0x66,0x73,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x30,0x5d,0x2e,
+    0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x69,0x66,0x66,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,
+    0x6f,0x72,0x6d,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x64,
+    0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3d,0x20,0x66,0x73,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x20,
+    0x2a,0x20,0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x44,
+    0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x66,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x20,
+    0x2d,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x20,
+    0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x6c,0x69,0x67,0x68,0x74,
+    0x44,0x69,0x72,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,
+    0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x76,0x69,0x65,0x77,0x44,0x69,0x72,
+    0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x29,0x2c,0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x5b,0x30,0x5d,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3d,0x20,0x66,0x73,0x5f,0x6c,
+    0x69,0x67,0x68,0x74,0x5b,0x33,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,0x70,
+    0x65,0x63,0x20,0x2a,0x20,0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x28,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,
+    0x46,0x61,0x63,0x74,0x6f,0x72,0x28,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x2c,0x20,
+    0x6e,0x6f,0x72,0x6d,0x2c,0x20,0x56,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x20,0x3d,0x20,0x28,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x2b,0x20,0x73,
+    0x68,0x61,0x64,0x6f,0x77,0x20,0x2a,0x20,0x28,0x64,0x69,0x66,0x66,0x75,0x73,0x65,
+    0x20,0x2b,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x29,0x20,0x2a,0x20,
+    0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x54,0x69,0x6e,0x74,0x28,0x56,0x69,0x65,0x77,
+    0x44,0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 vs_shadow_params[4];
+    layout(location = 0) in vec3 aPos;
+
+    void main()
+    {
+        gl_Position = mat4(vs_shadow_params[0], vs_shadow_params[1], vs_shadow_params[2], vs_shadow_params[3]) * vec4(aPos, 1.0);
+    }
+
+*/
+static const uint8_t shadow_vs_source_glsl430[228] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x73,0x68,
+    0x61,0x64,0x6f,0x77,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,
+    0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x73,0x68,0x61,0x64,
+    0x6f,0x77,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,
+    0x77,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    void main()
+    {
+    }
+
+*/
+static const uint8_t shadow_fs_source_glsl430[32] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec3 aNormal;
+    layout(location = 2) in vec2 aTexCoords;
+    out vec3 FragPos;
+    out vec3 Normal;
+    out vec2 TexCoords;
+    out float ViewDepth;
+
+    void main()
+    {
+        vec4 viewPos = mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * viewPos;
+        FragPos = vec3(mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0));
+        Normal = mat3(mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15])) * aNormal;
+        TexCoords = aTexCoords;
+        ViewDepth = -viewPos.z;
+    }
+
+*/
+static const uint8_t vs_source_glsl300es[759] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x4e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x3b,
+    0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,
+    0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x56,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x6f,0x73,0x20,0x3d,0x20,0x6d,0x61,0x74,
+    0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x76,
+    0x69,0x65,0x77,0x50,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
+    0x50,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x6d,0x61,0x74,0x34,0x28,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x61,
+    0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x34,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x35,0x5d,0x29,0x29,0x20,
+    0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x61,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x56,0x69,0x65,0x77,0x44,
+    0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x2d,0x76,0x69,0x65,0x77,0x50,0x6f,0x73,0x2e,
+    0x7a,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 fs_shadows[23];
+    uniform highp vec4 fs_params[1];
+    uniform highp vec4 fs_material[1];
+    uniform highp vec4 fs_light[4];
+    uniform highp sampler2DShadow _shadow_map_shadow_smp;
+    uniform highp sampler2D _diffuse_texture_diffuse_texture_smp;
+    uniform highp sampler2D _specular_texture_specular_texture_smp;
+    in highp vec3 FragPos;
+    in highp vec3 Normal;
+    in highp vec2 TexCoords;
+    in highp float ViewDepth;
+    layout(location = 0) out highp vec4 FragColor;
+
+    int shadowCascade(highp float viewDepth)
+    {
+        int count = int(fs_shadows[22].x);
+        for (int i = 0; i < 4; i++)
+        {
+            if (i < count && viewDepth < fs_shadows[20][i])
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    highp float shadowFactor(highp vec3 worldPos, highp vec3 normal, highp float viewDepth)
+    {
+        int cascade = shadowCascade(viewDepth);
+        if (cascade < 0)
+        {
+            return 1.0;
+        }
+        highp vec3 offsetPos = worldPos + normal * fs_shadows[21][cascade] * fs_shadows[22].z;
+        highp vec4 coords = mat4(fs_shadows[cascade * 4], fs_shadows[cascade * 4 + 1], fs_shadows[cascade * 4 + 2], fs_shadows[cascade * 4 + 3]) * vec4(offsetPos, 1.0);
+        highp vec4 rect = fs_shadows[16 + cascade];
+        highp vec2 texel = 1.0 / vec2(textureSize(_shadow_map_shadow_smp, 0));
+        highp float depth = coords.z - fs_shadows[22].y;
+        highp float lit = 0.0;
+        for (int x = -1; x <= 1; x++)
+        {
+            for (int y = -1; y <= 1; y++)
+            {
+                highp vec2 uv = clamp(coords.xy + vec2(x, y) * texel, rect.xy, rect.zw);
+                lit += texture(_shadow_map_shadow_smp, vec3(uv, depth));
+            }
+        }
+        return lit / 9.0;
+    }
+
+    highp vec3 cascadeTint(highp float viewDepth)
+    {
+        int cascade = shadowCascade(viewDepth);
+        if (fs_shadows[22].w < 0.5 || cascade < 0)
+        {
+            return vec3(1.0);
+        }
+        highp vec3 tints[4] = vec3[4](vec3(1.0, 0.6, 0.6), vec3(0.6, 1.0, 0.6),
+                                vec3(0.6, 0.6, 1.0), vec3(1.0, 1.0, 0.6));
+        return tints[cascade];
+    }
+
+    void main()
+    {
+        highp vec3 ambient = fs_light[1].xyz * vec3(texture(_diffuse_texture_diffuse_texture_smp, TexCoords));
+        highp vec3 norm = normalize(Normal);
+        highp vec3 lightDir = normalize(-fs_light[0].xyz);
+        highp float diff = max(dot(norm, lightDir), 0.0);
+        highp vec3 diffuse = fs_light[2].xyz * diff * vec3(texture(_diffuse_texture_diffuse_texture_smp, TexCoords));
+        highp vec3 viewDir = normalize(fs_params[0].xyz - FragPos);
+        highp vec3 reflectDir = reflect(-lightDir, norm);
+        highp float spec = pow(max(dot(viewDir, reflectDir), 0.0), fs_material[0].x);
+        highp vec3 specular = fs_light[3].xyz * spec * vec3(texture(_specular_texture_specular_texture_smp, TexCoords));
+        highp float shadow = shadowFactor(FragPos, norm, ViewDepth);
+        highp vec3 result = (ambient + shadow * (diffuse + specular)) * cascadeTint(ViewDepth);
+        FragColor = vec4(result, 1.0);
+    }
+
+*/
+static const uint8_t fs_source_glsl300es[2945] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x32,0x33,0x5d,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,
+    0x6c,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x5b,0x34,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x53,0x68,0x61,
+    0x64,0x6f,0x77,0x20,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x6d,0x61,0x70,0x5f,
+    0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,
+    0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x3b,
+    0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x4e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,
+    0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,
+    0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x73,0x68,
+    0x61,0x64,0x6f,0x77,0x43,0x61,0x73,0x63,0x61,0x64,0x65,0x28,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x44,0x65,0x70,0x74,
+    0x68,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,
+    0x6e,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,
+    0x6f,0x77,0x73,0x5b,0x32,0x32,0x5d,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,
+    0x69,0x20,0x3c,0x20,0x34,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x20,
+    0x3c,0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x26,0x26,0x20,0x76,0x69,0x65,0x77,0x44,
+    0x65,0x70,0x74,0x68,0x20,0x3c,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,
+    0x73,0x5b,0x32,0x30,0x5d,0x5b,0x69,0x5d,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x46,0x61,
+    0x63,0x74,0x6f,0x72,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x77,0x6f,0x72,0x6c,0x64,0x50,0x6f,0x73,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x44,0x65,0x70,
+    0x74,0x68,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,
+    0x73,0x63,0x61,0x64,0x65,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x43,0x61,
+    0x73,0x63,0x61,0x64,0x65,0x28,0x76,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x61,0x73,0x63,0x61,0x64,
+    0x65,0x20,0x3c,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x50,0x6f,0x73,0x20,
+    0x3d,0x20,0x77,0x6f,0x72,0x6c,0x64,0x50,0x6f,0x73,0x20,0x2b,0x20,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x20,0x2a,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,
+    0x5b,0x32,0x31,0x5d,0x5b,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x5d,0x20,0x2a,0x20,
+    0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x32,0x32,0x5d,0x2e,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x63,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x66,
+    0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x63,0x61,0x73,0x63,0x61,0x64,
+    0x65,0x20,0x2a,0x20,0x34,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,
+    0x77,0x73,0x5b,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x20,0x2a,0x20,0x34,0x20,0x2b,
+    0x20,0x31,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,
+    0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x32,0x5d,
+    0x2c,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x63,0x61,0x73,
+    0x63,0x61,0x64,0x65,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x33,0x5d,0x29,0x20,0x2a,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x50,0x6f,0x73,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x72,0x65,0x63,0x74,0x20,0x3d,0x20,0x66,0x73,0x5f,
+    0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x31,0x36,0x20,0x2b,0x20,0x63,0x61,0x73,
+    0x63,0x61,0x64,0x65,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x31,0x2e,
+    0x30,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x53,0x69,0x7a,0x65,0x28,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x6d,0x61,0x70,
+    0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x30,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,0x73,
+    0x2e,0x7a,0x20,0x2d,0x20,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,
+    0x32,0x32,0x5d,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,0x74,0x20,0x3d,0x20,0x30,0x2e,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x78,
+    0x20,0x3d,0x20,0x2d,0x31,0x3b,0x20,0x78,0x20,0x3c,0x3d,0x20,0x31,0x3b,0x20,0x78,
+    0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x79,0x20,0x3d,0x20,0x2d,
+    0x31,0x3b,0x20,0x79,0x20,0x3c,0x3d,0x20,0x31,0x3b,0x20,0x79,0x2b,0x2b,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x75,0x76,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x63,0x6f,0x6f,0x72,
+    0x64,0x73,0x2e,0x78,0x79,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x78,0x2c,0x20,
+    0x79,0x29,0x20,0x2a,0x20,0x74,0x65,0x78,0x65,0x6c,0x2c,0x20,0x72,0x65,0x63,0x74,
+    0x2e,0x78,0x79,0x2c,0x20,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x69,0x74,0x20,0x2b,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x68,0x61,0x64,0x6f,
+    0x77,0x5f,0x6d,0x61,0x70,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x75,0x76,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,
+    0x69,0x74,0x20,0x2f,0x20,0x39,0x2e,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x54,
+    0x69,0x6e,0x74,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x20,0x3d,0x20,0x73,
+    0x68,0x61,0x64,0x6f,0x77,0x43,0x61,0x73,0x63,0x61,0x64,0x65,0x28,0x76,0x69,0x65,
+    0x77,0x44,0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x66,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x5b,0x32,0x32,0x5d,0x2e,
+    0x77,0x20,0x3c,0x20,0x30,0x2e,0x35,0x20,0x7c,0x7c,0x20,0x63,0x61,0x73,0x63,0x61,
+    0x64,0x65,0x20,0x3c,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x74,0x69,0x6e,
+    0x74,0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x5b,0x34,0x5d,0x28,
+    0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x36,0x2c,0x20,0x30,
+    0x2e,0x36,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x36,0x2c,0x20,0x31,
+    0x2e,0x30,0x2c,0x20,0x30,0x2e,0x36,0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x36,0x2c,0x20,
+    0x30,0x2e,0x36,0x2c,0x20,0x31,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,
+    0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x36,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x69,0x6e,0x74,
+    0x73,0x5b,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x5d,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x6d,0x62,0x69,
+    0x65,0x6e,0x74,0x20,0x3d,0x20,0x66,0x73,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x31,
+    0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,
+    0x6f,0x72,0x64,0x73,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x20,0x3d,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x69,0x7a,0x65,0x28,0x2d,0x66,0x73,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x30,
+    0x5d,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x66,0x66,0x20,0x3d,0x20,0x6d,
+    0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x2c,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x20,0x3d,0x20,0x66,0x73,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,
+    0x32,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x20,0x2a,0x20,
+    0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x64,0x69,
+    0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x64,0x69,
+    0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+    0x69,0x65,0x77,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,
+    0x78,0x79,0x7a,0x20,0x2d,0x20,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x72,
+    0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,
+    0x65,0x63,0x74,0x28,0x2d,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x2c,0x20,0x6e,
+    0x6f,0x72,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,
+    0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x76,0x69,0x65,0x77,0x44,0x69,0x72,
+    0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x29,0x2c,0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x5b,0x30,0x5d,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,
+    0x3d,0x20,0x66,0x73,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x33,0x5d,0x2e,0x78,0x79,
+    0x7a,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x20,0x2a,0x20,0x76,0x65,0x63,0x33,0x28,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
+    0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,
+    0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x61,
+    0x64,0x6f,0x77,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x46,0x61,0x63,0x74,
+    0x6f,0x72,0x28,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x2c,0x20,0x6e,0x6f,0x72,0x6d,
+    0x2c,0x20,0x56,0x69,0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x3d,0x20,0x28,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x2b,
+    0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x20,0x2a,0x20,0x28,0x64,0x69,0x66,0x66,0x75,
+    0x73,0x65,0x20,0x2b,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x29,0x20,
+    0x2a,0x20,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x54,0x69,0x6e,0x74,0x28,0x56,0x69,
+    0x65,0x77,0x44,0x65,0x70,0x74,0x68,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,
+    0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 vs_shadow_params[4];
+    layout(location = 0) in vec3 aPos;
+
+    void main()
+    {
+        gl_Position = mat4(vs_shadow_params[0], vs_shadow_params[1], vs_shadow_params[2], vs_shadow_params[3]) * vec4(aPos, 1.0);
+    }
+
+*/
+static const uint8_t shadow_vs_source_glsl300es[231] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,
+    0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x61,0x50,0x6f,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x73,
+    0x68,0x61,0x64,0x6f,0x77,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x73,0x68,
+    0x61,0x64,0x6f,0x77,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,
+    0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    void main()
+    {
+    }
+
+*/
+static const uint8_t shadow_fs_source_glsl300es[81] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+static inline const sg_shader_desc* phong_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aNormal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[7].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[7].size = 368;
+            desc.uniform_blocks[7].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[7].glsl_uniforms[0].array_count = 23;
+            desc.uniform_blocks[7].glsl_uniforms[0].glsl_name = "fs_shadows";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "fs_light";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_params";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "fs_material";
+            desc.images[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[7].image_type = SG_IMAGETYPE_2D;
+            desc.images[7].sample_type = SG_IMAGESAMPLETYPE_DEPTH;
+            desc.images[7].multisampled = false;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.samplers[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[7].sampler_type = SG_SAMPLERTYPE_COMPARISON;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 7;
+            desc.image_sampler_pairs[0].sampler_slot = 7;
+            desc.image_sampler_pairs[0].glsl_name = "_shadow_map_shadow_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 0;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_diffuse_texture_diffuse_texture_smp";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 1;
+            desc.image_sampler_pairs[2].sampler_slot = 1;
+            desc.image_sampler_pairs[2].glsl_name = "_specular_texture_specular_texture_smp";
+            desc.label = "phong_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aNormal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[7].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[7].size = 368;
+            desc.uniform_blocks[7].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[7].glsl_uniforms[0].array_count = 23;
+            desc.uniform_blocks[7].glsl_uniforms[0].glsl_name = "fs_shadows";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "fs_light";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_params";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "fs_material";
+            desc.images[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[7].image_type = SG_IMAGETYPE_2D;
+            desc.images[7].sample_type = SG_IMAGESAMPLETYPE_DEPTH;
+            desc.images[7].multisampled = false;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.samplers[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[7].sampler_type = SG_SAMPLERTYPE_COMPARISON;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 7;
+            desc.image_sampler_pairs[0].sampler_slot = 7;
+            desc.image_sampler_pairs[0].glsl_name = "_shadow_map_shadow_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 0;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_diffuse_texture_diffuse_texture_smp";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 1;
+            desc.image_sampler_pairs[2].sampler_slot = 1;
+            desc.image_sampler_pairs[2].glsl_name = "_specular_texture_specular_texture_smp";
+            desc.label = "phong_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* shadow_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)shadow_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)shadow_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 64;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_shadow_params";
+            desc.label = "shadow_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)shadow_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)shadow_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 64;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_shadow_params";
+            desc.label = "shadow_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
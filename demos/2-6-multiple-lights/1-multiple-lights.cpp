@@ -2,6 +2,7 @@
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 #include <sjd/camera.h>
+#include <sjd/normal_matrix.h>
 #include <sjd/sok_texture.h>
 
 #define SOKOL_DEBUG
@@ -33,6 +34,8 @@ namespace state {
     sg_bindings bind_light;
     sg_pass_action pass_action;
     std::vector<glm::vec3> cube_positions;
+    std::vector<glm::mat4> cube_models;
+    std::vector<glm::mat4> cube_normal_matrices;
     glm::vec3 dirLight_colour;
     glm::vec3 spotLight_colour;
     std::vector<glm::vec3> light_colours;
@@ -90,6 +93,18 @@ static void init(void) {
         glm::vec3(-1.3f,  1.0f, -1.5f),
     };
 
+    // the cubes never move so their model and normal matrices can be
+    // worked out once here instead of every frame
+    for (size_t i {0}; i < state::cube_positions.size(); i++) {
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), state::cube_positions[i]);
+        float angle = 20.0f * i;
+        state::cube_models.push_back(glm::rotate(model, angle, glm::vec3(1.0f, 0.3f, 0.5f)));
+    }
+    state::cube_normal_matrices.resize(state::cube_models.size());
+    sjd::computeNormalMatrices(state::cube_models.data(),
+                               state::cube_normal_matrices.data(),
+                               state::cube_models.size());
+
     std::vector<float> vertices {
         // positions          // normals           // texture coords
         -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
@@ -295,25 +310,20 @@ void frame(void) {
     };
     sg_apply_uniforms(UB_fs_spot_light, SG_RANGE(fs_spot_light));
 
-    int i {0};
-    for (glm::vec3 position : state::cube_positions) {
-
-        glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
-        float angle = 20.0f * i;
-        model = glm::rotate(model, angle, glm::vec3(1.0f, 0.3f, 0.5f));
-        vs_params.model = model;
+    for (size_t i {0}; i < state::cube_models.size(); i++) {
+        vs_params.model = state::cube_models[i];
+        vs_params.normalMatrix = state::cube_normal_matrices[i];
 
         sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
 
         sg_draw(0, 36, 1);
-        ++i;
     }
 
     // Prepare and draw object
     sg_apply_pipeline(state::pip_light);
     sg_apply_bindings(state::bind_light);
     
-    i = 0;
+    int i {0};
     for (glm::vec3 light_pos : state::light_positions) {
         light_cube_fs_params_t light_cube_fs_params = {
             .lightColour {state::light_colours[i]}
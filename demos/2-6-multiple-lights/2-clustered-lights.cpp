@@ -0,0 +1,644 @@
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <random>
+#include <sjd/camera.h>
+#include <sjd/clustered_lights.h>
+#include <sjd/depth_prepass.h>
+#include <sjd/dynamic_resolution.h>
+#include <sjd/jobs.h>
+#include <sjd/normal_matrix.h>
+#include <sjd/occlusion.h>
+#include <sjd/post.h>
+#include <sjd/profiler.h>
+#include <sjd/render_graph.h>
+#include <sjd/sok_texture.h>
+#include <iostream>
+#include <string>
+
+#define SOKOL_DEBUG
+#define SOKOL_IMPL
+#ifndef __EMSCRIPTEN__
+#define SOKOL_GLCORE
+#else
+#define SOKOL_GLES3
+#endif
+#include <sokol/sokol_app.h>
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_log.h>
+#include <sokol/sokol_fetch.h>
+#include <sokol/sokol_glue.h>
+#include <sokol/sokol_time.h>
+
+// add the shader after glm
+#include "2-clustered-lights.glsl.h"
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+/* Same lighting as 1-multiple-lights but with a few hundred point lights
+ * instead of four. The lights are binned into view-space clusters on the
+ * CPU every frame (sjd/clustered_lights.h) and each fragment only shades
+ * the lights that can reach its cluster.
+ *
+ * The scene is drawn below the window size when frames take too long
+ * (sjd/dynamic_resolution.h) and sharpened back up to the window, R turns
+ * that off.
+ *
+ * P switches the depth pre-pass (sjd/depth_prepass.h) on and off and prints
+ * the frame times with and without it. The grid of cubes hides a lot of
+ * floor, so the lighting shader gets run far less often with it on.
+ *
+ * The floor and cubes are also rasterised on the CPU into a small depth
+ * buffer (sjd/occlusion.h) and cubes and light cubes hidden behind them
+ * aren't drawn at all, O switches that and prints how many were culled.
+ *
+ * F9 starts the profiler (sjd/profiler.h), pressing it again writes
+ * trace.json for chrome://tracing or Perfetto.
+ */
+namespace state {
+    sg_pipeline pip_object;
+    sg_pipeline pip_object_equal;
+    sg_pipeline pip_light;
+    sg_pipeline pip_depth;
+    sg_bindings bind_object;
+    sg_bindings bind_light;
+    sg_bindings bind_depth;
+    sjd::DepthPrepass prepass;
+    sjd::OcclusionCuller occlusion;
+    bool occlusion_culling {true};
+    // the cube as a triangle list for the occlusion buffer
+    std::vector<glm::vec3> occluder;
+    std::vector<char> cube_visible;
+    sg_pass_action pass_action;
+    sjd::RenderGraph graph;
+    sjd::RenderGraph::PassId scene_pass;
+    sjd::PostProcess post;
+    sjd::DynamicResolution resolution;
+    bool dynamic_resolution {true};
+    std::vector<glm::mat4> cube_models;
+    std::vector<glm::mat4> cube_normal_matrices;
+    glm::vec3 dirLight_colour;
+    // every light that goes through the clusters, the last one is the torch
+    std::vector<sjd::ClusterLight> lights;
+    std::vector<glm::vec3> light_orbits;
+    sjd::ClusteredLights clusters;
+    unsigned bin_threads {1};
+    sjd::Camera camera(glm::vec3(0.0f, 3.0f, 12.0f));
+    bool spotlight {true};
+    float time {};
+    uint64_t last_time;
+    float deltaTime;
+}
+namespace offscreen {
+    sjd::RenderGraph::Target color;
+    sjd::RenderGraph::Target depth;
+}
+
+const int NR_POINT_LIGHTS {256};
+const int GRID_SIZE {11};
+
+static void fail_callback() {
+    state::pass_action = sg_pass_action {
+        .colors = {{ .load_action=SG_LOADACTION_CLEAR,
+            .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f }
+        }}
+    };
+    state::graph.setPassAction(state::scene_pass, state::pass_action);
+}
+
+static void draw_scene();
+
+// the scene goes into a target that follows the render scale, the upscale
+// pass fills the whole window so the swapchain doesn't need clearing
+static void create_render_graph() {
+    offscreen::color = state::graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = SG_PIXELFORMAT_RGBA8,
+        .scale = state::resolution.scale(),
+        .label = "color-image"
+    });
+    offscreen::depth = state::graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = SG_PIXELFORMAT_DEPTH,
+        .scale = state::resolution.scale(),
+        .label = "depth-image"
+    });
+
+    state::scene_pass = state::graph.addPass(sjd::RenderGraph::PassDesc {
+        .name = "scene-pass",
+        .colors = {offscreen::color},
+        .depth = offscreen::depth,
+        .action = state::pass_action,
+    }, draw_scene);
+
+    state::post.addUpscale(state::graph, offscreen::color, sg_pass_action {
+        .colors = {{ .load_action = SG_LOADACTION_DONTCARE }}
+    });
+}
+
+static void set_render_scale(float scale) {
+    state::graph.setTargetScale(offscreen::color, scale);
+    state::graph.setTargetScale(offscreen::depth, scale);
+    std::string title {"Clustered Lights - LearnOpenGL ("};
+    title += state::dynamic_resolution ? std::to_string(static_cast<int>(scale * 100.0f + 0.5f)) + "%)" : "native)";
+    sapp_set_window_title(title.c_str());
+}
+
+static void init(void) {
+    sg_setup(sg_desc {
+        .logger {
+            .func = slog_func
+        },
+        .environment = sglue_environment(),
+    });
+
+    sfetch_setup(sfetch_desc_t {
+        .max_requests = 8,
+        .num_channels = 1,
+        .num_lanes = 1,
+        .logger {
+            .func = slog_func
+        },
+    });
+
+    stm_setup();
+
+    // aim for 60fps and never go below half the window size
+    state::resolution.setup(sjd::DynamicResolutionSettings {
+        .targetFrameTime = 1.0 / 60.0,
+        .minScale = 0.5f,
+    });
+
+    state::clusters.setup();
+    // the workers are already running, so every one of them can help
+    state::bin_threads = sjd::JobSystem::instance().threadCount();
+
+    // a floor with a grid of cubes on it, none of them move so the model
+    // and normal matrices are worked out once here
+    state::cube_models.push_back(glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -1.0f, 0.0f)),
+                                            glm::vec3(GRID_SIZE * 2.0f, 0.2f, GRID_SIZE * 2.0f)));
+    for (int x {0}; x < GRID_SIZE; x++) {
+        for (int z {0}; z < GRID_SIZE; z++) {
+            glm::vec3 position {(x - GRID_SIZE / 2) * 2.0f, -0.4f, (z - GRID_SIZE / 2) * 2.0f};
+            glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+            float angle = 20.0f * (x * GRID_SIZE + z);
+            state::cube_models.push_back(glm::rotate(model, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f)));
+        }
+    }
+    state::cube_normal_matrices.resize(state::cube_models.size());
+    sjd::computeNormalMatrices(state::cube_models.data(),
+                               state::cube_normal_matrices.data(),
+                               state::cube_models.size());
+
+    // point lights circling at random heights, x = radius, y = height, z = phase
+    std::mt19937 rng {42};
+    std::uniform_real_distribution<float> unit {0.0f, 1.0f};
+    for (int i {0}; i < NR_POINT_LIGHTS; i++) {
+        state::light_orbits.push_back(glm::vec3(unit(rng) * GRID_SIZE,
+                                                0.2f + unit(rng) * 1.5f,
+                                                unit(rng) * glm::two_pi<float>()));
+        glm::vec3 colour {unit(rng), unit(rng), unit(rng)};
+        state::lights.push_back(sjd::ClusterLight {
+            .position = glm::vec3(0.0f),
+            .range = 2.5f,
+            .colour = glm::normalize(colour) * 2.0f,
+        });
+    }
+    // torch
+    state::lights.push_back(sjd::ClusterLight {
+        .range = 20.0f,
+        .cutOff = glm::cos(glm::radians(12.5f)),
+        .outerCutOff = glm::cos(glm::radians(17.5f)),
+    });
+
+    std::vector<float> vertices {
+        // positions          // normals           // texture coords
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
+         0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
+
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
+
+        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+
+        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
+
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f
+    };
+    sg_buffer cube_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = vertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = vertices.data(),
+            .size = vertices.size() * sizeof(float),
+        },
+        .label = "cube-vertices"
+    });
+
+    state::bind_object.vertex_buffers[0] = cube_buffer;
+    state::bind_light.vertex_buffers[0] = cube_buffer;
+
+    // the pre-pass only needs positions, a third of the vertex data
+    std::vector<float> positions {sjd::DepthPrepass::positions(vertices, 8)};
+    for (size_t i {0}; i + 2 < positions.size(); i += 3)
+        state::occluder.push_back(glm::vec3(positions[i], positions[i + 1], positions[i + 2]));
+    state::cube_visible.resize(state::cube_models.size(), 1);
+    state::bind_depth.vertex_buffers[0] = sg_make_buffer(sg_buffer_desc {
+        .size = positions.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = positions.data(),
+            .size = positions.size() * sizeof(float),
+        },
+        .label = "cube-positions"
+    });
+
+    state::clusters.applyBindings(state::bind_object,
+                                  IMG__light_texture,
+                                  IMG__cluster_texture,
+                                  IMG__index_texture,
+                                  SMP_cluster_smp);
+
+    // create shader from code-generated sg_shader_desc
+    sg_shader phong_shd = sg_make_shader(phong_shader_desc(sg_query_backend()));
+
+    // we need to initialise layout seperately to the pipeline
+    // because we cant do array initilisation of structs in C++
+    sg_vertex_layout_state layout {};
+    layout.attrs[ATTR_phong_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    layout.attrs[ATTR_phong_aNormal].format = SG_VERTEXFORMAT_FLOAT3;
+    layout.attrs[ATTR_phong_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
+
+    sg_pipeline_desc object_desc {
+        .shader = phong_shd,
+        .layout = layout,
+        .depth {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+        },
+        .color_count = 1,
+        .colors = {{
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+        }},
+        .label = "object-pipeline"
+    };
+    state::pip_object = sg_make_pipeline(object_desc);
+    // shading after the pre-pass, only where the depth matches
+    object_desc.label = "object-equal-pipeline";
+    state::pip_object_equal = sg_make_pipeline(sjd::DepthPrepass::equalPipeline(object_desc));
+
+    sg_shader depth_shd = sg_make_shader(depth_shader_desc(sg_query_backend()));
+    sg_vertex_layout_state depth_layout {};
+    depth_layout.attrs[ATTR_depth_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    state::pip_depth = sg_make_pipeline(sjd::DepthPrepass::depthPipeline(sg_pipeline_desc {
+        .shader = depth_shd,
+        .layout = depth_layout,
+        .depth {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+        },
+        .color_count = 1,
+        .colors = {{
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+        }},
+        .label = "depth-prepass-pipeline"
+    }));
+    // create shader from code-generated sg_shader_desc
+    sg_shader light_cube_shd = sg_make_shader(light_cube_shader_desc(sg_query_backend()));
+
+    state::pip_light = sg_make_pipeline(sg_pipeline_desc {
+        .shader = light_cube_shd,
+        .layout = layout,
+        .depth {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+        },
+        .color_count = 1,
+        .colors = {{
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+        }},
+        .label = "light-pipeline"
+    });
+
+    state::post.setup(sjd::PostProcess::Shaders {
+        .upscale = sg_make_shader(post_upscale_shader_desc(sg_query_backend())),
+    }, SG_PIXELFORMAT_RGBA8);
+
+    // a pass action to clear framebuffer
+    state::pass_action = sg_pass_action {
+        .colors = {{
+            .load_action=SG_LOADACTION_CLEAR,
+            .clear_value={0.05f, 0.05f, 0.05f, 1.0f}
+        }}
+    };
+
+    create_render_graph();
+    set_render_scale(state::resolution.scale());
+
+    SokTexture container2("../data/container2.png",
+                          state::bind_object,
+                          IMG__diffuse_texture,
+                          SMP_diffuse_texture_smp,
+                          true,
+                          fail_callback);
+
+    SokTexture container2_specular("../data/container2_specular.png",
+                                   state::bind_object,
+                                   IMG__specular_texture,
+                                   SMP_specular_texture_smp,
+                                   true,
+                                   fail_callback);
+
+}
+
+void frame(void) {
+    sjd::Profiler::instance().beginFrame();
+    {
+        SJD_PROFILE_SCOPE("sfetch_dowork");
+        sfetch_dowork();
+    }
+
+    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
+    state::time += state::deltaTime;
+
+    state::dirLight_colour = glm::vec3(0.1f);
+
+    if (!sapp_mouse_locked()) {
+        sapp_lock_mouse(true);
+    }
+    state::camera.moveCamera(state::deltaTime);
+
+    for (int i {0}; i < NR_POINT_LIGHTS; i++) {
+        glm::vec3 orbit {state::light_orbits[i]};
+        float angle {orbit.z + state::time * 0.3f};
+        state::lights[i].position = glm::vec3(glm::cos(angle) * orbit.x,
+                                              orbit.y,
+                                              glm::sin(angle) * orbit.x);
+    }
+    sjd::ClusterLight& torch {state::lights.back()};
+    torch.position = state::camera.pos;
+    torch.direction = state::camera.front;
+    torch.colour = state::spotlight ? glm::vec3(1.0f) : glm::vec3(0.0f);
+
+    float fovy {glm::radians(state::camera.zoom)};
+    float aspect {static_cast<float>(sapp_width()) / sapp_height()};
+    glm::mat4 view = state::camera.getViewMatrix();
+
+    // bin the lights and upload the lists before the pass starts
+    {
+        SJD_PROFILE_SCOPE("bin-lights");
+        state::clusters.setProjection(fovy, aspect, 0.1f, 100.0f);
+        state::clusters.bin(view, state::lights, state::bin_threads);
+        state::clusters.upload();
+    }
+
+    // every cube is an occluder, the floor goes in last since it's behind
+    // most of them. The floor itself is too big to be worth testing.
+    if (state::occlusion_culling) {
+        SJD_PROFILE_SCOPE("occlusion");
+        glm::mat4 projection = glm::perspective(fovy, aspect, 0.1f, 100.0f);
+        state::occlusion.begin(projection * view);
+        for (size_t i {state::cube_models.size()}; i-- > 0;)
+            state::occlusion.addOccluder(state::occluder, state::cube_models[i]);
+        state::occlusion.rasterize(state::bin_threads);
+        for (size_t i {1}; i < state::cube_models.size(); i++)
+            state::cube_visible[i] = state::occlusion.boxVisible(glm::vec3(-0.5f), glm::vec3(0.5f), state::cube_models[i]);
+    }
+
+    // a new scale takes effect from this frame, the graph remakes the
+    // targets when it runs
+    if (state::dynamic_resolution && state::resolution.update(state::deltaTime))
+        set_render_scale(state::resolution.scale());
+    state::prepass.record(state::deltaTime);
+
+    state::graph.execute(sglue_swapchain());
+    {
+        SJD_PROFILE_SCOPE("sg_commit");
+        sg_commit();
+    }
+    sjd::Profiler::instance().endFrame();
+}
+
+static void draw_scene() {
+    float fovy {glm::radians(state::camera.zoom)};
+    float aspect {static_cast<float>(sapp_width()) / sapp_height()};
+    glm::mat4 view = state::camera.getViewMatrix();
+    glm::mat4 projection = glm::perspective(fovy, aspect, 0.1f, 100.0f);
+
+    vs_params_t vs_params = {
+        .view = view,
+        .projection = projection
+    };
+
+    // lay down the depth of everything the lighting shader would draw, the
+    // light cubes are cheap and just depth test as usual afterwards
+    if (state::prepass.enabled) {
+        sg_apply_pipeline(state::pip_depth);
+        sg_apply_bindings(state::bind_depth);
+        for (size_t i {0}; i < state::cube_models.size(); i++) {
+            if (state::occlusion_culling && !state::cube_visible[i])
+                continue;
+            vs_params.model = state::cube_models[i];
+            sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+            sg_draw(0, 36, 1);
+            state::prepass.countDraw();
+        }
+    }
+
+    // Prepare and draw object
+    sg_apply_pipeline(state::prepass.enabled ? state::pip_object_equal : state::pip_object);
+    sg_apply_bindings(state::bind_object);
+
+    fs_params_t fs_params = {
+        .viewPos {state::camera.pos}
+    };
+    sg_apply_uniforms(UB_fs_params, SG_RANGE(fs_params));
+
+    fs_material_t fs_material = {
+        .shininess = 32.0f,
+    };
+    sg_apply_uniforms(UB_fs_material, SG_RANGE(fs_material));
+
+    fs_dir_light_t fs_dir_light = {
+        .direction = glm::vec3(-0.2f, -1.0f, -0.3f),
+        .ambient = state::dirLight_colour * 0.2f,
+        .diffuse = state::dirLight_colour * 0.5f,
+        .specular = state::dirLight_colour * 1.0f,
+    };
+    sg_apply_uniforms(UB_fs_dir_light, SG_RANGE(fs_dir_light));
+
+    // the tiles are worked out from gl_FragCoord, so they need the size of
+    // the target rather than the window
+    fs_clusters_t fs_clusters = {
+        .clusterParams = glm::vec4(state::clusters.sliceScale(),
+                                   state::clusters.sliceBias(),
+                                   static_cast<float>(state::graph.width(offscreen::color)),
+                                   static_cast<float>(state::graph.height(offscreen::color))),
+    };
+    sg_apply_uniforms(UB_fs_clusters, SG_RANGE(fs_clusters));
+
+    for (size_t i {0}; i < state::cube_models.size(); i++) {
+        if (state::occlusion_culling && !state::cube_visible[i])
+            continue;
+        vs_params.model = state::cube_models[i];
+        vs_params.normalMatrix = state::cube_normal_matrices[i];
+
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+
+        sg_draw(0, 36, 1);
+    }
+
+    // Prepare and draw lights
+    sg_apply_pipeline(state::pip_light);
+    sg_apply_bindings(state::bind_light);
+
+    for (int i {0}; i < NR_POINT_LIGHTS; i++) {
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), state::lights[i].position);
+        model = glm::scale(model, glm::vec3(0.05f));
+        if (state::occlusion_culling && !state::occlusion.boxVisible(glm::vec3(-0.5f), glm::vec3(0.5f), model))
+            continue;
+        light_cube_fs_params_t light_cube_fs_params = {
+            .lightColour {state::lights[i].colour}
+        };
+        sg_apply_uniforms(UB_light_cube_fs_params, SG_RANGE(light_cube_fs_params));
+        vs_params.model = model;
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+
+        sg_draw(0, 36, 1);
+    }
+}
+
+void cleanup(void) {
+    sjd::Profiler::instance().finish("trace.json");
+    state::prepass.report();
+    state::occlusion.report();
+    state::resolution.report();
+    state::graph.report();
+    state::post.shutdown();
+    state::clusters.shutdown();
+    sfetch_shutdown();
+    sg_shutdown();
+}
+
+void event(const sapp_event* e) {
+    if (e->type == SAPP_EVENTTYPE_KEY_DOWN) {
+        if (e->key_code == SAPP_KEYCODE_ESCAPE) {
+            sapp_request_quit();
+        }
+        if (e->key_code == SAPP_KEYCODE_F) {
+            state::spotlight = !state::spotlight;
+        }
+        if (e->key_code == SAPP_KEYCODE_P) {
+            state::prepass.report();
+            state::prepass.enabled = !state::prepass.enabled;
+            std::cout << "Depth pre-pass " << (state::prepass.enabled ? "on" : "off") << "\n";
+        }
+        if (e->key_code == SAPP_KEYCODE_F9)
+            sjd::Profiler::instance().startOrWrite("trace.json");
+        if (e->key_code == SAPP_KEYCODE_O) {
+            state::occlusion.report();
+            state::occlusion_culling = !state::occlusion_culling;
+            std::cout << "Occlusion culling " << (state::occlusion_culling ? "on" : "off") << "\n";
+        }
+        if (e->key_code == SAPP_KEYCODE_R) {
+            state::dynamic_resolution = !state::dynamic_resolution;
+            state::resolution.reset(1.0f);
+            set_render_scale(state::resolution.scale());
+        }
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::PRESS);
+    }
+
+    if (e->type == SAPP_EVENTTYPE_KEY_UP) {
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::RELEASE);
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_BEGAN) {
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_MOVED) {
+        float offsetX = e -> touches[0].pos_x - state::camera.lastX;
+        float offsetY = state::camera.lastY - e -> touches[0].pos_y;
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+        state::camera.processMouseMovement(offsetX, offsetY);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+        state::camera.processMouseMovement(e->mouse_dx, -e->mouse_dy);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_SCROLL) {
+        state::camera.processMouseScroll(e->scroll_y);
+    }
+
+}
+
+sapp_desc sokol_main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    return sapp_desc {
+        .init_cb = init,
+        .frame_cb = frame,
+        .cleanup_cb = cleanup,
+        .event_cb = event,
+        .width = 800,
+        .height = 600,
+        .high_dpi = true,
+        .window_title = "Clustered Lights - LearnOpenGL",
+        .logger {
+            .func = slog_func
+        },
+#ifdef _WIN32
+        .win32_console_utf8 = true,
+        .win32_console_attach = true,
+#endif
+    };
+}
+
@@ -0,0 +1,226 @@
+@ctype mat4 glm::mat4
+@ctype vec3 glm::vec3
+@ctype vec4 glm::vec4
+
+@include ../../include/sjd/glsl/post.glsl
+
+@block transform
+layout(binding = 0) uniform vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+    mat4 normalMatrix;
+};
+
+// the depth pre-pass and the shading pass must get exactly the same depth
+// for the EQUAL test, so both work it out here
+invariant gl_Position;
+
+vec4 viewPosition(vec3 position) {
+    return view * model * vec4(position, 1.0);
+}
+@end
+
+@vs vs
+@include_block transform
+in vec3 aPos;
+in vec3 aNormal;
+in vec2 aTexCoords;
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoords;
+out float ViewDepth;
+
+void main() {
+    vec4 viewPos = viewPosition(aPos);
+    gl_Position = projection * viewPos;
+    FragPos = vec3(model * vec4(aPos, 1.0));
+    Normal = mat3(normalMatrix) * aNormal; 
+    TexCoords = aTexCoords;
+    ViewDepth = -viewPos.z;
+}
+@end
+
+@fs fs
+in vec3 FragPos;
+in vec3 Normal;
+in vec2 TexCoords;
+in float ViewDepth;
+
+out vec4 FragColor;
+
+layout(binding = 1) uniform fs_params {
+    vec3 viewPos;
+};
+
+layout(binding = 2) uniform fs_material {
+    float shininess;
+} material;
+
+layout(binding = 3) uniform fs_dir_light {
+    vec3 direction;
+
+    vec3 ambient;
+    vec3 diffuse;
+    vec3 specular;
+} dirLight;
+
+layout(binding = 4) uniform fs_clusters {
+    // x = slice scale, y = slice bias, zw = framebuffer size
+    vec4 clusterParams;
+};
+
+// must match sjd::ClusteredLights
+const int TILES_X = 16;
+const int TILES_Y = 9;
+const int SLICES = 24;
+const int INDEX_TEXTURE_WIDTH = 1024;
+
+layout(binding = 0) uniform texture2D _diffuse_texture;
+layout(binding = 0) uniform sampler diffuse_texture_smp;
+#define diffuse_texture sampler2D(_diffuse_texture, diffuse_texture_smp)
+layout(binding = 1) uniform texture2D _specular_texture;
+layout(binding = 1) uniform sampler specular_texture_smp;
+#define specular_texture sampler2D(_specular_texture, specular_texture_smp)
+
+// float data textures, only ever read with texelFetch
+@image_sample_type _light_texture unfilterable_float
+@image_sample_type _cluster_texture unfilterable_float
+@image_sample_type _index_texture unfilterable_float
+@sampler_type cluster_smp nonfiltering
+layout(binding = 2) uniform texture2D _light_texture;
+layout(binding = 3) uniform texture2D _cluster_texture;
+layout(binding = 4) uniform texture2D _index_texture;
+layout(binding = 2) uniform sampler cluster_smp;
+#define light_texture sampler2D(_light_texture, cluster_smp)
+#define cluster_texture sampler2D(_cluster_texture, cluster_smp)
+#define index_texture sampler2D(_index_texture, cluster_smp)
+
+vec3 calcDirLight(vec3 normal, vec3 viewDir, vec3 diffuseColour, vec3 specularColour);
+vec3 calcClusterLight(int light, vec3 normal, vec3 fragPos, vec3 viewDir, vec3 diffuseColour, vec3 specularColour);
+
+void main() {
+
+    // Properties
+    vec3 norm = normalize(Normal);
+    vec3 viewDir = normalize(viewPos - FragPos);
+    // the textures are the same for every light so only sample them once
+    vec3 diffuseColour = texture(diffuse_texture, TexCoords).rgb;
+    vec3 specularColour = texture(specular_texture, TexCoords).rgb;
+
+    // Directional lighting
+    vec3 result = calcDirLight(norm, viewDir, diffuseColour, specularColour);
+
+    // find this fragment's cluster
+    vec2 tile = gl_FragCoord.xy / clusterParams.zw * vec2(TILES_X, TILES_Y);
+    int tileX = clamp(int(tile.x), 0, TILES_X - 1);
+    int tileY = clamp(int(tile.y), 0, TILES_Y - 1);
+    int slice = clamp(int(log(ViewDepth) * clusterParams.x - clusterParams.y), 0, SLICES - 1);
+    vec2 cluster = texelFetch(cluster_texture, ivec2(tileY * TILES_X + tileX, slice), 0).xy;
+
+    // Point and spot lights touching the cluster
+    int offset = int(cluster.x);
+    int count = int(cluster.y);
+    for (int i = 0; i < count; i++) {
+        int index = offset + i;
+        int light = int(texelFetch(index_texture, ivec2(index % INDEX_TEXTURE_WIDTH, index / INDEX_TEXTURE_WIDTH), 0).r);
+        result += calcClusterLight(light, norm, FragPos, viewDir, diffuseColour, specularColour);
+    }
+
+    FragColor = vec4(result, 1.0);
+}
+
+vec3 calcDirLight(vec3 normal, vec3 viewDir, vec3 diffuseColour, vec3 specularColour) {
+    vec3 lightDir = normalize(-dirLight.direction);
+
+    // diffuse shading
+    float diff = max(dot(normal, lightDir), 0.0);
+
+    // specular shading
+    vec3 reflectDir = reflect(-lightDir, normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
+
+    // combine results
+    vec3 ambient = dirLight.ambient * diffuseColour;
+    vec3 diffuse = dirLight.diffuse * diff * diffuseColour;
+    vec3 specular = dirLight.specular * spec * specularColour;
+    return (ambient + diffuse + specular);
+}
+
+vec3 calcClusterLight(int light, vec3 normal, vec3 fragPos, vec3 viewDir, vec3 diffuseColour, vec3 specularColour) {
+    vec4 positionRange = texelFetch(light_texture, ivec2(0, light), 0);
+    vec3 colour = texelFetch(light_texture, ivec2(1, light), 0).rgb;
+    vec4 directionCutOff = texelFetch(light_texture, ivec2(2, light), 0);
+    float outerCutOff = texelFetch(light_texture, ivec2(3, light), 0).x;
+
+    vec3 lightDir = normalize(positionRange.xyz - fragPos);
+
+    // point lights have cutOff -1 and outerCutOff -2 so this is always 1
+    float theta = dot(lightDir, normalize(-directionCutOff.xyz));
+    float epsilon = directionCutOff.w - outerCutOff;
+    float intensity = clamp((theta - outerCutOff) / epsilon, 0.0, 1.0);
+
+    float diff = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse = colour * diff * diffuseColour;
+
+    vec3 reflectDir = reflect(-lightDir, normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
+    vec3 specular = colour * spec * specularColour;
+
+    // inverse square falloff windowed so it reaches zero at the light's range,
+    // otherwise the cluster bounds would cut it off with a visible edge
+    float distance = length(positionRange.xyz - fragPos);
+    float window = clamp(1.0 - pow(distance / positionRange.w, 4.0), 0.0, 1.0);
+    float attenuation = window * window / (1.0 + distance * distance);
+
+    return (diffuse + specular) * attenuation * intensity;
+}
+
+@end
+
+@vs light_cube_vs
+in vec3 aPos;
+
+layout(binding = 0) uniform vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+    mat4 normalMatrix;
+};
+
+void main() {
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
+}
+@end
+
+@fs light_cube_fs
+out vec4 FragColor;
+
+layout(binding = 1) uniform light_cube_fs_params {
+    vec3 lightColour;
+};
+
+void main() {
+    FragColor = vec4(lightColour, 1.0);
+}
+@end
+
+@vs depth_vs
+@include_block transform
+in vec3 aPos;
+
+void main() {
+    gl_Position = projection * viewPosition(aPos);
+}
+@end
+
+// depth only, colour writes are off in the pipeline
+@fs depth_fs
+void main() {
+}
+@end
+
+@program phong vs fs
+@program depth depth_vs depth_fs
+@program light_cube light_cube_vs light_cube_fs
@@ -0,0 +1,649 @@
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <random>
+#include <sjd/camera.h>
+#include <sjd/icosahedron.h>
+#include <sjd/normal_matrix.h>
+#include <sjd/sok_texture.h>
+
+#define SOKOL_DEBUG
+#define SOKOL_IMPL
+#ifndef __EMSCRIPTEN__
+#define SOKOL_GLCORE
+#else
+#define SOKOL_GLES3
+#endif
+#include <sokol/sokol_app.h>
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_log.h>
+#include <sokol/sokol_fetch.h>
+#include <sokol/sokol_glue.h>
+#include <sokol/sokol_time.h>
+
+// add the shader after glm
+#include "3-deferred.glsl.h"
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+/* Deferred version of 1-multiple-lights
+ *   pass 1: the cubes write albedo/specular and a packed normal into the
+ *           G-buffer (two RGBA8 targets + depth)
+ *   pass 2: a fullscreen quad does the directional light and the torch,
+ *           then every point light draws an instanced icosahedron that is
+ *           blended additively over the pixels it can reach
+ * Point light cost now follows the number of pixels each light covers
+ * instead of every fragment looping over every light.
+ */
+struct LightInstance {
+    glm::vec4 positionRange;
+    glm::vec4 colour;
+};
+
+const int NR_POINT_LIGHTS {64};
+// an icosahedron with its vertices on the unit sphere only reaches 0.79 at
+// the middle of its faces, scale it up so the whole light range is covered
+const float VOLUME_RADIUS {1.0f / 0.7946545f};
+
+namespace state {
+    sg_pipeline pip_ambient;
+    sg_pipeline pip_volume;
+    sg_bindings bind_ambient;
+    sg_bindings bind_volume;
+    sg_buffer light_instances;
+    sg_pass_action pass_action;
+    std::vector<glm::vec3> cube_positions;
+    std::vector<glm::mat4> cube_models;
+    std::vector<glm::mat4> cube_normal_matrices;
+    glm::vec3 dirLight_colour;
+    glm::vec3 spotLight_colour;
+    std::vector<LightInstance> lights;
+    // x, y, z = orbit centre, w = phase, the first four lights don't move
+    std::vector<glm::vec4> light_orbits;
+    sjd::Camera camera(glm::vec3(0.2f, 0.8f, 4.0f));
+    bool spotlight {true};
+    float time {};
+    uint64_t last_time;
+    float deltaTime;
+}
+namespace offscreen {
+    sg_attachments attachment;
+    sg_attachments_desc attachment_desc;
+    sg_sampler sampler;
+    sg_pipeline pip_object;
+    sg_pipeline pip_light;
+    sg_bindings bind_object;
+    sg_bindings bind_light;
+    sg_pass_action pass_action;
+}
+
+static void fail_callback() {
+    state::pass_action = sg_pass_action {
+        .colors = {{ .load_action=SG_LOADACTION_CLEAR,
+            .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f }
+        }}
+    };
+}
+
+// called initially and when window size changes
+void create_offscreen_pass(int width, int height) {
+    // destroy previous resource
+    sg_destroy_attachments(offscreen::attachment);
+    sg_destroy_image(offscreen::attachment_desc.colors[0].image);
+    sg_destroy_image(offscreen::attachment_desc.colors[1].image);
+    sg_destroy_image(offscreen::attachment_desc.depth_stencil.image);
+
+    sg_image_desc albedo_img_desc = {
+        .render_target = true,
+        .width = width,
+        .height = height,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .label = "gbuffer-albedo-spec"
+    };
+    sg_image albedo_img = sg_make_image(albedo_img_desc);
+
+    sg_image_desc normal_img_desc = albedo_img_desc;
+    normal_img_desc.label = "gbuffer-normal";
+    sg_image normal_img = sg_make_image(normal_img_desc);
+
+    sg_image_desc depth_img_desc = albedo_img_desc;
+    depth_img_desc.pixel_format = SG_PIXELFORMAT_DEPTH;
+    depth_img_desc.label = "gbuffer-depth";
+    sg_image depth_img = sg_make_image(depth_img_desc);
+
+    // everything is read with texelFetch so one sampler does for all sizes
+    if (offscreen::sampler.id == SG_INVALID_ID) {
+        offscreen::sampler = sg_make_sampler(sg_sampler_desc {
+            .min_filter = SG_FILTER_NEAREST,
+            .mag_filter = SG_FILTER_NEAREST,
+            .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+            .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+            .label = "gbuffer-sampler"
+        });
+    }
+
+    offscreen::attachment_desc = sg_attachments_desc {
+        .colors {
+            { .image = albedo_img },
+            { .image = normal_img },
+        },
+        .depth_stencil {
+            .image = depth_img,
+        },
+        .label = "gbuffer-pass"
+    };
+    offscreen::attachment = sg_make_attachments(offscreen::attachment_desc);
+
+    // both lighting passes read the G-buffer
+    for (sg_bindings* bind : {&state::bind_ambient, &state::bind_volume}) {
+        bind->images[IMG__gAlbedoSpec] = albedo_img;
+        bind->images[IMG__gNormal] = normal_img;
+        bind->images[IMG__gDepth] = depth_img;
+        bind->samplers[SMP_gbuffer_smp] = offscreen::sampler;
+    }
+}
+
+static void init(void) {
+    sg_setup(sg_desc {
+        .logger {
+            .func = slog_func
+        },
+        .environment = sglue_environment(),
+    });
+
+    sfetch_setup(sfetch_desc_t {
+        .max_requests = 8,
+        .num_channels = 1,
+        .num_lanes = 1,
+        .logger {
+            .func = slog_func
+        },
+    });
+
+    stm_setup();
+
+    create_offscreen_pass(sapp_width(), sapp_height());
+
+    // a pass action to clear the G-buffer, the depth has to be kept for
+    // the lighting passes
+    offscreen::pass_action = sg_pass_action {
+        .colors = {
+            { .load_action=SG_LOADACTION_CLEAR, .clear_value={0.1f, 0.1f, 0.1f, 0.0f} },
+            // unlit, so the background keeps the clear colour
+            { .load_action=SG_LOADACTION_CLEAR, .clear_value={0.0f, 0.0f, 0.0f, 1.0f} },
+        },
+        .depth {
+            .load_action=SG_LOADACTION_CLEAR,
+            .store_action=SG_STOREACTION_STORE,
+            .clear_value=1.0f,
+        },
+    };
+
+    // the ambient quad covers every pixel
+    state::pass_action = sg_pass_action {
+        .colors = {{
+            .load_action=SG_LOADACTION_DONTCARE,
+        }}
+    };
+
+    state::cube_positions = {
+        glm::vec3( 0.0f,  0.0f,  0.0f),
+        glm::vec3( 2.0f,  5.0f, -15.0f),
+        glm::vec3(-1.5f, -2.2f, -2.5f),
+        glm::vec3(-3.8f, -2.0f, -12.3f),
+        glm::vec3( 2.4f, -0.4f, -3.5f),
+        glm::vec3(-1.7f,  3.0f, -7.5f),
+        glm::vec3( 1.3f, -2.0f, -2.5f),
+        glm::vec3( 1.5f,  2.0f, -2.5f),
+        glm::vec3( 1.5f,  0.2f, -1.5f),
+        glm::vec3(-1.3f,  1.0f, -1.5f),
+    };
+
+    // the cubes never move so their model and normal matrices can be
+    // worked out once here instead of every frame
+    for (size_t i {0}; i < state::cube_positions.size(); i++) {
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), state::cube_positions[i]);
+        float angle = 20.0f * i;
+        state::cube_models.push_back(glm::rotate(model, angle, glm::vec3(1.0f, 0.3f, 0.5f)));
+    }
+    state::cube_normal_matrices.resize(state::cube_models.size());
+    sjd::computeNormalMatrices(state::cube_models.data(),
+                               state::cube_normal_matrices.data(),
+                               state::cube_models.size());
+
+    std::vector<float> vertices {
+        // positions          // normals           // texture coords
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
+         0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
+
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
+
+        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
+
+        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
+
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f
+    };
+    // the original four lights and a swarm of small ones around the cubes
+    std::vector<glm::vec3> light_positions {
+        glm::vec3( 0.7f,  0.2f,  2.0f),
+        glm::vec3( 2.3f, -3.3f, -4.0f),
+        glm::vec3(-4.0f,  2.0f, -12.0f),
+        glm::vec3( 0.0f,  0.0f, -3.0f)
+    };
+    std::vector<glm::vec3> light_colours {
+        glm::vec3(1.0f, 1.0f, 1.0f),
+        glm::vec3(1.0f, 0.1f, 0.1f),
+        glm::vec3(0.8f, 0.5f, 0.1f),
+        glm::vec3(0.9f, 0.9f, 0.1f),
+    };
+    std::mt19937 rng {7};
+    std::uniform_real_distribution<float> unit {0.0f, 1.0f};
+    for (int i {0}; i < NR_POINT_LIGHTS; i++) {
+        if (i < 4) {
+            state::light_orbits.push_back(glm::vec4(light_positions[i], 0.0f));
+            state::lights.push_back(LightInstance {
+                .positionRange = glm::vec4(light_positions[i], 10.0f),
+                .colour = glm::vec4(light_colours[i], 1.0f),
+            });
+            continue;
+        }
+        glm::vec3 centre {-4.0f + unit(rng) * 8.0f, -3.0f + unit(rng) * 8.0f, -15.0f + unit(rng) * 16.0f};
+        state::light_orbits.push_back(glm::vec4(centre, unit(rng) * glm::two_pi<float>()));
+        state::lights.push_back(LightInstance {
+            .positionRange = glm::vec4(centre, 3.0f),
+            .colour = glm::vec4(glm::normalize(glm::vec3(unit(rng), unit(rng), unit(rng))) * 1.5f, 1.0f),
+        });
+    }
+
+    sg_buffer cube_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = vertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = vertices.data(),
+            .size = vertices.size() * sizeof(float),
+        },
+        .label = "cube-vertices"
+    });
+
+    offscreen::bind_object.vertex_buffers[0] = cube_buffer;
+    offscreen::bind_light.vertex_buffers[0] = cube_buffer;
+
+    std::vector<float> screenVertices {
+        -1.0f, -1.0f,
+         1.0f, -1.0f,
+         1.0f,  1.0f,
+         1.0f,  1.0f,
+        -1.0f,  1.0f,
+        -1.0f, -1.0f,
+    };
+
+    state::bind_ambient.vertex_buffers[0] = sg_make_buffer(sg_buffer_desc {
+        .size = screenVertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = screenVertices.data(),
+            .size = screenVertices.size() * sizeof(float),
+        },
+        .label = "screen-vertices"
+    });
+
+    // Icosahedron's triangles don't all wind the same way, flip the ones
+    // facing inwards so the volumes can be face culled
+    sjd::Icosahedron volume(VOLUME_RADIUS);
+    std::array<float, 36> volumeVertices {volume.getVertices()};
+    std::array<uint16_t, 60> volumeIndices {volume.getIndices()};
+    for (size_t i {0}; i < volumeIndices.size(); i += 3) {
+        glm::vec3 a {glm::make_vec3(&volumeVertices[3 * volumeIndices[i]])};
+        glm::vec3 b {glm::make_vec3(&volumeVertices[3 * volumeIndices[i + 1]])};
+        glm::vec3 c {glm::make_vec3(&volumeVertices[3 * volumeIndices[i + 2]])};
+        if (glm::dot(glm::cross(b - a, c - a), a + b + c) < 0.0f)
+            std::swap(volumeIndices[i + 1], volumeIndices[i + 2]);
+    }
+
+    state::bind_volume.vertex_buffers[0] = sg_make_buffer(sg_buffer_desc {
+        .size = sizeof(volumeVertices),
+        .data = SG_RANGE(volumeVertices),
+        .label = "volume-vertices"
+    });
+    state::bind_volume.index_buffer = sg_make_buffer(sg_buffer_desc {
+        .type = SG_BUFFERTYPE_INDEXBUFFER,
+        .data = SG_RANGE(volumeIndices),
+        .label = "volume-indices"
+    });
+    state::light_instances = sg_make_buffer(sg_buffer_desc {
+        .size = NR_POINT_LIGHTS * sizeof(LightInstance),
+        .usage = SG_USAGE_STREAM,
+        .label = "light-instances"
+    });
+    state::bind_volume.vertex_buffers[1] = state::light_instances;
+
+    // create shader from code-generated sg_shader_desc
+    sg_shader gbuffer_shd = sg_make_shader(gbuffer_shader_desc(sg_query_backend()));
+
+    // we need to initialise layout seperately to the pipeline
+    // because we cant do array initilisation of structs in C++
+    sg_vertex_layout_state layout {};
+    layout.attrs[ATTR_gbuffer_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    layout.attrs[ATTR_gbuffer_aNormal].format = SG_VERTEXFORMAT_FLOAT3;
+    layout.attrs[ATTR_gbuffer_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
+
+    sg_pipeline_desc gbuffer_pip_desc {
+        .shader = gbuffer_shd,
+        .layout = layout,
+        .depth {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+        },
+        .color_count = 2,
+        .colors = {
+            { .pixel_format = SG_PIXELFORMAT_RGBA8 },
+            { .pixel_format = SG_PIXELFORMAT_RGBA8 },
+        },
+        .label = "gbuffer-pipeline"
+    };
+    offscreen::pip_object = sg_make_pipeline(gbuffer_pip_desc);
+
+    // the light cubes go into the G-buffer too, marked as unlit
+    gbuffer_pip_desc.shader = sg_make_shader(light_cube_shader_desc(sg_query_backend()));
+    gbuffer_pip_desc.label = "light-pipeline";
+    offscreen::pip_light = sg_make_pipeline(gbuffer_pip_desc);
+
+    sg_vertex_layout_state screen_layout {};
+    screen_layout.attrs[ATTR_ambient_aPos].format = SG_VERTEXFORMAT_FLOAT2;
+
+    state::pip_ambient = sg_make_pipeline(sg_pipeline_desc {
+        .shader = sg_make_shader(ambient_shader_desc(sg_query_backend())),
+        .layout = screen_layout,
+        .label = "ambient-pipeline"
+    });
+
+    // per vertex positions from buffer 0, per instance light data from buffer 1
+    sg_vertex_layout_state volume_layout {};
+    volume_layout.buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+    volume_layout.attrs[ATTR_volume_aPos] = { .buffer_index = 0, .format = SG_VERTEXFORMAT_FLOAT3 };
+    volume_layout.attrs[ATTR_volume_lightPositionRange] = { .buffer_index = 1, .format = SG_VERTEXFORMAT_FLOAT4 };
+    volume_layout.attrs[ATTR_volume_lightColour] = { .buffer_index = 1, .format = SG_VERTEXFORMAT_FLOAT4 };
+
+    state::pip_volume = sg_make_pipeline(sg_pipeline_desc {
+        .shader = sg_make_shader(volume_shader_desc(sg_query_backend())),
+        .layout = volume_layout,
+        .colors = {{
+            .blend = {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_ONE,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE,
+                .src_factor_alpha = SG_BLENDFACTOR_ONE,
+                .dst_factor_alpha = SG_BLENDFACTOR_ONE,
+            }
+        }},
+        .index_type = SG_INDEXTYPE_UINT16,
+        // back faces only, so each pixel is lit once per light even when
+        // the camera is inside the volume
+        .cull_mode = SG_CULLMODE_FRONT,
+        .face_winding = SG_FACEWINDING_CCW,
+        .label = "volume-pipeline"
+    });
+
+    SokTexture container2("../data/container2.png",
+                          offscreen::bind_object,
+                          IMG__diffuse_texture,
+                          SMP_diffuse_texture_smp,
+                          true,
+                          fail_callback);
+
+    SokTexture container2_specular("../data/container2_specular.png",
+                                   offscreen::bind_object,
+                                   IMG__specular_texture,
+                                   SMP_specular_texture_smp,
+                                   true,
+                                   fail_callback);
+
+}
+
+void frame(void) {
+    sfetch_dowork();
+
+    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
+    state::time += state::deltaTime;
+
+    if (state::spotlight)
+        state::spotLight_colour = glm::vec3(1.0f);
+    else
+        state::spotLight_colour = glm::vec3(0.0f);
+
+    state::dirLight_colour = glm::vec3(0.2f);
+
+    if (!sapp_mouse_locked()) {
+        sapp_lock_mouse(true);
+    }
+    state::camera.moveCamera(state::deltaTime);
+
+    for (size_t i {4}; i < state::lights.size(); i++) {
+        glm::vec4 orbit {state::light_orbits[i]};
+        float angle {orbit.w + state::time};
+        glm::vec3 position {glm::vec3(orbit) + glm::vec3(glm::cos(angle), 0.0f, glm::sin(angle))};
+        state::lights[i].positionRange = glm::vec4(position, state::lights[i].positionRange.w);
+    }
+    sg_update_buffer(state::light_instances, sg_range {
+        .ptr = state::lights.data(),
+        .size = state::lights.size() * sizeof(LightInstance),
+    });
+
+    glm::mat4 view = state::camera.getViewMatrix();
+    glm::mat4 projection = glm::perspective(glm::radians(state::camera.zoom), static_cast<float>(sapp_width()) / sapp_height(), 0.1f, 100.0f);
+    vs_params_t vs_params = {
+        .view = view,
+        .projection = projection
+    };
+
+    // G-buffer
+    sg_begin_pass(sg_pass {
+        .action = offscreen::pass_action,
+        .attachments = offscreen::attachment
+    });
+
+    sg_apply_pipeline(offscreen::pip_object);
+    sg_apply_bindings(offscreen::bind_object);
+
+    for (size_t i {0}; i < state::cube_models.size(); i++) {
+        vs_params.model = state::cube_models[i];
+        vs_params.normalMatrix = state::cube_normal_matrices[i];
+
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+
+        sg_draw(0, 36, 1);
+    }
+
+    sg_apply_pipeline(offscreen::pip_light);
+    sg_apply_bindings(offscreen::bind_light);
+
+    for (const LightInstance& light : state::lights) {
+        light_cube_fs_params_t light_cube_fs_params = {
+            .lightColour = glm::vec3(light.colour)
+        };
+        sg_apply_uniforms(UB_light_cube_fs_params, SG_RANGE(light_cube_fs_params));
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(light.positionRange));
+        model = glm::scale(model, glm::vec3(light.positionRange.w > 5.0f ? 0.2f : 0.05f));
+        vs_params.model = model;
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+
+        sg_draw(0, 36, 1);
+    }
+
+    sg_end_pass();
+
+    // Lighting
+    sg_begin_pass(sg_pass {
+        .action = state::pass_action,
+        .swapchain = sglue_swapchain()
+    });
+
+    fs_gbuffer_params_t fs_gbuffer_params = {
+        .invViewProjection = glm::inverse(projection * view),
+        .viewPos {state::camera.pos}
+    };
+    fs_material_t fs_material = {
+        .shininess = 32.0f,
+    };
+
+    sg_apply_pipeline(state::pip_ambient);
+    sg_apply_bindings(state::bind_ambient);
+    sg_apply_uniforms(UB_fs_gbuffer_params, SG_RANGE(fs_gbuffer_params));
+    sg_apply_uniforms(UB_fs_material, SG_RANGE(fs_material));
+
+    fs_dir_light_t fs_dir_light = {
+        .direction = glm::vec3(-0.2f, -1.0f, -0.3f),
+        .ambient = state::dirLight_colour * 0.2f,
+        .diffuse = state::dirLight_colour * 0.5f,
+        .specular = state::dirLight_colour * 1.0f,
+    };
+    sg_apply_uniforms(UB_fs_dir_light, SG_RANGE(fs_dir_light));
+
+    fs_spot_light_t fs_spot_light = {
+        .position = state::camera.pos,
+        .direction = state::camera.front,
+        .cutOff = glm::cos(glm::radians(12.5f)),
+        .outerCutOff = glm::cos(glm::radians(17.5f)),
+        .diffuse = state::spotLight_colour * 0.5f,
+        .specular = state::spotLight_colour * 1.0f,
+        .constant = 1.0f,
+        .linear = 0.09f,
+        .quadratic = 0.032f,
+    };
+    sg_apply_uniforms(UB_fs_spot_light, SG_RANGE(fs_spot_light));
+
+    sg_draw(0, 6, 1);
+
+    // Point lights, one instance each
+    sg_apply_pipeline(state::pip_volume);
+    sg_apply_bindings(state::bind_volume);
+    vs_volume_params_t vs_volume_params = {
+        .viewProjection = projection * view
+    };
+    sg_apply_uniforms(UB_vs_volume_params, SG_RANGE(vs_volume_params));
+    sg_apply_uniforms(UB_fs_gbuffer_params, SG_RANGE(fs_gbuffer_params));
+    sg_apply_uniforms(UB_fs_material, SG_RANGE(fs_material));
+
+    sg_draw(0, 60, static_cast<int>(state::lights.size()));
+
+    sg_end_pass();
+    sg_commit();
+}
+
+void cleanup(void) {
+    sfetch_shutdown();
+    sg_shutdown();
+}
+
+void event(const sapp_event* e) {
+    if (e->type == SAPP_EVENTTYPE_RESIZED) {
+        create_offscreen_pass(e->framebuffer_width, e->framebuffer_height);
+    }
+    if (e->type == SAPP_EVENTTYPE_KEY_DOWN) {
+        if (e->key_code == SAPP_KEYCODE_ESCAPE) {
+            sapp_request_quit();
+        }
+        if (e->key_code == SAPP_KEYCODE_F) {
+            state::spotlight = !state::spotlight;
+        }
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::PRESS);
+    }
+
+    if (e->type == SAPP_EVENTTYPE_KEY_UP) {
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::RELEASE);
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_BEGAN) {
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_MOVED) {
+        float offsetX = e -> touches[0].pos_x - state::camera.lastX;
+        float offsetY = state::camera.lastY - e -> touches[0].pos_y;
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+        state::camera.processMouseMovement(offsetX, offsetY);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+        state::camera.processMouseMovement(e->mouse_dx, -e->mouse_dy);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_SCROLL) {
+        state::camera.processMouseScroll(e->scroll_y);
+    }
+
+}
+
+sapp_desc sokol_main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    return sapp_desc {
+        .init_cb = init,
+        .frame_cb = frame,
+        .cleanup_cb = cleanup,
+        .event_cb = event,
+        .width = 800,
+        .height = 600,
+        .high_dpi = true,
+        .window_title = "Deferred Shading - LearnOpenGL",
+        .logger {
+            .func = slog_func
+        },
+#ifdef _WIN32
+        .win32_console_utf8 = true,
+        .win32_console_attach = true,
+#endif
+    };
+}
+
@@ -0,0 +1,287 @@
+@ctype mat4 glm::mat4
+@ctype vec3 glm::vec3
+@ctype vec4 glm::vec4
+
+// G-buffer layout, two RGBA8 targets plus the depth buffer:
+//   0: albedo.rgb, specular intensity
+//   1: octahedral normal packed as 12 + 12 bits into rgb, a = 1 for unlit
+//   depth: world position is rebuilt from it with the inverse view-projection
+@block gbuffer_encoding
+vec2 signNotZero(vec2 v) {
+    return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+vec3 packNormal(vec3 n) {
+    n /= abs(n.x) + abs(n.y) + abs(n.z);
+    vec2 e = n.z >= 0.0 ? n.xy : (1.0 - abs(n.yx)) * signNotZero(n.xy);
+    uvec2 q = uvec2(round((e * 0.5 + 0.5) * 4095.0));
+    return vec3(float(q.x >> 4u),
+                float(((q.x & 15u) << 4u) | (q.y >> 8u)),
+                float(q.y & 255u)) / 255.0;
+}
+
+vec3 unpackNormal(vec3 encoded) {
+    uvec3 b = uvec3(round(encoded * 255.0));
+    vec2 e = vec2(float((b.x << 4u) | (b.y >> 4u)),
+                  float(((b.y & 15u) << 8u) | b.z)) / 4095.0 * 2.0 - 1.0;
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0) {
+        n.xy = (1.0 - abs(n.yx)) * signNotZero(n.xy);
+    }
+    return normalize(n);
+}
+@end
+
+@block gbuffer_read
+layout(binding = 1) uniform fs_gbuffer_params {
+    mat4 invViewProjection;
+    vec3 viewPos;
+};
+
+layout(binding = 2) uniform fs_material {
+    float shininess;
+} material;
+
+layout(binding = 0) uniform texture2D _gAlbedoSpec;
+layout(binding = 1) uniform texture2D _gNormal;
+layout(binding = 2) uniform texture2D _gDepth;
+layout(binding = 0) uniform sampler gbuffer_smp;
+#define gAlbedoSpec sampler2D(_gAlbedoSpec, gbuffer_smp)
+#define gNormal sampler2D(_gNormal, gbuffer_smp)
+#define gDepth sampler2D(_gDepth, gbuffer_smp)
+
+struct surface_t {
+    vec3 position;
+    vec3 normal;
+    vec3 albedo;
+    float specular;
+    bool unlit;
+};
+
+surface_t readSurface() {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    vec4 albedoSpec = texelFetch(gAlbedoSpec, pixel, 0);
+    vec4 normal = texelFetch(gNormal, pixel, 0);
+    float depth = texelFetch(gDepth, pixel, 0).r;
+
+    vec2 ndc = (gl_FragCoord.xy / vec2(textureSize(gDepth, 0))) * 2.0 - 1.0;
+    vec4 world = invViewProjection * vec4(ndc, depth * 2.0 - 1.0, 1.0);
+
+    return surface_t(world.xyz / world.w,
+                     unpackNormal(normal.rgb),
+                     albedoSpec.rgb,
+                     albedoSpec.a,
+                     normal.a > 0.5);
+}
+@end
+
+@vs gbuffer_vs
+in vec3 aPos;
+in vec3 aNormal;
+in vec2 aTexCoords;
+
+out vec3 Normal;
+out vec2 TexCoords;
+
+layout(binding = 0) uniform vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+    mat4 normalMatrix;
+};
+
+void main() {
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    Normal = mat3(normalMatrix) * aNormal;
+    TexCoords = aTexCoords;
+}
+@end
+
+@fs gbuffer_fs
+@include_block gbuffer_encoding
+in vec3 Normal;
+in vec2 TexCoords;
+
+layout(location = 0) out vec4 gAlbedoSpec;
+layout(location = 1) out vec4 gNormal;
+
+layout(binding = 0) uniform texture2D _diffuse_texture;
+layout(binding = 0) uniform sampler diffuse_texture_smp;
+#define diffuse_texture sampler2D(_diffuse_texture, diffuse_texture_smp)
+layout(binding = 1) uniform texture2D _specular_texture;
+layout(binding = 1) uniform sampler specular_texture_smp;
+#define specular_texture sampler2D(_specular_texture, specular_texture_smp)
+
+void main() {
+    gAlbedoSpec = vec4(texture(diffuse_texture, TexCoords).rgb,
+                       texture(specular_texture, TexCoords).r);
+    gNormal = vec4(packNormal(normalize(Normal)), 0.0);
+}
+@end
+
+@vs light_cube_vs
+in vec3 aPos;
+
+layout(binding = 0) uniform vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+    mat4 normalMatrix;
+};
+
+void main() {
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
+}
+@end
+
+@fs light_cube_fs
+layout(location = 0) out vec4 gAlbedoSpec;
+layout(location = 1) out vec4 gNormal;
+
+layout(binding = 1) uniform light_cube_fs_params {
+    vec3 lightColour;
+};
+
+void main() {
+    gAlbedoSpec = vec4(lightColour, 0.0);
+    // flagged as unlit, the ambient pass writes the albedo as is
+    gNormal = vec4(0.0, 0.0, 0.0, 1.0);
+}
+@end
+
+@vs screen_vs
+in vec2 aPos;
+
+void main() {
+    gl_Position = vec4(aPos, 0.0, 1.0);
+}
+@end
+
+// ambient, directional light and the torch for every pixel
+@fs ambient_fs
+@include_block gbuffer_encoding
+@include_block gbuffer_read
+@image_sample_type _gDepth depth
+@sampler_type gbuffer_smp nonfiltering
+
+out vec4 FragColor;
+
+layout(binding = 3) uniform fs_dir_light {
+    vec3 direction;
+
+    vec3 ambient;
+    vec3 diffuse;
+    vec3 specular;
+} dirLight;
+
+layout(binding = 4) uniform fs_spot_light {
+    vec3 position;
+    vec3 direction;
+    float cutOff;
+    float outerCutOff;
+
+    vec3 diffuse;
+    vec3 specular;
+
+    float constant;
+    float linear;
+    float quadratic;
+} spotLight;
+
+void main() {
+    surface_t surface = readSurface();
+    if (surface.unlit) {
+        FragColor = vec4(surface.albedo, 1.0);
+        return;
+    }
+    vec3 viewDir = normalize(viewPos - surface.position);
+
+    // Directional lighting
+    vec3 lightDir = normalize(-dirLight.direction);
+    float diff = max(dot(surface.normal, lightDir), 0.0);
+    vec3 reflectDir = reflect(-lightDir, surface.normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
+    vec3 result = dirLight.ambient * surface.albedo
+                + dirLight.diffuse * diff * surface.albedo
+                + dirLight.specular * spec * surface.specular;
+
+    // Spot light
+    lightDir = normalize(spotLight.position - surface.position);
+    float theta = dot(lightDir, normalize(-spotLight.direction));
+    float epsilon = spotLight.cutOff - spotLight.outerCutOff;
+    float intensity = clamp((theta - spotLight.outerCutOff) / epsilon, 0.0, 1.0);
+    diff = max(dot(surface.normal, lightDir), 0.0);
+    reflectDir = reflect(-lightDir, surface.normal);
+    spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
+    float distance = length(spotLight.position - surface.position);
+    float attenuation = 1.0 / (spotLight.constant + spotLight.linear * distance + spotLight.quadratic * (distance * distance));
+    result += (spotLight.diffuse * diff * surface.albedo
+               + spotLight.specular * spec * surface.specular) * attenuation * intensity;
+
+    FragColor = vec4(result, 1.0);
+}
+@end
+
+// one instanced icosahedron per point light, only its back faces are drawn
+// so it still covers the right pixels when the camera is inside it
+@vs volume_vs
+in vec3 aPos;
+in vec4 lightPositionRange;
+in vec4 lightColour;
+
+flat out vec4 PositionRange;
+flat out vec3 Colour;
+
+layout(binding = 0) uniform vs_volume_params {
+    mat4 viewProjection;
+};
+
+void main() {
+    gl_Position = viewProjection * vec4(lightPositionRange.xyz + aPos * lightPositionRange.w, 1.0);
+    PositionRange = lightPositionRange;
+    Colour = lightColour.rgb;
+}
+@end
+
+@fs volume_fs
+@include_block gbuffer_encoding
+@include_block gbuffer_read
+@image_sample_type _gDepth depth
+@sampler_type gbuffer_smp nonfiltering
+
+flat in vec4 PositionRange;
+flat in vec3 Colour;
+
+out vec4 FragColor;
+
+void main() {
+    surface_t surface = readSurface();
+    vec3 toLight = PositionRange.xyz - surface.position;
+    float distance = length(toLight);
+    // the volume's back faces also cover pixels that are in front of or
+    // behind the light, those are out of range
+    if (surface.unlit || distance > PositionRange.w) {
+        discard;
+    }
+    vec3 viewDir = normalize(viewPos - surface.position);
+    vec3 lightDir = toLight / distance;
+
+    float diff = max(dot(surface.normal, lightDir), 0.0);
+    vec3 reflectDir = reflect(-lightDir, surface.normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
+
+    // LearnOpenGL falloff, windowed so it reaches zero at the volume's edge
+    float window = clamp(1.0 - pow(distance / PositionRange.w, 4.0), 0.0, 1.0);
+    float attenuation = window * window / (1.0 + 0.09 * distance + 0.032 * (distance * distance));
+
+    vec3 ambient = Colour * 0.2 * surface.albedo;
+    vec3 diffuse = Colour * 0.5 * diff * surface.albedo;
+    vec3 specular = Colour * spec * surface.specular;
+    FragColor = vec4((ambient + diffuse + specular) * attenuation, 1.0);
+}
+@end
+
+@program gbuffer gbuffer_vs gbuffer_fs
+@program light_cube light_cube_vs light_cube_fs
+@program ambient screen_vs ambient_fs
+@program volume volume_vs volume_fs
@@ -0,0 +1,2281 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i .\3-deferred.glsl -o .\3-deferred.glsl.h -l glsl430:glsl300es
+
+    Overview:
+    =========
+    Shader program: 'ambient':
+        Get shader desc: ambient_shader_desc(sg_query_backend());
+        Vertex Shader: screen_vs
+        Fragment Shader: ambient_fs
+        Attributes:
+            ATTR_ambient_aPos => 0
+    Shader program: 'gbuffer':
+        Get shader desc: gbuffer_shader_desc(sg_query_backend());
+        Vertex Shader: gbuffer_vs
+        Fragment Shader: gbuffer_fs
+        Attributes:
+            ATTR_gbuffer_aPos => 0
+            ATTR_gbuffer_aNormal => 1
+            ATTR_gbuffer_aTexCoords => 2
+    Shader program: 'light_cube':
+        Get shader desc: light_cube_shader_desc(sg_query_backend());
+        Vertex Shader: light_cube_vs
+        Fragment Shader: light_cube_fs
+        Attributes:
+            ATTR_light_cube_aPos => 0
+    Shader program: 'volume':
+        Get shader desc: volume_shader_desc(sg_query_backend());
+        Vertex Shader: volume_vs
+        Fragment Shader: volume_fs
+        Attributes:
+            ATTR_volume_aPos => 0
+            ATTR_volume_lightPositionRange => 1
+            ATTR_volume_lightColour => 2
+    Bindings:
+        Uniform block 'fs_gbuffer_params':
+            C struct: fs_gbuffer_params_t
+            Bind slot: UB_fs_gbuffer_params => 1
+        Uniform block 'fs_dir_light':
+            C struct: fs_dir_light_t
+            Bind slot: UB_fs_dir_light => 3
+        Uniform block 'fs_material':
+            C struct: fs_material_t
+            Bind slot: UB_fs_material => 2
+        Uniform block 'fs_spot_light':
+            C struct: fs_spot_light_t
+            Bind slot: UB_fs_spot_light => 4
+        Uniform block 'vs_params':
+            C struct: vs_params_t
+            Bind slot: UB_vs_params => 0
+        Uniform block 'light_cube_fs_params':
+            C struct: light_cube_fs_params_t
+            Bind slot: UB_light_cube_fs_params => 1
+        Uniform block 'vs_volume_params':
+            C struct: vs_volume_params_t
+            Bind slot: UB_vs_volume_params => 0
+        Image '_gAlbedoSpec':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__gAlbedoSpec => 0
+        Image '_gNormal':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__gNormal => 1
+        Image '_gDepth':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_DEPTH
+            Multisampled: false
+            Bind slot: IMG__gDepth => 2
+        Image '_diffuse_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__diffuse_texture => 0
+        Image '_specular_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__specular_texture => 1
+        Sampler 'gbuffer_smp':
+            Type: SG_SAMPLERTYPE_NONFILTERING
+            Bind slot: SMP_gbuffer_smp => 0
+        Sampler 'diffuse_texture_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_diffuse_texture_smp => 0
+        Sampler 'specular_texture_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_specular_texture_smp => 1
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before 3-deferred.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define ATTR_ambient_aPos (0)
+#define ATTR_gbuffer_aPos (0)
+#define ATTR_gbuffer_aNormal (1)
+#define ATTR_gbuffer_aTexCoords (2)
+#define ATTR_light_cube_aPos (0)
+#define ATTR_volume_aPos (0)
+#define ATTR_volume_lightPositionRange (1)
+#define ATTR_volume_lightColour (2)
+#define UB_fs_gbuffer_params (1)
+#define UB_fs_dir_light (3)
+#define UB_fs_material (2)
+#define UB_fs_spot_light (4)
+#define UB_vs_params (0)
+#define UB_light_cube_fs_params (1)
+#define UB_vs_volume_params (0)
+#define IMG__gAlbedoSpec (0)
+#define IMG__gNormal (1)
+#define IMG__gDepth (2)
+#define IMG__diffuse_texture (0)
+#define IMG__specular_texture (1)
+#define SMP_gbuffer_smp (0)
+#define SMP_diffuse_texture_smp (0)
+#define SMP_specular_texture_smp (1)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_gbuffer_params_t {
+    glm::mat4 invViewProjection;
+    glm::vec3 viewPos;
+    uint8_t _pad_76[4];
+} fs_gbuffer_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_dir_light_t {
+    glm::vec3 direction;
+    uint8_t _pad_12[4];
+    glm::vec3 ambient;
+    uint8_t _pad_28[4];
+    glm::vec3 diffuse;
+    uint8_t _pad_44[4];
+    glm::vec3 specular;
+    uint8_t _pad_60[4];
+} fs_dir_light_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_material_t {
+    float shininess;
+    uint8_t _pad_4[12];
+} fs_material_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_spot_light_t {
+    glm::vec3 position;
+    uint8_t _pad_12[4];
+    glm::vec3 direction;
+    float cutOff;
+    float outerCutOff;
+    uint8_t _pad_36[12];
+    glm::vec3 diffuse;
+    uint8_t _pad_60[4];
+    glm::vec3 specular;
+    float constant;
+    float linear;
+    float quadratic;
+    uint8_t _pad_88[8];
+} fs_spot_light_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
+    glm::mat4 model;
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::mat4 normalMatrix;
+} vs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct light_cube_fs_params_t {
+    glm::vec3 lightColour;
+    uint8_t _pad_12[4];
+} light_cube_fs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_volume_params_t {
+    glm::mat4 viewProjection;
+} vs_volume_params_t;
+#pragma pack(pop)
+/*
+    #version 430
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec3 aNormal;
+    layout(location = 2) in vec2 aTexCoords;
+    layout(location = 0) out vec3 Normal;
+    layout(location = 1) out vec2 TexCoords;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        Normal = mat3(mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15])) * aNormal;
+        TexCoords = aTexCoords;
+    }
+
+*/
+static const uint8_t gbuffer_vs_source_glsl430[603] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,
+    0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x34,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x35,0x5d,0x29,0x29,0x20,
+    0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x61,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    layout(binding = 16) uniform sampler2D _diffuse_texture_diffuse_texture_smp;
+    layout(binding = 17) uniform sampler2D _specular_texture_specular_texture_smp;
+    layout(location = 0) in vec3 Normal;
+    layout(location = 1) in vec2 TexCoords;
+    layout(location = 0) out vec4 gAlbedoSpec;
+    layout(location = 1) out vec4 gNormal;
+
+    vec2 signNotZero(vec2 v)
+    {
+        return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    }
+
+    vec3 packNormal(vec3 n)
+    {
+        n /= abs(n.x) + abs(n.y) + abs(n.z);
+        vec2 e = n.z >= 0.0 ? n.xy : (1.0 - abs(n.yx)) * signNotZero(n.xy);
+        uvec2 q = uvec2(round((e * 0.5 + 0.5) * 4095.0));
+        return vec3(float(q.x >> 4u),
+                    float(((q.x & 15u) << 4u) | (q.y >> 8u)),
+                    float(q.y & 255u)) / 255.0;
+    }
+
+    void main()
+    {
+        gAlbedoSpec = vec4(texture(_diffuse_texture_diffuse_texture_smp, TexCoords).rgb,
+                           texture(_specular_texture_specular_texture_smp, TexCoords).r);
+        gNormal = vec4(packNormal(normalize(Normal)), 0.0);
+    }
+
+*/
+static const uint8_t gbuffer_fs_source_glsl430[1004] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,
+    0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x32,0x44,0x20,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x37,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x0a,0x76,0x65,0x63,0x32,0x20,0x73,
+    0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,0x65,0x72,0x6f,0x28,0x76,0x65,0x63,0x32,0x20,
+    0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x76,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,
+    0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x76,0x2e,
+    0x79,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,
+    0x20,0x2d,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,
+    0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x76,0x65,0x63,0x33,0x20,
+    0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x20,0x2f,0x3d,0x20,0x61,0x62,
+    0x73,0x28,0x6e,0x2e,0x78,0x29,0x20,0x2b,0x20,0x61,0x62,0x73,0x28,0x6e,0x2e,0x79,
+    0x29,0x20,0x2b,0x20,0x61,0x62,0x73,0x28,0x6e,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x65,0x20,0x3d,0x20,0x6e,0x2e,0x7a,0x20,0x3e,
+    0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x6e,0x2e,0x78,0x79,0x20,0x3a,0x20,0x28,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x6e,0x2e,0x79,0x78,0x29,0x29,
+    0x20,0x2a,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,0x65,0x72,0x6f,0x28,0x6e,
+    0x2e,0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x32,0x20,
+    0x71,0x20,0x3d,0x20,0x75,0x76,0x65,0x63,0x32,0x28,0x72,0x6f,0x75,0x6e,0x64,0x28,
+    0x28,0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,
+    0x2a,0x20,0x34,0x30,0x39,0x35,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x71,0x2e,0x78,0x20,0x3e,0x3e,0x20,0x34,0x75,0x29,0x2c,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x28,0x28,0x28,0x71,0x2e,0x78,0x20,0x26,0x20,0x31,0x35,0x75,0x29,
+    0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x71,0x2e,0x79,0x20,0x3e,
+    0x3e,0x20,0x38,0x75,0x29,0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x71,0x2e,
+    0x79,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x29,0x20,0x2f,0x20,0x32,0x35,0x35,
+    0x2e,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,
+    0x53,0x70,0x65,0x63,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x29,0x2e,0x72,0x67,0x62,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,
+    0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,0x75,
+    0x6c,0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+    }
+
+*/
+static const uint8_t light_cube_vs_source_glsl430[322] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 light_cube_fs_params[1];
+    layout(location = 0) out vec4 gAlbedoSpec;
+    layout(location = 1) out vec4 gNormal;
+
+    void main()
+    {
+        gAlbedoSpec = vec4(light_cube_fs_params[0].xyz, 0.0);
+        gNormal = vec4(0.0, 0.0, 0.0, 1.0);
+    }
+
+*/
+static const uint8_t light_cube_fs_source_glsl430[251] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,
+    0x5f,0x63,0x75,0x62,0x65,0x5f,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x67,0x4e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,
+    0x53,0x70,0x65,0x63,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6c,0x69,0x67,0x68,
+    0x74,0x5f,0x63,0x75,0x62,0x65,0x5f,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    layout(location = 0) in vec2 aPos;
+
+    void main()
+    {
+        gl_Position = vec4(aPos, 0.0, 1.0);
+    }
+
+*/
+static const uint8_t screen_vs_source_glsl430[108] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x50,0x6f,0x73,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    struct surface_t
+    {
+        vec3 position;
+        vec3 normal;
+        vec3 albedo;
+        float specular;
+        bool unlit;
+    };
+
+    uniform vec4 fs_gbuffer_params[5];
+    uniform vec4 fs_material[1];
+    uniform vec4 fs_dir_light[4];
+    uniform vec4 fs_spot_light[6];
+    layout(binding = 16) uniform sampler2D _gAlbedoSpec_gbuffer_smp;
+    layout(binding = 17) uniform sampler2D _gNormal_gbuffer_smp;
+    layout(binding = 18) uniform sampler2D _gDepth_gbuffer_smp;
+    layout(location = 0) out vec4 FragColor;
+
+    vec2 signNotZero(vec2 v)
+    {
+        return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    }
+
+    vec3 unpackNormal(vec3 encoded)
+    {
+        uvec3 b = uvec3(round(encoded * 255.0));
+        vec2 e = vec2(float((b.x << 4u) | (b.y >> 4u)),
+                      float(((b.y & 15u) << 8u) | b.z)) / 4095.0 * 2.0 - 1.0;
+        vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+        if (n.z < 0.0)
+        {
+            n.xy = (1.0 - abs(n.yx)) * signNotZero(n.xy);
+        }
+        return normalize(n);
+    }
+
+    surface_t readSurface()
+    {
+        ivec2 pixel = ivec2(gl_FragCoord.xy);
+        vec4 albedoSpec = texelFetch(_gAlbedoSpec_gbuffer_smp, pixel, 0);
+        vec4 normal = texelFetch(_gNormal_gbuffer_smp, pixel, 0);
+        float depth = texelFetch(_gDepth_gbuffer_smp, pixel, 0).r;
+        vec2 ndc = (gl_FragCoord.xy / vec2(textureSize(_gDepth_gbuffer_smp, 0))) * 2.0 - 1.0;
+        vec4 world = mat4(fs_gbuffer_params[0], fs_gbuffer_params[1], fs_gbuffer_params[2], fs_gbuffer_params[3]) * vec4(ndc, depth * 2.0 - 1.0, 1.0);
+        return surface_t(world.xyz / world.w,
+                         unpackNormal(normal.rgb),
+                         albedoSpec.rgb,
+                         albedoSpec.a,
+                         normal.a > 0.5);
+    }
+
+    void main()
+    {
+        surface_t surface = readSurface();
+        if (surface.unlit)
+        {
+            FragColor = vec4(surface.albedo, 1.0);
+            return;
+        }
+        vec3 viewDir = normalize(fs_gbuffer_params[4].xyz - surface.position);
+        vec3 lightDir = normalize(-fs_dir_light[0].xyz);
+        float diff = max(dot(surface.normal, lightDir), 0.0);
+        vec3 reflectDir = reflect(-lightDir, surface.normal);
+        float spec = pow(max(dot(viewDir, reflectDir), 0.0), fs_material[0].x);
+        vec3 result = fs_dir_light[1].xyz * surface.albedo
+                    + fs_dir_light[2].xyz * diff * surface.albedo
+                    + fs_dir_light[3].xyz * spec * surface.specular;
+        lightDir = normalize(fs_spot_light[0].xyz - surface.position);
+        float theta = dot(lightDir, normalize(-fs_spot_light[1].xyz));
+        float epsilon = fs_spot_light[1].w - fs_spot_light[2].x;
+        float intensity = clamp((theta - fs_spot_light[2].x) / epsilon, 0.0, 1.0);
+        diff = max(dot(surface.normal, lightDir), 0.0);
+        reflectDir = reflect(-lightDir, surface.normal);
+        spec = pow(max(dot(viewDir, reflectDir), 0.0), fs_material[0].x);
+        float distance = length(fs_spot_light[0].xyz - surface.position);
+        float attenuation = 1.0 / (fs_spot_light[4].w + fs_spot_light[5].x * distance + fs_spot_light[5].y * (distance * distance));
+        result += (fs_spot_light[3].xyz * diff * surface.albedo
+                   + fs_spot_light[4].xyz * spec * surface.specular) * attenuation * intensity;
+        FragColor = vec4(result, 1.0);
+    }
+
+*/
+static const uint8_t ambient_fs_source_glsl430[3137] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x6c,
+    0x62,0x65,0x64,0x6f,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x75,0x6e,0x6c,0x69,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x67,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x3b,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,
+    0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x64,0x69,
+    0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x34,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,
+    0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x5f,0x67,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x37,0x29,
+    0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x32,0x44,0x20,0x5f,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x67,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x38,0x29,0x20,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x5f,0x67,0x44,0x65,0x70,0x74,0x68,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,
+    0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,
+    0x65,0x63,0x32,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,0x65,0x72,0x6f,0x28,
+    0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,0x76,0x2e,0x78,0x20,0x3e,0x3d,
+    0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,0x2d,0x31,0x2e,
+    0x30,0x2c,0x20,0x76,0x2e,0x79,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,
+    0x31,0x2e,0x30,0x20,0x3a,0x20,0x2d,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x76,0x65,0x63,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x28,0x76,0x65,0x63,0x33,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x33,0x20,0x62,0x20,0x3d,0x20,
+    0x75,0x76,0x65,0x63,0x33,0x28,0x72,0x6f,0x75,0x6e,0x64,0x28,0x65,0x6e,0x63,0x6f,
+    0x64,0x65,0x64,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x65,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x62,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x34,
+    0x75,0x29,0x20,0x7c,0x20,0x28,0x62,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x34,0x75,0x29,
+    0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x28,0x62,0x2e,0x79,
+    0x20,0x26,0x20,0x31,0x35,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x7c,
+    0x20,0x62,0x2e,0x7a,0x29,0x29,0x20,0x2f,0x20,0x34,0x30,0x39,0x35,0x2e,0x30,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x65,
+    0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x78,0x29,
+    0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x6e,0x2e,0x7a,0x20,0x3c,0x20,0x30,0x2e,0x30,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,
+    0x2e,0x78,0x79,0x20,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,
+    0x28,0x6e,0x2e,0x79,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,
+    0x74,0x5a,0x65,0x72,0x6f,0x28,0x6e,0x2e,0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x75,0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x20,0x72,0x65,0x61,0x64,0x53,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,
+    0x63,0x32,0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,
+    0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x61,0x6c,0x62,0x65,
+    0x64,0x6f,0x53,0x70,0x65,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+    0x74,0x63,0x68,0x28,0x5f,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,
+    0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,
+    0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,
+    0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x67,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,
+    0x6c,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+    0x74,0x63,0x68,0x28,0x5f,0x67,0x44,0x65,0x70,0x74,0x68,0x5f,0x67,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,
+    0x30,0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x6e,
+    0x64,0x63,0x20,0x3d,0x20,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,
+    0x72,0x64,0x2e,0x78,0x79,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,0x5f,0x67,0x44,0x65,0x70,0x74,0x68,
+    0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x30,0x29,
+    0x29,0x29,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x77,0x6f,0x72,0x6c,0x64,0x20,0x3d,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x67,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x2c,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,
+    0x76,0x65,0x63,0x34,0x28,0x6e,0x64,0x63,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x75,
+    0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x28,0x77,0x6f,0x72,0x6c,0x64,0x2e,0x78,0x79,
+    0x7a,0x20,0x2f,0x20,0x77,0x6f,0x72,0x6c,0x64,0x2e,0x77,0x2c,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x2e,0x72,0x67,0x62,0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x2e,0x72,0x67,0x62,0x2c,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,
+    0x2e,0x61,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2e,
+    0x61,0x20,0x3e,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x75,0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,
+    0x20,0x3d,0x20,0x72,0x65,0x61,0x64,0x53,0x75,0x72,0x66,0x61,0x63,0x65,0x28,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x75,0x72,0x66,0x61,0x63,
+    0x65,0x2e,0x75,0x6e,0x6c,0x69,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,
+    0x61,0x6c,0x62,0x65,0x64,0x6f,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,0x65,
+    0x77,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
+    0x28,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x34,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,0x75,0x72,0x66,
+    0x61,0x63,0x65,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,
+    0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2d,0x66,0x73,
+    0x5f,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x30,0x5d,0x2e,0x78,0x79,
+    0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,
+    0x66,0x66,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,
+    0x72,0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x6c,0x69,0x67,
+    0x68,0x74,0x44,0x69,0x72,0x2c,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x73,0x70,0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,
+    0x28,0x64,0x6f,0x74,0x28,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x72,0x65,
+    0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,
+    0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x30,0x5d,0x2e,
+    0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x3d,0x20,0x66,0x73,0x5f,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,
+    0x68,0x74,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,
+    0x61,0x63,0x65,0x2e,0x61,0x6c,0x62,0x65,0x64,0x6f,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x66,0x73,0x5f,
+    0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,
+    0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,0x61,0x63,
+    0x65,0x2e,0x61,0x6c,0x62,0x65,0x64,0x6f,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x66,0x73,0x5f,0x64,0x69,
+    0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x33,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,
+    0x20,0x73,0x70,0x65,0x63,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,
+    0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,
+    0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,0x75,0x72,0x66,0x61,0x63,
+    0x65,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x68,0x65,0x74,0x61,0x20,0x3d,0x20,0x64,
+    0x6f,0x74,0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x2c,0x20,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2d,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,
+    0x6c,0x69,0x67,0x68,0x74,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x65,0x70,0x73,0x69,0x6c,0x6f,
+    0x6e,0x20,0x3d,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x5b,0x31,0x5d,0x2e,0x77,0x20,0x2d,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,
+    0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x32,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,0x79,
+    0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x74,0x68,0x65,0x74,0x61,0x20,
+    0x2d,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,
+    0x32,0x5d,0x2e,0x78,0x29,0x20,0x2f,0x20,0x65,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x64,0x69,0x66,0x66,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x73,
+    0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,
+    0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x20,0x3d,
+    0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x6c,0x69,0x67,0x68,0x74,0x44,
+    0x69,0x72,0x2c,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x70,0x65,0x63,0x20,0x3d,0x20,
+    0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x76,0x69,0x65,0x77,
+    0x44,0x69,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,0x65,0x72,
+    0x69,0x61,0x6c,0x5b,0x30,0x5d,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x3d,0x20,
+    0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,
+    0x69,0x67,0x68,0x74,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,0x75,
+    0x72,0x66,0x61,0x63,0x65,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x65,0x6e,
+    0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2f,0x20,0x28,
+    0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x34,0x5d,
+    0x2e,0x77,0x20,0x2b,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,
+    0x68,0x74,0x5b,0x35,0x5d,0x2e,0x78,0x20,0x2a,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x20,0x2b,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,
+    0x68,0x74,0x5b,0x35,0x5d,0x2e,0x79,0x20,0x2a,0x20,0x28,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x20,0x2a,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,
+    0x28,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x33,
+    0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x20,0x2a,0x20,0x73,
+    0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x61,0x6c,0x62,0x65,0x64,0x6f,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x66,
+    0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x34,0x5d,0x2e,
+    0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x20,0x2a,0x20,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x2e,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x20,0x2a,
+    0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x2a,0x20,0x69,
+    0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,
+    0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 vs_volume_params[4];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec4 lightPositionRange;
+    layout(location = 2) in vec4 lightColour;
+    layout(location = 0) flat out vec4 PositionRange;
+    layout(location = 1) flat out vec3 Colour;
+
+    void main()
+    {
+        gl_Position = mat4(vs_volume_params[0], vs_volume_params[1], vs_volume_params[2], vs_volume_params[3]) * vec4(lightPositionRange.xyz + aPos * lightPositionRange.w, 1.0);
+        PositionRange = lightPositionRange;
+        Colour = lightColour.rgb;
+    }
+
+*/
+static const uint8_t volume_vs_source_glsl430[530] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,
+    0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,
+    0x67,0x65,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x66,0x6c,0x61,0x74,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x66,0x6c,0x61,0x74,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x6c,0x69,0x67,0x68,
+    0x74,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x78,
+    0x79,0x7a,0x20,0x2b,0x20,0x61,0x50,0x6f,0x73,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,
+    0x74,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x77,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,0x6c,0x69,0x67,0x68,
+    0x74,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+/*
+    #version 430
+
+    struct surface_t
+    {
+        vec3 position;
+        vec3 normal;
+        vec3 albedo;
+        float specular;
+        bool unlit;
+    };
+
+    uniform vec4 fs_gbuffer_params[5];
+    uniform vec4 fs_material[1];
+    layout(binding = 16) uniform sampler2D _gAlbedoSpec_gbuffer_smp;
+    layout(binding = 17) uniform sampler2D _gNormal_gbuffer_smp;
+    layout(binding = 18) uniform sampler2D _gDepth_gbuffer_smp;
+    layout(location = 0) flat in vec4 PositionRange;
+    layout(location = 1) flat in vec3 Colour;
+    layout(location = 0) out vec4 FragColor;
+
+    vec2 signNotZero(vec2 v)
+    {
+        return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    }
+
+    vec3 unpackNormal(vec3 encoded)
+    {
+        uvec3 b = uvec3(round(encoded * 255.0));
+        vec2 e = vec2(float((b.x << 4u) | (b.y >> 4u)),
+                      float(((b.y & 15u) << 8u) | b.z)) / 4095.0 * 2.0 - 1.0;
+        vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+        if (n.z < 0.0)
+        {
+            n.xy = (1.0 - abs(n.yx)) * signNotZero(n.xy);
+        }
+        return normalize(n);
+    }
+
+    surface_t readSurface()
+    {
+        ivec2 pixel = ivec2(gl_FragCoord.xy);
+        vec4 albedoSpec = texelFetch(_gAlbedoSpec_gbuffer_smp, pixel, 0);
+        vec4 normal = texelFetch(_gNormal_gbuffer_smp, pixel, 0);
+        float depth = texelFetch(_gDepth_gbuffer_smp, pixel, 0).r;
+        vec2 ndc = (gl_FragCoord.xy / vec2(textureSize(_gDepth_gbuffer_smp, 0))) * 2.0 - 1.0;
+        vec4 world = mat4(fs_gbuffer_params[0], fs_gbuffer_params[1], fs_gbuffer_params[2], fs_gbuffer_params[3]) * vec4(ndc, depth * 2.0 - 1.0, 1.0);
+        return surface_t(world.xyz / world.w,
+                         unpackNormal(normal.rgb),
+                         albedoSpec.rgb,
+                         albedoSpec.a,
+                         normal.a > 0.5);
+    }
+
+    void main()
+    {
+        surface_t surface = readSurface();
+        vec3 toLight = PositionRange.xyz - surface.position;
+        float distance = length(toLight);
+        if (surface.unlit || distance > PositionRange.w)
+        {
+            discard;
+        }
+        vec3 viewDir = normalize(fs_gbuffer_params[4].xyz - surface.position);
+        vec3 lightDir = toLight / distance;
+        float diff = max(dot(surface.normal, lightDir), 0.0);
+        vec3 reflectDir = reflect(-lightDir, surface.normal);
+        float spec = pow(max(dot(viewDir, reflectDir), 0.0), fs_material[0].x);
+        float window = clamp(1.0 - pow(distance / PositionRange.w, 4.0), 0.0, 1.0);
+        float attenuation = window * window / (1.0 + 0.09 * distance + 0.032 * (distance * distance));
+        vec3 ambient = Colour * 0.2 * surface.albedo;
+        vec3 diffuse = Colour * 0.5 * diff * surface.albedo;
+        vec3 specular = Colour * spec * surface.specular;
+        FragColor = vec4((ambient + diffuse + specular) * attenuation, 1.0);
+    }
+
+*/
+static const uint8_t volume_fs_source_glsl430[2629] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x6c,
+    0x62,0x65,0x64,0x6f,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x75,0x6e,0x6c,0x69,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x67,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x3b,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,
+    0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x31,0x5d,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,
+    0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x32,0x44,0x20,0x5f,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,
+    0x63,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+    0x31,0x37,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x67,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x38,0x29,
+    0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x32,0x44,0x20,0x5f,0x67,0x44,0x65,0x70,0x74,0x68,0x5f,0x67,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x66,0x6c,0x61,
+    0x74,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x66,0x6c,
+    0x61,0x74,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x43,0x6f,0x6c,0x6f,0x75,
+    0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x65,0x63,
+    0x32,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,0x65,0x72,0x6f,0x28,0x76,0x65,
+    0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,0x76,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,0x2d,0x31,0x2e,0x30,0x2c,
+    0x20,0x76,0x2e,0x79,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,
+    0x30,0x20,0x3a,0x20,0x2d,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,
+    0x63,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,
+    0x76,0x65,0x63,0x33,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x33,0x20,0x62,0x20,0x3d,0x20,0x75,0x76,
+    0x65,0x63,0x33,0x28,0x72,0x6f,0x75,0x6e,0x64,0x28,0x65,0x6e,0x63,0x6f,0x64,0x65,
+    0x64,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x65,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x28,0x28,0x62,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,
+    0x20,0x7c,0x20,0x28,0x62,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x34,0x75,0x29,0x29,0x2c,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x28,0x62,0x2e,0x79,0x20,0x26,
+    0x20,0x31,0x35,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x7c,0x20,0x62,
+    0x2e,0x7a,0x29,0x29,0x20,0x2f,0x20,0x34,0x30,0x39,0x35,0x2e,0x30,0x20,0x2a,0x20,
+    0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x65,0x2c,0x20,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x78,0x29,0x20,0x2d,
+    0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x6e,0x2e,0x7a,0x20,0x3c,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x2e,0x78,
+    0x79,0x20,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x6e,
+    0x2e,0x79,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,
+    0x65,0x72,0x6f,0x28,0x6e,0x2e,0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x5f,0x74,0x20,0x72,0x65,0x61,0x64,0x53,0x75,0x72,0x66,0x61,
+    0x63,0x65,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,
+    0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x67,
+    0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,
+    0x53,0x70,0x65,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,
+    0x68,0x28,0x5f,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x5f,0x67,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,
+    0x6c,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+    0x74,0x63,0x68,0x28,0x5f,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x67,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,
+    0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
+    0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,
+    0x68,0x28,0x5f,0x67,0x44,0x65,0x70,0x74,0x68,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,
+    0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x6e,0x64,0x63,
+    0x20,0x3d,0x20,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,
+    0x2e,0x78,0x79,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x53,0x69,0x7a,0x65,0x28,0x5f,0x67,0x44,0x65,0x70,0x74,0x68,0x5f,0x67,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x30,0x29,0x29,0x29,
+    0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x77,0x6f,0x72,0x6c,0x64,0x20,0x3d,0x20,0x6d,
+    0x61,0x74,0x34,0x28,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,
+    0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x32,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x6e,0x64,0x63,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x2a,0x20,
+    0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x75,0x72,0x66,
+    0x61,0x63,0x65,0x5f,0x74,0x28,0x77,0x6f,0x72,0x6c,0x64,0x2e,0x78,0x79,0x7a,0x20,
+    0x2f,0x20,0x77,0x6f,0x72,0x6c,0x64,0x2e,0x77,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x75,0x6e,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x2e,0x72,0x67,0x62,0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,
+    0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x2e,0x72,0x67,0x62,0x2c,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x2e,0x61,
+    0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2e,0x61,0x20,
+    0x3e,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x5f,0x74,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x20,0x3d,
+    0x20,0x72,0x65,0x61,0x64,0x53,0x75,0x72,0x66,0x61,0x63,0x65,0x28,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x74,0x6f,0x4c,0x69,0x67,0x68,0x74,
+    0x20,0x3d,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,
+    0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x3d,0x20,0x6c,0x65,
+    0x6e,0x67,0x74,0x68,0x28,0x74,0x6f,0x4c,0x69,0x67,0x68,0x74,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x75,
+    0x6e,0x6c,0x69,0x74,0x20,0x7c,0x7c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x20,0x3e,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,
+    0x2e,0x77,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x44,0x69,
+    0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x66,0x73,
+    0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x34,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,
+    0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,
+    0x74,0x6f,0x4c,0x69,0x67,0x68,0x74,0x20,0x2f,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,
+    0x66,0x66,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,
+    0x72,0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x6c,0x69,0x67,
+    0x68,0x74,0x44,0x69,0x72,0x2c,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x73,0x70,0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,
+    0x28,0x64,0x6f,0x74,0x28,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x72,0x65,
+    0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,
+    0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x30,0x5d,0x2e,
+    0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x69,
+    0x6e,0x64,0x6f,0x77,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,
+    0x20,0x2d,0x20,0x70,0x6f,0x77,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,
+    0x2f,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,
+    0x77,0x2c,0x20,0x34,0x2e,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,
+    0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x77,0x69,0x6e,0x64,
+    0x6f,0x77,0x20,0x2a,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x2f,0x20,0x28,0x31,
+    0x2e,0x30,0x20,0x2b,0x20,0x30,0x2e,0x30,0x39,0x20,0x2a,0x20,0x64,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x20,0x2b,0x20,0x30,0x2e,0x30,0x33,0x32,0x20,0x2a,0x20,0x28,
+    0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2a,0x20,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,0x43,0x6f,0x6c,0x6f,0x75,0x72,
+    0x20,0x2a,0x20,0x30,0x2e,0x32,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,
+    0x2e,0x61,0x6c,0x62,0x65,0x64,0x6f,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3d,0x20,0x43,0x6f,0x6c,0x6f,
+    0x75,0x72,0x20,0x2a,0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x20,
+    0x2a,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x61,0x6c,0x62,0x65,0x64,0x6f,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,
+    0x6c,0x61,0x72,0x20,0x3d,0x20,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2a,0x20,0x73,
+    0x70,0x65,0x63,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x73,0x70,
+    0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x28,0x61,0x6d,
+    0x62,0x69,0x65,0x6e,0x74,0x20,0x2b,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,
+    0x2b,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x20,0x2a,0x20,0x61,0x74,
+    0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec3 aNormal;
+    layout(location = 2) in vec2 aTexCoords;
+    out vec3 Normal;
+    out vec2 TexCoords;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        Normal = mat3(mat4(vs_params[12], vs_params[13], vs_params[14], vs_params[15])) * aNormal;
+        TexCoords = aTexCoords;
+    }
+
+*/
+static const uint8_t gbuffer_vs_source_glsl300es[564] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x4e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,
+    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x31,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,
+    0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,
+    0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,
+    0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x31,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x31,0x35,0x5d,0x29,0x29,0x20,0x2a,0x20,0x61,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,
+    0x73,0x20,0x3d,0x20,0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp sampler2D _diffuse_texture_diffuse_texture_smp;
+    uniform highp sampler2D _specular_texture_specular_texture_smp;
+    in highp vec3 Normal;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 gAlbedoSpec;
+    layout(location = 1) out highp vec4 gNormal;
+
+    highp vec2 signNotZero(highp vec2 v)
+    {
+        return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    }
+
+    highp vec3 packNormal(highp vec3 n)
+    {
+        n /= abs(n.x) + abs(n.y) + abs(n.z);
+        highp vec2 e = n.z >= 0.0 ? n.xy : (1.0 - abs(n.yx)) * signNotZero(n.xy);
+        uvec2 q = uvec2(round((e * 0.5 + 0.5) * 4095.0));
+        return vec3(float(q.x >> 4u),
+                    float(((q.x & 15u) << 4u) | (q.y >> 8u)),
+                    float(q.y & 255u)) / 255.0;
+    }
+
+    void main()
+    {
+        gAlbedoSpec = vec4(texture(_diffuse_texture_diffuse_texture_smp, TexCoords).rgb,
+                           texture(_specular_texture_specular_texture_smp, TexCoords).r);
+        gNormal = vec4(packNormal(normalize(Normal)), 0.0);
+    }
+
+*/
+static const uint8_t gbuffer_fs_source_glsl300es[1035] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x4e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,0x65,0x72,
+    0x6f,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x76,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,
+    0x2e,0x30,0x20,0x3a,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x76,0x2e,0x79,0x20,0x3e,
+    0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,0x2d,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x6e,0x20,0x2f,0x3d,0x20,0x61,0x62,0x73,0x28,0x6e,0x2e,0x78,0x29,0x20,
+    0x2b,0x20,0x61,0x62,0x73,0x28,0x6e,0x2e,0x79,0x29,0x20,0x2b,0x20,0x61,0x62,0x73,
+    0x28,0x6e,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x65,0x20,0x3d,0x20,0x6e,0x2e,0x7a,0x20,0x3e,0x3d,
+    0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x6e,0x2e,0x78,0x79,0x20,0x3a,0x20,0x28,0x31,
+    0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x6e,0x2e,0x79,0x78,0x29,0x29,0x20,
+    0x2a,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,0x65,0x72,0x6f,0x28,0x6e,0x2e,
+    0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x32,0x20,0x71,
+    0x20,0x3d,0x20,0x75,0x76,0x65,0x63,0x32,0x28,0x72,0x6f,0x75,0x6e,0x64,0x28,0x28,
+    0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,0x2a,
+    0x20,0x34,0x30,0x39,0x35,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x28,0x71,0x2e,0x78,0x20,0x3e,0x3e,0x20,0x34,0x75,0x29,0x2c,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x28,0x28,0x71,0x2e,0x78,0x20,0x26,0x20,0x31,0x35,0x75,0x29,0x20,
+    0x3c,0x3c,0x20,0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x71,0x2e,0x79,0x20,0x3e,0x3e,
+    0x20,0x38,0x75,0x29,0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x71,0x2e,0x79,
+    0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x29,0x20,0x2f,0x20,0x32,0x35,0x35,0x2e,
+    0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,
+    0x70,0x65,0x63,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x29,0x2e,0x72,0x67,0x62,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
+    0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x65,0x63,0x75,0x6c,
+    0x61,0x72,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 vs_params[16];
+    layout(location = 0) in vec3 aPos;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+    }
+
+*/
+static const uint8_t light_cube_vs_source_glsl300es[325] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x38,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,
+    0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,
+    0x76,0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 light_cube_fs_params[1];
+    layout(location = 0) out highp vec4 gAlbedoSpec;
+    layout(location = 1) out highp vec4 gNormal;
+
+    void main()
+    {
+        gAlbedoSpec = vec4(light_cube_fs_params[0].xyz, 0.0);
+        gNormal = vec4(0.0, 0.0, 0.0, 1.0);
+    }
+
+*/
+static const uint8_t light_cube_fs_source_glsl300es[318] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x63,0x75,0x62,0x65,0x5f,0x66,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x67,
+    0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,
+    0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x41,0x6c,0x62,
+    0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6c,
+    0x69,0x67,0x68,0x74,0x5f,0x63,0x75,0x62,0x65,0x5f,0x66,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x30,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,
+    0x76,0x65,0x63,0x34,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    layout(location = 0) in vec2 aPos;
+
+    void main()
+    {
+        gl_Position = vec4(aPos, 0.0, 1.0);
+    }
+
+*/
+static const uint8_t screen_vs_source_glsl300es[111] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x50,
+    0x6f,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,
+    0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    struct surface_t
+    {
+        highp vec3 position;
+        highp vec3 normal;
+        highp vec3 albedo;
+        highp float specular;
+        bool unlit;
+    };
+
+    uniform highp vec4 fs_gbuffer_params[5];
+    uniform highp vec4 fs_material[1];
+    uniform highp vec4 fs_dir_light[4];
+    uniform highp vec4 fs_spot_light[6];
+    uniform highp sampler2D _gAlbedoSpec_gbuffer_smp;
+    uniform highp sampler2D _gNormal_gbuffer_smp;
+    uniform highp sampler2D _gDepth_gbuffer_smp;
+    layout(location = 0) out highp vec4 FragColor;
+
+    highp vec2 signNotZero(highp vec2 v)
+    {
+        return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    }
+
+    highp vec3 unpackNormal(highp vec3 encoded)
+    {
+        uvec3 b = uvec3(round(encoded * 255.0));
+        highp vec2 e = vec2(float((b.x << 4u) | (b.y >> 4u)),
+                      float(((b.y & 15u) << 8u) | b.z)) / 4095.0 * 2.0 - 1.0;
+        highp vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+        if (n.z < 0.0)
+        {
+            n.xy = (1.0 - abs(n.yx)) * signNotZero(n.xy);
+        }
+        return normalize(n);
+    }
+
+    surface_t readSurface()
+    {
+        ivec2 pixel = ivec2(gl_FragCoord.xy);
+        highp vec4 albedoSpec = texelFetch(_gAlbedoSpec_gbuffer_smp, pixel, 0);
+        highp vec4 normal = texelFetch(_gNormal_gbuffer_smp, pixel, 0);
+        highp float depth = texelFetch(_gDepth_gbuffer_smp, pixel, 0).r;
+        highp vec2 ndc = (gl_FragCoord.xy / vec2(textureSize(_gDepth_gbuffer_smp, 0))) * 2.0 - 1.0;
+        highp vec4 world = mat4(fs_gbuffer_params[0], fs_gbuffer_params[1], fs_gbuffer_params[2], fs_gbuffer_params[3]) * vec4(ndc, depth * 2.0 - 1.0, 1.0);
+        return surface_t(world.xyz / world.w,
+                         unpackNormal(normal.rgb),
+                         albedoSpec.rgb,
+                         albedoSpec.a,
+                         normal.a > 0.5);
+    }
+
+    void main()
+    {
+        surface_t surface = readSurface();
+        if (surface.unlit)
+        {
+            FragColor = vec4(surface.albedo, 1.0);
+            return;
+        }
+        highp vec3 viewDir = normalize(fs_gbuffer_params[4].xyz - surface.position);
+        highp vec3 lightDir = normalize(-fs_dir_light[0].xyz);
+        highp float diff = max(dot(surface.normal, lightDir), 0.0);
+        highp vec3 reflectDir = reflect(-lightDir, surface.normal);
+        highp float spec = pow(max(dot(viewDir, reflectDir), 0.0), fs_material[0].x);
+        highp vec3 result = fs_dir_light[1].xyz * surface.albedo
+                    + fs_dir_light[2].xyz * diff * surface.albedo
+                    + fs_dir_light[3].xyz * spec * surface.specular;
+        lightDir = normalize(fs_spot_light[0].xyz - surface.position);
+        highp float theta = dot(lightDir, normalize(-fs_spot_light[1].xyz));
+        highp float epsilon = fs_spot_light[1].w - fs_spot_light[2].x;
+        highp float intensity = clamp((theta - fs_spot_light[2].x) / epsilon, 0.0, 1.0);
+        diff = max(dot(surface.normal, lightDir), 0.0);
+        reflectDir = reflect(-lightDir, surface.normal);
+        spec = pow(max(dot(viewDir, reflectDir), 0.0), fs_material[0].x);
+        highp float distance = length(fs_spot_light[0].xyz - surface.position);
+        highp float attenuation = 1.0 / (fs_spot_light[4].w + fs_spot_light[5].x * distance + fs_spot_light[5].y * (distance * distance));
+        result += (fs_spot_light[3].xyz * diff * surface.albedo
+                   + fs_spot_light[4].xyz * spec * surface.specular) * attenuation * intensity;
+        FragColor = vec4(result, 1.0);
+    }
+
+*/
+static const uint8_t ambient_fs_source_glsl300es[3327] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x75,0x6e,0x6c,0x69,
+    0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x3b,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x31,
+    0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,
+    0x68,0x74,0x5b,0x34,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,
+    0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x36,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x5f,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,
+    0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x67,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x5f,0x67,0x44,0x65,0x70,0x74,0x68,0x5f,0x67,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,0x65,0x72,0x6f,0x28,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x76,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,0x30,
+    0x20,0x3a,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x76,0x2e,0x79,0x20,0x3e,0x3d,0x20,
+    0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,0x2d,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x33,0x20,0x62,0x20,
+    0x3d,0x20,0x75,0x76,0x65,0x63,0x33,0x28,0x72,0x6f,0x75,0x6e,0x64,0x28,0x65,0x6e,
+    0x63,0x6f,0x64,0x65,0x64,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x65,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,
+    0x62,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x62,0x2e,
+    0x79,0x20,0x3e,0x3e,0x20,0x34,0x75,0x29,0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x28,0x28,0x62,0x2e,0x79,0x20,0x26,0x20,0x31,0x35,0x75,0x29,0x20,
+    0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x7c,0x20,0x62,0x2e,0x7a,0x29,0x29,0x20,0x2f,
+    0x20,0x34,0x30,0x39,0x35,0x2e,0x30,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,
+    0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x65,0x2c,0x20,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x78,0x29,0x20,0x2d,
+    0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x6e,0x2e,0x7a,0x20,0x3c,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x2e,0x78,
+    0x79,0x20,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x6e,
+    0x2e,0x79,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,
+    0x65,0x72,0x6f,0x28,0x6e,0x2e,0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x5f,0x74,0x20,0x72,0x65,0x61,0x64,0x53,0x75,0x72,0x66,0x61,
+    0x63,0x65,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,
+    0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x67,
+    0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x61,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x67,0x41,0x6c,0x62,0x65,0x64,0x6f,
+    0x53,0x70,0x65,0x63,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,
+    0x5f,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+    0x74,0x63,0x68,0x28,0x5f,0x67,0x44,0x65,0x70,0x74,0x68,0x5f,0x67,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,
+    0x30,0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x6e,0x64,0x63,0x20,0x3d,0x20,0x28,0x67,0x6c,0x5f,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2f,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,0x5f,
+    0x67,0x44,0x65,0x70,0x74,0x68,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x30,0x29,0x29,0x29,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,
+    0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x77,0x6f,0x72,0x6c,0x64,0x20,0x3d,0x20,0x6d,0x61,0x74,
+    0x34,0x28,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x66,0x73,
+    0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x32,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x6e,0x64,0x63,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x2a,0x20,0x32,0x2e,
+    0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x75,0x72,0x66,0x61,0x63,
+    0x65,0x5f,0x74,0x28,0x77,0x6f,0x72,0x6c,0x64,0x2e,0x78,0x79,0x7a,0x20,0x2f,0x20,
+    0x77,0x6f,0x72,0x6c,0x64,0x2e,0x77,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x6e,
+    0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x2e,0x72,0x67,0x62,0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x62,
+    0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x2e,0x72,0x67,0x62,0x2c,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x2e,0x61,0x2c,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2e,0x61,0x20,0x3e,0x20,
+    0x30,0x2e,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x72,0x66,0x61,
+    0x63,0x65,0x5f,0x74,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x20,0x3d,0x20,0x72,
+    0x65,0x61,0x64,0x53,0x75,0x72,0x66,0x61,0x63,0x65,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x75,0x6e,
+    0x6c,0x69,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x61,0x6c,0x62,0x65,
+    0x64,0x6f,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+    0x69,0x65,0x77,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,0x75,
+    0x72,0x66,0x61,0x63,0x65,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x69,0x7a,0x65,0x28,0x2d,0x66,0x73,0x5f,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,
+    0x68,0x74,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x66,0x66,
+    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x73,0x75,0x72,0x66,0x61,
+    0x63,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,
+    0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x66,0x6c,0x65,
+    0x63,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,
+    0x2d,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x2c,0x20,0x73,0x75,0x72,0x66,0x61,
+    0x63,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,0x65,0x63,
+    0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x76,
+    0x69,0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,
+    0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x66,0x73,0x5f,0x6d,0x61,
+    0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x30,0x5d,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x3d,0x20,0x66,0x73,0x5f,0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,
+    0x68,0x74,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,
+    0x61,0x63,0x65,0x2e,0x61,0x6c,0x62,0x65,0x64,0x6f,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x66,0x73,0x5f,
+    0x64,0x69,0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,
+    0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,0x61,0x63,
+    0x65,0x2e,0x61,0x6c,0x62,0x65,0x64,0x6f,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x66,0x73,0x5f,0x64,0x69,
+    0x72,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x33,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,
+    0x20,0x73,0x70,0x65,0x63,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,
+    0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,
+    0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,0x75,0x72,0x66,0x61,0x63,
+    0x65,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x68,0x65,
+    0x74,0x61,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,
+    0x72,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2d,0x66,0x73,
+    0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x31,0x5d,0x2e,0x78,
+    0x79,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x65,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x20,0x3d,0x20,
+    0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x31,0x5d,
+    0x2e,0x77,0x20,0x2d,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,
+    0x68,0x74,0x5b,0x32,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x74,0x65,0x6e,0x73,0x69,
+    0x74,0x79,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x74,0x68,0x65,0x74,
+    0x61,0x20,0x2d,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x5b,0x32,0x5d,0x2e,0x78,0x29,0x20,0x2f,0x20,0x65,0x70,0x73,0x69,0x6c,0x6f,
+    0x6e,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x64,0x69,0x66,0x66,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
+    0x28,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,0x72,
+    0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x6c,0x69,0x67,0x68,
+    0x74,0x44,0x69,0x72,0x2c,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x70,0x65,0x63,0x20,
+    0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x76,0x69,
+    0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x44,0x69,
+    0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,
+    0x65,0x72,0x69,0x61,0x6c,0x5b,0x30,0x5d,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x20,0x3d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x66,
+    0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x30,0x5d,0x2e,
+    0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2f,0x20,0x28,0x66,0x73,
+    0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x34,0x5d,0x2e,0x77,
+    0x20,0x2b,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,
+    0x5b,0x35,0x5d,0x2e,0x78,0x20,0x2a,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x20,0x2b,0x20,0x66,0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,
+    0x5b,0x35,0x5d,0x2e,0x79,0x20,0x2a,0x20,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x20,0x2a,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x28,0x66,
+    0x73,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x33,0x5d,0x2e,
+    0x78,0x79,0x7a,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x20,0x2a,0x20,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x2e,0x61,0x6c,0x62,0x65,0x64,0x6f,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x66,0x73,0x5f,
+    0x73,0x70,0x6f,0x74,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5b,0x34,0x5d,0x2e,0x78,0x79,
+    0x7a,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,0x61,
+    0x63,0x65,0x2e,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x29,0x20,0x2a,0x20,0x61,
+    0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x2a,0x20,0x69,0x6e,0x74,
+    0x65,0x6e,0x73,0x69,0x74,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 vs_volume_params[4];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec4 lightPositionRange;
+    layout(location = 2) in vec4 lightColour;
+    flat out vec4 PositionRange;
+    flat out vec3 Colour;
+
+    void main()
+    {
+        gl_Position = mat4(vs_volume_params[0], vs_volume_params[1], vs_volume_params[2], vs_volume_params[3]) * vec4(lightPositionRange.xyz + aPos * lightPositionRange.w, 1.0);
+        PositionRange = lightPositionRange;
+        Colour = lightColour.rgb;
+    }
+
+*/
+static const uint8_t volume_vs_source_glsl300es[491] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,
+    0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x61,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x52,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x3b,
+    0x0a,0x66,0x6c,0x61,0x74,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x66,0x6c,
+    0x61,0x74,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x43,0x6f,0x6c,0x6f,
+    0x75,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x76,0x6f,0x6c,
+    0x75,0x6d,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x75,
+    0x6d,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,
+    0x76,0x65,0x63,0x34,0x28,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2b,0x20,0x61,0x50,
+    0x6f,0x73,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x77,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,
+    0x67,0x65,0x20,0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x43,0x6f,0x6c,
+    0x6f,0x75,0x72,0x20,0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,0x43,0x6f,0x6c,0x6f,0x75,
+    0x72,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    struct surface_t
+    {
+        highp vec3 position;
+        highp vec3 normal;
+        highp vec3 albedo;
+        highp float specular;
+        bool unlit;
+    };
+
+    uniform highp vec4 fs_gbuffer_params[5];
+    uniform highp vec4 fs_material[1];
+    uniform highp sampler2D _gAlbedoSpec_gbuffer_smp;
+    uniform highp sampler2D _gNormal_gbuffer_smp;
+    uniform highp sampler2D _gDepth_gbuffer_smp;
+    flat in highp vec4 PositionRange;
+    flat in highp vec3 Colour;
+    layout(location = 0) out highp vec4 FragColor;
+
+    highp vec2 signNotZero(highp vec2 v)
+    {
+        return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    }
+
+    highp vec3 unpackNormal(highp vec3 encoded)
+    {
+        uvec3 b = uvec3(round(encoded * 255.0));
+        highp vec2 e = vec2(float((b.x << 4u) | (b.y >> 4u)),
+                      float(((b.y & 15u) << 8u) | b.z)) / 4095.0 * 2.0 - 1.0;
+        highp vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+        if (n.z < 0.0)
+        {
+            n.xy = (1.0 - abs(n.yx)) * signNotZero(n.xy);
+        }
+        return normalize(n);
+    }
+
+    surface_t readSurface()
+    {
+        ivec2 pixel = ivec2(gl_FragCoord.xy);
+        highp vec4 albedoSpec = texelFetch(_gAlbedoSpec_gbuffer_smp, pixel, 0);
+        highp vec4 normal = texelFetch(_gNormal_gbuffer_smp, pixel, 0);
+        highp float depth = texelFetch(_gDepth_gbuffer_smp, pixel, 0).r;
+        highp vec2 ndc = (gl_FragCoord.xy / vec2(textureSize(_gDepth_gbuffer_smp, 0))) * 2.0 - 1.0;
+        highp vec4 world = mat4(fs_gbuffer_params[0], fs_gbuffer_params[1], fs_gbuffer_params[2], fs_gbuffer_params[3]) * vec4(ndc, depth * 2.0 - 1.0, 1.0);
+        return surface_t(world.xyz / world.w,
+                         unpackNormal(normal.rgb),
+                         albedoSpec.rgb,
+                         albedoSpec.a,
+                         normal.a > 0.5);
+    }
+
+    void main()
+    {
+        surface_t surface = readSurface();
+        highp vec3 toLight = PositionRange.xyz - surface.position;
+        highp float distance = length(toLight);
+        if (surface.unlit || distance > PositionRange.w)
+        {
+            discard;
+        }
+        highp vec3 viewDir = normalize(fs_gbuffer_params[4].xyz - surface.position);
+        highp vec3 lightDir = toLight / distance;
+        highp float diff = max(dot(surface.normal, lightDir), 0.0);
+        highp vec3 reflectDir = reflect(-lightDir, surface.normal);
+        highp float spec = pow(max(dot(viewDir, reflectDir), 0.0), fs_material[0].x);
+        highp float window = clamp(1.0 - pow(distance / PositionRange.w, 4.0), 0.0, 1.0);
+        highp float attenuation = window * window / (1.0 + 0.09 * distance + 0.032 * (distance * distance));
+        highp vec3 ambient = Colour * 0.2 * surface.albedo;
+        highp vec3 diffuse = Colour * 0.5 * diff * surface.albedo;
+        highp vec3 specular = Colour * spec * surface.specular;
+        FragColor = vec4((ambient + diffuse + specular) * attenuation, 1.0);
+    }
+
+*/
+static const uint8_t volume_fs_source_glsl300es[2783] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x75,0x6e,0x6c,0x69,
+    0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x3b,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x66,0x73,0x5f,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x31,
+    0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x67,0x41,0x6c,0x62,
+    0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,
+    0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x67,0x4e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,
+    0x70,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x67,0x44,0x65,0x70,
+    0x74,0x68,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,
+    0x66,0x6c,0x61,0x74,0x20,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,
+    0x3b,0x0a,0x66,0x6c,0x61,0x74,0x20,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x69,0x67,0x6e,0x4e,0x6f,0x74,0x5a,
+    0x65,0x72,0x6f,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x76,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,
+    0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x76,0x2e,0x79,
+    0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,
+    0x2d,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x65,0x6e,0x63,
+    0x6f,0x64,0x65,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,
+    0x33,0x20,0x62,0x20,0x3d,0x20,0x75,0x76,0x65,0x63,0x33,0x28,0x72,0x6f,0x75,0x6e,
+    0x64,0x28,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,
+    0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x65,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x28,0x62,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x20,0x7c,
+    0x20,0x28,0x62,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x34,0x75,0x29,0x29,0x2c,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x28,0x62,0x2e,0x79,0x20,0x26,0x20,0x31,
+    0x35,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x7c,0x20,0x62,0x2e,0x7a,
+    0x29,0x29,0x20,0x2f,0x20,0x34,0x30,0x39,0x35,0x2e,0x30,0x20,0x2a,0x20,0x32,0x2e,
+    0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x65,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x65,0x2e,
+    0x78,0x29,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x65,0x2e,0x79,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6e,0x2e,0x7a,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6e,0x2e,0x78,0x79,0x20,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,
+    0x62,0x73,0x28,0x6e,0x2e,0x79,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,0x69,0x67,0x6e,
+    0x4e,0x6f,0x74,0x5a,0x65,0x72,0x6f,0x28,0x6e,0x2e,0x78,0x79,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x20,0x72,0x65,0x61,0x64,0x53,
+    0x75,0x72,0x66,0x61,0x63,0x65,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x76,0x65,0x63,0x32,0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,0x76,0x65,
+    0x63,0x32,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,
+    0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x67,0x41,0x6c,
+    0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+    0x74,0x63,0x68,0x28,0x5f,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x67,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,
+    0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x67,0x44,0x65,0x70,0x74,0x68,0x5f,
+    0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,
+    0x65,0x6c,0x2c,0x20,0x30,0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x6e,0x64,0x63,0x20,0x3d,0x20,0x28,
+    0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,
+    0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,
+    0x7a,0x65,0x28,0x5f,0x67,0x44,0x65,0x70,0x74,0x68,0x5f,0x67,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x30,0x29,0x29,0x29,0x20,0x2a,0x20,0x32,
+    0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x77,0x6f,0x72,0x6c,0x64,0x20,0x3d,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x67,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x2c,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,
+    0x76,0x65,0x63,0x34,0x28,0x6e,0x64,0x63,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x75,
+    0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x28,0x77,0x6f,0x72,0x6c,0x64,0x2e,0x78,0x79,
+    0x7a,0x20,0x2f,0x20,0x77,0x6f,0x72,0x6c,0x64,0x2e,0x77,0x2c,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x2e,0x72,0x67,0x62,0x29,0x2c,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,0x2e,0x72,0x67,0x62,0x2c,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x62,0x65,0x64,0x6f,0x53,0x70,0x65,0x63,
+    0x2e,0x61,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2e,
+    0x61,0x20,0x3e,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x75,0x72,0x66,0x61,0x63,0x65,0x5f,0x74,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,
+    0x20,0x3d,0x20,0x72,0x65,0x61,0x64,0x53,0x75,0x72,0x66,0x61,0x63,0x65,0x28,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x74,0x6f,0x4c,0x69,0x67,0x68,0x74,0x20,0x3d,0x20,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,
+    0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x3d,0x20,0x6c,0x65,0x6e,0x67,
+    0x74,0x68,0x28,0x74,0x6f,0x4c,0x69,0x67,0x68,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x75,0x6e,0x6c,
+    0x69,0x74,0x20,0x7c,0x7c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x3e,
+    0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,0x65,0x2e,0x77,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,
+    0x65,0x77,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,
+    0x65,0x28,0x66,0x73,0x5f,0x67,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,
+    0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x74,0x6f,0x4c,0x69,0x67,0x68,
+    0x74,0x20,0x2f,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,
+    0x66,0x66,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x66,
+    0x6c,0x65,0x63,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,
+    0x74,0x28,0x2d,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x2c,0x20,0x73,0x75,0x72,
+    0x66,0x61,0x63,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,
+    0x65,0x63,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
+    0x28,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,
+    0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x66,0x73,0x5f,
+    0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x5b,0x30,0x5d,0x2e,0x78,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,
+    0x2e,0x30,0x20,0x2d,0x20,0x70,0x6f,0x77,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x20,0x2f,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x52,0x61,0x6e,0x67,
+    0x65,0x2e,0x77,0x2c,0x20,0x34,0x2e,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x2a,0x20,0x77,0x69,0x6e,
+    0x64,0x6f,0x77,0x20,0x2f,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x30,0x2e,0x30,
+    0x39,0x20,0x2a,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2b,0x20,0x30,
+    0x2e,0x30,0x33,0x32,0x20,0x2a,0x20,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x20,0x2a,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x6d,
+    0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2a,
+    0x20,0x30,0x2e,0x32,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x61,
+    0x6c,0x62,0x65,0x64,0x6f,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x3d,0x20,
+    0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2a,0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x64,
+    0x69,0x66,0x66,0x20,0x2a,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x61,0x6c,
+    0x62,0x65,0x64,0x6f,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3d,0x20,
+    0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x20,0x2a,0x20,
+    0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x28,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,
+    0x2b,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x2b,0x20,0x73,0x70,0x65,0x63,
+    0x75,0x6c,0x61,0x72,0x29,0x20,0x2a,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,
+    0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* ambient_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)screen_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)ambient_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 80;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 5;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_gbuffer_params";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "fs_dir_light";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "fs_material";
+            desc.uniform_blocks[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[4].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[4].size = 96;
+            desc.uniform_blocks[4].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[4].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[4].glsl_uniforms[0].glsl_name = "fs_spot_light";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_DEPTH;
+            desc.images[2].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_gAlbedoSpec_gbuffer_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_gNormal_gbuffer_smp";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 0;
+            desc.image_sampler_pairs[2].glsl_name = "_gDepth_gbuffer_smp";
+            desc.label = "ambient_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)screen_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)ambient_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 80;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 5;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_gbuffer_params";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 64;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "fs_dir_light";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "fs_material";
+            desc.uniform_blocks[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[4].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[4].size = 96;
+            desc.uniform_blocks[4].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[4].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[4].glsl_uniforms[0].glsl_name = "fs_spot_light";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_DEPTH;
+            desc.images[2].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_gAlbedoSpec_gbuffer_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_gNormal_gbuffer_smp";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 0;
+            desc.image_sampler_pairs[2].glsl_name = "_gDepth_gbuffer_smp";
+            desc.label = "ambient_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* gbuffer_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)gbuffer_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)gbuffer_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aNormal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_diffuse_texture_diffuse_texture_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[1].glsl_name = "_specular_texture_specular_texture_smp";
+            desc.label = "gbuffer_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)gbuffer_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)gbuffer_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aNormal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_diffuse_texture_diffuse_texture_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[1].glsl_name = "_specular_texture_specular_texture_smp";
+            desc.label = "gbuffer_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* light_cube_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)light_cube_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)light_cube_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "light_cube_fs_params";
+            desc.label = "light_cube_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)light_cube_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)light_cube_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 256;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "light_cube_fs_params";
+            desc.label = "light_cube_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* volume_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)volume_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)volume_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "lightPositionRange";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "lightColour";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 64;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_volume_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 80;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 5;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_gbuffer_params";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "fs_material";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_DEPTH;
+            desc.images[2].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_gAlbedoSpec_gbuffer_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_gNormal_gbuffer_smp";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 0;
+            desc.image_sampler_pairs[2].glsl_name = "_gDepth_gbuffer_smp";
+            desc.label = "volume_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)volume_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)volume_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "lightPositionRange";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "lightColour";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 64;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_volume_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 80;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 5;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_gbuffer_params";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 16;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "fs_material";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_DEPTH;
+            desc.images[2].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_gAlbedoSpec_gbuffer_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_gNormal_gbuffer_smp";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 0;
+            desc.image_sampler_pairs[2].glsl_name = "_gDepth_gbuffer_smp";
+            desc.label = "volume_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
@@ -0,0 +1,404 @@
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <sjd/camera.h>
+#include <sjd/outline.h>
+#include <sjd/render_graph.h>
+#include <sjd/sok_texture.h>
+#include <vector>
+
+#define SOKOL_DEBUG
+#define SOKOL_IMPL
+#ifndef __EMSCRIPTEN__
+#define SOKOL_GLCORE
+#else
+#define SOKOL_GLES3
+#endif
+#include <sokol/sokol_app.h>
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_log.h>
+#include <sokol/sokol_fetch.h>
+#include <sokol/sokol_glue.h>
+#include <sokol/sokol_time.h>
+
+// add the shader after glm
+#include "2-id-outlines.glsl.h"
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+/* The outlines from 1-stencil-testing without drawing anything twice. The
+ * scene pass writes an object id next to the colour and one fullscreen pass
+ * draws the outlines from the ids (sjd/outline.h), so the cost doesn't go up
+ * with the number of selected objects and the L shaped object made of three
+ * cubes gets one outline around the whole shape, not one per cube.
+ *
+ * 1 - 3 select and deselect the objects, + and - change the outline width.
+ */
+namespace state {
+    sg_pipeline pip;
+    sg_bindings bind_cubes;
+    sg_bindings bind_plane;
+    sg_pass_action pass_action;
+    sjd::RenderGraph graph;
+    sjd::RenderGraph::PassId scene_pass;
+    sjd::Outline outline;
+    sjd::Camera camera(glm::vec3(3.0f, 0.8f, 4.0f),
+                       glm::vec3(1.0f, 0.4f, 0.0f));
+    uint64_t last_time;
+    float deltaTime;
+}
+namespace offscreen {
+    sjd::RenderGraph::Target color;
+    sjd::RenderGraph::Target ids;
+    sjd::RenderGraph::Target depth;
+}
+
+// a cube and the id of the object it belongs to, the plane is id 0 and
+// can't be selected
+struct Cube {
+    glm::vec3 position;
+    uint16_t id;
+};
+
+const std::vector<Cube> CUBES {
+    {glm::vec3(-1.0f, 0.0f, -1.0f), 1},
+    {glm::vec3( 2.0f, 0.0f,  0.0f), 2},
+    {glm::vec3( 0.0f, 0.0f,  1.5f), 3},
+    {glm::vec3( 0.0f, 1.0f,  1.5f), 3},
+    {glm::vec3(-1.0f, 0.0f,  1.5f), 3},
+};
+const uint16_t OBJECT_COUNT {3};
+
+static void fail_callback() {
+    state::pass_action = sg_pass_action {
+        .colors = {{ .load_action=SG_LOADACTION_CLEAR,
+            .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f }
+        }}
+    };
+    state::graph.setPassAction(state::scene_pass, state::pass_action);
+}
+
+static void draw_scene();
+
+// the scene pass draws colour and ids side by side, the outline pass reads
+// both and fills the whole window so the swapchain doesn't need clearing
+static void create_render_graph() {
+    offscreen::color = state::graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = SG_PIXELFORMAT_RGBA8,
+        .label = "color-image"
+    });
+    offscreen::ids = sjd::Outline::idTarget(state::graph);
+    offscreen::depth = state::graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = SG_PIXELFORMAT_DEPTH,
+        .label = "depth-image"
+    });
+
+    state::scene_pass = state::graph.addPass(sjd::RenderGraph::PassDesc {
+        .name = "scene-pass",
+        .colors = {offscreen::color, offscreen::ids},
+        .depth = offscreen::depth,
+        .action = state::pass_action,
+    }, draw_scene);
+
+    state::outline.addComposite(state::graph, offscreen::color, offscreen::ids, sg_pass_action {
+        .colors = {{ .load_action = SG_LOADACTION_DONTCARE }}
+    });
+}
+
+static void init(void) {
+    sg_setup(sg_desc {
+        .logger {
+            .func = slog_func
+        },
+        .environment = sglue_environment(),
+    });
+
+    sfetch_setup(sfetch_desc_t {
+        .max_requests = 8,
+        .num_channels = 1,
+        .num_lanes = 1,
+        .logger {
+            .func = slog_func
+        },
+    });
+
+    stm_setup();
+
+    std::vector<float> vertices {
+        // positions          // texture coords
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f,
+
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  1.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+
+        -0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+
+        -0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f
+    };
+
+    sg_buffer cube_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = vertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = vertices.data(),
+            .size = vertices.size() * sizeof(float),
+        },
+        .label = "cube-vertices"
+    });
+
+    state::bind_cubes.vertex_buffers[0] = cube_buffer;
+
+    std::vector<float> planeVertices = {
+        // positions        // texture Coords
+         5.0f, -0.5f,  5.0f,  2.0f, 0.0f,
+        -5.0f, -0.5f,  5.0f,  0.0f, 0.0f,
+        -5.0f, -0.5f, -5.0f,  0.0f, 2.0f,
+
+         5.0f, -0.5f,  5.0f,  2.0f, 0.0f,
+        -5.0f, -0.5f, -5.0f,  0.0f, 2.0f,
+         5.0f, -0.5f, -5.0f,  2.0f, 2.0f
+    };
+
+    sg_buffer plane_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = planeVertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = planeVertices.data(),
+            .size = planeVertices.size() * sizeof(float),
+        },
+        .label = "plane-vertices"
+    });
+
+    state::bind_plane.vertex_buffers[0] = plane_buffer;
+
+    // create shader from code-generated sg_shader_desc
+    sg_shader simple_shd = sg_make_shader(simple_shader_desc(sg_query_backend()));
+
+    // we need to initialise layout seperately to the pipeline
+    // because we cant do array initilisation of structs in C++
+    sg_vertex_layout_state layout {};
+    layout.attrs[ATTR_simple_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    layout.attrs[ATTR_simple_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
+
+    // no stencil any more, just a second colour attachment for the ids
+    state::pip = sg_make_pipeline(sg_pipeline_desc {
+        .shader = simple_shd,
+        .layout = layout,
+        .depth {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = true,
+        },
+        .color_count = 2,
+        .colors = {
+            { .pixel_format = SG_PIXELFORMAT_RGBA8 },
+            { .pixel_format = sjd::Outline::ID_FORMAT },
+        },
+        .label = "object-pipeline"
+    });
+
+    state::outline.setup(sg_make_shader(outline_shader_desc(sg_query_backend())));
+    for (uint16_t id {1}; id <= OBJECT_COUNT; id++)
+        state::outline.select(id, true);
+
+    // a pass action to clear framebuffer, the ids clear to 0 (nothing)
+    state::pass_action = sg_pass_action {
+        .colors = {
+            {
+                .load_action=SG_LOADACTION_CLEAR,
+                .clear_value={0.1f, 0.1f, 0.1f, 1.0f}
+            },
+            {
+                .load_action=SG_LOADACTION_CLEAR,
+                .clear_value={0.0f, 0.0f, 0.0f, 0.0f}
+            },
+        }
+    };
+
+    create_render_graph();
+
+    SokTexture marble("../data/marble.jpg",
+                          state::bind_cubes,
+                          IMG__texture1,
+                          SMP_texture1_smp,
+                          true,
+                          fail_callback);
+
+    SokTexture metal("../data/metal.png",
+                                   state::bind_plane,
+                                   IMG__texture1,
+                                   SMP_texture1_smp,
+                                   true,
+                                   fail_callback);
+
+}
+
+void frame(void) {
+    sfetch_dowork();
+
+    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
+
+    if (!sapp_mouse_locked()) {
+        sapp_lock_mouse(true);
+    }
+    state::camera.moveCamera(state::deltaTime);
+
+    state::graph.execute(sglue_swapchain());
+    sg_commit();
+}
+
+static void draw_scene() {
+    glm::mat4 view = state::camera.getViewMatrix();
+    glm::mat4 projection = glm::perspective(glm::radians(state::camera.zoom), static_cast<float>(sapp_width()) / sapp_height(), 0.1f, 100.0f);
+    vs_params_t vs_params = {
+        .view = view,
+        .projection = projection
+    };
+
+    sg_apply_pipeline(state::pip);
+
+    // Plane
+    sg_apply_bindings(state::bind_plane);
+
+    vs_params.model = glm::mat4(1.0f);
+    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+    fs_object_t fs_object = {
+        .objectId = state::outline.idColour(0)
+    };
+    sg_apply_uniforms(UB_fs_object, SG_RANGE(fs_object));
+    sg_draw(0, 6, 1);
+
+    // Cubes, every one writes the id of its object and that's all the
+    // outlines need
+    sg_apply_bindings(state::bind_cubes);
+
+    for (const Cube& cube : CUBES) {
+        vs_params.model = glm::translate(glm::mat4(1.0f), cube.position);
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        fs_object.objectId = state::outline.idColour(cube.id);
+        sg_apply_uniforms(UB_fs_object, SG_RANGE(fs_object));
+        sg_draw(0, 36, 1);
+    }
+}
+
+void cleanup(void) {
+    state::graph.report();
+    state::outline.shutdown();
+    sfetch_shutdown();
+    sg_shutdown();
+}
+
+void event(const sapp_event* e) {
+    if (e->type == SAPP_EVENTTYPE_KEY_DOWN) {
+        if (e->key_code == SAPP_KEYCODE_ESCAPE) {
+            sapp_request_quit();
+        }
+        if (e->key_code >= SAPP_KEYCODE_1 && e->key_code < SAPP_KEYCODE_1 + OBJECT_COUNT) {
+            uint16_t id {static_cast<uint16_t>(e->key_code - SAPP_KEYCODE_1 + 1)};
+            state::outline.select(id, !state::outline.selected(id));
+        }
+        if (e->key_code == SAPP_KEYCODE_EQUAL || e->key_code == SAPP_KEYCODE_KP_ADD)
+            state::outline.settings.width = std::min(state::outline.settings.width + 1, sjd::Outline::MAX_WIDTH);
+        if (e->key_code == SAPP_KEYCODE_MINUS || e->key_code == SAPP_KEYCODE_KP_SUBTRACT)
+            state::outline.settings.width = std::max(state::outline.settings.width - 1, 1);
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::PRESS);
+    }
+
+    if (e->type == SAPP_EVENTTYPE_KEY_UP) {
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::RELEASE);
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_BEGAN) {
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_MOVED) {
+        float offsetX = e -> touches[0].pos_x - state::camera.lastX;
+        float offsetY = state::camera.lastY - e -> touches[0].pos_y;
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+        state::camera.processMouseMovement(offsetX, offsetY);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+        state::camera.processMouseMovement(e->mouse_dx, -e->mouse_dy);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_SCROLL) {
+        state::camera.processMouseScroll(e->scroll_y);
+    }
+
+}
+
+sapp_desc sokol_main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    return sapp_desc {
+        .init_cb = init,
+        .frame_cb = frame,
+        .cleanup_cb = cleanup,
+        .event_cb = event,
+        .width = 800,
+        .height = 600,
+        .high_dpi = true,
+        .window_title = "ID Buffer Outlines - LearnOpenGL",
+        .logger {
+            .func = slog_func
+        },
+#ifdef _WIN32
+        .win32_console_utf8 = true,
+        .win32_console_attach = true,
+#endif
+    };
+}
+
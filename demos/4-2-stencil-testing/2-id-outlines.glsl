@@ -0,0 +1,45 @@
+@ctype mat4 glm::mat4
+@ctype vec4 glm::vec4
+
+@include ../../include/sjd/glsl/outline.glsl
+
+@vs vs
+in vec3 aPos;
+in vec2 aTexCoords;
+
+out vec2 TexCoords;
+
+layout(binding = 0) uniform vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+};
+
+void main() {
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    TexCoords = aTexCoords;
+}
+@end
+
+@fs fs
+in vec2 TexCoords;
+
+layout(location = 0) out vec4 FragColor;
+// sjd::Outline::idColour() of the object being drawn
+layout(location = 1) out vec4 ObjectId;
+
+layout(binding = 0) uniform texture2D _texture1;
+layout(binding = 0) uniform sampler texture1_smp;
+#define texture1 sampler2D(_texture1, texture1_smp)
+
+layout(binding = 1) uniform fs_object {
+    vec4 objectId;
+};
+
+void main() {
+    FragColor = texture(texture1, TexCoords);
+    ObjectId = objectId;
+}
+@end
+
+@program simple vs fs
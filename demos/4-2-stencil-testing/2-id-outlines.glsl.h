@@ -0,0 +1,747 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i .\2-id-outlines.glsl -o .\2-id-outlines.glsl.h -l glsl430:glsl300es
+
+    Overview:
+    =========
+    Shader program: 'outline':
+        Get shader desc: outline_shader_desc(sg_query_backend());
+        Vertex Shader: vs_outline
+        Fragment Shader: fs_outline
+    Shader program: 'simple':
+        Get shader desc: simple_shader_desc(sg_query_backend());
+        Vertex Shader: vs
+        Fragment Shader: fs
+        Attributes:
+            ATTR_simple_aPos => 0
+            ATTR_simple_aTexCoords => 1
+    Bindings:
+        Uniform block 'outline_params':
+            C struct: outline_params_t
+            Bind slot: UB_outline_params => 0
+        Uniform block 'vs_params':
+            C struct: vs_params_t
+            Bind slot: UB_vs_params => 0
+        Uniform block 'fs_object':
+            C struct: fs_object_t
+            Bind slot: UB_fs_object => 1
+        Image '_ids':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__ids => 1
+        Image '_scene':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__scene => 0
+        Image '_texture1':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__texture1 => 0
+        Sampler 'outline_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_outline_smp => 0
+        Sampler 'texture1_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_texture1_smp => 0
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before 2-id-outlines.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define ATTR_simple_aPos (0)
+#define ATTR_simple_aTexCoords (1)
+#define UB_outline_params (0)
+#define UB_vs_params (0)
+#define UB_fs_object (1)
+#define IMG__ids (1)
+#define IMG__scene (0)
+#define IMG__texture1 (0)
+#define SMP_outline_smp (0)
+#define SMP_texture1_smp (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct outline_params_t {
+    glm::vec4 outlineColour;
+    glm::vec4 params;
+} outline_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
+    glm::mat4 model;
+    glm::mat4 view;
+    glm::mat4 projection;
+} vs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_object_t {
+    glm::vec4 objectId;
+} fs_object_t;
+#pragma pack(pop)
+/*
+    #version 430
+
+    void main()
+    {
+        vec2 uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+        gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+    }
+
+*/
+static const uint8_t vs_outline_source_glsl430[143] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x3c,0x3c,0x20,0x31,
+    0x29,0x20,0x26,0x20,0x32,0x2c,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x49,0x44,0x20,0x26,0x20,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x75,0x76,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x2c,0x20,
+    0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 outline_params[2];
+    layout(binding = 16) uniform sampler2D _ids_outline_smp;
+    layout(binding = 17) uniform sampler2D _scene_outline_smp;
+    layout(location = 0) out vec4 FragColor;
+
+    int objectId(ivec2 pixel)
+    {
+        vec2 rg = round(texelFetch(_ids_outline_smp, pixel, 0).rg * 255.0);
+        return int(rg.x) + int(rg.y) * 256;
+    }
+
+    void main()
+    {
+        ivec2 pixel = ivec2(gl_FragCoord.xy);
+        ivec2 size = textureSize(_ids_outline_smp, 0) - 1;
+        vec4 colour = texelFetch(_scene_outline_smp, pixel, 0);
+        int centre = objectId(pixel);
+        int width = int(outline_params[1].x);
+        int directions = int(outline_params[1].y);
+        float coverage = 0.0;
+        for (int d = 0; d < 16; d++)
+        {
+            if (d >= directions)
+            {
+                break;
+            }
+            float angle = 6.2831853 * float(d) / float(directions);
+            vec2 step = vec2(cos(angle), sin(angle));
+            for (int i = 1; i <= 8; i++)
+            {
+                if (i > width)
+                {
+                    break;
+                }
+                ivec2 p = clamp(pixel + ivec2(round(step * float(i))), ivec2(0), size);
+                int id = objectId(p);
+                if (id >= 32768 && id != centre)
+                {
+                    coverage = 1.0;
+                    break;
+                }
+            }
+        }
+        FragColor = vec4(mix(colour.rgb, outline_params[0].rgb, coverage * outline_params[0].a), colour.a);
+    }
+
+*/
+static const uint8_t fs_outline_source_glsl430[1383] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x6f,0x75,0x74,0x6c,0x69,
+    0x6e,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,
+    0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x32,0x44,0x20,0x5f,0x69,0x64,0x73,0x5f,0x6f,0x75,0x74,0x6c,0x69,0x6e,
+    0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x37,0x29,0x20,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,
+    0x63,0x65,0x6e,0x65,0x5f,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x73,0x6d,0x70,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x69,0x6e,0x74,0x20,
+    0x6f,0x62,0x6a,0x65,0x63,0x74,0x49,0x64,0x28,0x69,0x76,0x65,0x63,0x32,0x20,0x70,
+    0x69,0x78,0x65,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x72,0x67,0x20,0x3d,0x20,0x72,0x6f,0x75,0x6e,0x64,0x28,0x74,0x65,0x78,0x65,
+    0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x69,0x64,0x73,0x5f,0x6f,0x75,0x74,0x6c,
+    0x69,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,
+    0x30,0x29,0x2e,0x72,0x67,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,0x74,0x28,0x72,
+    0x67,0x2e,0x78,0x29,0x20,0x2b,0x20,0x69,0x6e,0x74,0x28,0x72,0x67,0x2e,0x79,0x29,
+    0x20,0x2a,0x20,0x32,0x35,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,
+    0x63,0x32,0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,
+    0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x73,0x69,0x7a,
+    0x65,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,
+    0x5f,0x69,0x64,0x73,0x5f,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x30,0x29,0x20,0x2d,0x20,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x73,0x63,0x65,0x6e,0x65,0x5f,0x6f,0x75,
+    0x74,0x6c,0x69,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,
+    0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x65,
+    0x6e,0x74,0x72,0x65,0x20,0x3d,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x49,0x64,0x28,
+    0x70,0x69,0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x77,0x69,0x64,0x74,0x68,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x6f,0x75,0x74,0x6c,
+    0x69,0x6e,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x64,0x69,0x72,0x65,0x63,0x74,
+    0x69,0x6f,0x6e,0x73,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x6f,0x75,0x74,0x6c,0x69,
+    0x6e,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x79,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x76,0x65,0x72,
+    0x61,0x67,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x3b,0x20,0x64,
+    0x20,0x3c,0x20,0x31,0x36,0x3b,0x20,0x64,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x64,0x20,
+    0x3e,0x3d,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x73,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x61,0x6e,0x67,0x6c,0x65,0x20,0x3d,0x20,0x36,0x2e,0x32,0x38,
+    0x33,0x31,0x38,0x35,0x33,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x64,0x29,
+    0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
+    0x6f,0x6e,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x73,0x74,0x65,0x70,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x63,
+    0x6f,0x73,0x28,0x61,0x6e,0x67,0x6c,0x65,0x29,0x2c,0x20,0x73,0x69,0x6e,0x28,0x61,
+    0x6e,0x67,0x6c,0x65,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x31,0x3b,0x20,
+    0x69,0x20,0x3c,0x3d,0x20,0x38,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x20,0x3e,0x20,0x77,0x69,0x64,0x74,0x68,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x72,
+    0x6f,0x75,0x6e,0x64,0x28,0x73,0x74,0x65,0x70,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x69,0x29,0x29,0x29,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x30,0x29,
+    0x2c,0x20,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x64,0x20,0x3d,0x20,0x6f,0x62,
+    0x6a,0x65,0x63,0x74,0x49,0x64,0x28,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x20,0x3e,0x3d,
+    0x20,0x33,0x32,0x37,0x36,0x38,0x20,0x26,0x26,0x20,0x69,0x64,0x20,0x21,0x3d,0x20,
+    0x63,0x65,0x6e,0x74,0x72,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x3d,
+    0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x6d,0x69,0x78,0x28,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x72,0x67,0x62,0x2c,0x20,
+    0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2e,0x72,0x67,0x62,0x2c,0x20,0x63,0x6f,0x76,0x65,0x72,0x61,0x67,0x65,0x20,
+    0x2a,0x20,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x61,0x29,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x61,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 vs_params[12];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec2 aTexCoords;
+    layout(location = 0) out vec2 TexCoords;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        TexCoords = aTexCoords;
+    }
+
+*/
+static const uint8_t vs_source_glsl430[432] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x54,0x65,0x78,0x43,0x6f,
+    0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,
+    0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,
+    0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 fs_object[1];
+    layout(binding = 16) uniform sampler2D _texture1_texture1_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+    layout(location = 1) out vec4 ObjectId;
+
+    void main()
+    {
+        FragColor = texture(_texture1_texture1_smp, TexCoords);
+        ObjectId = fs_object[0];
+    }
+
+*/
+static const uint8_t fs_source_glsl430[333] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x6f,0x62,
+    0x6a,0x65,0x63,0x74,0x5b,0x31,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x31,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x31,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x4f,0x62,0x6a,0x65,0x63,0x74,0x49,0x64,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x31,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x31,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x4f,0x62,0x6a,0x65,0x63,0x74,0x49,0x64,0x20,0x3d,0x20,0x66,0x73,0x5f,0x6f,0x62,
+    0x6a,0x65,0x63,0x74,0x5b,0x30,0x5d,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    void main()
+    {
+        vec2 uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+        gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+    }
+
+*/
+static const uint8_t vs_outline_source_glsl300es[146] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x3c,
+    0x3c,0x20,0x31,0x29,0x20,0x26,0x20,0x32,0x2c,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,
+    0x74,0x65,0x78,0x49,0x44,0x20,0x26,0x20,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x75,0x76,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,
+    0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 outline_params[2];
+    uniform highp sampler2D _ids_outline_smp;
+    uniform highp sampler2D _scene_outline_smp;
+    layout(location = 0) out highp vec4 FragColor;
+
+    int objectId(ivec2 pixel)
+    {
+        highp vec2 rg = round(texelFetch(_ids_outline_smp, pixel, 0).rg * 255.0);
+        return int(rg.x) + int(rg.y) * 256;
+    }
+
+    void main()
+    {
+        ivec2 pixel = ivec2(gl_FragCoord.xy);
+        ivec2 size = textureSize(_ids_outline_smp, 0) - 1;
+        highp vec4 colour = texelFetch(_scene_outline_smp, pixel, 0);
+        int centre = objectId(pixel);
+        int width = int(outline_params[1].x);
+        int directions = int(outline_params[1].y);
+        highp float coverage = 0.0;
+        for (int d = 0; d < 16; d++)
+        {
+            if (d >= directions)
+            {
+                break;
+            }
+            highp float angle = 6.2831853 * float(d) / float(directions);
+            highp vec2 step = vec2(cos(angle), sin(angle));
+            for (int i = 1; i <= 8; i++)
+            {
+                if (i > width)
+                {
+                    break;
+                }
+                ivec2 p = clamp(pixel + ivec2(round(step * float(i))), ivec2(0), size);
+                int id = objectId(p);
+                if (id >= 32768 && id != centre)
+                {
+                    coverage = 1.0;
+                    break;
+                }
+            }
+        }
+        FragColor = vec4(mix(colour.rgb, outline_params[0].rgb, coverage * outline_params[0].a), colour.a);
+    }
+
+*/
+static const uint8_t fs_outline_source_glsl300es[1444] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x32,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x69,0x64,
+    0x73,0x5f,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x65,0x6e,0x65,0x5f,0x6f,0x75,
+    0x74,0x6c,0x69,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x6f,
+    0x62,0x6a,0x65,0x63,0x74,0x49,0x64,0x28,0x69,0x76,0x65,0x63,0x32,0x20,0x70,0x69,
+    0x78,0x65,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x72,0x67,0x20,0x3d,0x20,0x72,0x6f,0x75,0x6e,0x64,
+    0x28,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x5f,0x69,0x64,0x73,
+    0x5f,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,
+    0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x2e,0x72,0x67,0x20,0x2a,0x20,0x32,0x35,0x35,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x69,0x6e,0x74,0x28,0x72,0x67,0x2e,0x78,0x29,0x20,0x2b,0x20,0x69,0x6e,0x74,0x28,
+    0x72,0x67,0x2e,0x79,0x29,0x20,0x2a,0x20,0x32,0x35,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,
+    0x69,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,
+    0x72,0x64,0x2e,0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,
+    0x32,0x20,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x53,0x69,0x7a,0x65,0x28,0x5f,0x69,0x64,0x73,0x5f,0x6f,0x75,0x74,0x6c,0x69,0x6e,
+    0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x30,0x29,0x20,0x2d,0x20,0x31,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,
+    0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,
+    0x68,0x28,0x5f,0x73,0x63,0x65,0x6e,0x65,0x5f,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x65,0x6e,0x74,0x72,0x65,0x20,
+    0x3d,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x49,0x64,0x28,0x70,0x69,0x78,0x65,0x6c,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x77,0x69,0x64,0x74,0x68,
+    0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x73,0x20,
+    0x3d,0x20,0x69,0x6e,0x74,0x28,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x76,0x65,
+    0x72,0x61,0x67,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x3b,0x20,
+    0x64,0x20,0x3c,0x20,0x31,0x36,0x3b,0x20,0x64,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x64,
+    0x20,0x3e,0x3d,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x73,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6e,0x67,0x6c,0x65,
+    0x20,0x3d,0x20,0x36,0x2e,0x32,0x38,0x33,0x31,0x38,0x35,0x33,0x20,0x2a,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x28,0x64,0x29,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,
+    0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x73,0x74,0x65,0x70,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x63,0x6f,0x73,0x28,
+    0x61,0x6e,0x67,0x6c,0x65,0x29,0x2c,0x20,0x73,0x69,0x6e,0x28,0x61,0x6e,0x67,0x6c,
+    0x65,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,
+    0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x31,0x3b,0x20,0x69,0x20,0x3c,
+    0x3d,0x20,0x38,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x20,0x3e,0x20,0x77,0x69,0x64,0x74,0x68,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,
+    0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x76,
+    0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x70,0x69,
+    0x78,0x65,0x6c,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x72,0x6f,0x75,0x6e,
+    0x64,0x28,0x73,0x74,0x65,0x70,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,
+    0x29,0x29,0x29,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x30,0x29,0x2c,0x20,0x73,
+    0x69,0x7a,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x64,0x20,0x3d,0x20,0x6f,0x62,0x6a,0x65,0x63,
+    0x74,0x49,0x64,0x28,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x20,0x3e,0x3d,0x20,0x33,0x32,
+    0x37,0x36,0x38,0x20,0x26,0x26,0x20,0x69,0x64,0x20,0x21,0x3d,0x20,0x63,0x65,0x6e,
+    0x74,0x72,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x6f,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x3d,0x20,0x31,0x2e,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6d,0x69,0x78,
+    0x28,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x72,0x67,0x62,0x2c,0x20,0x6f,0x75,0x74,
+    0x6c,0x69,0x6e,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x72,
+    0x67,0x62,0x2c,0x20,0x63,0x6f,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x2a,0x20,0x6f,
+    0x75,0x74,0x6c,0x69,0x6e,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
+    0x2e,0x61,0x29,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x61,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 vs_params[12];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec2 aTexCoords;
+    out vec2 TexCoords;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        TexCoords = aTexCoords;
+    }
+
+*/
+static const uint8_t vs_source_glsl300es[414] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x54,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x61,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 fs_object[1];
+    uniform highp sampler2D _texture1_texture1_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+    layout(location = 1) out highp vec4 ObjectId;
+
+    void main()
+    {
+        FragColor = texture(_texture1_texture1_smp, TexCoords);
+        ObjectId = fs_object[0];
+    }
+
+*/
+static const uint8_t fs_source_glsl300es[370] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x73,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5b,0x31,0x5d,0x3b,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x31,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x31,0x5f,0x73,0x6d,0x70,0x3b,0x0a,
+    0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x4f,0x62,0x6a,0x65,
+    0x63,0x74,0x49,0x64,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x31,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x31,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x4f,0x62,0x6a,0x65,0x63,0x74,0x49,0x64,0x20,0x3d,0x20,
+    0x66,0x73,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5b,0x30,0x5d,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+static inline const sg_shader_desc* outline_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_outline_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_outline_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "outline_params";
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 1;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_ids_outline_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 0;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_scene_outline_smp";
+            desc.label = "outline_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_outline_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_outline_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "outline_params";
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 1;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_ids_outline_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 0;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_scene_outline_smp";
+            desc.label = "outline_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* simple_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_object";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_texture1_texture1_smp";
+            desc.label = "simple_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_object";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_texture1_texture1_smp";
+            desc.label = "simple_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
@@ -1,8 +1,11 @@
 #include "glm/ext/quaternion_geometric.hpp"
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
-#include <map>
 #include <sjd/camera.h>
+#include <sjd/depth_sorter.h>
+#include <sjd/frame_arena.h>
+#include <sjd/gfx_cache.h>
+#include <sjd/render_queue.h>
 #include <sjd/sok_texture.h>
 #include <vector>
 
@@ -36,6 +39,11 @@ namespace state {
     sg_bindings bind_plane;
     sg_bindings bind_windows;
     sg_pass_action pass_action;
+    sjd::GfxCache gfx_cache;
+    sjd::RenderQueue queue;
+    uint16_t plane_bindings;
+    uint16_t cubes_bindings;
+    sjd::DepthSorter window_sorter;
     sjd::Camera camera(glm::vec3(3.0f, 0.8f, 4.0f),
                        glm::vec3(1.0f, 0.4f, 0.0f));
     uint64_t last_time;
@@ -76,7 +84,8 @@ static void init(void) {
 
     stm_setup();
 
-    std::vector<float> vertices {
+    // scratch for the uploads, on the frame arena until the first sg_commit
+    sjd::FrameVector<float> vertices {
         // positions          // texture coords
         -0.5f, -0.5f, -0.5f,  0.0f,  0.0f,
          0.5f, -0.5f, -0.5f,  1.0f,  0.0f,
@@ -132,7 +141,7 @@ static void init(void) {
 
     state::bind_cubes.vertex_buffers[0] = cube_buffer;
 
-    std::vector<float> planeVertices = {
+    sjd::FrameVector<float> planeVertices = {
         // positions        // texture Coords
          5.0f, -0.5f,  5.0f,  2.0f, 0.0f,
         -5.0f, -0.5f,  5.0f,  0.0f, 0.0f,
@@ -154,7 +163,7 @@ static void init(void) {
 
     state::bind_plane.vertex_buffers[0] = plane_buffer;
 
-    std::vector<float> windowsVertices {
+    sjd::FrameVector<float> windowsVertices {
         // positions          // texture coords
         -0.5f, -0.5f,  0.0f,  0.0f,  0.0f,
          0.5f, -0.5f,  0.0f,  1.0f,  0.0f,
@@ -184,8 +193,9 @@ static void init(void) {
     layout.attrs[ATTR_simple_aPos].format = SG_VERTEXFORMAT_FLOAT3;
     layout.attrs[ATTR_simple_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
 
-    // create a pipeline object
-    state::pip_cubes = sg_make_pipeline(sg_pipeline_desc {
+    // the cubes and the plane only differ in their label so the cache hands
+    // both the same pipeline, and the render queue never has to switch
+    state::pip_cubes = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = simple_shd,
         .layout = layout,
         .depth {    // Our first 3D elements so we need to enable depth testing
@@ -196,7 +206,7 @@ static void init(void) {
     });
 
     // create a pipeline object (default render states are fine for triangle)
-    state::pip_plane = sg_make_pipeline(sg_pipeline_desc {
+    state::pip_plane = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = simple_shd,
         .layout = layout,
         .depth {    // Our first 3D elements so we need to enable depth testing
@@ -207,7 +217,7 @@ static void init(void) {
     });
 
     // create a pipeline object (default render states are fine for triangle)
-    state::pip_windows = sg_make_pipeline(sg_pipeline_desc {
+    state::pip_windows = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = simple_shd,
         .layout = layout,
         .depth {    // Our first 3D elements so we need to enable depth testing
@@ -259,6 +269,9 @@ static void init(void) {
                           true,
                           fail_callback);
 
+    // the textures have filled in the image slots so the bindings are final
+    state::plane_bindings = state::queue.addBindings(state::bind_plane);
+    state::cubes_bindings = state::queue.addBindings(state::bind_cubes);
 }
 
 void frame(void) {
@@ -283,49 +296,49 @@ void frame(void) {
         .projection = projection
     };
 
-    // Plane
-    sg_apply_pipeline(state::pip_plane);
-    sg_apply_bindings(state::bind_plane);
+    // Opaque geometry goes through the render queue so draws sharing
+    // pipeline and bindings end up next to each other
+    state::queue.begin();
 
-    glm::mat4 model = glm::mat4(1.0f);
-    vs_params.model = model;
-    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-    sg_draw(0, 6, 1);
+    // Plane
+    vs_params.model = glm::mat4(1.0f);
+    state::queue.submit(0, false, state::pip_plane, state::plane_bindings,
+                        0.0f, {{UB_vs_params, SG_RANGE(vs_params)}}, 0, 6);
 
     // Cubes
-    sg_apply_pipeline(state::pip_cubes);
-    sg_apply_bindings(state::bind_cubes);
-
-    model = glm::translate(glm::mat4(1.0f), glm::vec3(-1.0f, 0.0f, -1.0f));
-    vs_params.model = model;
-    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-    sg_draw(0, 36, 1);
-    model = glm::translate(glm::mat4(1.0f), glm::vec3(2.0f, 0.0f, 0.0f));
-    vs_params.model = model;
-    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-    sg_draw(0, 36, 1);
+    for (glm::vec3 position : {glm::vec3(-1.0f, 0.0f, -1.0f), glm::vec3(2.0f, 0.0f, 0.0f)}) {
+        vs_params.model = glm::translate(glm::mat4(1.0f), position);
+        float depth = glm::length(state::camera.pos - position) / 100.0f;
+        state::queue.submit(0, false, state::pip_cubes, state::cubes_bindings,
+                            depth, {{UB_vs_params, SG_RANGE(vs_params)}}, 0, 36);
+    }
+
+    state::queue.execute(0);
 
     // Windows
-    std::map<float, glm::vec3> sorted;
+    // squared distance sorts the same as distance so skip the sqrt
+    state::window_sorter.clear();
     for (size_t i = 0; i < state::windows.size(); i++) {
-        float distance = glm::length(state::camera.pos - state::windows[i]);
-        sorted[distance] = state::windows[i];
+        glm::vec3 offset = state::camera.pos - state::windows[i];
+        state::window_sorter.add(glm::dot(offset, offset), static_cast<uint32_t>(i));
     }
 
     sg_apply_pipeline(state::pip_windows);
     sg_apply_bindings(state::bind_windows);
 
-    for(std::map<float,glm::vec3>::reverse_iterator it = sorted.rbegin(); it != sorted.rend(); ++it) {
-        vs_params.model = glm::translate(glm::mat4(1.0f), it->second);
+    for (const sjd::SortItem32& sorted : state::window_sorter.sortBackToFront()) {
+        vs_params.model = glm::translate(glm::mat4(1.0f), state::windows[sorted.index]);
         sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
         sg_draw(0, 6, 1);
     }
 
     sg_end_pass();
     sg_commit();
+    sjd::FrameArena::instance().reset();
 }
 
 void cleanup(void) {
+    state::gfx_cache.report();
     sfetch_shutdown();
     sg_shutdown();
 }
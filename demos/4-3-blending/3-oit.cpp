@@ -0,0 +1,591 @@
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <sjd/camera.h>
+#include <sjd/oit.h>
+#include <sjd/sok_texture.h>
+#include <iostream>
+#include <vector>
+
+#define SOKOL_DEBUG
+#define SOKOL_IMPL
+#ifndef __EMSCRIPTEN__
+#define SOKOL_GLCORE
+#else
+#define SOKOL_GLES3
+#endif
+#include <sokol/sokol_app.h>
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_log.h>
+#include <sokol/sokol_fetch.h>
+#include <sokol/sokol_glue.h>
+#include <sokol/sokol_time.h>
+
+// add the shader after glm
+#include "3-oit.glsl.h"
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+/* Same scene as 2-blending but the windows and grass are drawn with weighted
+ * blended order-independent transparency, see sjd/oit.h. Nothing is sorted
+ * on the CPU and the transparent quads can be drawn in any order.
+ *
+ *   pass 1: plane and cubes into an offscreen colour + depth target
+ *   pass 2: windows and grass into the accumulation and weight targets,
+ *           depth tested against pass 1
+ *   pass 3: copy pass 1 to the screen and composite pass 2 over it
+ *
+ * Without blendable half float targets (WebGL2 without
+ * EXT_color_buffer_float) pass 2 is skipped and the windows and grass are
+ * alpha blended into pass 1 unsorted, so overlapping quads can come out in
+ * the wrong order.
+ */
+namespace state {
+    sg_pipeline pip_screen;
+    sg_pipeline pip_composite;
+    sg_bindings bind_screen;
+    sg_bindings bind_composite;
+    sg_bindings bind_cubes;
+    sg_bindings bind_plane;
+    sg_bindings bind_windows;
+    sg_bindings bind_vegetation;
+    sg_pass_action pass_action;
+    sjd::OitTargets oit;
+    bool oit_supported;
+    sjd::Camera camera(glm::vec3(3.0f, 0.8f, 4.0f),
+                       glm::vec3(1.0f, 0.4f, 0.0f));
+    uint64_t last_time;
+    float deltaTime;
+    std::vector<glm::vec3> windows {
+        glm::vec3(-1.5f,  0.0f, -0.48f),
+        glm::vec3( 1.5f,  0.0f,  0.51f),
+        glm::vec3( 0.0f,  0.0f,  0.7f),
+        glm::vec3(-0.3f,  0.0f, -2.3f),
+        glm::vec3( 0.5f,  0.0f, -0.6f)
+    };
+    std::vector<glm::vec3> vegetation {
+        glm::vec3(-1.2f,  0.0f,  1.2f),
+        glm::vec3( 0.8f,  0.0f,  1.6f),
+        glm::vec3( 2.2f,  0.0f, -1.1f),
+        glm::vec3(-2.0f,  0.0f, -1.6f),
+        glm::vec3( 0.2f,  0.0f, -1.4f)
+    };
+}
+namespace offscreen {
+    sg_attachments attachment;
+    sg_attachments_desc attachment_desc;
+    sg_sampler sampler;
+    sg_pipeline pip_opaque;
+    sg_pipeline pip_transparent;
+    sg_pipeline pip_blended;
+    sg_pass_action pass_action;
+}
+
+static sg_sampler_desc custom_sampler_desc = {
+    .min_filter = SG_FILTER_LINEAR,
+    .mag_filter = SG_FILTER_LINEAR,
+    .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+    .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+    .compare = SG_COMPAREFUNC_NEVER,
+};
+
+static void fail_callback() {
+    state::pass_action = sg_pass_action {
+        .colors = {{ .load_action=SG_LOADACTION_CLEAR,
+            .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f }
+        }}
+    };
+}
+
+// called initially and when window size changes
+void create_offscreen_pass(int width, int height) {
+    // destroy previous resource
+    sg_destroy_attachments(offscreen::attachment);
+    sg_destroy_image(offscreen::attachment_desc.colors[0].image);
+    sg_destroy_image(offscreen::attachment_desc.depth_stencil.image);
+
+    sg_image_desc color_img_desc = {
+        .render_target = true,
+        .width = width,
+        .height = height,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .label = "color-image"
+    };
+    sg_image color_img = sg_make_image(color_img_desc);
+    if (offscreen::sampler.id == SG_INVALID_ID) {
+        offscreen::sampler = sg_make_sampler(custom_sampler_desc);
+    }
+
+    sg_image_desc depth_img_desc = color_img_desc;
+    depth_img_desc.pixel_format = SG_PIXELFORMAT_DEPTH;
+    depth_img_desc.label = "depth-image";
+    sg_image depth_img = sg_make_image(depth_img_desc);
+
+    offscreen::attachment_desc = sg_attachments_desc {
+        .colors {{
+            .image = color_img,
+        }},
+        .depth_stencil {
+            .image = depth_img,
+        },
+        .label = "offscreen-pass"
+    };
+    offscreen::attachment = sg_make_attachments(offscreen::attachment_desc);
+
+    // the transparent pass tests against the opaque depth buffer, does nothing
+    // when OIT isn't supported
+    state::oit.create(width, height, depth_img);
+
+    // also need to update the fullscreen-quad texture bindings
+    state::bind_screen.images[IMG__screenTexture] = color_img;
+    state::bind_screen.samplers[SMP_screenTexture_smp] = offscreen::sampler;
+    state::bind_composite.images[IMG__accumTexture] = state::oit.accum;
+    state::bind_composite.images[IMG__weightTexture] = state::oit.weight;
+    state::bind_composite.samplers[SMP_oit_smp] = state::oit.sampler;
+}
+
+static void init(void) {
+    sg_setup(sg_desc {
+        .logger {
+            .func = slog_func
+        },
+        .environment = sglue_environment(),
+    });
+
+    sfetch_setup(sfetch_desc_t {
+        .max_requests = 8,
+        .num_channels = 1,
+        .num_lanes = 1,
+        .logger {
+            .func = slog_func
+        },
+    });
+
+    stm_setup();
+
+    state::oit_supported = sjd::OitTargets::supported();
+    if (!state::oit_supported) {
+        std::cout << "WARNING::OIT::HALF_FLOAT_NOT_BLENDABLE: falling back to unsorted alpha blending\n";
+    }
+
+    // one colour and depth target for the opaque scene, plus the OIT targets
+    create_offscreen_pass(sapp_width(), sapp_height());
+
+    /* a pass action to clear offscreen framebuffer */
+    offscreen::pass_action = sg_pass_action {
+        .colors = {{
+            .load_action=SG_LOADACTION_CLEAR,
+            .clear_value={0.1f, 0.1f, 0.1f, 1.0f}
+        }},
+        .depth {
+            .load_action=SG_LOADACTION_CLEAR,
+            .store_action=SG_STOREACTION_STORE,
+            .clear_value=1.0f,
+        },
+    };
+
+    // the screen quad covers everything so there's nothing to clear
+    state::pass_action = sg_pass_action {
+        .colors = {{
+            .load_action=SG_LOADACTION_DONTCARE,
+        }}
+    };
+
+    std::vector<float> vertices {
+        // positions          // texture coords
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f,
+
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  1.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+
+        -0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+
+        -0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+         0.5f, -0.5f, -0.5f,  1.0f,  1.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,
+         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,
+        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f,  1.0f,
+
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,
+         0.5f,  0.5f, -0.5f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f
+    };
+
+    sg_buffer cube_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = vertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = vertices.data(),
+            .size = vertices.size() * sizeof(float),
+        },
+        .label = "cube-vertices"
+    });
+
+    state::bind_cubes.vertex_buffers[0] = cube_buffer;
+
+    std::vector<float> planeVertices = {
+        // positions        // texture Coords
+         5.0f, -0.5f,  5.0f,  2.0f, 0.0f,
+        -5.0f, -0.5f,  5.0f,  0.0f, 0.0f,
+        -5.0f, -0.5f, -5.0f,  0.0f, 2.0f,
+
+         5.0f, -0.5f,  5.0f,  2.0f, 0.0f,
+        -5.0f, -0.5f, -5.0f,  0.0f, 2.0f,
+         5.0f, -0.5f, -5.0f,  2.0f, 2.0f
+    };
+
+    sg_buffer plane_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = planeVertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = planeVertices.data(),
+            .size = planeVertices.size() * sizeof(float),
+        },
+        .label = "plane-vertices"
+    });
+
+    state::bind_plane.vertex_buffers[0] = plane_buffer;
+
+    std::vector<float> windowsVertices {
+        // positions          // texture coords
+        -0.5f, -0.5f,  0.0f,  0.0f,  0.0f,
+         0.5f, -0.5f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.0f,  0.0f,  0.0f,
+    };
+
+    sg_buffer windows_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = windowsVertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = windowsVertices.data(),
+            .size = windowsVertices.size() * sizeof(float),
+        },
+        .label = "windows-vertices"
+    });
+
+    state::bind_windows.vertex_buffers[0] = windows_buffer;
+
+    std::vector<float> screenVertices {
+        // positions          // texture coords
+        -1.0f, -1.0f,  0.0f,  0.0f,  0.0f,
+         1.0f, -1.0f,  0.0f,  1.0f,  0.0f,
+         1.0f,  1.0f,  0.0f,  1.0f,  1.0f,
+         1.0f,  1.0f,  0.0f,  1.0f,  1.0f,
+        -1.0f,  1.0f,  0.0f,  0.0f,  1.0f,
+        -1.0f, -1.0f,  0.0f,  0.0f,  0.0f,
+    };
+
+    sg_buffer screen_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = screenVertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = screenVertices.data(),
+            .size = screenVertices.size() * sizeof(float),
+        },
+        .label = "screen-vertices"
+    });
+
+    state::bind_screen.vertex_buffers[0] = screen_buffer;
+    state::bind_composite.vertex_buffers[0] = screen_buffer;
+    // grass uses the same quad as the windows
+    state::bind_vegetation.vertex_buffers[0] = windows_buffer;
+
+    // create shader from code-generated sg_shader_desc
+    sg_shader simple_shd = sg_make_shader(simple_shader_desc(sg_query_backend()));
+    sg_shader oit_accum_shd = sg_make_shader(oit_accum_shader_desc(sg_query_backend()));
+    sg_shader screen_shd = sg_make_shader(screen_shader_desc(sg_query_backend()));
+    sg_shader oit_composite_shd = sg_make_shader(oit_composite_shader_desc(sg_query_backend()));
+
+    // we need to initialise layout seperately to the pipeline
+    // because we cant do array initilisation of structs in C++
+    sg_vertex_layout_state layout {};
+    layout.attrs[ATTR_simple_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    layout.attrs[ATTR_simple_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
+
+    offscreen::pip_opaque = sg_make_pipeline(sg_pipeline_desc {
+        .shader = simple_shd,
+        .layout = layout,
+        .depth {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = true,
+        },
+        .color_count = 1,
+        .colors = {{
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+        }},
+        .label = "opaque-pipeline"
+    });
+
+    if (state::oit_supported) {
+        // additive accumulation, multiplicative revealage and no depth writes
+        offscreen::pip_transparent = sg_make_pipeline(
+            sjd::OitTargets::accumulationPipelineDesc(oit_accum_shd, layout));
+        state::pip_composite = sg_make_pipeline(
+            sjd::OitTargets::compositePipelineDesc(oit_composite_shd, layout));
+    }
+    else {
+        // ordinary alpha blending into the opaque target
+        offscreen::pip_blended = sg_make_pipeline(sg_pipeline_desc {
+            .shader = simple_shd,
+            .layout = layout,
+            .depth {
+                .pixel_format = SG_PIXELFORMAT_DEPTH,
+                .compare = SG_COMPAREFUNC_LESS,
+                .write_enabled = false,
+            },
+            .color_count = 1,
+            .colors = {{
+                .pixel_format = SG_PIXELFORMAT_RGBA8,
+                .blend = {
+                    .enabled = true,
+                    .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+                    .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                    .src_factor_alpha = SG_BLENDFACTOR_SRC_ALPHA,
+                    .dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                }
+            }},
+            .label = "blended-pipeline"
+        });
+    }
+
+    state::pip_screen = sg_make_pipeline(sg_pipeline_desc {
+        .shader = screen_shd,
+        .layout = layout,
+        .label = "screen-pipeline"
+    });
+
+    SokTexture marble("../data/marble.jpg",
+                          state::bind_cubes,
+                          IMG__texture1,
+                          SMP_texture1_smp,
+                          true,
+                          fail_callback);
+
+    SokTexture metal("../data/metal.png",
+                                   state::bind_plane,
+                                   IMG__texture1,
+                                   SMP_texture1_smp,
+                                   true,
+                                   fail_callback);
+
+    SokTexture windowTex("../data/blending_transparent_window.png",
+                          state::bind_windows,
+                          IMG__texture1,
+                          SMP_texture1_smp,
+                          true,
+                          fail_callback);
+
+    SokTexture vegetation("../data/grass.png",
+                          state::bind_vegetation,
+                          IMG__texture1,
+                          SMP_texture1_smp,
+                          true,
+                          fail_callback,
+                          &custom_sampler_desc);
+}
+
+// windows and grass, in whatever order they happen to be stored
+static void draw_transparent(vs_params_t& vs_params) {
+    // Windows
+    sg_apply_bindings(state::bind_windows);
+    for (glm::vec3 position : state::windows) {
+        vs_params.model = glm::translate(glm::mat4(1.0f), position);
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        sg_draw(0, 6, 1);
+    }
+
+    // Grass
+    sg_apply_bindings(state::bind_vegetation);
+    for (glm::vec3 position : state::vegetation) {
+        vs_params.model = glm::translate(glm::mat4(1.0f), position);
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        sg_draw(0, 6, 1);
+    }
+}
+
+void frame(void) {
+    sfetch_dowork();
+
+    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
+
+    if (!sapp_mouse_locked()) {
+        sapp_lock_mouse(true);
+    }
+    state::camera.moveCamera(state::deltaTime);
+
+    glm::mat4 view = state::camera.getViewMatrix();
+    glm::mat4 projection = glm::perspective(glm::radians(state::camera.zoom), static_cast<float>(sapp_width()) / sapp_height(), 0.1f, 100.0f);
+    vs_params_t vs_params = {
+        .view = view,
+        .projection = projection
+    };
+
+    // opaque geometry
+    sg_begin_pass(sg_pass {
+        .action = offscreen::pass_action,
+        .attachments = offscreen::attachment
+    });
+
+    sg_apply_pipeline(offscreen::pip_opaque);
+
+    // Plane
+    sg_apply_bindings(state::bind_plane);
+    vs_params.model = glm::mat4(1.0f);
+    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+    sg_draw(0, 6, 1);
+
+    // Cubes
+    sg_apply_bindings(state::bind_cubes);
+    for (glm::vec3 position : {glm::vec3(-1.0f, 0.0f, -1.0f), glm::vec3(2.0f, 0.0f, 0.0f)}) {
+        vs_params.model = glm::translate(glm::mat4(1.0f), position);
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        sg_draw(0, 36, 1);
+    }
+
+    if (!state::oit_supported) {
+        sg_apply_pipeline(offscreen::pip_blended);
+        draw_transparent(vs_params);
+    }
+
+    sg_end_pass();
+
+    // transparent geometry
+    if (state::oit_supported) {
+        sg_begin_pass(sg_pass {
+            .action = sjd::OitTargets::passAction(),
+            .attachments = state::oit.attachments
+        });
+        sg_apply_pipeline(offscreen::pip_transparent);
+        draw_transparent(vs_params);
+        sg_end_pass();
+    }
+
+    sg_begin_pass(sg_pass {
+        .action = state::pass_action,
+        .swapchain = sglue_swapchain()
+    });
+
+    // opaque scene
+    sg_apply_pipeline(state::pip_screen);
+    sg_apply_bindings(state::bind_screen);
+    sg_draw(0, 6, 1);
+
+    // resolve the transparent layers over it
+    if (state::oit_supported) {
+        sg_apply_pipeline(state::pip_composite);
+        sg_apply_bindings(state::bind_composite);
+        sg_draw(0, 6, 1);
+    }
+
+    sg_end_pass();
+    sg_commit();
+}
+
+void cleanup(void) {
+    sfetch_shutdown();
+    sg_shutdown();
+}
+
+void event(const sapp_event* e) {
+    if (e->type == SAPP_EVENTTYPE_RESIZED) {
+        create_offscreen_pass(e->framebuffer_width, e->framebuffer_height);
+    }
+    if (e->type == SAPP_EVENTTYPE_KEY_DOWN) {
+        if (e->key_code == SAPP_KEYCODE_ESCAPE) {
+            sapp_request_quit();
+        }
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::PRESS);
+    }
+
+    if (e->type == SAPP_EVENTTYPE_KEY_UP) {
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::RELEASE);
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_BEGAN) {
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_MOVED) {
+        float offsetX = e -> touches[0].pos_x - state::camera.lastX;
+        float offsetY = state::camera.lastY - e -> touches[0].pos_y;
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+        state::camera.processMouseMovement(offsetX, offsetY);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+        state::camera.processMouseMovement(e->mouse_dx, -e->mouse_dy);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_SCROLL) {
+        state::camera.processMouseScroll(e->scroll_y);
+    }
+
+}
+
+sapp_desc sokol_main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    return sapp_desc {
+        .init_cb = init,
+        .frame_cb = frame,
+        .cleanup_cb = cleanup,
+        .event_cb = event,
+        .width = 800,
+        .height = 600,
+        .high_dpi = true,
+        .window_title = "Weighted Blended OIT - LearnOpenGL",
+        .logger {
+            .func = slog_func
+        },
+#ifdef _WIN32
+        .win32_console_utf8 = true,
+        .win32_console_attach = true,
+#endif
+    };
+}
+
@@ -0,0 +1,118 @@
+@ctype mat4 glm::mat4
+@ctype vec3 glm::vec3
+
+@vs vs
+in vec3 aPos;
+in vec2 aTexCoords;
+
+out vec2 TexCoords;
+
+layout(binding = 0) uniform vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+};
+
+void main() {
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    TexCoords = aTexCoords;
+}
+@end
+
+@fs fs
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+layout(binding = 0) uniform texture2D _texture1;
+layout(binding = 0) uniform sampler texture1_smp;
+#define texture1 sampler2D(_texture1, texture1_smp)
+
+void main() {
+    FragColor = texture(texture1, TexCoords);
+}
+@end
+
+@fs fs_accum
+in vec2 TexCoords;
+
+layout(location = 0) out vec4 accum;
+layout(location = 1) out vec4 weights;
+
+layout(binding = 0) uniform texture2D _texture1;
+layout(binding = 0) uniform sampler texture1_smp;
+#define texture1 sampler2D(_texture1, texture1_smp)
+
+void main() {
+    vec4 colour = texture(texture1, TexCoords);
+    if (colour.a < 0.01) {
+        discard;
+    }
+
+    // weight function from McGuire & Bavoil (eq. 10), favours fragments that
+    // are close to the camera and more opaque. Clamped to stay within fp16.
+    float weight = clamp(pow(min(1.0, colour.a * 10.0) + 0.01, 3.0) * 1e8
+                         * pow(1.0 - gl_FragCoord.z * 0.9, 3.0), 1e-2, 3e3);
+
+    // rgb and the weight target are summed, accum.a multiplies the revealage
+    // by (1 - alpha), see sjd/oit.h
+    accum = vec4(colour.rgb * colour.a * weight, colour.a);
+    weights = vec4(colour.a * weight);
+}
+@end
+
+@vs vs_screen
+in vec3 aPos;
+in vec2 aTexCoords;
+
+out vec2 TexCoords;
+
+void main() {
+    gl_Position = vec4(aPos.x, aPos.y, 0.0, 1.0);
+    TexCoords = aTexCoords;
+}
+@end
+
+@fs fs_screen
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+layout(binding = 0) uniform texture2D _screenTexture;
+layout(binding = 0) uniform sampler screenTexture_smp;
+#define screenTexture sampler2D(_screenTexture, screenTexture_smp)
+
+void main() {
+    FragColor = texture(screenTexture, TexCoords);
+}
+@end
+
+@fs fs_composite
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+layout(binding = 0) uniform texture2D _accumTexture;
+layout(binding = 1) uniform texture2D _weightTexture;
+layout(binding = 0) uniform sampler oit_smp;
+#define accumTexture sampler2D(_accumTexture, oit_smp)
+#define weightTexture sampler2D(_weightTexture, oit_smp)
+
+void main() {
+    vec4 accum = texture(accumTexture, TexCoords);
+    float revealage = accum.a;
+    // nothing transparent covers this pixel
+    if (revealage >= 1.0) {
+        discard;
+    }
+    float weight = texture(weightTexture, TexCoords).r;
+    vec3 average = accum.rgb / max(weight, 1e-5);
+
+    FragColor = vec4(average, 1.0 - revealage);
+}
+@end
+
+@program simple vs fs
+@program oit_accum vs fs_accum
+@program screen vs_screen fs_screen
+@program oit_composite vs_screen fs_composite
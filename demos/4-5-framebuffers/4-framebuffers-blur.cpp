@@ -1,6 +1,8 @@
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 #include <sjd/camera.h>
+#include <sjd/gfx_cache.h>
+#include <sjd/render_graph.h>
 #include <sjd/sok_texture.h>
 #include <vector>
 
@@ -30,6 +32,10 @@ namespace state {
     sg_pipeline pip;
     sg_bindings bind;
     sg_pass_action pass_action;
+    sjd::GfxCache gfx_cache;
+    sjd::RenderGraph graph;
+    sjd::RenderGraph::PassId screen_pass;
+    int sample_count {1};
     sjd::Camera camera(glm::vec3(3.0f, 0.8f, 4.0f),
                        glm::vec3(1.0f, 0.4f, 0.0f));
     uint64_t last_time;
@@ -43,8 +49,8 @@ namespace state {
     };
 }
 namespace offscreen {
-    sg_attachments attachment;
-    sg_attachments_desc attachment_desc;
+    sjd::RenderGraph::Target color;
+    sjd::RenderGraph::Target depth;
     sg_pipeline pip_cubes;
     sg_pipeline pip_vegetation;
     sg_bindings bind_cubes;
@@ -53,6 +59,10 @@ namespace offscreen {
     sg_pass_action pass_action;
 }
 
+// samples for the offscreen targets, 1 turns MSAA off. The swapchain's MSAA
+// doesn't help once the scene is drawn into a texture first.
+const int OFFSCREEN_SAMPLES {4};
+
 static sg_sampler_desc custom_sampler_desc = {
     .min_filter = SG_FILTER_LINEAR,
     .mag_filter = SG_FILTER_LINEAR,
@@ -67,45 +77,51 @@ static void fail_callback() {
             .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f }
         }}
     };
+    state::graph.setPassAction(state::screen_pass, state::pass_action);
 }
 
-// called initially and when window size changes
-void create_offscreen_pass(int width, int height) {
-    // destroy previous resource
-    sg_destroy_attachments(offscreen::attachment);
-    sg_destroy_image(offscreen::attachment_desc.colors[0].image);
-    sg_destroy_image(offscreen::attachment_desc.depth_stencil.image);
-
-    sg_image_desc color_img_desc = {
-        .render_target = true,
-        .width = width,
-        .height = height,
-        .pixel_format = SG_PIXELFORMAT_RGBA8,
+static void draw_scene();
+static void draw_screen();
+
+// the scene is drawn into an offscreen color target that the screen pass
+// samples. The graph makes the images and remakes them when the window size
+// changes, a multisampled color target is resolved before the screen pass
+// reads it.
+void create_render_graph() {
+    sjd::RenderGraph::TargetDesc color_desc {
+        .format = SG_PIXELFORMAT_RGBA8,
         .label = "color-image"
     };
-    sg_image color_img = sg_make_image(color_img_desc);
-    sg_sampler color_smp = sg_make_sampler(custom_sampler_desc);
-
-    sg_image_desc depth_img_desc = color_img_desc;
-    depth_img_desc.pixel_format = SG_PIXELFORMAT_DEPTH;
-    depth_img_desc.label = "depth-image";
-    sg_image depth_img = sg_make_image(depth_img_desc);
-
-    offscreen::attachment_desc = sg_attachments_desc {
-        .colors {{
-            .image = color_img,
-        }},
-        .depth_stencil {
-            .image = depth_img,
-        },
-        .label = "offscreen-pass"
+    sjd::RenderGraph::TargetDesc depth_desc {
+        .format = SG_PIXELFORMAT_DEPTH,
+        .label = "depth-image"
     };
-    offscreen::attachment = sg_make_attachments(offscreen::attachment_desc);
-
-    // also need to update the fullscreen-quad texture bindings
-    state::bind.images[IMG__screenTexture] = color_img;
-    state::bind.samplers[SMP_screenTexture_smp] = color_smp;
+    state::sample_count = sjd::RenderGraph::pickSampleCount({color_desc, depth_desc},
+                                                            OFFSCREEN_SAMPLES,
+                                                            sapp_width(),
+                                                            sapp_height());
+    color_desc.sampleCount = state::sample_count;
+    depth_desc.sampleCount = state::sample_count;
+    offscreen::color = state::graph.createTarget(color_desc);
+    offscreen::depth = state::graph.createTarget(depth_desc);
+
+    state::graph.addPass(sjd::RenderGraph::PassDesc {
+        .name = "offscreen-pass",
+        .colors = {offscreen::color},
+        .depth = offscreen::depth,
+        .action = offscreen::pass_action,
+    }, draw_scene);
+
+    state::screen_pass = state::graph.addPass(sjd::RenderGraph::PassDesc {
+        .name = "screen-pass",
+        .reads = {offscreen::color},
+        .swapchain = true,
+        .action = state::pass_action,
+    }, draw_screen);
+
+    state::bind.samplers[SMP_screenTexture_smp] = state::gfx_cache.sampler(custom_sampler_desc);
 }
+
 static void init(void) {
     sg_setup(sg_desc {
         .logger {
@@ -125,9 +141,6 @@ static void init(void) {
 
     stm_setup();
 
-    // a render pass with one color and one depth-attachment image
-    create_offscreen_pass(sapp_width(), sapp_height());
-
     /* a pass action to clear offscreen framebuffer */
     offscreen::pass_action = sg_pass_action {
         .colors = {{ 
@@ -144,6 +157,10 @@ static void init(void) {
         }},
     };
 
+    // a render pass with one color and one depth-attachment image, then the
+    // fullscreen-quad
+    create_render_graph();
+
     std::vector<float> vertices {
         // Back face
         -0.5f, -0.5f, -0.5f,  0.0f, 0.0f, // Bottom-left
@@ -276,7 +293,7 @@ static void init(void) {
     layout.attrs[ATTR_simple_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
 
     // create a pipeline object
-    offscreen::pip_cubes = sg_make_pipeline(sg_pipeline_desc {
+    offscreen::pip_cubes = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = simple_shd,
         .layout = layout,
         .depth = {
@@ -289,10 +306,11 @@ static void init(void) {
             .pixel_format = SG_PIXELFORMAT_RGBA8,
         }},
         .cull_mode = SG_CULLMODE_FRONT,
+        .sample_count = state::sample_count,
         .label = "object-pipeline"
     });
 
-    offscreen::pip_vegetation = sg_make_pipeline(sg_pipeline_desc {
+    offscreen::pip_vegetation = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = simple_shd,
         .layout = layout,
         .depth {    // Our first 3D elements so we need to enable depth testing
@@ -304,10 +322,11 @@ static void init(void) {
         .colors = {{
             .pixel_format = SG_PIXELFORMAT_RGBA8,
         }},
+        .sample_count = state::sample_count,
         .label = "vegetation-pipeline"
     });
 
-    state::pip = sg_make_pipeline(sg_pipeline_desc {
+    state::pip = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = blur_framebuffer_shd,
         .layout = layout,
         .label = "screen-pipeline"
@@ -337,21 +356,7 @@ static void init(void) {
 
 }
 
-void frame(void) {
-    sfetch_dowork();
-
-    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
-
-    if (!sapp_mouse_locked()) {
-        sapp_lock_mouse(true);
-    }
-    state::camera.moveCamera(state::deltaTime);
-
-    sg_begin_pass(sg_pass { 
-	.action = offscreen::pass_action,
-        .attachments = offscreen::attachment
-    });
-
+static void draw_scene() {
     glm::mat4 view = state::camera.getViewMatrix();
     glm::mat4 projection = glm::perspective(glm::radians(state::camera.zoom), static_cast<float>(sapp_width()) / sapp_height(), 0.1f, 100.0f);
     vs_params_t vs_params = {
@@ -389,23 +394,35 @@ void frame(void) {
         sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
         sg_draw(0, 6, 1);
     }
-    sg_end_pass();
+}
+
+static void draw_screen() {
+    // the offscreen image changes when the window is resized
+    state::bind.images[IMG__screenTexture] = state::graph.image(offscreen::color);
 
-    sg_begin_pass(sg_pass { 
-	.action = state::pass_action,
-        .swapchain = sglue_swapchain()
-    });
     // screen quad
     sg_apply_pipeline(state::pip);
     sg_apply_bindings(state::bind);
     sg_draw(0, 6, 1);
+}
 
+void frame(void) {
+    sfetch_dowork();
+
+    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
+
+    if (!sapp_mouse_locked()) {
+        sapp_lock_mouse(true);
+    }
+    state::camera.moveCamera(state::deltaTime);
 
-    sg_end_pass();
+    state::graph.execute(sglue_swapchain());
     sg_commit();
 }
 
 void cleanup(void) {
+    state::gfx_cache.report();
+    state::graph.report();
     sfetch_shutdown();
     sg_shutdown();
 }
@@ -1,6 +1,9 @@
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 #include <sjd/camera.h>
+#include <sjd/gfx_cache.h>
+#include <sjd/render_graph.h>
+#include <sjd/secondary_view.h>
 #include <sjd/sok_texture.h>
 #include <vector>
 
@@ -32,10 +35,18 @@ namespace state {
     sg_pipeline pip_cubes;
     sg_pipeline pip_vegetation;
     sg_pass_action pass_action;
+    sjd::GfxCache gfx_cache;
+    sjd::RenderGraph graph;
+    sjd::RenderGraph::PassId screen_pass;
+    sjd::SecondaryView mirror;
     sjd::Camera camera(glm::vec3(3.0f, 0.8f, 4.0f),
                        glm::vec3(1.0f, 0.4f, 0.0f));
     uint64_t last_time;
     float deltaTime;
+    std::vector<glm::vec3> cubes {
+        glm::vec3(-1.0f,  0.0f, -1.0f),
+        glm::vec3( 2.0f,  0.0f,  0.0f)
+    };
     std::vector<glm::vec3> vegetation {
         glm::vec3(-1.5f,  0.0f, -0.48f),
         glm::vec3( 1.5f,  0.0f,  0.51f),
@@ -45,8 +56,9 @@ namespace state {
     };
 }
 namespace offscreen {
-    sg_attachments attachment;
-    sg_attachments_desc attachment_desc;
+    sjd::RenderGraph::Target mirror;
+    sjd::RenderGraph::Target mirror_depth;
+    sjd::RenderGraph::PassId mirror_pass;
     sg_pipeline pip_mirror_cubes;
     sg_pipeline pip_mirror_vegetation;
     sg_bindings bind_cubes;
@@ -55,6 +67,19 @@ namespace offscreen {
     sg_pass_action pass_action;
 }
 
+// the mirror quad covers half the width and a quarter of the height of the
+// window, the mirror is drawn at half that resolution
+const float MIRROR_WIDTH {0.5f};
+const float MIRROR_HEIGHT {0.25f};
+const float MIRROR_RESOLUTION {0.5f};
+// objects smaller than this on screen (in pixels) are left out of the mirror
+const float MIRROR_MIN_PIXELS {4.0f};
+
+// bounding sphere radii
+const float PLANE_RADIUS {7.08f};
+const float CUBE_RADIUS {0.87f};
+const float VEGETATION_RADIUS {0.71f};
+
 static sg_sampler_desc custom_sampler_desc = {
     .min_filter = SG_FILTER_LINEAR,
     .mag_filter = SG_FILTER_LINEAR,
@@ -69,44 +94,50 @@ static void fail_callback() {
             .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f }
         }}
     };
+    state::graph.setPassAction(state::screen_pass, state::pass_action);
 }
 
-// called initially and when window size changes
-void create_offscreen_pass(int width, int height) {
-    // destroy previous resource
-    sg_destroy_attachments(offscreen::attachment);
-    sg_destroy_image(offscreen::attachment_desc.colors[0].image);
-    sg_destroy_image(offscreen::attachment_desc.depth_stencil.image);
-
-    sg_image_desc color_img_desc = {
-        .render_target = true,
-        .width = width,
-        .height = height,
-        .pixel_format = SG_PIXELFORMAT_RGBA8,
-        .label = "color-image"
-    };
-    sg_image color_img = sg_make_image(color_img_desc);
-    sg_sampler color_smp = sg_make_sampler(custom_sampler_desc);
+struct ScenePipelines {
+    sg_pipeline cubes;
+    sg_pipeline vegetation;
+};
 
-    sg_image_desc depth_img_desc = color_img_desc;
-    depth_img_desc.pixel_format = SG_PIXELFORMAT_DEPTH;
-    depth_img_desc.label = "depth-image";
-    sg_image depth_img = sg_make_image(depth_img_desc);
+static void draw_mirror();
+static void draw_screen();
+
+// the mirror goes into a persistent target so it keeps its picture on the
+// frames it isn't redrawn, the screen pass draws the scene and then the
+// mirror on top of it
+void create_render_graph() {
+    offscreen::mirror = state::graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = SG_PIXELFORMAT_RGBA8,
+        .scale = MIRROR_WIDTH * MIRROR_RESOLUTION,
+        .heightScale = MIRROR_HEIGHT * MIRROR_RESOLUTION,
+        .persistent = true,
+        .label = "mirror-image"
+    });
+    offscreen::mirror_depth = state::graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = SG_PIXELFORMAT_DEPTH,
+        .scale = MIRROR_WIDTH * MIRROR_RESOLUTION,
+        .heightScale = MIRROR_HEIGHT * MIRROR_RESOLUTION,
+        .label = "mirror-depth-image"
+    });
 
-    offscreen::attachment_desc = sg_attachments_desc {
-        .colors {{
-            .image = color_img,
-        }},
-        .depth_stencil {
-            .image = depth_img,
-        },
-        .label = "offscreen-pass"
-    };
-    offscreen::attachment = sg_make_attachments(offscreen::attachment_desc);
+    offscreen::mirror_pass = state::graph.addPass(sjd::RenderGraph::PassDesc {
+        .name = "mirror-pass",
+        .colors = {offscreen::mirror},
+        .depth = offscreen::mirror_depth,
+        .action = offscreen::pass_action,
+    }, draw_mirror);
+
+    state::screen_pass = state::graph.addPass(sjd::RenderGraph::PassDesc {
+        .name = "screen-pass",
+        .reads = {offscreen::mirror},
+        .swapchain = true,
+        .action = state::pass_action,
+    }, draw_screen);
 
-    // also need to update the fullscreen-quad texture bindings
-    state::bind.images[IMG__screenTexture] = color_img;
-    state::bind.samplers[SMP_screenTexture_smp] = color_smp;
+    state::bind.samplers[SMP_screenTexture_smp] = state::gfx_cache.sampler(custom_sampler_desc);
 }
 
 static void init(void) {
@@ -128,24 +159,24 @@ static void init(void) {
 
     stm_setup();
 
-    // a render pass with one color and one depth-attachment image
-    create_offscreen_pass(static_cast<int>(sapp_width() * 0.5f),
-                          static_cast<int>(sapp_height() * 0.25f));
-
-    /* a pass action to clear offscreen framebuffer */
+    /* a pass action to clear the screen and the mirror */
     state::pass_action = sg_pass_action {
         .colors = {{ 
             .load_action=SG_LOADACTION_CLEAR,
             .clear_value={0.1f, 0.1f, 0.1f, 1.0f} 
         }}
     };
+    offscreen::pass_action = state::pass_action;
+
+    // nothing in the scene moves but the camera, so the mirror is only
+    // redrawn when that moves or turns, and every 4th frame to be safe
+    state::mirror.setup(sjd::SecondaryViewSettings {
+        .updateInterval = 4,
+        .moveThreshold = 0.05f,
+        .turnThreshold = 1.0f,
+    });
 
-    // a pass action for rendering the fullscreen-quad
-    offscreen::pass_action = sg_pass_action {
-        .colors {{
-            .load_action=SG_LOADACTION_DONTCARE,
-        }},
-    };
+    create_render_graph();
 
     std::vector<float> vertices {
         // Back face
@@ -279,7 +310,7 @@ static void init(void) {
     layout.attrs[ATTR_simple_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
 
     // create a pipeline object
-    offscreen::pip_mirror_cubes = sg_make_pipeline(sg_pipeline_desc {
+    offscreen::pip_mirror_cubes = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = simple_shd,
         .layout = layout,
         .depth = {
@@ -295,7 +326,7 @@ static void init(void) {
         .label = "mirror-object-pipeline"
     });
 
-    offscreen::pip_mirror_vegetation = sg_make_pipeline(sg_pipeline_desc {
+    offscreen::pip_mirror_vegetation = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = simple_shd,
         .layout = layout,
         .depth {    // Our first 3D elements so we need to enable depth testing
@@ -311,7 +342,7 @@ static void init(void) {
     });
 
     // create a pipeline object
-    state::pip_cubes = sg_make_pipeline(sg_pipeline_desc {
+    state::pip_cubes = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = simple_shd,
         .layout = layout,
         .depth = {
@@ -322,7 +353,7 @@ static void init(void) {
         .label = "object-pipeline"
     });
 
-    state::pip_vegetation = sg_make_pipeline(sg_pipeline_desc {
+    state::pip_vegetation = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = simple_shd,
         .layout = layout,
         .depth {    // Our first 3D elements so we need to enable depth testing
@@ -332,12 +363,12 @@ static void init(void) {
         .label = "vegetation-pipeline"
     });
 
-    state::pip = sg_make_pipeline(sg_pipeline_desc {
+    // the mirror is drawn in the same pass as the scene, always on top
+    state::pip = state::gfx_cache.pipeline(sg_pipeline_desc {
         .shader = framebuffer_shd,
         .layout = layout,
-        .depth {    // Our first 3D elements so we need to enable depth testing
-            .compare = SG_COMPAREFUNC_LESS,   // discard fragments that are further away
-            .write_enabled = true,
+        .depth {
+            .compare = SG_COMPAREFUNC_ALWAYS,
         },
         .label = "screen-pipeline"
     });
@@ -366,117 +397,97 @@ static void init(void) {
 
 }
 
-void frame(void) {
-    sfetch_dowork();
-
-    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
-
-    if (!sapp_mouse_locked()) {
-        sapp_lock_mouse(true);
-    }
-    state::camera.moveCamera(state::deltaTime);
-
-    sg_begin_pass(sg_pass { 
-	.action = state::pass_action,
-        .swapchain = sglue_swapchain()
-    });
-
-    glm::mat4 view = state::camera.getViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(state::camera.zoom), static_cast<float>(sapp_width()) / sapp_height(), 0.1f, 100.0f);
+// one draw list for both views, each view skips what it can't see or what
+// is too small in it
+static void draw_scene(const sjd::View& view, const ScenePipelines& pipelines) {
     vs_params_t vs_params = {
-        .view = view,
-        .projection = projection
+        .view = view.view,
+        .projection = view.projection
     };
 
     // Plane
-    sg_apply_pipeline(state::pip_cubes);
-    sg_apply_bindings(offscreen::bind_plane);
-
-    glm::mat4 model = glm::mat4(1.0f);
-    vs_params.model = model;
-    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-    sg_draw(0, 6, 1);
+    sg_apply_pipeline(pipelines.cubes);
+    if (view.visible(glm::vec3(0.0f, -0.5f, 0.0f), PLANE_RADIUS)) {
+        sg_apply_bindings(offscreen::bind_plane);
+        vs_params.model = glm::mat4(1.0f);
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        sg_draw(0, 6, 1);
+    }
 
     // Cubes
     sg_apply_bindings(offscreen::bind_cubes);
-
-    model = glm::translate(glm::mat4(1.0f), glm::vec3(-1.0f, 0.0f, -1.0f));
-    vs_params.model = model;
-    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-    sg_draw(0, 36, 1);
-    model = glm::translate(glm::mat4(1.0f), glm::vec3(2.0f, 0.0f, 0.0f));
-    vs_params.model = model;
-    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-    sg_draw(0, 36, 1);
+    for (glm::vec3 position : state::cubes) {
+        if (!view.visible(position, CUBE_RADIUS))
+            continue;
+        vs_params.model = glm::translate(glm::mat4(1.0f), position);
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        sg_draw(0, 36, 1);
+    }
 
     // Vegetation
-    sg_apply_pipeline(state::pip_vegetation);
+    sg_apply_pipeline(pipelines.vegetation);
     sg_apply_bindings(offscreen::bind_vegetation);
 
     for (glm::vec3 position : state::vegetation) {
+        if (!view.visible(position, VEGETATION_RADIUS))
+            continue;
         vs_params.model = glm::translate(glm::mat4(1.0f), position);
         sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
         sg_draw(0, 6, 1);
     }
-    sg_end_pass();
-
-    sg_begin_pass(sg_pass {
-        .action = state::pass_action,
-        .attachments = offscreen::attachment
-    });
+}
 
-    state::camera.front *= -1;
-    view = state::camera.getViewMatrix();
-    state::camera.front *= -1;
-    vs_params.view = view;
+// looking backwards from the camera, with the projection matching the shape
+// of the mirror rather than the window
+static void draw_mirror() {
+    int width {state::graph.width(offscreen::mirror)};
+    int height {state::graph.height(offscreen::mirror)};
+    glm::mat4 view = glm::lookAt(state::camera.pos,
+                                 state::camera.pos - state::camera.front,
+                                 state::camera.up);
+    glm::mat4 projection = glm::perspective(glm::radians(state::camera.zoom), static_cast<float>(width) / height, 0.1f, 100.0f);
+    draw_scene(sjd::View::make(view, projection, state::camera.pos, height, MIRROR_MIN_PIXELS),
+               ScenePipelines {offscreen::pip_mirror_cubes, offscreen::pip_mirror_vegetation});
+}
 
-    // Plane
-    sg_apply_pipeline(offscreen::pip_mirror_cubes);
-    sg_apply_bindings(offscreen::bind_plane);
+static void draw_screen() {
+    glm::mat4 view = state::camera.getViewMatrix();
+    glm::mat4 projection = glm::perspective(glm::radians(state::camera.zoom), static_cast<float>(sapp_width()) / sapp_height(), 0.1f, 100.0f);
+    draw_scene(sjd::View::make(view, projection, state::camera.pos, sapp_height()),
+               ScenePipelines {state::pip_cubes, state::pip_vegetation});
 
-    model = glm::mat4(1.0f);
-    vs_params.model = model;
-    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+    // mirror quad
+    state::bind.images[IMG__screenTexture] = state::graph.image(offscreen::mirror);
+    sg_apply_pipeline(state::pip);
+    sg_apply_bindings(state::bind);
     sg_draw(0, 6, 1);
+}
 
-    // Cubes
-    sg_apply_bindings(offscreen::bind_cubes);
-
-    model = glm::translate(glm::mat4(1.0f), glm::vec3(-1.0f, 0.0f, -1.0f));
-    vs_params.model = model;
-    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-    sg_draw(0, 36, 1);
-    model = glm::translate(glm::mat4(1.0f), glm::vec3(2.0f, 0.0f, 0.0f));
-    vs_params.model = model;
-    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-    sg_draw(0, 36, 1);
+void frame(void) {
+    sfetch_dowork();
 
-    // Vegetation
-    sg_apply_pipeline(offscreen::pip_mirror_vegetation);
-    sg_apply_bindings(offscreen::bind_vegetation);
+    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
 
-    for (glm::vec3 position : state::vegetation) {
-        vs_params.model = glm::translate(glm::mat4(1.0f), position);
-        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
-        sg_draw(0, 6, 1);
+    if (!sapp_mouse_locked()) {
+        sapp_lock_mouse(true);
     }
-    sg_end_pass();
-
-    sg_begin_pass(sg_pass {
-	.action = offscreen::pass_action,
-        .swapchain = sglue_swapchain()
-    });
-    // screen quad
-    sg_apply_pipeline(state::pip);
-    sg_apply_bindings(state::bind);
-    sg_draw(0, 6, 1);
+    state::camera.moveCamera(state::deltaTime);
 
+    // the mirror image may be remade by a resize, which needs drawing again
+    state::graph.prepare(sglue_swapchain());
+    bool update_mirror {state::mirror.shouldUpdate(state::camera.pos,
+                                                   -state::camera.front,
+                                                   state::graph.image(offscreen::mirror))};
+    state::graph.setPassEnabled(offscreen::mirror_pass, update_mirror);
 
-    sg_end_pass();
+    state::graph.execute(sglue_swapchain());
     sg_commit();
 }
 
 void cleanup(void) {
+    state::gfx_cache.report();
+    state::graph.report();
+    state::mirror.report();
     sfetch_shutdown();
     sg_shutdown();
 }
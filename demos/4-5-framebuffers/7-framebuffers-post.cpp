@@ -0,0 +1,594 @@
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <sjd/camera.h>
+#include <sjd/gfx_cache.h>
+#include <sjd/post.h>
+#include <sjd/profiler.h>
+#include <sjd/render_graph.h>
+#include <sjd/sok_texture.h>
+#include <iostream>
+#include <vector>
+
+#define SOKOL_DEBUG
+#define SOKOL_IMPL
+#ifndef __EMSCRIPTEN__
+#define SOKOL_GLCORE
+#else
+#define SOKOL_GLES3
+#endif
+#include <sokol/sokol_app.h>
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_log.h>
+#include <sokol/sokol_fetch.h>
+#include <sokol/sokol_glue.h>
+#include <sokol/sokol_time.h>
+
+// add the shader after glm
+#include "7-framebuffers-post.glsl.h"
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+namespace state {
+    enum Mode { GAUSSIAN, KAWASE, BLOOM };
+
+    sg_pass_action pass_action;
+    sjd::GfxCache gfx_cache;
+    sjd::RenderGraph graph;
+    sjd::RenderGraph::PassId screen_pass;
+    sjd::PostProcess post;
+    Mode mode {BLOOM};
+    int sample_count {1};
+    sjd::Camera camera(glm::vec3(3.0f, 0.8f, 4.0f),
+                       glm::vec3(1.0f, 0.4f, 0.0f));
+    uint64_t last_time;
+    float deltaTime;
+    std::vector<glm::vec3> vegetation {
+        glm::vec3(-1.5f,  0.0f, -0.48f),
+        glm::vec3( 1.5f,  0.0f,  0.51f),
+        glm::vec3( 0.0f,  0.0f,  0.7f),
+        glm::vec3(-0.3f,  0.0f, -2.3f),
+        glm::vec3( 0.5f,  0.0f, -0.6f)
+    };
+    // small cubes bright enough to bloom
+    std::vector<glm::vec3> lamps {
+        glm::vec3(-1.0f,  0.9f, -1.0f),
+        glm::vec3( 2.0f,  0.9f,  0.0f),
+        glm::vec3( 0.6f,  0.2f, -2.0f)
+    };
+    std::vector<glm::vec4> lamp_colours {
+        glm::vec4(6.0f, 4.0f, 2.0f, 1.0f),
+        glm::vec4(1.5f, 3.0f, 6.0f, 1.0f),
+        glm::vec4(5.0f, 1.0f, 1.0f, 1.0f)
+    };
+}
+namespace offscreen {
+    sjd::RenderGraph::Target color;
+    sjd::RenderGraph::Target depth;
+    sg_pixel_format format;
+    sg_pipeline pip_cubes;
+    sg_pipeline pip_vegetation;
+    sg_pipeline pip_lamps;
+    sg_bindings bind_cubes;
+    sg_bindings bind_plane;
+    sg_bindings bind_vegetation;
+    sg_pass_action pass_action;
+}
+
+// samples for the scene, 1 turns MSAA off. The post passes read the resolved
+// image and don't need it.
+const int OFFSCREEN_SAMPLES {4};
+
+static sg_sampler_desc custom_sampler_desc = {
+    .min_filter = SG_FILTER_LINEAR,
+    .mag_filter = SG_FILTER_LINEAR,
+    .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+    .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+    .compare = SG_COMPAREFUNC_NEVER,
+};
+
+static void fail_callback() {
+    state::pass_action = sg_pass_action {
+        .colors = {{ .load_action=SG_LOADACTION_CLEAR,
+            .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f }
+        }}
+    };
+    state::graph.setPassAction(state::screen_pass, state::pass_action);
+}
+
+static void draw_scene();
+
+// the scene pass followed by the passes of the current effect. Switching
+// effect rebuilds the graph, the effects that aren't shown don't cost
+// anything and their targets are freed.
+void create_render_graph() {
+    state::graph.clear();
+
+    offscreen::color = state::graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = offscreen::format,
+        .sampleCount = state::sample_count,
+        .label = "color-image"
+    });
+    offscreen::depth = state::graph.createTarget(sjd::RenderGraph::TargetDesc {
+        .format = SG_PIXELFORMAT_DEPTH,
+        .sampleCount = state::sample_count,
+        .label = "depth-image"
+    });
+
+    state::graph.addPass(sjd::RenderGraph::PassDesc {
+        .name = "offscreen-pass",
+        .colors = {offscreen::color},
+        .depth = offscreen::depth,
+        .action = offscreen::pass_action,
+    }, draw_scene);
+
+    switch (state::mode) {
+    case state::GAUSSIAN: {
+        sjd::RenderGraph::Target blurred {state::post.addGaussianBlur(state::graph, offscreen::color, 0.5f)};
+        state::screen_pass = state::post.addCopy(state::graph, blurred, state::pass_action);
+        break;
+    }
+    case state::KAWASE: {
+        sjd::RenderGraph::Target blurred {state::post.addKawaseBlur(state::graph, offscreen::color, 4)};
+        state::screen_pass = state::post.addCopy(state::graph, blurred, state::pass_action);
+        break;
+    }
+    case state::BLOOM: {
+        sjd::RenderGraph::Target bloom {state::post.addBloom(state::graph, offscreen::color, 5)};
+        state::screen_pass = state::post.addBloomComposite(state::graph, offscreen::color, bloom, state::pass_action);
+        break;
+    }
+    }
+}
+
+static void print_settings() {
+    switch (state::mode) {
+    case state::GAUSSIAN:
+        std::cout << "Separable Gaussian at half resolution, sigma " << state::post.gaussian.sigma << " texels\n";
+        break;
+    case state::KAWASE:
+        std::cout << "Dual Kawase blur, 4 levels, spread " << state::post.kawase.spread << "\n";
+        break;
+    case state::BLOOM:
+        std::cout << "Kawase bloom, 5 levels, intensity " << state::post.bloom.intensity << "\n";
+        break;
+    }
+}
+
+static void set_mode(state::Mode mode) {
+    if (mode == state::mode)
+        return;
+    state::mode = mode;
+    create_render_graph();
+    print_settings();
+}
+
+static void adjust_strength(float factor) {
+    switch (state::mode) {
+    case state::GAUSSIAN:
+        state::post.gaussian.sigma = glm::clamp(state::post.gaussian.sigma * factor, 0.5f, 16.0f / 3.0f);
+        break;
+    case state::KAWASE:
+        state::post.kawase.spread = glm::clamp(state::post.kawase.spread * factor, 0.5f, 4.0f);
+        break;
+    case state::BLOOM:
+        state::post.bloom.intensity = glm::clamp(state::post.bloom.intensity * factor, 0.05f, 4.0f);
+        break;
+    }
+    print_settings();
+}
+
+static void init(void) {
+    sg_setup(sg_desc {
+        .logger {
+            .func = slog_func
+        },
+        .environment = sglue_environment(),
+    });
+
+    sfetch_setup(sfetch_desc_t {
+        .max_requests = 8,
+        .num_channels = 1,
+        .num_lanes = 1,
+        .logger {
+            .func = slog_func
+        },
+    });
+
+    stm_setup();
+
+    /* a pass action to clear offscreen framebuffer */
+    offscreen::pass_action = sg_pass_action {
+        .colors = {{ 
+            .load_action=SG_LOADACTION_CLEAR,
+            .clear_value={0.1f, 0.1f, 0.1f, 1.0f} 
+        }}
+    };
+
+    // the post-processing passes cover the whole screen
+    state::pass_action = sg_pass_action {
+        .colors {{
+            .load_action=SG_LOADACTION_DONTCARE,
+        }},
+    };
+
+    std::vector<float> vertices {
+        // Back face
+        -0.5f, -0.5f, -0.5f,  0.0f, 0.0f, // Bottom-left
+         0.5f,  0.5f, -0.5f,  1.0f, 1.0f, // top-right
+         0.5f, -0.5f, -0.5f,  1.0f, 0.0f, // bottom-right
+         0.5f,  0.5f, -0.5f,  1.0f, 1.0f, // top-right
+        -0.5f, -0.5f, -0.5f,  0.0f, 0.0f, // bottom-left
+        -0.5f,  0.5f, -0.5f,  0.0f, 1.0f, // top-left
+        // Front face
+        -0.5f, -0.5f,  0.5f,  0.0f, 0.0f, // bottom-left
+         0.5f, -0.5f,  0.5f,  1.0f, 0.0f, // bottom-right
+         0.5f,  0.5f,  0.5f,  1.0f, 1.0f, // top-right
+         0.5f,  0.5f,  0.5f,  1.0f, 1.0f, // top-right
+        -0.5f,  0.5f,  0.5f,  0.0f, 1.0f, // top-left
+        -0.5f, -0.5f,  0.5f,  0.0f, 0.0f, // bottom-left
+        // Left face
+        -0.5f,  0.5f,  0.5f,  1.0f, 0.0f, // top-right
+        -0.5f,  0.5f, -0.5f,  1.0f, 1.0f, // top-left
+        -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, // bottom-left
+        -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, // bottom-left
+        -0.5f, -0.5f,  0.5f,  0.0f, 0.0f, // bottom-right
+        -0.5f,  0.5f,  0.5f,  1.0f, 0.0f, // top-right
+        // Right face
+         0.5f,  0.5f,  0.5f,  1.0f, 0.0f, // top-left
+         0.5f, -0.5f, -0.5f,  0.0f, 1.0f, // bottom-right
+         0.5f,  0.5f, -0.5f,  1.0f, 1.0f, // top-right
+         0.5f, -0.5f, -0.5f,  0.0f, 1.0f, // bottom-right
+         0.5f,  0.5f,  0.5f,  1.0f, 0.0f, // top-left
+         0.5f, -0.5f,  0.5f,  0.0f, 0.0f, // bottom-left
+        // Bottom face
+        -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, // top-right
+         0.5f, -0.5f, -0.5f,  1.0f, 1.0f, // top-left
+         0.5f, -0.5f,  0.5f,  1.0f, 0.0f, // bottom-left
+         0.5f, -0.5f,  0.5f,  1.0f, 0.0f, // bottom-left
+        -0.5f, -0.5f,  0.5f,  0.0f, 0.0f, // bottom-right
+        -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, // top-right
+        // Top face
+        -0.5f,  0.5f, -0.5f,  0.0f, 1.0f, // top-left
+         0.5f,  0.5f,  0.5f,  1.0f, 0.0f, // bottom-right
+         0.5f,  0.5f, -0.5f,  1.0f, 1.0f, // top-right
+         0.5f,  0.5f,  0.5f,  1.0f, 0.0f, // bottom-right
+        -0.5f,  0.5f, -0.5f,  0.0f, 1.0f, // top-left
+        -0.5f,  0.5f,  0.5f,  0.0f, 0.0f  // bottom-left
+    };
+
+    sg_buffer cube_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = vertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = vertices.data(),
+            .size = vertices.size() * sizeof(float),
+        },
+        .label = "cube-vertices"
+    });
+
+    offscreen::bind_cubes.vertex_buffers[0] = cube_buffer;
+
+    std::vector<float> planeVertices = {
+        // positions        // texture Coords
+         5.0f, -0.5f,  5.0f,  2.0f, 0.0f,
+        -5.0f, -0.5f, -5.0f,  0.0f, 2.0f,
+        -5.0f, -0.5f,  5.0f,  0.0f, 0.0f,
+
+         5.0f, -0.5f,  5.0f,  2.0f, 0.0f,
+         5.0f, -0.5f, -5.0f,  2.0f, 2.0f,
+        -5.0f, -0.5f, -5.0f,  0.0f, 2.0f
+    };
+
+    sg_buffer plane_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = planeVertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = planeVertices.data(),
+            .size = planeVertices.size() * sizeof(float),
+        },
+        .label = "plane-vertices"
+    });
+
+    offscreen::bind_plane.vertex_buffers[0] = plane_buffer;
+
+    std::vector<float> vegetationVertices {
+        // positions          // texture coords
+        -0.5f, -0.5f,  0.0f,  0.0f,  0.0f,
+         0.5f, -0.5f,  0.0f,  1.0f,  0.0f,
+         0.5f,  0.5f,  0.0f,  1.0f,  1.0f,
+         0.5f,  0.5f,  0.0f,  1.0f,  1.0f,
+        -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
+        -0.5f, -0.5f,  0.0f,  0.0f,  0.0f,
+    };
+
+    sg_buffer vegetation_buffer = sg_make_buffer(sg_buffer_desc {
+        .size = vegetationVertices.size() * sizeof(float),
+        .data = sg_range {
+            .ptr = vegetationVertices.data(),
+            .size = vegetationVertices.size() * sizeof(float),
+        },
+        .label = "vegetation-vertices"
+    });
+
+    offscreen::bind_vegetation.vertex_buffers[0] = vegetation_buffer;
+
+    // create shader from code-generated sg_shader_desc
+    sg_shader simple_shd = sg_make_shader(simple_shader_desc(sg_query_backend()));
+    sg_shader emissive_shd = sg_make_shader(emissive_shader_desc(sg_query_backend()));
+
+    // the scene goes into a float target when possible so the lamps can be
+    // brighter than white, that's what the bloom threshold picks out
+    offscreen::format = sjd::PostProcess::hdrFormat();
+    if (offscreen::format != SG_PIXELFORMAT_RGBA16F) {
+        std::cout << "WARNING::POST::RGBA16F_NOT_RENDERABLE: bloom falls back to an RGBA8 scene\n";
+        state::post.bloom.threshold = 0.9f;
+        state::post.bloom.exposure = 0.0f;
+    }
+    // not every GPU can multisample a float target
+    state::sample_count = sjd::RenderGraph::pickSampleCount({
+        sjd::RenderGraph::TargetDesc {.format = offscreen::format},
+        sjd::RenderGraph::TargetDesc {.format = SG_PIXELFORMAT_DEPTH},
+    }, OFFSCREEN_SAMPLES, sapp_width(), sapp_height());
+    state::post.setup(sjd::PostProcess::Shaders {
+        .gaussian = sg_make_shader(post_gaussian_shader_desc(sg_query_backend())),
+        .kawaseDown = sg_make_shader(post_kawase_down_shader_desc(sg_query_backend())),
+        .kawaseUp = sg_make_shader(post_kawase_up_shader_desc(sg_query_backend())),
+        .bloomPrefilter = sg_make_shader(post_bloom_prefilter_shader_desc(sg_query_backend())),
+        .bloomComposite = sg_make_shader(post_bloom_composite_shader_desc(sg_query_backend())),
+        .copy = sg_make_shader(post_copy_shader_desc(sg_query_backend())),
+    }, offscreen::format);
+
+    // we need to initialise layout seperately to the pipeline
+    // because we cant do array initilisation of structs in C++
+    sg_vertex_layout_state layout {};
+    layout.attrs[ATTR_simple_aPos].format = SG_VERTEXFORMAT_FLOAT3;
+    layout.attrs[ATTR_simple_aTexCoords].format = SG_VERTEXFORMAT_FLOAT2;
+
+    // create a pipeline object
+    offscreen::pip_cubes = state::gfx_cache.pipeline(sg_pipeline_desc {
+        .shader = simple_shd,
+        .layout = layout,
+        .depth = {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = true,
+        },
+        .color_count = 1,
+        .colors = {{
+            .pixel_format = offscreen::format,
+        }},
+        .cull_mode = SG_CULLMODE_FRONT,
+        .sample_count = state::sample_count,
+        .label = "object-pipeline"
+    });
+
+    offscreen::pip_vegetation = state::gfx_cache.pipeline(sg_pipeline_desc {
+        .shader = simple_shd,
+        .layout = layout,
+        .depth {    // Our first 3D elements so we need to enable depth testing
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS,   // discard fragments that are further away
+            .write_enabled = true,
+        },
+        .color_count = 1,
+        .colors = {{
+            .pixel_format = offscreen::format,
+        }},
+        .sample_count = state::sample_count,
+        .label = "vegetation-pipeline"
+    });
+
+    offscreen::pip_lamps = state::gfx_cache.pipeline(sg_pipeline_desc {
+        .shader = emissive_shd,
+        .layout = layout,
+        .depth = {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = true,
+        },
+        .color_count = 1,
+        .colors = {{
+            .pixel_format = offscreen::format,
+        }},
+        .cull_mode = SG_CULLMODE_FRONT,
+        .sample_count = state::sample_count,
+        .label = "lamp-pipeline"
+    });
+
+    create_render_graph();
+    print_settings();
+
+    SokTexture marble("../data/container.jpg",
+                          offscreen::bind_cubes,
+                          IMG__texture1,
+                          SMP_texture1_smp,
+                          true,
+                          fail_callback);
+
+    SokTexture metal("../data/metal.png",
+                       offscreen::bind_plane,
+                       IMG__texture1,
+                       SMP_texture1_smp,
+                       true,
+                       fail_callback);
+
+    SokTexture vegetation("../data/grass.png",
+                          offscreen::bind_vegetation,
+                          IMG__texture1,
+                          SMP_texture1_smp,
+                          true,
+                          fail_callback,
+                          &custom_sampler_desc);
+
+}
+
+static void draw_scene() {
+    glm::mat4 view = state::camera.getViewMatrix();
+    glm::mat4 projection = glm::perspective(glm::radians(state::camera.zoom), static_cast<float>(sapp_width()) / sapp_height(), 0.1f, 100.0f);
+    vs_params_t vs_params = {
+        .view = view,
+        .projection = projection
+    };
+
+    // Plane
+    sg_apply_pipeline(offscreen::pip_cubes);
+    sg_apply_bindings(offscreen::bind_plane);
+
+    glm::mat4 model = glm::mat4(1.0f);
+    vs_params.model = model;
+    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+    sg_draw(0, 6, 1);
+
+    // Cubes
+    sg_apply_bindings(offscreen::bind_cubes);
+
+    model = glm::translate(glm::mat4(1.0f), glm::vec3(-1.0f, 0.0f, -1.0f));
+    vs_params.model = model;
+    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+    sg_draw(0, 36, 1);
+    model = glm::translate(glm::mat4(1.0f), glm::vec3(2.0f, 0.0f, 0.0f));
+    vs_params.model = model;
+    sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+    sg_draw(0, 36, 1);
+
+    // Lamps
+    sg_apply_pipeline(offscreen::pip_lamps);
+    sg_apply_bindings(offscreen::bind_cubes);
+
+    for (size_t i = 0; i < state::lamps.size(); i++) {
+        vs_params.model = glm::scale(glm::translate(glm::mat4(1.0f), state::lamps[i]), glm::vec3(0.2f));
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        fs_emissive_params_t emissive_params {
+            .colour = state::lamp_colours[i]
+        };
+        sg_apply_uniforms(UB_fs_emissive_params, SG_RANGE(emissive_params));
+        sg_draw(0, 36, 1);
+    }
+
+    // Vegetation
+    sg_apply_pipeline(offscreen::pip_vegetation);
+    sg_apply_bindings(offscreen::bind_vegetation);
+
+    for (glm::vec3 position : state::vegetation) {
+        vs_params.model = glm::translate(glm::mat4(1.0f), position);
+        sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+        sg_draw(0, 6, 1);
+    }
+}
+
+void frame(void) {
+    sjd::Profiler::instance().beginFrame();
+    {
+        SJD_PROFILE_SCOPE("sfetch_dowork");
+        sfetch_dowork();
+    }
+
+    state::deltaTime = static_cast<float>(stm_sec(stm_laptime(&state::last_time)));
+
+    if (!sapp_mouse_locked()) {
+        sapp_lock_mouse(true);
+    }
+    state::camera.moveCamera(state::deltaTime);
+
+    state::graph.execute(sglue_swapchain());
+    {
+        SJD_PROFILE_SCOPE("sg_commit");
+        sg_commit();
+    }
+    sjd::Profiler::instance().endFrame();
+}
+
+void cleanup(void) {
+    sjd::Profiler::instance().finish("trace.json");
+    state::gfx_cache.report();
+    state::graph.report();
+    state::post.shutdown();
+    sfetch_shutdown();
+    sg_shutdown();
+}
+
+void event(const sapp_event* e) {
+    if (e->type == SAPP_EVENTTYPE_KEY_DOWN) {
+        if (e->key_code == SAPP_KEYCODE_ESCAPE) {
+            sapp_request_quit();
+        }
+        if (e->key_code == SAPP_KEYCODE_F9)
+            sjd::Profiler::instance().startOrWrite("trace.json");
+        if (e->key_code == SAPP_KEYCODE_1)
+            set_mode(state::GAUSSIAN);
+        if (e->key_code == SAPP_KEYCODE_2)
+            set_mode(state::KAWASE);
+        if (e->key_code == SAPP_KEYCODE_3)
+            set_mode(state::BLOOM);
+        if (e->key_code == SAPP_KEYCODE_UP)
+            adjust_strength(1.25f);
+        if (e->key_code == SAPP_KEYCODE_DOWN)
+            adjust_strength(0.8f);
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::PRESS);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::PRESS);
+    }
+
+    if (e->type == SAPP_EVENTTYPE_KEY_UP) {
+        if (e->key_code == SAPP_KEYCODE_SPACE)
+            state::camera.processKeyboard(sjd::Camera::UP, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_C)
+            state::camera.processKeyboard(sjd::Camera::DOWN, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_W)
+            state::camera.processKeyboard(sjd::Camera::FORWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_S) 
+            state::camera.processKeyboard(sjd::Camera::BACKWARD, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_A)
+            state::camera.processKeyboard(sjd::Camera::LEFT, sjd::Camera::RELEASE);
+        if (e->key_code == SAPP_KEYCODE_D)
+            state::camera.processKeyboard(sjd::Camera::RIGHT, sjd::Camera::RELEASE);
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_BEGAN) {
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+    }
+    if (e->type == SAPP_EVENTTYPE_TOUCHES_MOVED) {
+        float offsetX = e -> touches[0].pos_x - state::camera.lastX;
+        float offsetY = state::camera.lastY - e -> touches[0].pos_y;
+        state::camera.lastX = e->touches[0].pos_x;
+        state::camera.lastY = e->touches[0].pos_y;
+        state::camera.processMouseMovement(offsetX, offsetY);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+        state::camera.processMouseMovement(e->mouse_dx, -e->mouse_dy);
+    }
+    if (e->type == SAPP_EVENTTYPE_MOUSE_SCROLL) {
+        state::camera.processMouseScroll(e->scroll_y);
+    }
+
+}
+
+sapp_desc sokol_main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    return sapp_desc {
+        .init_cb = init,
+        .frame_cb = frame,
+        .cleanup_cb = cleanup,
+        .event_cb = event,
+        .width = 800,
+        .height = 600,
+        .high_dpi = true,
+        .window_title = "Post-processing (1 Gaussian, 2 Kawase, 3 bloom) - LearnOpenGL",
+        .logger {
+            .func = slog_func
+        },
+#ifdef _WIN32
+        .win32_console_utf8 = true,
+        .win32_console_attach = true,
+#endif
+    };
+}
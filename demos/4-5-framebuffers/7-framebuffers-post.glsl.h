@@ -0,0 +1,2043 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i .\7-framebuffers-post.glsl -o .\7-framebuffers-post.glsl.h -l glsl430:glsl300es
+
+    Overview:
+    =========
+    Shader program: 'emissive':
+        Get shader desc: emissive_shader_desc(sg_query_backend());
+        Vertex Shader: vs
+        Fragment Shader: fs_emissive
+        Attributes:
+            ATTR_emissive_aPos => 0
+            ATTR_emissive_aTexCoords => 1
+    Shader program: 'post_bloom_composite':
+        Get shader desc: post_bloom_composite_shader_desc(sg_query_backend());
+        Vertex Shader: vs_post
+        Fragment Shader: fs_bloom_composite
+    Shader program: 'post_bloom_prefilter':
+        Get shader desc: post_bloom_prefilter_shader_desc(sg_query_backend());
+        Vertex Shader: vs_post
+        Fragment Shader: fs_bloom_prefilter
+    Shader program: 'post_copy':
+        Get shader desc: post_copy_shader_desc(sg_query_backend());
+        Vertex Shader: vs_post
+        Fragment Shader: fs_post_copy
+    Shader program: 'post_gaussian':
+        Get shader desc: post_gaussian_shader_desc(sg_query_backend());
+        Vertex Shader: vs_post
+        Fragment Shader: fs_gaussian
+    Shader program: 'post_kawase_down':
+        Get shader desc: post_kawase_down_shader_desc(sg_query_backend());
+        Vertex Shader: vs_post
+        Fragment Shader: fs_kawase_down
+    Shader program: 'post_kawase_up':
+        Get shader desc: post_kawase_up_shader_desc(sg_query_backend());
+        Vertex Shader: vs_post
+        Fragment Shader: fs_kawase_up
+    Shader program: 'post_upscale':
+        Get shader desc: post_upscale_shader_desc(sg_query_backend());
+        Vertex Shader: vs_post
+        Fragment Shader: fs_upscale
+    Shader program: 'simple':
+        Get shader desc: simple_shader_desc(sg_query_backend());
+        Vertex Shader: vs
+        Fragment Shader: fs
+        Attributes:
+            ATTR_simple_aPos => 0
+            ATTR_simple_aTexCoords => 1
+    Bindings:
+        Uniform block 'vs_params':
+            C struct: vs_params_t
+            Bind slot: UB_vs_params => 0
+        Uniform block 'fs_emissive_params':
+            C struct: fs_emissive_params_t
+            Bind slot: UB_fs_emissive_params => 1
+        Uniform block 'post_params':
+            C struct: post_params_t
+            Bind slot: UB_post_params => 0
+        Image '_source':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__source => 0
+        Image '_bloom':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__bloom => 1
+        Image '_texture1':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__texture1 => 0
+        Sampler 'source_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_source_smp => 0
+        Sampler 'texture1_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_texture1_smp => 0
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before 7-framebuffers-post.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define ATTR_emissive_aPos (0)
+#define ATTR_emissive_aTexCoords (1)
+#define ATTR_simple_aPos (0)
+#define ATTR_simple_aTexCoords (1)
+#define UB_vs_params (0)
+#define UB_fs_emissive_params (1)
+#define UB_post_params (0)
+#define IMG__source (0)
+#define IMG__bloom (1)
+#define IMG__texture1 (0)
+#define SMP_source_smp (0)
+#define SMP_texture1_smp (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
+    glm::mat4 model;
+    glm::mat4 view;
+    glm::mat4 projection;
+} vs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_emissive_params_t {
+    glm::vec4 colour;
+} fs_emissive_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct post_params_t {
+    glm::vec4 texel;
+    glm::vec4 offsets[2];
+    glm::vec4 weights[2];
+    glm::vec4 params;
+} post_params_t;
+#pragma pack(pop)
+/*
+    #version 430
+
+    layout(location = 0) out vec2 TexCoords;
+
+    void main()
+    {
+        TexCoords = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+        gl_Position = vec4(TexCoords * 2.0 - 1.0, 0.0, 1.0);
+    }
+
+*/
+static const uint8_t vs_post_source_glsl430[194] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x28,0x67,0x6c,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x3c,0x3c,0x20,0x31,0x29,0x20,0x26,0x20,
+    0x32,0x2c,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x26,
+    0x20,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,
+    0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 post_params[6];
+    layout(binding = 16) uniform sampler2D _source_source_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    void main()
+    {
+        vec3 colour = texture(_source_source_smp, TexCoords).rgb * post_params[5].x;
+        int pairs = int(post_params[5].y);
+        for (int i = 0; i < 8; i++)
+        {
+            if (i >= pairs)
+            {
+                break;
+            }
+            vec2 offset = post_params[0].xy * post_params[1 + (i / 4)][i % 4];
+            float weight = post_params[3 + (i / 4)][i % 4];
+            colour += texture(_source_source_smp, TexCoords + offset).rgb * weight;
+            colour += texture(_source_source_smp, TexCoords - offset).rgb * weight;
+        }
+        FragColor = vec4(colour, 1.0);
+    }
+
+*/
+static const uint8_t fs_gaussian_source_glsl430[755] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,
+    0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,
+    0x67,0x62,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x35,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x70,
+    0x61,0x69,0x72,0x73,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,
+    0x3b,0x20,0x69,0x20,0x3c,0x20,0x38,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x20,0x3e,0x3d,0x20,0x70,0x61,0x69,0x72,0x73,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x70,0x6f,0x73,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x20,0x2b,0x20,0x28,0x69,0x20,
+    0x2f,0x20,0x34,0x29,0x5d,0x5b,0x69,0x20,0x25,0x20,0x34,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x65,0x69,0x67,
+    0x68,0x74,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x33,0x20,0x2b,0x20,0x28,0x69,0x20,0x2f,0x20,0x34,0x29,0x5d,0x5b,0x69,0x20,
+    0x25,0x20,0x34,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x6f,0x75,0x72,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x77,0x65,
+    0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x6f,0x75,0x72,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2d,0x20,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x77,0x65,
+    0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 post_params[6];
+    layout(binding = 16) uniform sampler2D _source_source_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    vec3 kawaseDown(vec2 uv)
+    {
+        vec2 halfpixel = post_params[0].xy * post_params[0].z;
+        vec3 sum = texture(_source_source_smp, uv).rgb * 4.0;
+        sum += texture(_source_source_smp, uv - halfpixel).rgb;
+        sum += texture(_source_source_smp, uv + halfpixel).rgb;
+        sum += texture(_source_source_smp, uv + vec2(halfpixel.x, -halfpixel.y)).rgb;
+        sum += texture(_source_source_smp, uv - vec2(halfpixel.x, -halfpixel.y)).rgb;
+        return sum / 8.0;
+    }
+
+    void main()
+    {
+        FragColor = vec4(kawaseDown(TexCoords), 1.0);
+    }
+
+*/
+static const uint8_t fs_kawase_down_source_glsl430[705] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x6b,0x61,0x77,
+    0x61,0x73,0x65,0x44,0x6f,0x77,0x6e,0x28,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x61,0x6c,0x66,
+    0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x2e,0x72,0x67,0x62,
+    0x20,0x2a,0x20,0x34,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,
+    0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,
+    0x76,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x29,0x2e,0x72,
+    0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,
+    0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,0x2d,0x68,
+    0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,
+    0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,
+    0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
+    0x75,0x6d,0x20,0x2f,0x20,0x38,0x2e,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x6b,0x61,0x77,0x61,0x73,0x65,0x44,0x6f,0x77,0x6e,0x28,0x54,0x65,0x78,0x43,0x6f,
+    0x6f,0x72,0x64,0x73,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 post_params[6];
+    layout(binding = 16) uniform sampler2D _source_source_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    void main()
+    {
+        vec2 halfpixel = post_params[0].xy * 0.5 * post_params[0].z;
+        vec3 sum = texture(_source_source_smp, TexCoords + vec2(-halfpixel.x * 2.0, 0.0)).rgb;
+        sum += texture(_source_source_smp, TexCoords + vec2(-halfpixel.x, halfpixel.y)).rgb * 2.0;
+        sum += texture(_source_source_smp, TexCoords + vec2(0.0, halfpixel.y * 2.0)).rgb;
+        sum += texture(_source_source_smp, TexCoords + vec2(halfpixel.x, halfpixel.y)).rgb * 2.0;
+        sum += texture(_source_source_smp, TexCoords + vec2(halfpixel.x * 2.0, 0.0)).rgb;
+        sum += texture(_source_source_smp, TexCoords + vec2(halfpixel.x, -halfpixel.y)).rgb * 2.0;
+        sum += texture(_source_source_smp, TexCoords + vec2(0.0, -halfpixel.y * 2.0)).rgb;
+        sum += texture(_source_source_smp, TexCoords + vec2(-halfpixel.x, -halfpixel.y)).rgb * 2.0;
+        FragColor = vec4(sum / 12.0, 1.0);
+    }
+
+*/
+static const uint8_t fs_kawase_up_source_glsl430[1036] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x68,
+    0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x30,
+    0x2e,0x35,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x73,0x75,0x6d,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x72,0x67,0x62,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x68,0x61,0x6c,0x66,0x70,
+    0x69,0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,
+    0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x32,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,
+    0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x68,0x61,
+    0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,
+    0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x68,
+    0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,0x68,0x61,0x6c,0x66,
+    0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,
+    0x32,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x68,0x61,0x6c,
+    0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x20,0x2a,0x20,0x32,0x2e,0x30,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,
+    0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,
+    0x67,0x62,0x20,0x2a,0x20,0x32,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,
+    0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,
+    0x6c,0x2e,0x79,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,
+    0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,
+    0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,
+    0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x32,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x73,0x75,0x6d,0x20,0x2f,0x20,0x31,0x32,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 post_params[6];
+    layout(binding = 16) uniform sampler2D _source_source_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    vec3 kawaseDown(vec2 uv)
+    {
+        vec2 halfpixel = post_params[0].xy * post_params[0].z;
+        vec3 sum = texture(_source_source_smp, uv).rgb * 4.0;
+        sum += texture(_source_source_smp, uv - halfpixel).rgb;
+        sum += texture(_source_source_smp, uv + halfpixel).rgb;
+        sum += texture(_source_source_smp, uv + vec2(halfpixel.x, -halfpixel.y)).rgb;
+        sum += texture(_source_source_smp, uv - vec2(halfpixel.x, -halfpixel.y)).rgb;
+        return sum / 8.0;
+    }
+
+    void main()
+    {
+        vec3 colour = kawaseDown(TexCoords);
+        float brightness = max(colour.r, max(colour.g, colour.b));
+        float threshold = post_params[5].x;
+        float knee = threshold * post_params[5].y + 1e-5;
+        float soft = clamp(brightness - threshold + knee, 0.0, 2.0 * knee);
+        soft = soft * soft / (4.0 * knee);
+        float contribution = max(soft, brightness - threshold) / max(brightness, 1e-5);
+        FragColor = vec4(colour * contribution, 1.0);
+    }
+
+*/
+static const uint8_t fs_bloom_prefilter_source_glsl430[1098] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x6b,0x61,0x77,
+    0x61,0x73,0x65,0x44,0x6f,0x77,0x6e,0x28,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x61,0x6c,0x66,
+    0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x2e,0x72,0x67,0x62,
+    0x20,0x2a,0x20,0x34,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,
+    0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,
+    0x76,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x29,0x2e,0x72,
+    0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,
+    0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,0x2d,0x68,
+    0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,
+    0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,
+    0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
+    0x75,0x6d,0x20,0x2f,0x20,0x38,0x2e,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x6b,0x61,0x77,
+    0x61,0x73,0x65,0x44,0x6f,0x77,0x6e,0x28,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,
+    0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x72,
+    0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x63,
+    0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x72,0x2c,0x20,0x6d,0x61,0x78,0x28,0x63,0x6f,0x6c,
+    0x6f,0x75,0x72,0x2e,0x67,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x62,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x68,0x72,
+    0x65,0x73,0x68,0x6f,0x6c,0x64,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x6b,0x6e,0x65,0x65,0x20,0x3d,0x20,0x74,0x68,0x72,0x65,
+    0x73,0x68,0x6f,0x6c,0x64,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x79,0x20,0x2b,0x20,0x31,0x65,0x2d,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6f,0x66,0x74,0x20,
+    0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,
+    0x73,0x73,0x20,0x2d,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x20,0x2b,
+    0x20,0x6b,0x6e,0x65,0x65,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,0x20,
+    0x2a,0x20,0x6b,0x6e,0x65,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x6f,0x66,
+    0x74,0x20,0x3d,0x20,0x73,0x6f,0x66,0x74,0x20,0x2a,0x20,0x73,0x6f,0x66,0x74,0x20,
+    0x2f,0x20,0x28,0x34,0x2e,0x30,0x20,0x2a,0x20,0x6b,0x6e,0x65,0x65,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x73,0x6f,0x66,
+    0x74,0x2c,0x20,0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x20,0x2d,0x20,
+    0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x29,0x20,0x2f,0x20,0x6d,0x61,0x78,
+    0x28,0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x2c,0x20,0x31,0x65,0x2d,
+    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,
+    0x2a,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 post_params[6];
+    layout(binding = 16) uniform sampler2D _source_source_smp;
+    layout(binding = 17) uniform sampler2D _bloom_source_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    void main()
+    {
+        vec3 colour = texture(_source_source_smp, TexCoords).rgb + texture(_bloom_source_smp, TexCoords).rgb * post_params[5].z;
+        if (post_params[5].w > 0.0)
+        {
+            colour = vec3(1.0) - exp(-colour * post_params[5].w);
+        }
+        FragColor = vec4(colour, 1.0);
+    }
+
+*/
+static const uint8_t fs_bloom_composite_source_glsl430[526] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x37,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x62,0x6c,
+    0x6f,0x6f,0x6d,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,
+    0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,0x67,0x62,0x20,0x2b,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x62,0x6c,0x6f,0x6f,0x6d,0x5f,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x35,0x5d,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x75,
+    0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,
+    0x65,0x78,0x70,0x28,0x2d,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2a,0x20,0x70,0x6f,
+    0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x6f,
+    0x75,0x72,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    layout(binding = 16) uniform sampler2D _source_source_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    void main()
+    {
+        FragColor = vec4(texture(_source_source_smp, TexCoords).rgb, 1.0);
+    }
+
+*/
+static const uint8_t fs_post_copy_source_glsl430[244] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,
+    0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x29,0x2e,0x72,0x67,0x62,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 post_params[6];
+    layout(binding = 16) uniform sampler2D _source_source_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    void main()
+    {
+        vec3 c = texture(_source_source_smp, TexCoords).rgb;
+        vec3 n = texture(_source_source_smp, TexCoords + vec2(0.0, post_params[0].y)).rgb;
+        vec3 s = texture(_source_source_smp, TexCoords - vec2(0.0, post_params[0].y)).rgb;
+        vec3 e = texture(_source_source_smp, TexCoords + vec2(post_params[0].x, 0.0)).rgb;
+        vec3 w = texture(_source_source_smp, TexCoords - vec2(post_params[0].x, 0.0)).rgb;
+        vec3 mn = clamp(min(c, min(min(n, s), min(e, w))), 0.0, 1.0);
+        vec3 mx = clamp(max(c, max(max(n, s), max(e, w))), 0.0, 1.0);
+        vec3 amount = sqrt(clamp(min(mn, 1.0 - mx) / max(mx, 1e-5), 0.0, 1.0));
+        vec3 weight = amount * -mix(0.125, 0.2, post_params[5].x);
+        vec3 colour = (c + (n + s + e + w) * weight) / (1.0 + 4.0 * weight);
+        FragColor = vec4(max(colour, 0.0), 1.0);
+    }
+
+*/
+static const uint8_t fs_upscale_source_glsl430[996] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,
+    0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x70,0x6f,
+    0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x29,
+    0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x30,0x2e,0x30,0x2c,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x65,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,
+    0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x72,
+    0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x77,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,
+    0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x70,0x6f,
+    0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x6d,0x6e,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6d,
+    0x69,0x6e,0x28,0x63,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x6d,0x69,0x6e,0x28,0x6e,0x2c,
+    0x20,0x73,0x29,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x65,0x2c,0x20,0x77,0x29,0x29,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x6d,0x78,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x6d,0x61,0x78,0x28,0x63,0x2c,0x20,0x6d,0x61,0x78,0x28,0x6d,0x61,0x78,0x28,
+    0x6e,0x2c,0x20,0x73,0x29,0x2c,0x20,0x6d,0x61,0x78,0x28,0x65,0x2c,0x20,0x77,0x29,
+    0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x6d,0x6f,0x75,0x6e,0x74,0x20,0x3d,
+    0x20,0x73,0x71,0x72,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6d,0x69,0x6e,0x28,
+    0x6d,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x6d,0x78,0x29,0x20,0x2f,0x20,
+    0x6d,0x61,0x78,0x28,0x6d,0x78,0x2c,0x20,0x31,0x65,0x2d,0x35,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x3d,0x20,0x61,0x6d,0x6f,
+    0x75,0x6e,0x74,0x20,0x2a,0x20,0x2d,0x6d,0x69,0x78,0x28,0x30,0x2e,0x31,0x32,0x35,
+    0x2c,0x20,0x30,0x2e,0x32,0x2c,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x28,0x63,0x20,0x2b,
+    0x20,0x28,0x6e,0x20,0x2b,0x20,0x73,0x20,0x2b,0x20,0x65,0x20,0x2b,0x20,0x77,0x29,
+    0x20,0x2a,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x29,0x20,0x2f,0x20,0x28,0x31,0x2e,
+    0x30,0x20,0x2b,0x20,0x34,0x2e,0x30,0x20,0x2a,0x20,0x77,0x65,0x69,0x67,0x68,0x74,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6d,0x61,0x78,0x28,0x63,0x6f,0x6c,0x6f,
+    0x75,0x72,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 vs_params[12];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec2 aTexCoords;
+    layout(location = 0) out vec2 TexCoords;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        TexCoords = aTexCoords;
+    }
+
+*/
+static const uint8_t vs_source_glsl430[432] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x54,0x65,0x78,0x43,0x6f,
+    0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,
+    0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,
+    0x61,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    layout(binding = 16) uniform sampler2D _texture1_texture1_smp;
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    void main()
+    {
+        vec4 texColour = texture(_texture1_texture1_smp, TexCoords);
+        if (texColour.a < 0.1)
+        {
+            discard;
+        };
+        FragColor = texColour;
+    }
+
+*/
+static const uint8_t fs_source_glsl430[326] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,
+    0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x32,0x44,0x20,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x31,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x31,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x65,0x78,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x31,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x31,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x65,0x78,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x2e,
+    0x61,0x20,0x3c,0x20,0x30,0x2e,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x43,0x6f,0x6c,0x6f,0x75,0x72,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 fs_emissive_params[1];
+    layout(location = 0) in vec2 TexCoords;
+    layout(location = 0) out vec4 FragColor;
+
+    void main()
+    {
+        FragColor = fs_emissive_params[0];
+    }
+
+*/
+static const uint8_t fs_emissive_source_glsl430[189] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x65,0x6d,
+    0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x66,0x73,0x5f,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    out vec2 TexCoords;
+
+    void main()
+    {
+        TexCoords = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+        gl_Position = vec4(TexCoords * 2.0 - 1.0, 0.0, 1.0);
+    }
+
+*/
+static const uint8_t vs_post_source_glsl300es[176] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,
+    0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,
+    0x74,0x65,0x78,0x49,0x44,0x20,0x3c,0x3c,0x20,0x31,0x29,0x20,0x26,0x20,0x32,0x2c,
+    0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x26,0x20,0x32,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 post_params[6];
+    uniform highp sampler2D _source_source_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    void main()
+    {
+        highp vec3 colour = texture(_source_source_smp, TexCoords).rgb * post_params[5].x;
+        int pairs = int(post_params[5].y);
+        for (int i = 0; i < 8; i++)
+        {
+            if (i >= pairs)
+            {
+                break;
+            }
+            highp vec2 offset = post_params[0].xy * post_params[1 + (i / 4)][i % 4];
+            highp float weight = post_params[3 + (i / 4)][i % 4];
+            colour += texture(_source_source_smp, TexCoords + offset).rgb * weight;
+            colour += texture(_source_source_smp, TexCoords - offset).rgb * weight;
+        }
+        FragColor = vec4(colour, 1.0);
+    }
+
+*/
+static const uint8_t fs_gaussian_source_glsl300es[804] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x70,0x61,0x69,0x72,0x73,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,
+    0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x79,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,
+    0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x38,0x3b,0x20,0x69,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x20,0x3e,0x3d,0x20,0x70,0x61,0x69,0x72,0x73,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x31,0x20,0x2b,0x20,0x28,0x69,0x20,0x2f,0x20,0x34,0x29,0x5d,
+    0x5b,0x69,0x20,0x25,0x20,0x34,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x65,0x69,
+    0x67,0x68,0x74,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x33,0x20,0x2b,0x20,0x28,0x69,0x20,0x2f,0x20,0x34,0x29,0x5d,0x5b,0x69,
+    0x20,0x25,0x20,0x34,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,
+    0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x77,
+    0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2d,
+    0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x77,
+    0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 post_params[6];
+    uniform highp sampler2D _source_source_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    highp vec3 kawaseDown(highp vec2 uv)
+    {
+        highp vec2 halfpixel = post_params[0].xy * post_params[0].z;
+        highp vec3 sum = texture(_source_source_smp, uv).rgb * 4.0;
+        sum += texture(_source_source_smp, uv - halfpixel).rgb;
+        sum += texture(_source_source_smp, uv + halfpixel).rgb;
+        sum += texture(_source_source_smp, uv + vec2(halfpixel.x, -halfpixel.y)).rgb;
+        sum += texture(_source_source_smp, uv - vec2(halfpixel.x, -halfpixel.y)).rgb;
+        return sum / 8.0;
+    }
+
+    void main()
+    {
+        FragColor = vec4(kawaseDown(TexCoords), 1.0);
+    }
+
+*/
+static const uint8_t fs_kawase_down_source_glsl300es[760] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x6b,0x61,0x77,0x61,0x73,0x65,0x44,0x6f,0x77,0x6e,0x28,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x61,0x6c,
+    0x66,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x70,0x6f,0x73,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x75,
+    0x6d,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x75,0x76,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x34,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x70,
+    0x69,0x78,0x65,0x6c,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,
+    0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,
+    0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,
+    0x6c,0x2e,0x78,0x2c,0x20,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,
+    0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,
+    0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x75,0x76,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x68,0x61,0x6c,0x66,0x70,0x69,
+    0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,
+    0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x75,0x6d,0x20,0x2f,0x20,0x38,0x2e,0x30,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6b,0x61,0x77,0x61,0x73,0x65,0x44,0x6f,0x77,
+    0x6e,0x28,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 post_params[6];
+    uniform highp sampler2D _source_source_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    void main()
+    {
+        highp vec2 halfpixel = post_params[0].xy * 0.5 * post_params[0].z;
+        highp vec3 sum = texture(_source_source_smp, TexCoords + vec2(-halfpixel.x * 2.0, 0.0)).rgb;
+        sum += texture(_source_source_smp, TexCoords + vec2(-halfpixel.x, halfpixel.y)).rgb * 2.0;
+        sum += texture(_source_source_smp, TexCoords + vec2(0.0, halfpixel.y * 2.0)).rgb;
+        sum += texture(_source_source_smp, TexCoords + vec2(halfpixel.x, halfpixel.y)).rgb * 2.0;
+        sum += texture(_source_source_smp, TexCoords + vec2(halfpixel.x * 2.0, 0.0)).rgb;
+        sum += texture(_source_source_smp, TexCoords + vec2(halfpixel.x, -halfpixel.y)).rgb * 2.0;
+        sum += texture(_source_source_smp, TexCoords + vec2(0.0, -halfpixel.y * 2.0)).rgb;
+        sum += texture(_source_source_smp, TexCoords + vec2(-halfpixel.x, -halfpixel.y)).rgb * 2.0;
+        FragColor = vec4(sum / 12.0, 1.0);
+    }
+
+*/
+static const uint8_t fs_kawase_up_source_glsl300es[1079] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,
+    0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x79,0x20,0x2a,0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x75,0x6d,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,
+    0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x68,
+    0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x20,0x2a,0x20,0x32,0x2e,0x30,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,
+    0x78,0x2c,0x20,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x29,0x29,
+    0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x32,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,
+    0x65,0x6c,0x2e,0x79,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x29,0x2e,0x72,0x67,0x62,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x68,0x61,0x6c,0x66,0x70,0x69,
+    0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,
+    0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x32,0x2e,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,
+    0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,
+    0x6c,0x2e,0x78,0x20,0x2a,0x20,0x32,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,
+    0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,
+    0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x68,0x61,
+    0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,0x2d,0x68,0x61,0x6c,0x66,
+    0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,
+    0x32,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,
+    0x2c,0x20,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x20,0x2a,
+    0x20,0x32,0x2e,0x30,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x78,
+    0x2c,0x20,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,0x79,0x29,0x29,
+    0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x32,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x73,0x75,0x6d,0x20,0x2f,0x20,0x31,0x32,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 post_params[6];
+    uniform highp sampler2D _source_source_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    highp vec3 kawaseDown(highp vec2 uv)
+    {
+        highp vec2 halfpixel = post_params[0].xy * post_params[0].z;
+        highp vec3 sum = texture(_source_source_smp, uv).rgb * 4.0;
+        sum += texture(_source_source_smp, uv - halfpixel).rgb;
+        sum += texture(_source_source_smp, uv + halfpixel).rgb;
+        sum += texture(_source_source_smp, uv + vec2(halfpixel.x, -halfpixel.y)).rgb;
+        sum += texture(_source_source_smp, uv - vec2(halfpixel.x, -halfpixel.y)).rgb;
+        return sum / 8.0;
+    }
+
+    void main()
+    {
+        highp vec3 colour = kawaseDown(TexCoords);
+        highp float brightness = max(colour.r, max(colour.g, colour.b));
+        highp float threshold = post_params[5].x;
+        highp float knee = threshold * post_params[5].y + 1e-5;
+        highp float soft = clamp(brightness - threshold + knee, 0.0, 2.0 * knee);
+        soft = soft * soft / (4.0 * knee);
+        highp float contribution = max(soft, brightness - threshold) / max(brightness, 1e-5);
+        FragColor = vec4(colour * contribution, 1.0);
+    }
+
+*/
+static const uint8_t fs_bloom_prefilter_source_glsl300es[1189] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x6b,0x61,0x77,0x61,0x73,0x65,0x44,0x6f,0x77,0x6e,0x28,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x61,0x6c,
+    0x66,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x70,0x6f,0x73,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x75,
+    0x6d,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x75,0x76,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x34,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x70,
+    0x69,0x78,0x65,0x6c,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,
+    0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,
+    0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,
+    0x6c,0x2e,0x78,0x2c,0x20,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,0x6c,0x2e,
+    0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,
+    0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x75,0x76,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x68,0x61,0x6c,0x66,0x70,0x69,
+    0x78,0x65,0x6c,0x2e,0x78,0x2c,0x20,0x2d,0x68,0x61,0x6c,0x66,0x70,0x69,0x78,0x65,
+    0x6c,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x75,0x6d,0x20,0x2f,0x20,0x38,0x2e,0x30,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x6b,0x61,0x77,0x61,0x73,0x65,
+    0x44,0x6f,0x77,0x6e,0x28,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x20,0x3d,0x20,0x6d,0x61,
+    0x78,0x28,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x72,0x2c,0x20,0x6d,0x61,0x78,0x28,
+    0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x67,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,
+    0x2e,0x62,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x20,
+    0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,
+    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x6b,0x6e,0x65,0x65,0x20,0x3d,0x20,0x74,0x68,0x72,0x65,0x73,
+    0x68,0x6f,0x6c,0x64,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x79,0x20,0x2b,0x20,0x31,0x65,0x2d,0x35,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x73,0x6f,0x66,0x74,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x62,0x72,0x69,
+    0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x20,0x2d,0x20,0x74,0x68,0x72,0x65,0x73,0x68,
+    0x6f,0x6c,0x64,0x20,0x2b,0x20,0x6b,0x6e,0x65,0x65,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+    0x20,0x32,0x2e,0x30,0x20,0x2a,0x20,0x6b,0x6e,0x65,0x65,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x6f,0x66,0x74,0x20,0x3d,0x20,0x73,0x6f,0x66,0x74,0x20,0x2a,0x20,
+    0x73,0x6f,0x66,0x74,0x20,0x2f,0x20,0x28,0x34,0x2e,0x30,0x20,0x2a,0x20,0x6b,0x6e,
+    0x65,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x6e,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x73,0x6f,0x66,0x74,0x2c,0x20,0x62,0x72,
+    0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x20,0x2d,0x20,0x74,0x68,0x72,0x65,0x73,
+    0x68,0x6f,0x6c,0x64,0x29,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x62,0x72,0x69,0x67,
+    0x68,0x74,0x6e,0x65,0x73,0x73,0x2c,0x20,0x31,0x65,0x2d,0x35,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x2a,0x20,0x63,0x6f,0x6e,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 post_params[6];
+    uniform highp sampler2D _source_source_smp;
+    uniform highp sampler2D _bloom_source_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    void main()
+    {
+        highp vec3 colour = texture(_source_source_smp, TexCoords).rgb + texture(_bloom_source_smp, TexCoords).rgb * post_params[5].z;
+        if (post_params[5].w > 0.0)
+        {
+            colour = vec3(1.0) - exp(-colour * post_params[5].w);
+        }
+        FragColor = vec4(colour, 1.0);
+    }
+
+*/
+static const uint8_t fs_bloom_composite_source_glsl300es[548] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x62,0x6c,0x6f,0x6f,0x6d,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x63,
+    0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,
+    0x67,0x62,0x20,0x2b,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x62,0x6c,
+    0x6f,0x6f,0x6d,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,
+    0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x31,
+    0x2e,0x30,0x29,0x20,0x2d,0x20,0x65,0x78,0x70,0x28,0x2d,0x63,0x6f,0x6c,0x6f,0x75,
+    0x72,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x35,0x5d,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp sampler2D _source_source_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    void main()
+    {
+        FragColor = vec4(texture(_source_source_smp, TexCoords).rgb, 1.0);
+    }
+
+*/
+static const uint8_t fs_post_copy_source_glsl300es[269] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,0x67,
+    0x62,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 post_params[6];
+    uniform highp sampler2D _source_source_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    void main()
+    {
+        highp vec3 c = texture(_source_source_smp, TexCoords).rgb;
+        highp vec3 n = texture(_source_source_smp, TexCoords + vec2(0.0, post_params[0].y)).rgb;
+        highp vec3 s = texture(_source_source_smp, TexCoords - vec2(0.0, post_params[0].y)).rgb;
+        highp vec3 e = texture(_source_source_smp, TexCoords + vec2(post_params[0].x, 0.0)).rgb;
+        highp vec3 w = texture(_source_source_smp, TexCoords - vec2(post_params[0].x, 0.0)).rgb;
+        highp vec3 mn = clamp(min(c, min(min(n, s), min(e, w))), 0.0, 1.0);
+        highp vec3 mx = clamp(max(c, max(max(n, s), max(e, w))), 0.0, 1.0);
+        highp vec3 amount = sqrt(clamp(min(mn, 1.0 - mx) / max(mx, 1e-5), 0.0, 1.0));
+        highp vec3 weight = amount * -mix(0.125, 0.2, post_params[5].x);
+        highp vec3 colour = (c + (n + s + e + w) * weight) / (1.0 + 4.0 * weight);
+        FragColor = vec4(max(colour, 0.0), 1.0);
+    }
+
+*/
+static const uint8_t fs_upscale_source_glsl300es[1087] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,0x6e,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x2e,0x72,
+    0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x73,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x30,0x2e,0x30,0x2c,0x20,0x70,0x6f,0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x65,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,
+    0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x70,0x6f,
+    0x73,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x77,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x70,0x6f,0x73,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6d,0x6e,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x6d,0x69,0x6e,0x28,0x63,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x6d,0x69,0x6e,
+    0x28,0x6e,0x2c,0x20,0x73,0x29,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x65,0x2c,0x20,0x77,
+    0x29,0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x6d,
+    0x78,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6d,0x61,0x78,0x28,0x63,0x2c,
+    0x20,0x6d,0x61,0x78,0x28,0x6d,0x61,0x78,0x28,0x6e,0x2c,0x20,0x73,0x29,0x2c,0x20,
+    0x6d,0x61,0x78,0x28,0x65,0x2c,0x20,0x77,0x29,0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x6d,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,
+    0x73,0x71,0x72,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6d,0x69,0x6e,0x28,0x6d,
+    0x6e,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x6d,0x78,0x29,0x20,0x2f,0x20,0x6d,
+    0x61,0x78,0x28,0x6d,0x78,0x2c,0x20,0x31,0x65,0x2d,0x35,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x20,
+    0x3d,0x20,0x61,0x6d,0x6f,0x75,0x6e,0x74,0x20,0x2a,0x20,0x2d,0x6d,0x69,0x78,0x28,
+    0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x32,0x2c,0x20,0x70,0x6f,0x73,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x78,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,
+    0x6c,0x6f,0x75,0x72,0x20,0x3d,0x20,0x28,0x63,0x20,0x2b,0x20,0x28,0x6e,0x20,0x2b,
+    0x20,0x73,0x20,0x2b,0x20,0x65,0x20,0x2b,0x20,0x77,0x29,0x20,0x2a,0x20,0x77,0x65,
+    0x69,0x67,0x68,0x74,0x29,0x20,0x2f,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x34,
+    0x2e,0x30,0x20,0x2a,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x6d,0x61,0x78,0x28,0x63,0x6f,0x6c,0x6f,0x75,0x72,0x2c,0x20,0x30,
+    0x2e,0x30,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 vs_params[12];
+    layout(location = 0) in vec3 aPos;
+    layout(location = 1) in vec2 aTexCoords;
+    out vec2 TexCoords;
+
+    void main()
+    {
+        gl_Position = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]) * mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * vec4(aPos, 1.0);
+        TexCoords = aTexCoords;
+    }
+
+*/
+static const uint8_t vs_source_glsl300es[414] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x50,0x6f,0x73,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x54,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x3d,0x20,0x61,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp sampler2D _texture1_texture1_smp;
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    void main()
+    {
+        highp vec4 texColour = texture(_texture1_texture1_smp, TexCoords);
+        if (texColour.a < 0.1)
+        {
+            discard;
+        };
+        FragColor = texColour;
+    }
+
+*/
+static const uint8_t fs_source_glsl300es[357] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x31,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x31,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x69,
+    0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,
+    0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x74,0x65,0x78,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x31,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x31,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x74,0x65,0x78,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x2e,0x61,
+    0x20,0x3c,0x20,0x30,0x2e,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 fs_emissive_params[1];
+    in highp vec2 TexCoords;
+    layout(location = 0) out highp vec4 FragColor;
+
+    void main()
+    {
+        FragColor = fs_emissive_params[0];
+    }
+
+*/
+static const uint8_t fs_emissive_source_glsl300es[235] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x73,0x5f,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x66,0x73,0x5f,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* emissive_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_emissive_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_emissive_params";
+            desc.label = "emissive_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_emissive_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 16;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_emissive_params";
+            desc.label = "emissive_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* post_bloom_composite_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_bloom_composite_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_bloom_source_smp";
+            desc.label = "post_bloom_composite_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_bloom_composite_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_bloom_source_smp";
+            desc.label = "post_bloom_composite_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* post_bloom_prefilter_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_bloom_prefilter_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_bloom_prefilter_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_bloom_prefilter_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_bloom_prefilter_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* post_copy_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_post_copy_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_copy_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_post_copy_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_copy_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* post_gaussian_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_gaussian_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_gaussian_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_gaussian_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_gaussian_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* post_kawase_down_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_kawase_down_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_kawase_down_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_kawase_down_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_kawase_down_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* post_kawase_up_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_kawase_up_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_kawase_up_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_kawase_up_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_kawase_up_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* post_upscale_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_upscale_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_upscale_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_post_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_upscale_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 96;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_source_source_smp";
+            desc.label = "post_upscale_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* simple_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_texture1_texture1_smp";
+            desc.label = "simple_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "aPos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "aTexCoords";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_texture1_texture1_smp";
+            desc.label = "simple_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
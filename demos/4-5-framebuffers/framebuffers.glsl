@@ -100,19 +100,20 @@ layout(binding = 0) uniform texture2D _screenTexture;
 layout(binding = 0) uniform sampler screenTexture_smp;
 #define screenTexture sampler2D(_screenTexture, screenTexture_smp)
 
-const float offset = 1.0 / 300.0;
-
 void main() {
+    // one texel of the offscreen target, whatever size the window is
+    vec2 offset = 1.0 / vec2(textureSize(screenTexture, 0));
+
     vec2 offsets[9] = vec2[](
-        vec2(-offset,  offset), // top-left
-        vec2( 0.0f,    offset), // top-center
-        vec2( offset,  offset), // top-right
-        vec2(-offset,  0.0f),   // center-left
-        vec2( 0.0f,    0.0f),   // center-center
-        vec2( offset,  0.0f),   // center-right
-        vec2(-offset, -offset), // bottom-left
-        vec2( 0.0f,   -offset), // bottom-center
-        vec2( offset, -offset)  // bottom-right
+        vec2(-offset.x,  offset.y), // top-left
+        vec2( 0.0f,      offset.y), // top-center
+        vec2( offset.x,  offset.y), // top-right
+        vec2(-offset.x,  0.0f),     // center-left
+        vec2( 0.0f,      0.0f),     // center-center
+        vec2( offset.x,  0.0f),     // center-right
+        vec2(-offset.x, -offset.y), // bottom-left
+        vec2( 0.0f,     -offset.y), // bottom-center
+        vec2( offset.x, -offset.y)  // bottom-right
     );
 
     float kernel[9] = float[](
@@ -142,19 +143,20 @@ layout(binding = 0) uniform texture2D _screenTexture;
 layout(binding = 0) uniform sampler screenTexture_smp;
 #define screenTexture sampler2D(_screenTexture, screenTexture_smp)
 
-const float offset = 1.0 / 300.0;
-
 void main() {
+    // one texel of the offscreen target, whatever size the window is
+    vec2 offset = 1.0 / vec2(textureSize(screenTexture, 0));
+
     vec2 offsets[9] = vec2[](
-        vec2(-offset,  offset), // top-left
-        vec2( 0.0f,    offset), // top-center
-        vec2( offset,  offset), // top-right
-        vec2(-offset,  0.0f),   // center-left
-        vec2( 0.0f,    0.0f),   // center-center
-        vec2( offset,  0.0f),   // center-right
-        vec2(-offset, -offset), // bottom-left
-        vec2( 0.0f,   -offset), // bottom-center
-        vec2( offset, -offset)  // bottom-right
+        vec2(-offset.x,  offset.y), // top-left
+        vec2( 0.0f,      offset.y), // top-center
+        vec2( offset.x,  offset.y), // top-right
+        vec2(-offset.x,  0.0f),     // center-left
+        vec2( 0.0f,      0.0f),     // center-center
+        vec2( offset.x,  0.0f),     // center-right
+        vec2(-offset.x, -offset.y), // bottom-left
+        vec2( 0.0f,     -offset.y), // bottom-center
+        vec2( offset.x, -offset.y)  // bottom-right
     );
 
     float kernel[9] = float[](
@@ -184,19 +186,20 @@ layout(binding = 0) uniform texture2D _screenTexture;
 layout(binding = 0) uniform sampler screenTexture_smp;
 #define screenTexture sampler2D(_screenTexture, screenTexture_smp)
 
-const float offset = 1.0 / 300.0;
-
 void main() {
+    // one texel of the offscreen target, whatever size the window is
+    vec2 offset = 1.0 / vec2(textureSize(screenTexture, 0));
+
     vec2 offsets[9] = vec2[](
-        vec2(-offset,  offset), // top-left
-        vec2( 0.0f,    offset), // top-center
-        vec2( offset,  offset), // top-right
-        vec2(-offset,  0.0f),   // center-left
-        vec2( 0.0f,    0.0f),   // center-center
-        vec2( offset,  0.0f),   // center-right
-        vec2(-offset, -offset), // bottom-left
-        vec2( 0.0f,   -offset), // bottom-center
-        vec2( offset, -offset)  // bottom-right
+        vec2(-offset.x,  offset.y), // top-left
+        vec2( 0.0f,      offset.y), // top-center
+        vec2( offset.x,  offset.y), // top-right
+        vec2(-offset.x,  0.0f),     // center-left
+        vec2( 0.0f,      0.0f),     // center-center
+        vec2( offset.x,  0.0f),     // center-right
+        vec2(-offset.x, -offset.y), // bottom-left
+        vec2( 0.0f,     -offset.y), // bottom-center
+        vec2( offset.x, -offset.y)  // bottom-right
     );
 
     float kernel[9] = float[](
@@ -345,12 +345,10 @@ static const uint8_t fs_greyscale_framebuffer_source_glsl430[448] = {
     0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
     0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x34,0x35,0x2c,0x20,0x5f,0x34,0x35,0x2c,
     0x20,0x5f,0x34,0x35,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
-
 };
 /*
     #version 430
 
-    const vec2 _25[9] = vec2[](vec2(-0.0033333334140479564666748046875, 0.0033333334140479564666748046875), vec2(0.0, 0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875), vec2(-0.0033333334140479564666748046875, 0.0), vec2(0.0), vec2(0.0033333334140479564666748046875, 0.0), vec2(-0.0033333334140479564666748046875), vec2(0.0, -0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875, -0.0033333334140479564666748046875));
     const float _31[9] = float[](-1.0, -1.0, -1.0, -1.0, 9.0, -1.0, -1.0, -1.0, -1.0);
 
     layout(binding = 16) uniform sampler2D _screenTexture_screenTexture_smp;
@@ -360,6 +358,8 @@ static const uint8_t fs_greyscale_framebuffer_source_glsl430[448] = {
 
     void main()
     {
+        vec2 _20 = vec2(1.0) / vec2(textureSize(_screenTexture_screenTexture_smp, 0));
+        vec2 _25[9] = vec2[](vec2(-_20.x, _20.y), vec2(0.0, _20.y), _20, vec2(-_20.x, 0.0), vec2(0.0), vec2(_20.x, 0.0), -_20, vec2(0.0, -_20.y), vec2(_20.x, -_20.y));
         vec3 sampleTex[9];
         for (int i = 0; i < 9; i++)
         {
@@ -374,78 +374,64 @@ static const uint8_t fs_greyscale_framebuffer_source_glsl430[448] = {
     }
 
 */
-static const uint8_t fs_sharpen_framebuffer_source_glsl430[1049] = {
+static const uint8_t fs_sharpen_framebuffer_source_glsl430[834] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x63,0x6f,
-    0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,0x20,
-    0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,
-    0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,
-    0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,
-    0x2c,0x20,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,
-    0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,
-    0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,
-    0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,
-    0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,
-    0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,
-    0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,
-    0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,
-    0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,
-    0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,
-    0x36,0x38,0x37,0x35,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,
-    0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,
-    0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x2c,0x20,0x30,
-    0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,
-    0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,
-    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,
-    0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,
-    0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,
-    0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,
-    0x36,0x38,0x37,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,
-    0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,
-    0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,
-    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x5b,0x39,0x5d,0x20,0x3d,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,
-    0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,
-    0x20,0x39,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,
-    0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x0a,
-    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,
-    0x20,0x31,0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
-    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
-    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
-    0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,
-    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,
-    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
-    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x63,0x33,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x39,0x5d,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,
-    0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x2b,0x2b,0x29,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x76,0x65,
-    0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,
-    0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,
-    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,
-    0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x5f,0x32,0x35,0x5b,0x69,0x5d,0x29,
-    0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,
-    0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,
-    0x69,0x6e,0x74,0x20,0x69,0x5f,0x31,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x5f,0x31,
-    0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,
-    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x2b,
-    0x3d,0x20,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5f,0x31,
-    0x5d,0x20,0x2a,0x20,0x5f,0x33,0x31,0x5b,0x69,0x5f,0x31,0x5d,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
-    0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x2c,0x20,0x31,
-    0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x5b,0x39,0x5d,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x2d,0x31,0x2e,0x30,0x2c,
+    0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,
+    0x30,0x2c,0x20,0x39,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,
+    0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x20,0x3d,0x20,0x31,0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x30,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x31,0x2e,0x30,0x29,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x30,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,0x5f,0x32,
+    0x30,0x2e,0x78,0x2c,0x20,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x5f,
+    0x32,0x30,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x5f,0x32,0x30,0x2e,0x78,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x29,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,
+    0x2e,0x30,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2e,0x79,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x54,0x65,0x78,0x5b,0x39,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,
+    0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,
+    0x3c,0x20,0x39,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,
+    0x78,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,
+    0x2b,0x20,0x5f,0x32,0x35,0x5b,0x69,0x5d,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,
+    0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x5f,0x31,
+    0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x5f,0x31,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,
+    0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x2b,0x3d,0x20,0x28,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5f,0x31,0x5d,0x20,0x2a,0x20,0x5f,0x33,0x31,
+    0x5b,0x69,0x5f,0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x63,0x6f,0x6c,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
 };
 /*
     #version 430
 
-    const vec2 _25[9] = vec2[](vec2(-0.0033333334140479564666748046875, 0.0033333334140479564666748046875), vec2(0.0, 0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875), vec2(-0.0033333334140479564666748046875, 0.0), vec2(0.0), vec2(0.0033333334140479564666748046875, 0.0), vec2(-0.0033333334140479564666748046875), vec2(0.0, -0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875, -0.0033333334140479564666748046875));
     const float _32[9] = float[](0.0625, 0.125, 0.0625, 0.125, 0.25, 0.125, 0.0625, 0.125, 0.0625);
 
     layout(binding = 16) uniform sampler2D _screenTexture_screenTexture_smp;
@@ -455,6 +441,8 @@ static const uint8_t fs_sharpen_framebuffer_source_glsl430[1049] = {
 
     void main()
     {
+        vec2 _20 = vec2(1.0) / vec2(textureSize(_screenTexture_screenTexture_smp, 0));
+        vec2 _25[9] = vec2[](vec2(-_20.x, _20.y), vec2(0.0, _20.y), _20, vec2(-_20.x, 0.0), vec2(0.0), vec2(_20.x, 0.0), -_20, vec2(0.0, -_20.y), vec2(_20.x, -_20.y));
         vec3 sampleTex[9];
         for (int i = 0; i < 9; i++)
         {
@@ -469,79 +457,64 @@ static const uint8_t fs_sharpen_framebuffer_source_glsl430[1049] = {
     }
 
 */
-static const uint8_t fs_blur_framebuffer_source_glsl430[1062] = {
+static const uint8_t fs_blur_framebuffer_source_glsl430[847] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x63,0x6f,
-    0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,0x20,
-    0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,
-    0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,
-    0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,
-    0x2c,0x20,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,
-    0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,
-    0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,
-    0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,
-    0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,
-    0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,
-    0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,
-    0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,
-    0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,
-    0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,
-    0x36,0x38,0x37,0x35,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,
-    0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,
-    0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x2c,0x20,0x30,
-    0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,
-    0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,
-    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,
-    0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,
-    0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,
-    0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,
-    0x36,0x38,0x37,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,
-    0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,
-    0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,
-    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x32,0x5b,0x39,0x5d,0x20,0x3d,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x30,0x2e,0x30,0x36,0x32,0x35,0x2c,
-    0x20,0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x2c,0x20,
-    0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x32,0x35,0x2c,0x20,0x30,0x2e,0x31,
-    0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x2c,0x20,0x30,0x2e,0x31,0x32,
-    0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x29,0x3b,0x0a,0x0a,0x6c,0x61,0x79,
-    0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,
-    0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
-    0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,
-    0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,
-    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
-    0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,
-    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
-    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
-    0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x39,0x5d,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,
-    0x3b,0x20,0x69,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,0x70,
-    0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,
-    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,
-    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
-    0x72,0x64,0x73,0x20,0x2b,0x20,0x5f,0x32,0x35,0x5b,0x69,0x5d,0x29,0x2e,0x78,0x79,
-    0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x63,0x33,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,
-    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,
-    0x20,0x69,0x5f,0x31,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x5f,0x31,0x20,0x3c,0x20,
-    0x39,0x3b,0x20,0x69,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x2b,0x3d,0x20,0x28,
-    0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5f,0x31,0x5d,0x20,0x2a,
-    0x20,0x5f,0x33,0x32,0x5b,0x69,0x5f,0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
-    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x2c,0x20,0x31,0x2e,0x30,0x29,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x32,0x5b,0x39,0x5d,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x30,0x2e,0x30,0x36,0x32,
+    0x35,0x2c,0x20,0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,
+    0x2c,0x20,0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x32,0x35,0x2c,0x20,0x30,
+    0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x2c,0x20,0x30,0x2e,
+    0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x29,0x3b,0x0a,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+    0x31,0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x5f,0x32,0x30,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,
+    0x29,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x53,0x69,0x7a,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,0x5f,0x32,0x30,0x2e,0x78,
+    0x2c,0x20,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,
+    0x2e,0x30,0x2c,0x20,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x5f,0x32,0x30,0x2c,
+    0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,
+    0x20,0x2d,0x5f,0x32,0x30,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,
+    0x20,0x2d,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,
+    0x32,0x30,0x2e,0x78,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2e,0x79,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,
+    0x65,0x78,0x5b,0x39,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,
+    0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x39,
+    0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,
+    0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x5f,
+    0x32,0x35,0x5b,0x69,0x5d,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x5f,0x31,0x20,0x3d,0x20,
+    0x30,0x3b,0x20,0x69,0x5f,0x31,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x5f,0x31,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x63,0x6f,0x6c,0x20,0x2b,0x3d,0x20,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,
+    0x65,0x78,0x5b,0x69,0x5f,0x31,0x5d,0x20,0x2a,0x20,0x5f,0x33,0x32,0x5b,0x69,0x5f,
+    0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x63,0x6f,0x6c,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 430
 
-    const vec2 _25[9] = vec2[](vec2(-0.0033333334140479564666748046875, 0.0033333334140479564666748046875), vec2(0.0, 0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875), vec2(-0.0033333334140479564666748046875, 0.0), vec2(0.0), vec2(0.0033333334140479564666748046875, 0.0), vec2(-0.0033333334140479564666748046875), vec2(0.0, -0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875, -0.0033333334140479564666748046875));
     const float _31[9] = float[](1.0, 1.0, 1.0, 1.0, -8.0, 1.0, 1.0, 1.0, 1.0);
 
     layout(binding = 16) uniform sampler2D _screenTexture_screenTexture_smp;
@@ -551,6 +524,8 @@ static const uint8_t fs_blur_framebuffer_source_glsl430[1062] = {
 
     void main()
     {
+        vec2 _20 = vec2(1.0) / vec2(textureSize(_screenTexture_screenTexture_smp, 0));
+        vec2 _25[9] = vec2[](vec2(-_20.x, _20.y), vec2(0.0, _20.y), _20, vec2(-_20.x, 0.0), vec2(0.0), vec2(_20.x, 0.0), -_20, vec2(0.0, -_20.y), vec2(_20.x, -_20.y));
         vec3 sampleTex[9];
         for (int i = 0; i < 9; i++)
         {
@@ -565,73 +540,59 @@ static const uint8_t fs_blur_framebuffer_source_glsl430[1062] = {
     }
 
 */
-static const uint8_t fs_edge_framebuffer_source_glsl430[1042] = {
+static const uint8_t fs_edge_framebuffer_source_glsl430[827] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x63,0x6f,
-    0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,0x20,
-    0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,
-    0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,
-    0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,
-    0x2c,0x20,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,
-    0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,
-    0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,
-    0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,
-    0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,
-    0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,
-    0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,
-    0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,
-    0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,
-    0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,
-    0x36,0x38,0x37,0x35,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,
-    0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,
-    0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x2c,0x20,0x30,
-    0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,
-    0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,
-    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,
-    0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,
-    0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,
-    0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,
-    0x36,0x38,0x37,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,
-    0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,
-    0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,
-    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x5b,0x39,0x5d,0x20,0x3d,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,
-    0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x38,0x2e,
-    0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
-    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
-    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,0x75,0x6e,
-    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x5b,0x39,0x5d,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x31,0x2e,0x30,0x2c,0x20,
+    0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x2d,
+    0x38,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
     0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
-    0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,
-    0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
-    0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
-    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
-    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
-    0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x61,0x6d,0x70,
-    0x6c,0x65,0x54,0x65,0x78,0x5b,0x39,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,
-    0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,
-    0x3c,0x20,0x39,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,
-    0x78,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,
-    0x2b,0x20,0x5f,0x32,0x35,0x5b,0x69,0x5d,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,
-    0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x5f,0x31,
-    0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x5f,0x31,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,
-    0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x2b,0x3d,0x20,0x28,0x73,0x61,0x6d,0x70,
-    0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5f,0x31,0x5d,0x20,0x2a,0x20,0x5f,0x33,0x31,
-    0x5b,0x69,0x5f,0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,
-    0x63,0x34,0x28,0x63,0x6f,0x6c,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x00,
+    0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,
+    0x30,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x20,0x2f,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,
+    0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,
+    0x28,0x76,0x65,0x63,0x32,0x28,0x2d,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x5f,0x32,
+    0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,
+    0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x5f,0x32,0x30,0x2c,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x2d,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x2d,0x5f,0x32,
+    0x30,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x5f,0x32,
+    0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x32,0x30,0x2e,0x78,
+    0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x39,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,
+    0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5d,0x20,0x3d,0x20,
+    0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x63,
+    0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,
+    0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x5f,0x32,0x35,0x5b,0x69,
+    0x5d,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,
+    0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x5f,0x31,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,
+    0x5f,0x31,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
+    0x20,0x2b,0x3d,0x20,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,
+    0x5f,0x31,0x5d,0x20,0x2a,0x20,0x5f,0x33,0x31,0x5b,0x69,0x5f,0x31,0x5d,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 300 es
@@ -882,7 +843,6 @@ static const uint8_t fs_greyscale_framebuffer_source_glsl300es[477] = {
     precision mediump float;
     precision highp int;
 
-    const vec2 _25[9] = vec2[](vec2(-0.0033333334140479564666748046875, 0.0033333334140479564666748046875), vec2(0.0, 0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875), vec2(-0.0033333334140479564666748046875, 0.0), vec2(0.0), vec2(0.0033333334140479564666748046875, 0.0), vec2(-0.0033333334140479564666748046875), vec2(0.0, -0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875, -0.0033333334140479564666748046875));
     const float _31[9] = float[](-1.0, -1.0, -1.0, -1.0, 9.0, -1.0, -1.0, -1.0, -1.0);
 
     uniform highp sampler2D _screenTexture_screenTexture_smp;
@@ -892,6 +852,8 @@ static const uint8_t fs_greyscale_framebuffer_source_glsl300es[477] = {
 
     void main()
     {
+        highp vec2 _20 = vec2(1.0) / vec2(textureSize(_screenTexture_screenTexture_smp, 0));
+        highp vec2 _25[9] = vec2[](vec2(-_20.x, _20.y), vec2(0.0, _20.y), _20, vec2(-_20.x, 0.0), vec2(0.0), vec2(_20.x, 0.0), -_20, vec2(0.0, -_20.y), vec2(_20.x, -_20.y));
         highp vec3 sampleTex[9];
         for (int i = 0; i < 9; i++)
         {
@@ -906,82 +868,69 @@ static const uint8_t fs_greyscale_framebuffer_source_glsl300es[477] = {
     }
 
 */
-static const uint8_t fs_sharpen_framebuffer_source_glsl300es[1086] = {
+static const uint8_t fs_sharpen_framebuffer_source_glsl300es[883] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
     0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
     0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x63,
-    0x6f,0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,
-    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,
-    0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,
-    0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,
-    0x35,0x2c,0x20,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,
-    0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,
-    0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,
-    0x20,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,
-    0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,
-    0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,
-    0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,
-    0x63,0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,
-    0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,
-    0x34,0x36,0x38,0x37,0x35,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,
-    0x32,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,
-    0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,
-    0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x2c,0x20,
-    0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,
-    0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,
-    0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,
-    0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,
-    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,
-    0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,
-    0x34,0x36,0x38,0x37,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,
-    0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,
-    0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x63,0x6f,0x6e,
-    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x5b,0x39,0x5d,0x20,
-    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x2d,0x31,0x2e,0x30,0x2c,0x20,
-    0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,
-    0x2c,0x20,0x39,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,
-    0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x29,0x3b,0x0a,
-    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,
-    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,
-    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
-    0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
-    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,
-    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
-    0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
-    0x33,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x39,0x5d,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,
-    0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x61,
-    0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,
-    0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,
-    0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,
-    0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x5f,0x32,0x35,0x5b,0x69,0x5d,0x29,0x2e,
-    0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x20,0x3d,
-    0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x5f,0x31,0x20,0x3d,0x20,0x30,
-    0x3b,0x20,0x69,0x5f,0x31,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x5f,0x31,0x2b,0x2b,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x63,0x6f,0x6c,0x20,0x2b,0x3d,0x20,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,
-    0x78,0x5b,0x69,0x5f,0x31,0x5d,0x20,0x2a,0x20,0x5f,0x33,0x31,0x5b,0x69,0x5f,0x31,
-    0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,
-    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,
-    0x6f,0x6c,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x5b,0x39,
+    0x5d,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x2d,0x31,0x2e,0x30,
+    0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,
+    0x2e,0x30,0x2c,0x20,0x39,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,
+    0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x72,0x65,
+    0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x69,0x6e,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,
+    0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x5f,0x32,0x30,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x31,
+    0x2e,0x30,0x29,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x53,0x69,0x7a,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,
+    0x5b,0x39,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,
+    0x32,0x28,0x2d,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x5f,0x32,0x30,0x2e,0x79,0x29,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x5f,0x32,0x30,0x2e,
+    0x79,0x29,0x2c,0x20,0x5f,0x32,0x30,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x5f,
+    0x32,0x30,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x32,0x30,0x2e,
+    0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2c,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2e,0x79,0x29,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x2d,0x5f,
+    0x32,0x30,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,
+    0x5b,0x39,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,
+    0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x39,0x3b,0x20,
+    0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5d,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,
+    0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x5f,0x32,0x35,
+    0x5b,0x69,0x5d,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x5f,
+    0x31,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x5f,0x31,0x20,0x3c,0x20,0x39,0x3b,0x20,
+    0x69,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x2b,0x3d,0x20,0x28,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5f,0x31,0x5d,0x20,0x2a,0x20,0x5f,0x33,
+    0x31,0x5b,0x69,0x5f,0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
 };
 /*
     #version 300 es
     precision mediump float;
     precision highp int;
 
-    const vec2 _25[9] = vec2[](vec2(-0.0033333334140479564666748046875, 0.0033333334140479564666748046875), vec2(0.0, 0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875), vec2(-0.0033333334140479564666748046875, 0.0), vec2(0.0), vec2(0.0033333334140479564666748046875, 0.0), vec2(-0.0033333334140479564666748046875), vec2(0.0, -0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875, -0.0033333334140479564666748046875));
     const float _32[9] = float[](0.0625, 0.125, 0.0625, 0.125, 0.25, 0.125, 0.0625, 0.125, 0.0625);
 
     uniform highp sampler2D _screenTexture_screenTexture_smp;
@@ -991,6 +940,8 @@ static const uint8_t fs_sharpen_framebuffer_source_glsl300es[1086] = {
 
     void main()
     {
+        highp vec2 _20 = vec2(1.0) / vec2(textureSize(_screenTexture_screenTexture_smp, 0));
+        highp vec2 _25[9] = vec2[](vec2(-_20.x, _20.y), vec2(0.0, _20.y), _20, vec2(-_20.x, 0.0), vec2(0.0), vec2(_20.x, 0.0), -_20, vec2(0.0, -_20.y), vec2(_20.x, -_20.y));
         highp vec3 sampleTex[9];
         for (int i = 0; i < 9; i++)
         {
@@ -1005,83 +956,69 @@ static const uint8_t fs_sharpen_framebuffer_source_glsl300es[1086] = {
     }
 
 */
-static const uint8_t fs_blur_framebuffer_source_glsl300es[1099] = {
+static const uint8_t fs_blur_framebuffer_source_glsl300es[896] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
     0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
     0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x63,
-    0x6f,0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x32,0x5b,0x39,
+    0x5d,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x30,0x2e,0x30,0x36,
+    0x32,0x35,0x2c,0x20,0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,
+    0x35,0x2c,0x20,0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x32,0x35,0x2c,0x20,
+    0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x2c,0x20,0x30,
+    0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x29,0x3b,0x0a,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+    0x64,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x5f,0x32,0x30,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,
+    0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,
+    0x69,0x7a,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,
     0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,
-    0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,
-    0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,
-    0x35,0x2c,0x20,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,
-    0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,
-    0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,
-    0x20,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,
-    0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,
-    0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,
-    0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,
-    0x63,0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,
-    0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,
-    0x34,0x36,0x38,0x37,0x35,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,
-    0x32,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,
-    0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,
-    0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x2c,0x20,
-    0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,
-    0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,
-    0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,
-    0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,
-    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,
-    0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,
-    0x34,0x36,0x38,0x37,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,
-    0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,
-    0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x63,0x6f,0x6e,
-    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x32,0x5b,0x39,0x5d,0x20,
-    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x30,0x2e,0x30,0x36,0x32,0x35,
-    0x2c,0x20,0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x2c,
-    0x20,0x30,0x2e,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x32,0x35,0x2c,0x20,0x30,0x2e,
-    0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x2c,0x20,0x30,0x2e,0x31,
-    0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x29,0x3b,0x0a,0x0a,0x75,0x6e,
-    0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,
-    0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,
-    0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,
-    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,
-    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,
-    0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
-    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x39,0x5d,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,
-    0x20,0x69,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,
-    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x54,0x65,0x78,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-    0x64,0x73,0x20,0x2b,0x20,0x5f,0x32,0x35,0x5b,0x69,0x5d,0x29,0x2e,0x78,0x79,0x7a,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
-    0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,
-    0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,
-    0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x5f,0x31,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,
-    0x5f,0x31,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,
-    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
-    0x20,0x2b,0x3d,0x20,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,
-    0x5f,0x31,0x5d,0x20,0x2a,0x20,0x5f,0x33,0x32,0x5b,0x69,0x5f,0x31,0x5d,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,
-    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x2c,
-    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,
+    0x20,0x5f,0x32,0x30,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x5f,0x32,0x30,0x2e,
+    0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,
+    0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2c,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2e,
+    0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x39,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,
+    0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x2b,0x2b,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x63,0x72,
+    0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,0x20,0x5f,0x32,0x35,0x5b,0x69,0x5d,
+    0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x5f,0x31,0x20,0x3d,
+    0x20,0x30,0x3b,0x20,0x69,0x5f,0x31,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x5f,0x31,
+    0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x6f,0x6c,0x20,0x2b,0x3d,0x20,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x54,0x65,0x78,0x5b,0x69,0x5f,0x31,0x5d,0x20,0x2a,0x20,0x5f,0x33,0x32,0x5b,0x69,
+    0x5f,0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x63,0x6f,0x6c,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 300 es
     precision mediump float;
     precision highp int;
 
-    const vec2 _25[9] = vec2[](vec2(-0.0033333334140479564666748046875, 0.0033333334140479564666748046875), vec2(0.0, 0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875), vec2(-0.0033333334140479564666748046875, 0.0), vec2(0.0), vec2(0.0033333334140479564666748046875, 0.0), vec2(-0.0033333334140479564666748046875), vec2(0.0, -0.0033333334140479564666748046875), vec2(0.0033333334140479564666748046875, -0.0033333334140479564666748046875));
     const float _31[9] = float[](1.0, 1.0, 1.0, 1.0, -8.0, 1.0, 1.0, 1.0, 1.0);
 
     uniform highp sampler2D _screenTexture_screenTexture_smp;
@@ -1091,6 +1028,8 @@ static const uint8_t fs_blur_framebuffer_source_glsl300es[1099] = {
 
     void main()
     {
+        highp vec2 _20 = vec2(1.0) / vec2(textureSize(_screenTexture_screenTexture_smp, 0));
+        highp vec2 _25[9] = vec2[](vec2(-_20.x, _20.y), vec2(0.0, _20.y), _20, vec2(-_20.x, 0.0), vec2(0.0), vec2(_20.x, 0.0), -_20, vec2(0.0, -_20.y), vec2(_20.x, -_20.y));
         highp vec3 sampleTex[9];
         for (int i = 0; i < 9; i++)
         {
@@ -1105,75 +1044,62 @@ static const uint8_t fs_blur_framebuffer_source_glsl300es[1099] = {
     }
 
 */
-static const uint8_t fs_edge_framebuffer_source_glsl300es[1079] = {
+static const uint8_t fs_edge_framebuffer_source_glsl300es[876] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
     0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
     0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x63,
-    0x6f,0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,
-    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,
-    0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,
-    0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,
-    0x35,0x2c,0x20,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,
-    0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,
-    0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,
-    0x20,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,
-    0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,
-    0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,
-    0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,
-    0x63,0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,
-    0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,
-    0x34,0x36,0x38,0x37,0x35,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,
-    0x32,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,
-    0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,
-    0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x2c,0x20,
-    0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,0x30,0x30,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,
-    0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,
-    0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,
-    0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,
-    0x36,0x36,0x36,0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x76,
-    0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,
-    0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,0x37,0x34,0x38,0x30,
-    0x34,0x36,0x38,0x37,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x30,0x33,0x33,0x33,0x33,
-    0x33,0x33,0x33,0x34,0x31,0x34,0x30,0x34,0x37,0x39,0x35,0x36,0x34,0x36,0x36,0x36,
-    0x37,0x34,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x63,0x6f,0x6e,
-    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x5b,0x39,0x5d,0x20,
-    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x31,0x2e,0x30,0x2c,0x20,0x31,
-    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x2d,0x38,
-    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,
-    0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,
-    0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
-    0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x5b,0x39,
+    0x5d,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x5b,0x5d,0x28,0x31,0x2e,0x30,0x2c,
+    0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,
+    0x2d,0x38,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,
+    0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x30,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x20,0x2f,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,
     0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
-    0x6d,0x70,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
-    0x63,0x32,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x3b,0x0a,0x6c,0x61,
-    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
-    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
-    0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,
-    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x54,0x65,0x78,0x5b,0x39,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,
-    0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,
-    0x20,0x39,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,
-    0x5b,0x69,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x74,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
-    0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x73,0x20,0x2b,
-    0x20,0x5f,0x32,0x35,0x5b,0x69,0x5d,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
-    0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,
-    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,
-    0x74,0x20,0x69,0x5f,0x31,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x5f,0x31,0x20,0x3c,
-    0x20,0x39,0x3b,0x20,0x69,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x2b,0x3d,0x20,
-    0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5f,0x31,0x5d,0x20,
-    0x2a,0x20,0x5f,0x33,0x31,0x5b,0x69,0x5f,0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
-    0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x2c,0x20,0x31,0x2e,0x30,
-    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x35,0x5b,0x39,0x5d,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,0x5f,0x32,0x30,0x2e,
+    0x78,0x2c,0x20,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x30,0x2e,0x30,0x2c,0x20,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x5f,0x32,0x30,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x30,
+    0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,
+    0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,
+    0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x5f,0x32,0x30,0x2e,0x78,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x2e,0x79,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,0x39,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,
+    0x3b,0x20,0x69,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x54,0x65,0x78,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x54,0x65,0x78,0x43,0x6f,0x6f,
+    0x72,0x64,0x73,0x20,0x2b,0x20,0x5f,0x32,0x35,0x5b,0x69,0x5d,0x29,0x2e,0x78,0x79,
+    0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,
+    0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x5f,0x31,0x20,0x3d,0x20,0x30,0x3b,0x20,
+    0x69,0x5f,0x31,0x20,0x3c,0x20,0x39,0x3b,0x20,0x69,0x5f,0x31,0x2b,0x2b,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x20,0x2b,0x3d,0x20,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x54,0x65,0x78,0x5b,
+    0x69,0x5f,0x31,0x5d,0x20,0x2a,0x20,0x5f,0x33,0x31,0x5b,0x69,0x5f,0x31,0x5d,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 static inline const sg_shader_desc* blur_framebuffer_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
@@ -3,6 +3,7 @@
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 #include <sjd/camera.h>
+#include <sjd/normal_matrix.h>
 #include <vector>
 
 // incl before defining SOKOL_IMPL
@@ -280,6 +281,7 @@ void frame(void) {
 
     glm::mat4 model(1.0f);
     vs_params.model = model;
+    vs_params.normalMatrix = sjd::normalMatrix(model);
 
     fs_params_t fs_params {
         .cameraPos = state::camera.pos
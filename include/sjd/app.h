@@ -0,0 +1,222 @@
+#ifndef APP_H
+#define APP_H
+
+/* App
+ * The part every demo used to write for itself: sokol setup and shutdown,
+ * frame timing, locking the mouse, WASD/mouse/touch camera controls and
+ * Escape to quit. A demo implements a Scene and returns sjd::run() from
+ * sokol_main:
+ *
+ *   sapp_desc sokol_main(int argc, char* argv[]) {
+ *       static MyScene scene;
+ *       return sjd::run(scene, sjd::AppDesc {.title = "My Demo"});
+ *   }
+ *
+ * The sokol implementations live in lib/sjd_app.cpp, which is built once
+ * into a static library (lib/build.bat, lib/embuild.bat) and linked by
+ * every demo using App. So a demo built this way must not define
+ * SOKOL_IMPL or STB_IMAGE_IMPLEMENTATION itself. sokol_args is in there
+ * too, for demos taking command line or URL arguments.
+ *
+ * A frame goes: sfetch_dowork(), the frame begin hooks, the camera moves,
+ * Scene::update(), Scene::render() (which begins and ends its own passes),
+ * the frame end hooks, sg_commit(). Hooks are the place for profilers and
+ * benchmarks, they see every demo the same way. The FrameArena is reset
+ * after init() and after every sg_commit(), so scenes can keep scratch
+ * containers on it (sjd::FrameVector) for the rest of the frame.
+ *
+ * The frame, sfetch_dowork(), update, render and sg_commit() are Profiler
+ * markers. F9 starts the profiler and then writes AppDesc::tracePath, it's
+ * written on exit too if the profiler is running.
+ *
+ * Time comes from a FrameClock ticked at the top of the frame, so scenes
+ * should animate from App::time() and the deltaTime update() gets rather
+ * than stm_now(). Then clock() can pause, slow down, fix the step or
+ * replay a recording for every demo the same way.
+ */
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <sjd/camera.h>
+#include <sjd/frame_clock.h>
+#include <sokol/sokol_app.h>
+
+namespace sjd {
+class App;
+
+// what a demo implements, everything but render() is optional
+class Scene {
+public:
+    virtual ~Scene() = default;
+    // sokol is set up by the time this is called
+    virtual void init([[maybe_unused]] App& app) {}
+    virtual void update([[maybe_unused]] App& app, [[maybe_unused]] float deltaTime) {}
+    virtual void render(App& app) = 0;
+    // every event, after the camera controls have had it
+    virtual void onEvent([[maybe_unused]] App& app, [[maybe_unused]] const sapp_event& event) {}
+    // before sokol shuts down
+    virtual void cleanup([[maybe_unused]] App& app) {}
+};
+
+struct AppDesc {
+    const char* title {"LearnOpenGL"};
+    int width {800};
+    int height {600};
+    // sfetch requests in flight, textures load through sfetch
+    int fetchRequests {8};
+    // grab the mouse for mouse look
+    bool lockMouse {true};
+    // profile from the first frame rather than from F9
+    bool profile {false};
+    const char* tracePath {"trace.json"};
+    // seconds per frame rather than the real clock, 0 for the real clock
+    double fixedStep {0.0};
+    // FrameClock recordings, written or played back from the first frame
+    const char* recordPath {nullptr};
+    const char* replayPath {nullptr};
+};
+
+// keys to camera movements, plus mouse and touch look
+class InputMap {
+public:
+    InputMap() {
+        bindDefaults();
+    }
+
+    void bind(sapp_keycode key, Camera::Movement movement) {
+        m_bindings.emplace_back(key, movement);
+    }
+
+    void clear() {
+        m_bindings.clear();
+    }
+
+    // WASD to move, space and C for up and down
+    void bindDefaults();
+
+    // returns true when the event moved the camera
+    bool handle(const sapp_event& event, Camera& camera) const;
+
+private:
+    std::vector<std::pair<sapp_keycode, Camera::Movement>> m_bindings;
+};
+
+class App {
+public:
+    using FrameHook = std::function<void(App&)>;
+
+    // seconds since the last frame, as the clock sees it
+    float deltaTime() const {
+        return m_clock.deltaTime();
+    }
+
+    // animation time in seconds
+    double time() const {
+        return m_clock.time();
+    }
+
+    FrameClock& clock() {
+        return m_clock;
+    }
+
+    uint64_t frameCount() const {
+        return m_frameCount;
+    }
+
+    // the camera the input map drives, nullptr for none
+    void useCamera(Camera* camera) {
+        m_camera = camera;
+    }
+
+    Camera* camera() const {
+        return m_camera;
+    }
+
+    InputMap& input() {
+        return m_input;
+    }
+
+    const AppDesc& desc() const {
+        return m_desc;
+    }
+
+    void onFrameBegin(FrameHook hook) {
+        m_frameBegin.push_back(std::move(hook));
+    }
+
+    void onFrameEnd(FrameHook hook) {
+        m_frameEnd.push_back(std::move(hook));
+    }
+
+    void quit();
+
+    // the sokol callbacks, called through sapp_desc::user_data
+    void init();
+    void frame();
+    void event(const sapp_event& event);
+    void cleanup();
+
+private:
+    friend sapp_desc run(Scene& scene, const AppDesc& desc);
+
+    Scene* m_scene {nullptr};
+    Camera* m_camera {nullptr};
+    AppDesc m_desc {};
+    InputMap m_input {};
+    std::vector<FrameHook> m_frameBegin;
+    std::vector<FrameHook> m_frameEnd;
+    FrameClock m_clock {};
+    uint64_t m_frameCount {};
+};
+
+// the sapp_desc for sokol_main, scene has to outlive the app
+sapp_desc run(Scene& scene, const AppDesc& desc = AppDesc {});
+
+inline void InputMap::bindDefaults() {
+    bind(SAPP_KEYCODE_W, Camera::FORWARD);
+    bind(SAPP_KEYCODE_S, Camera::BACKWARD);
+    bind(SAPP_KEYCODE_A, Camera::LEFT);
+    bind(SAPP_KEYCODE_D, Camera::RIGHT);
+    bind(SAPP_KEYCODE_SPACE, Camera::UP);
+    bind(SAPP_KEYCODE_C, Camera::DOWN);
+}
+
+inline bool InputMap::handle(const sapp_event& event, Camera& camera) const {
+    switch (event.type) {
+    case SAPP_EVENTTYPE_KEY_DOWN:
+    case SAPP_EVENTTYPE_KEY_UP: {
+        bool used {false};
+        Camera::Key action {event.type == SAPP_EVENTTYPE_KEY_DOWN ? Camera::PRESS : Camera::RELEASE};
+        for (const auto& [key, movement] : m_bindings) {
+            if (key == event.key_code) {
+                camera.processKeyboard(movement, action);
+                used = true;
+            }
+        }
+        return used;
+    }
+    case SAPP_EVENTTYPE_TOUCHES_BEGAN:
+        camera.lastX = event.touches[0].pos_x;
+        camera.lastY = event.touches[0].pos_y;
+        return true;
+    case SAPP_EVENTTYPE_TOUCHES_MOVED: {
+        float offsetX {event.touches[0].pos_x - camera.lastX};
+        float offsetY {camera.lastY - event.touches[0].pos_y};
+        camera.lastX = event.touches[0].pos_x;
+        camera.lastY = event.touches[0].pos_y;
+        camera.processMouseMovement(offsetX, offsetY);
+        return true;
+    }
+    case SAPP_EVENTTYPE_MOUSE_MOVE:
+        camera.processMouseMovement(event.mouse_dx, -event.mouse_dy);
+        return true;
+    case SAPP_EVENTTYPE_MOUSE_SCROLL:
+        camera.processMouseScroll(event.scroll_y);
+        return true;
+    default:
+        return false;
+    }
+}
+}
+#endif
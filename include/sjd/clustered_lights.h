@@ -0,0 +1,489 @@
+#ifndef CLUSTERED_LIGHTS_H
+#define CLUSTERED_LIGHTS_H
+
+/* Clustered forward lighting
+ * The view frustum is cut into TILES_X * TILES_Y screen tiles and SLICES
+ * exponentially spaced depth slices ("froxels"). Every frame the lights are
+ * moved into view space and tested against the bounding box of each cluster,
+ * and the fragment shader only loops over the lights listed for its cluster.
+ *
+ * Everything the shader needs goes into float data textures read with
+ * texelFetch, which WebGL2 can sample without any extensions:
+ *   lights:   RGBA32F, 4 texels per light (one light per row)
+ *               0: position.xyz, range
+ *               1: colour.rgb, unused
+ *               2: direction.xyz, cos(cutOff)
+ *               3: cos(outerCutOff), unused
+ *   clusters: RG32F, TILES_X * TILES_Y wide, SLICES high: offset, count
+ *   indices:  R32F, light indices for all clusters back to back
+ * Point lights get cutOff -1 and outerCutOff -2 so the spot cone factor
+ * is always 1 and the shader doesn't have to branch on the light type.
+ *
+ * Binning works one depth slice at a time and the slices only share the
+ * index pool, which a cluster claims its room in with one atomic add, so
+ * bin() hands them out to the JobSystem workers. Lights are kept as SoA
+ * and four of them are tested against a cluster at once.
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <sjd/jobs.h>
+#include <sjd/profiler.h>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+// emscripten maps these onto wasm simd128 when built with -msse -msimd128
+#include <xmmintrin.h>
+#define SJD_CLUSTERED_LIGHTS_SSE
+#endif
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+namespace sjd {
+
+struct ClusterLight {
+    glm::vec3 position;
+    // the light fades out to nothing at this distance
+    float range;
+    glm::vec3 colour;
+    // spot lights only, cosines like the LearnOpenGL spot light
+    glm::vec3 direction {0.0f, 0.0f, -1.0f};
+    float cutOff {-1.0f};
+    float outerCutOff {-2.0f};
+};
+
+class ClusteredLights {
+public:
+    static constexpr int TILES_X {16};
+    static constexpr int TILES_Y {9};
+    static constexpr int SLICES {24};
+    static constexpr int TILES {TILES_X * TILES_Y};
+    static constexpr int CLUSTERS {TILES * SLICES};
+    static constexpr int MAX_LIGHTS {1024};
+    static constexpr int INDEX_TEXTURE_WIDTH {1024};
+    static constexpr int INDEX_TEXTURE_HEIGHT {64};
+    static constexpr int MAX_INDICES {INDEX_TEXTURE_WIDTH * INDEX_TEXTURE_HEIGHT};
+
+    sg_image lightImage {};
+    sg_image clusterImage {};
+    sg_image indexImage {};
+    sg_sampler sampler {};
+
+    // creates the data textures, call after sg_setup()
+    void setup();
+    void shutdown();
+
+    // rebuilds the cluster bounds, cheap to call every frame as nothing
+    // happens unless one of the values changed
+    void setProjection(float fovy, float aspect, float zNear, float zFar);
+
+    // bins the lights for this frame's view matrix. Lights past MAX_LIGHTS
+    // are ignored. threadCount > 1 splits the slices over that many of the
+    // JobSystem's threads.
+    void bin(const glm::mat4& view,
+             const std::vector<ClusterLight>& lights,
+             unsigned threadCount = 1);
+
+    // prepares the lights for binning, then binSlices() can run on any
+    // number of threads as long as every slice is covered exactly once,
+    // then pack() builds the texture data. bin() does all three.
+    void prepare(const glm::mat4& view, const std::vector<ClusterLight>& lights);
+    void binSlices(int firstSlice, int lastSlice);
+    void pack();
+
+    // once per frame, after binning
+    void upload();
+
+    void applyBindings(sg_bindings& bindings,
+                       int lightSlot,
+                       int clusterSlot,
+                       int indexSlot,
+                       int samplerSlot) const;
+
+    // for the shader: slice = int(log(viewDepth) * sliceScale() - sliceBias())
+    float sliceScale() const {
+        return m_sliceScale;
+    }
+    float sliceBias() const {
+        return m_sliceBias;
+    }
+
+    int lightCount() const {
+        return m_lightCount;
+    }
+    // number of light indices written last frame, >= MAX_INDICES means some
+    // clusters lost lights
+    uint32_t indexCount() const {
+        return m_indexCount;
+    }
+
+private:
+    struct Bounds {
+        glm::vec3 min;
+        glm::vec3 max;
+    };
+
+    struct SliceBin {
+        // per cluster in this slice: offset into the index pool and count
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> counts;
+        // lights found that didn't fit in the pool
+        uint32_t dropped {};
+        // SoA copy of the lights that overlap the slice in depth
+        std::vector<float> x, y, z, radiusSq;
+        std::vector<uint16_t> lightIndex;
+    };
+
+    void binSlice(int slice);
+    void writeLight(int index, const ClusterLight& light);
+
+    float m_fovy {};
+    float m_aspect {};
+    float m_near {};
+    float m_far {};
+    float m_sliceScale {};
+    float m_sliceBias {};
+
+    // view space with +z pointing into the screen
+    std::vector<Bounds> m_bounds;
+    std::vector<float> m_sliceNear;
+    std::vector<float> m_sliceFar;
+
+    // view space lights, SoA
+    std::vector<float> m_x, m_y, m_z, m_radius;
+    int m_lightCount {};
+
+    std::vector<SliceBin> m_slices;
+    // every cluster's light indices, in the order the clusters were binned
+    std::vector<uint16_t> m_indexPool;
+    std::atomic<uint32_t> m_indexPoolUsed {0};
+    std::vector<float> m_lightData;
+    std::vector<float> m_clusterData;
+    std::vector<float> m_indexData;
+    uint32_t m_indexCount {};
+    bool m_overflowReported {false};
+};
+
+inline void ClusteredLights::setup() {
+    lightImage = sg_make_image(sg_image_desc {
+        .width = 4,
+        .height = MAX_LIGHTS,
+        .usage = SG_USAGE_STREAM,
+        .pixel_format = SG_PIXELFORMAT_RGBA32F,
+        .label = "cluster-lights"
+    });
+
+    clusterImage = sg_make_image(sg_image_desc {
+        .width = TILES,
+        .height = SLICES,
+        .usage = SG_USAGE_STREAM,
+        .pixel_format = SG_PIXELFORMAT_RG32F,
+        .label = "cluster-grid"
+    });
+
+    indexImage = sg_make_image(sg_image_desc {
+        .width = INDEX_TEXTURE_WIDTH,
+        .height = INDEX_TEXTURE_HEIGHT,
+        .usage = SG_USAGE_STREAM,
+        .pixel_format = SG_PIXELFORMAT_R32F,
+        .label = "cluster-indices"
+    });
+
+    // 32-bit float textures can't be filtered on WebGL2
+    sampler = sg_make_sampler(sg_sampler_desc {
+        .min_filter = SG_FILTER_NEAREST,
+        .mag_filter = SG_FILTER_NEAREST,
+        .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+        .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+        .label = "cluster-sampler"
+    });
+
+    m_lightData.assign(4 * 4 * MAX_LIGHTS, 0.0f);
+    m_clusterData.assign(2 * CLUSTERS, 0.0f);
+    m_indexData.assign(MAX_INDICES, 0.0f);
+    m_indexPool.assign(MAX_INDICES, 0);
+    m_slices.resize(SLICES);
+}
+
+inline void ClusteredLights::shutdown() {
+    sg_destroy_image(lightImage);
+    sg_destroy_image(clusterImage);
+    sg_destroy_image(indexImage);
+    sg_destroy_sampler(sampler);
+}
+
+inline void ClusteredLights::setProjection(float fovy, float aspect, float zNear, float zFar) {
+    if (fovy == m_fovy && aspect == m_aspect && zNear == m_near && zFar == m_far)
+        return;
+    m_fovy = fovy;
+    m_aspect = aspect;
+    m_near = zNear;
+    m_far = zFar;
+
+    float logRatio {std::log(zFar / zNear)};
+    m_sliceScale = SLICES / logRatio;
+    m_sliceBias = SLICES * std::log(zNear) / logRatio;
+
+    m_sliceNear.resize(SLICES);
+    m_sliceFar.resize(SLICES);
+    for (int k = 0; k < SLICES; ++k) {
+        m_sliceNear[k] = zNear * std::pow(zFar / zNear, static_cast<float>(k) / SLICES);
+        m_sliceFar[k] = zNear * std::pow(zFar / zNear, static_cast<float>(k + 1) / SLICES);
+    }
+
+    // a point at depth d with NDC x, y sits at (x * d * tan * aspect, y * d * tan)
+    // so the box of a tile spans its corners on the near and far plane
+    float tanY {std::tan(fovy * 0.5f)};
+    float tanX {tanY * aspect};
+    m_bounds.resize(CLUSTERS);
+    for (int k = 0; k < SLICES; ++k) {
+        for (int ty = 0; ty < TILES_Y; ++ty) {
+            for (int tx = 0; tx < TILES_X; ++tx) {
+                float x0 {-1.0f + 2.0f * tx / TILES_X};
+                float x1 {-1.0f + 2.0f * (tx + 1) / TILES_X};
+                float y0 {-1.0f + 2.0f * ty / TILES_Y};
+                float y1 {-1.0f + 2.0f * (ty + 1) / TILES_Y};
+
+                Bounds bounds {glm::vec3(INFINITY), glm::vec3(-INFINITY)};
+                for (float d : {m_sliceNear[k], m_sliceFar[k]}) {
+                    for (float nx : {x0, x1}) {
+                        for (float ny : {y0, y1}) {
+                            glm::vec3 corner {nx * d * tanX, ny * d * tanY, d};
+                            bounds.min = glm::min(bounds.min, corner);
+                            bounds.max = glm::max(bounds.max, corner);
+                        }
+                    }
+                }
+                m_bounds[(k * TILES_Y + ty) * TILES_X + tx] = bounds;
+            }
+        }
+    }
+}
+
+inline void ClusteredLights::bin(const glm::mat4& view,
+                                 const std::vector<ClusterLight>& lights,
+                                 unsigned threadCount) {
+    prepare(view, lights);
+    threadCount = std::clamp(threadCount, 1u, static_cast<unsigned>(SLICES));
+    // a grain of SLICES / threadCount keeps it to threadCount pieces
+    int grain {(SLICES + static_cast<int>(threadCount) - 1) / static_cast<int>(threadCount)};
+    JobSystem::instance().parallelFor(0, SLICES, grain, [this](int first, int last) {
+        binSlices(first, last);
+    });
+    pack();
+}
+
+inline void ClusteredLights::prepare(const glm::mat4& view,
+                                     const std::vector<ClusterLight>& lights) {
+    m_lightCount = std::min(static_cast<int>(lights.size()), MAX_LIGHTS);
+    m_x.resize(m_lightCount);
+    m_y.resize(m_lightCount);
+    m_z.resize(m_lightCount);
+    m_radius.resize(m_lightCount);
+    m_indexPoolUsed.store(0, std::memory_order_relaxed);
+
+    for (int i = 0; i < m_lightCount; ++i) {
+        const ClusterLight& light {lights[i]};
+        glm::vec4 p {view * glm::vec4(light.position, 1.0f)};
+        m_x[i] = p.x;
+        m_y[i] = p.y;
+        m_z[i] = -p.z;
+        m_radius[i] = light.range;
+        writeLight(i, light);
+    }
+}
+
+inline void ClusteredLights::binSlices(int firstSlice, int lastSlice) {
+    SJD_PROFILE_SCOPE("bin-slices");
+    for (int k = firstSlice; k < lastSlice; ++k) {
+        binSlice(k);
+    }
+}
+
+inline void ClusteredLights::binSlice(int slice) {
+    SliceBin& bin {m_slices[slice]};
+    bin.x.clear();
+    bin.y.clear();
+    bin.z.clear();
+    bin.radiusSq.clear();
+    bin.lightIndex.clear();
+    bin.offsets.assign(TILES, 0);
+    bin.counts.assign(TILES, 0);
+    bin.dropped = 0;
+    // room for every light, so a slice picking up more lights than it ever
+    // has before doesn't mean an allocation in the middle of a frame. It
+    // only allocates when the light count goes up.
+    size_t padded {(static_cast<size_t>(m_lightCount) + 3) & ~static_cast<size_t>(3)};
+    bin.x.reserve(padded);
+    bin.y.reserve(padded);
+    bin.z.reserve(padded);
+    bin.radiusSq.reserve(padded);
+    bin.lightIndex.reserve(padded);
+
+    // cheap depth-only test first, most lights miss most slices
+    float sliceNear {m_sliceNear[slice]};
+    float sliceFar {m_sliceFar[slice]};
+    for (int i = 0; i < m_lightCount; ++i) {
+        if (m_z[i] + m_radius[i] < sliceNear || m_z[i] - m_radius[i] > sliceFar)
+            continue;
+        bin.x.push_back(m_x[i]);
+        bin.y.push_back(m_y[i]);
+        bin.z.push_back(m_z[i]);
+        bin.radiusSq.push_back(m_radius[i] * m_radius[i]);
+        bin.lightIndex.push_back(static_cast<uint16_t>(i));
+    }
+    size_t candidates {bin.x.size()};
+    if (candidates == 0)
+        return;
+    // pad to a multiple of four with lights that can't touch anything
+    while (bin.x.size() % 4 != 0) {
+        bin.x.push_back(0.0f);
+        bin.y.push_back(0.0f);
+        bin.z.push_back(0.0f);
+        bin.radiusSq.push_back(-1.0f);
+        bin.lightIndex.push_back(0);
+    }
+
+    // one cluster's lights, at most every light once
+    std::array<uint16_t, MAX_LIGHTS> found {};
+    for (int tile = 0; tile < TILES; ++tile) {
+        const Bounds& bounds {m_bounds[slice * TILES + tile]};
+        uint32_t count {0};
+
+#ifdef SJD_CLUSTERED_LIGHTS_SSE
+        __m128 zero {_mm_setzero_ps()};
+        __m128 minX {_mm_set1_ps(bounds.min.x)}, maxX {_mm_set1_ps(bounds.max.x)};
+        __m128 minY {_mm_set1_ps(bounds.min.y)}, maxY {_mm_set1_ps(bounds.max.y)};
+        __m128 minZ {_mm_set1_ps(bounds.min.z)}, maxZ {_mm_set1_ps(bounds.max.z)};
+        for (size_t i = 0; i < bin.x.size(); i += 4) {
+            // distance from the sphere centre to the box along each axis
+            __m128 px {_mm_loadu_ps(&bin.x[i])};
+            __m128 py {_mm_loadu_ps(&bin.y[i])};
+            __m128 pz {_mm_loadu_ps(&bin.z[i])};
+            __m128 dx {_mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minX, px), _mm_sub_ps(px, maxX)))};
+            __m128 dy {_mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minY, py), _mm_sub_ps(py, maxY)))};
+            __m128 dz {_mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minZ, pz), _mm_sub_ps(pz, maxZ)))};
+            __m128 distSq {_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                                      _mm_mul_ps(dz, dz))};
+            int hits {_mm_movemask_ps(_mm_cmple_ps(distSq, _mm_loadu_ps(&bin.radiusSq[i])))};
+            while (hits) {
+                int lane {0};
+                while (!(hits & (1 << lane)))
+                    ++lane;
+                hits &= ~(1 << lane);
+                found[count++] = bin.lightIndex[i + lane];
+            }
+        }
+#else
+        for (size_t i = 0; i < candidates; ++i) {
+            float dx {std::max({0.0f, bounds.min.x - bin.x[i], bin.x[i] - bounds.max.x})};
+            float dy {std::max({0.0f, bounds.min.y - bin.y[i], bin.y[i] - bounds.max.y})};
+            float dz {std::max({0.0f, bounds.min.z - bin.z[i], bin.z[i] - bounds.max.z})};
+            if (dx * dx + dy * dy + dz * dz <= bin.radiusSq[i])
+                found[count++] = bin.lightIndex[i];
+        }
+#endif
+        if (count == 0)
+            continue;
+        // clusters that don't fit lose their lights rather than reading
+        // someone else's
+        uint32_t offset {m_indexPoolUsed.fetch_add(count, std::memory_order_relaxed)};
+        uint32_t space {static_cast<uint32_t>(MAX_INDICES) - std::min(offset, static_cast<uint32_t>(MAX_INDICES))};
+        uint32_t stored {std::min(count, space)};
+        std::copy_n(found.begin(), stored, m_indexPool.begin() + std::min(offset, static_cast<uint32_t>(MAX_INDICES)));
+        bin.offsets[tile] = offset;
+        bin.counts[tile] = stored;
+        bin.dropped += count - stored;
+    }
+}
+
+inline void ClusteredLights::pack() {
+    // back to slice order, so the texture is the same whichever threads
+    // binned the slices
+    uint32_t offset {0};
+    for (int k = 0; k < SLICES; ++k) {
+        const SliceBin& bin {m_slices[k]};
+        for (int tile = 0; tile < TILES; ++tile) {
+            uint32_t count {bin.counts.empty() ? 0 : bin.counts[tile]};
+            for (uint32_t i = 0; i < count; ++i) {
+                m_indexData[offset + i] = static_cast<float>(m_indexPool[bin.offsets[tile] + i]);
+            }
+            float* cluster {&m_clusterData[2 * (k * TILES + tile)]};
+            cluster[0] = static_cast<float>(offset);
+            cluster[1] = static_cast<float>(count);
+            offset += count;
+        }
+        if (bin.dropped > 0 && !m_overflowReported) {
+            std::cout << "WARNING::CLUSTERED_LIGHTS::INDEX_OVERFLOW: some lights were dropped\n";
+            m_overflowReported = true;
+        }
+    }
+    m_indexCount = offset;
+}
+
+inline void ClusteredLights::writeLight(int index, const ClusterLight& light) {
+    float* texel {&m_lightData[16 * index]};
+    texel[0] = light.position.x;
+    texel[1] = light.position.y;
+    texel[2] = light.position.z;
+    texel[3] = light.range;
+    texel[4] = light.colour.x;
+    texel[5] = light.colour.y;
+    texel[6] = light.colour.z;
+    texel[7] = 0.0f;
+    texel[8] = light.direction.x;
+    texel[9] = light.direction.y;
+    texel[10] = light.direction.z;
+    texel[11] = light.cutOff;
+    texel[12] = light.outerCutOff;
+    texel[13] = 0.0f;
+    texel[14] = 0.0f;
+    texel[15] = 0.0f;
+}
+
+inline void ClusteredLights::upload() {
+    // only the rows with lights in them are looked at, but a stream image
+    // has to be updated in one go
+    sg_image_data lights {};
+    lights.subimage[0][0] = sg_range {
+        .ptr = m_lightData.data(),
+        .size = m_lightData.size() * sizeof(float),
+    };
+    sg_update_image(lightImage, lights);
+
+    sg_image_data clusters {};
+    clusters.subimage[0][0] = sg_range {
+        .ptr = m_clusterData.data(),
+        .size = m_clusterData.size() * sizeof(float),
+    };
+    sg_update_image(clusterImage, clusters);
+
+    sg_image_data indices {};
+    indices.subimage[0][0] = sg_range {
+        .ptr = m_indexData.data(),
+        .size = m_indexData.size() * sizeof(float),
+    };
+    sg_update_image(indexImage, indices);
+}
+
+inline void ClusteredLights::applyBindings(sg_bindings& bindings,
+                                           int lightSlot,
+                                           int clusterSlot,
+                                           int indexSlot,
+                                           int samplerSlot) const {
+    bindings.images[lightSlot] = lightImage;
+    bindings.images[clusterSlot] = clusterImage;
+    bindings.images[indexSlot] = indexImage;
+    bindings.samplers[samplerSlot] = sampler;
+}
+
+}
+#endif
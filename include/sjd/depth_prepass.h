@@ -0,0 +1,126 @@
+#ifndef DEPTH_PREPASS_H
+#define DEPTH_PREPASS_H
+
+/* DepthPrepass
+ * An optional depth only pass in front of the shading pass. The opaque
+ * geometry is drawn first from a position only vertex buffer with colour
+ * writes off, then the shading pass tests with SG_COMPAREFUNC_EQUAL and
+ * doesn't write depth, so the expensive fragment shader runs once per pixel
+ * rather than once for every fragment that later gets drawn over.
+ *
+ * It costs a second trip through the vertex shader and the extra draws, so
+ * it only pays off with heavy fragment shaders and a lot of overdraw.
+ * record() keeps the average frame time with the pre-pass on and off so
+ * the two can be compared, report() prints them.
+ *
+ * Both passes have to come up with exactly the same depth or EQUAL fails on
+ * random pixels: put the position maths in an @block both vertex shaders
+ * include and declare gl_Position invariant, see
+ * demos/2-6-multiple-lights/2-clustered-lights.glsl.
+ */
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+
+namespace sjd {
+class DepthPrepass {
+public:
+    struct Stats {
+        uint32_t framesOn {};
+        uint32_t framesOff {};
+        double secondsOn {};
+        double secondsOff {};
+        uint64_t draws {};
+    };
+
+    bool enabled {true};
+
+    // pulls the positions (3 floats at offset) out of interleaved vertices
+    // stride floats apart, for the pre-pass vertex buffer
+    static std::vector<float> positions(const std::vector<float>& vertices, int stride, int offset = 0);
+
+    // the pre-pass pipeline from a desc with the shader, layout, formats and
+    // cull mode filled in: depth test and writes on, colour writes off
+    static sg_pipeline_desc depthPipeline(sg_pipeline_desc desc);
+
+    // the shading pipeline to use after the pre-pass: EQUAL, no depth writes
+    static sg_pipeline_desc equalPipeline(sg_pipeline_desc desc);
+
+    // call for every draw in the pre-pass
+    void countDraw() {
+        ++m_stats.draws;
+    }
+
+    // call once a frame with the frame time, it's filed under the mode the
+    // frame was drawn with
+    void record(double frameTime);
+
+    const Stats& stats() const {
+        return m_stats;
+    }
+
+    void report() const;
+
+private:
+    Stats m_stats {};
+};
+
+inline std::vector<float> DepthPrepass::positions(const std::vector<float>& vertices, int stride, int offset) {
+    std::vector<float> result;
+    result.reserve(vertices.size() / stride * 3);
+    for (size_t i = offset; i + 3 <= vertices.size(); i += stride) {
+        result.push_back(vertices[i]);
+        result.push_back(vertices[i + 1]);
+        result.push_back(vertices[i + 2]);
+    }
+    return result;
+}
+
+inline sg_pipeline_desc DepthPrepass::depthPipeline(sg_pipeline_desc desc) {
+    desc.depth.compare = SG_COMPAREFUNC_LESS;
+    desc.depth.write_enabled = true;
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; ++i)
+        desc.colors[i].write_mask = SG_COLORMASK_NONE;
+    return desc;
+}
+
+inline sg_pipeline_desc DepthPrepass::equalPipeline(sg_pipeline_desc desc) {
+    desc.depth.compare = SG_COMPAREFUNC_EQUAL;
+    desc.depth.write_enabled = false;
+    return desc;
+}
+
+inline void DepthPrepass::record(double frameTime) {
+    // stalls (loading, dragging the window) would swamp the average
+    if (frameTime <= 0.0 || frameTime > 0.25)
+        return;
+    if (enabled) {
+        ++m_stats.framesOn;
+        m_stats.secondsOn += frameTime;
+    }
+    else {
+        ++m_stats.framesOff;
+        m_stats.secondsOff += frameTime;
+    }
+}
+
+inline void DepthPrepass::report() const {
+    std::cout << "DepthPrepass: ";
+    if (m_stats.framesOn > 0) {
+        std::cout << "on " << m_stats.secondsOn / m_stats.framesOn * 1000.0 << "ms/frame over "
+                  << m_stats.framesOn << " frames, "
+                  << m_stats.draws / m_stats.framesOn << " pre-pass draws/frame";
+    }
+    else {
+        std::cout << "never on";
+    }
+    if (m_stats.framesOff > 0) {
+        std::cout << ", off " << m_stats.secondsOff / m_stats.framesOff * 1000.0 << "ms/frame over "
+                  << m_stats.framesOff << " frames";
+    }
+    std::cout << "\n";
+}
+}
+#endif
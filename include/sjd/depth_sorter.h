@@ -0,0 +1,56 @@
+#ifndef DEPTH_SORTER_H
+#define DEPTH_SORTER_H
+
+/* DepthSorter
+ * Back-to-front ordering for blended draws (windows, vegetation, particles).
+ * Draws are added as (depth, draw index) pairs into a flat array that is kept
+ * between frames, then radix sorted on the float bits of the depth. Nothing is
+ * allocated once the buffers have grown to the largest frame, and draws at
+ * exactly the same depth all survive in the order they were added.
+ *
+ * Any monotonic depth works, so callers can pass squared distances and skip
+ * the square root.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <sjd/radix_sort.h>
+
+namespace sjd {
+class DepthSorter {
+public:
+    void reserve(size_t count) {
+        m_items.reserve(count);
+        m_scratch.reserve(count);
+    }
+
+    // call at the start of each frame, keeps the memory of the last one
+    void clear() {
+        m_items.clear();
+    }
+
+    void add(float depth, uint32_t index) {
+        // inverting the key makes an ascending sort come out farthest first
+        m_items.push_back(SortItem32 {
+            .key = ~floatSortKey(depth),
+            .index = index,
+        });
+    }
+
+    // sorts everything added since clear(), farthest first. The draw index of
+    // each entry is in SortItem32::index.
+    const std::vector<SortItem32>& sortBackToFront() {
+        radixSort(m_items, m_scratch);
+        return m_items;
+    }
+
+    size_t size() const {
+        return m_items.size();
+    }
+
+private:
+    std::vector<SortItem32> m_items;
+    std::vector<SortItem32> m_scratch;
+};
+}
+#endif
@@ -0,0 +1,174 @@
+#ifndef DYNAMIC_RESOLUTION_H
+#define DYNAMIC_RESOLUTION_H
+
+/* Dynamic resolution
+ * Picks the scale the scene is drawn at from how long frames are taking.
+ * Feed update() the frame time every frame (stm_laptime is fine) and use
+ * scale() for the scene targets, e.g. with RenderGraph::setTargetScale, then
+ * draw the result into the swapchain with PostProcess::addUpscale.
+ *
+ * The average frame time is a running average so one slow frame doesn't
+ * move anything. Over budget the scale drops straight to where the pixel
+ * count should fit (cost goes with the square of the scale), under budget it
+ * climbs back one step at a time. Frame times are clamped to the refresh
+ * rate with vsync on, so there's no telling how much room there is and the
+ * only way to find out is to try the next step up. A step up that gets
+ * undone right away makes the controller wait twice as long before trying
+ * again, so it doesn't bounce between two sizes.
+ *
+ * Scales are rounded to DynamicResolutionSettings::step and nothing changes
+ * for a few frames after a change, every change means new render targets.
+ */
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+
+namespace sjd {
+
+struct DynamicResolutionSettings {
+    // seconds
+    double targetFrameTime {1.0 / 60.0};
+    float minScale {0.5f};
+    float maxScale {1.0f};
+    float step {0.05f};
+    // how far over the target the average can go before the scale drops,
+    // vsync and the compositor add some jitter
+    float tolerance {0.1f};
+    // frames to ignore after a change while the new targets settle in
+    int settleFrames {15};
+    // frames in budget before trying the next step up
+    int growFrames {60};
+    // weight of the newest frame in the average
+    float smoothing {0.1f};
+};
+
+class DynamicResolution {
+public:
+    void setup(const DynamicResolutionSettings& settings);
+
+    // returns true when the scale changed
+    bool update(double frameTime);
+
+    float scale() const {
+        return m_scale;
+    }
+
+    double averageFrameTime() const {
+        return m_average;
+    }
+
+    // pins the scale, e.g. at 1 while dynamic resolution is switched off
+    void reset(float scale);
+
+    // prints the scale and frame time, and the draw counts of the last frame
+    // if sg_enable_frame_stats() was called
+    void report() const;
+
+private:
+    float quantise(float scale) const;
+    void changeScale(float scale);
+
+    DynamicResolutionSettings m_settings {};
+    float m_scale {1.0f};
+    double m_average {};
+    int m_framesSinceChange {};
+    int m_framesInBudget {};
+    int m_growDelay {60};
+    // set by a step up until it has lasted growFrames
+    bool m_probing {false};
+};
+
+inline void DynamicResolution::setup(const DynamicResolutionSettings& settings) {
+    m_settings = settings;
+    m_settings.minScale = std::clamp(m_settings.minScale, 0.1f, 1.0f);
+    m_settings.maxScale = std::clamp(m_settings.maxScale, m_settings.minScale, 2.0f);
+    m_growDelay = m_settings.growFrames;
+    reset(m_settings.maxScale);
+}
+
+inline void DynamicResolution::reset(float scale) {
+    m_scale = quantise(scale);
+    m_average = m_settings.targetFrameTime;
+    m_framesSinceChange = 0;
+    m_framesInBudget = 0;
+    m_probing = false;
+}
+
+inline float DynamicResolution::quantise(float scale) const {
+    scale = std::clamp(scale, m_settings.minScale, m_settings.maxScale);
+    if (m_settings.step <= 0.0f)
+        return scale;
+    float steps {std::round(scale / m_settings.step)};
+    return std::clamp(steps * m_settings.step, m_settings.minScale, m_settings.maxScale);
+}
+
+inline void DynamicResolution::changeScale(float scale) {
+    m_scale = scale;
+    m_framesSinceChange = 0;
+    m_framesInBudget = 0;
+    // the frames measured at the old size don't say anything about the new one
+    m_average = m_settings.targetFrameTime;
+}
+
+inline bool DynamicResolution::update(double frameTime) {
+    // a frame that took ages was a stall (loading, the window being
+    // dragged), not the GPU, so it doesn't count
+    if (frameTime <= 0.0 || frameTime > 0.25)
+        return false;
+
+    ++m_framesSinceChange;
+    if (m_framesSinceChange <= m_settings.settleFrames)
+        return false;
+    m_average += (frameTime - m_average) * m_settings.smoothing;
+
+    double budget {m_settings.targetFrameTime * (1.0 + m_settings.tolerance)};
+    if (m_average > budget) {
+        m_framesInBudget = 0;
+        if (m_scale <= m_settings.minScale)
+            return false;
+        // back off harder every time a step up doesn't hold
+        if (m_probing)
+            m_growDelay = std::min(m_growDelay * 2, m_settings.growFrames * 16);
+        m_probing = false;
+
+        // at least one step down, pixel count goes with the square of the scale
+        float fit {m_scale * static_cast<float>(std::sqrt(m_settings.targetFrameTime / m_average))};
+        float next {std::min(quantise(fit), quantise(m_scale - m_settings.step))};
+        if (next >= m_scale)
+            return false;
+        changeScale(next);
+        return true;
+    }
+
+    ++m_framesInBudget;
+    if (m_probing && m_framesInBudget >= m_settings.growFrames) {
+        // the last step up held, go back to the normal wait
+        m_probing = false;
+        m_growDelay = m_settings.growFrames;
+    }
+    if (m_framesInBudget < m_growDelay || m_scale >= m_settings.maxScale)
+        return false;
+
+    float next {quantise(m_scale + m_settings.step)};
+    if (next <= m_scale)
+        return false;
+    changeScale(next);
+    m_probing = true;
+    return true;
+}
+
+inline void DynamicResolution::report() const {
+    std::cout << "DynamicResolution: scale " << m_scale
+              << ", average frame " << m_average * 1000.0 << "ms (target "
+              << m_settings.targetFrameTime * 1000.0 << "ms)";
+    if (sg_frame_stats_enabled()) {
+        sg_frame_stats stats {sg_query_frame_stats()};
+        std::cout << ", " << stats.num_passes << " passes and "
+                  << stats.num_draw << " draws last frame";
+    }
+    std::cout << "\n";
+}
+}
+#endif
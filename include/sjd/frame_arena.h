@@ -0,0 +1,175 @@
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+/* FrameArena
+ * A bump allocator for memory that only has to last until the end of the
+ * frame. allocate() moves a pointer along a block and reset() (after
+ * sg_commit) moves it back to the start, so scratch containers in draw code
+ * stop going to the heap every frame:
+ *
+ *   sjd::FrameVector<glm::mat4> models;      // std::vector on the arena
+ *   models.reserve(count);
+ *
+ * Blocks are only ever added, never freed until the arena goes, so once the
+ * arena has grown to the busiest frame so far (the high-water mark) frames
+ * don't call malloc at all. An allocation bigger than a block gets a block
+ * of its own, which is kept and reused the same way. FrameAllocator's
+ * deallocate() does nothing, memory comes back all at once at reset(). A
+ * container can outlive a reset() and be destroyed or assigned over later,
+ * but its elements mustn't be touched (and it mustn't be added to) since
+ * the next frame is handing the same memory out again.
+ *
+ * sjd::App resets instance() after every sg_commit. It isn't thread safe,
+ * it's for the thread the frame runs on.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace sjd {
+class FrameArena {
+public:
+    static constexpr size_t BLOCK_SIZE {1 << 20};
+
+    static FrameArena& instance() {
+        static FrameArena arena;
+        return arena;
+    }
+
+    FrameArena() = default;
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    // frees everything allocated since the last reset, once a frame
+    void reset();
+
+    // bytes handed out since the last reset
+    size_t used() const {
+        return m_used;
+    }
+
+    // the most any frame has used
+    size_t highWater() const {
+        return m_highWater;
+    }
+
+    // what the last frame used, reset() saves it
+    size_t lastFrame() const {
+        return m_lastFrame;
+    }
+
+    // bytes in every block
+    size_t capacity() const;
+
+    void report() const;
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> memory;
+        size_t size;
+    };
+
+    std::vector<Block> m_blocks;
+    // the block being allocated from and how far into it
+    size_t m_block {};
+    size_t m_offset {};
+    size_t m_used {};
+    size_t m_highWater {};
+    size_t m_lastFrame {};
+};
+
+// std::allocator stand-in that allocates from a FrameArena
+template <typename T>
+class FrameAllocator {
+public:
+    using value_type = T;
+
+    FrameAllocator() noexcept : m_arena {&FrameArena::instance()} {}
+    explicit FrameAllocator(FrameArena& arena) noexcept : m_arena {&arena} {}
+    template <typename U>
+    FrameAllocator(const FrameAllocator<U>& other) noexcept : m_arena {other.arena()} {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // reset() gets it back
+    void deallocate(T*, size_t) noexcept {}
+
+    FrameArena* arena() const {
+        return m_arena;
+    }
+
+    template <typename U>
+    bool operator==(const FrameAllocator<U>& other) const {
+        return m_arena == other.arena();
+    }
+
+    template <typename U>
+    bool operator!=(const FrameAllocator<U>& other) const {
+        return m_arena != other.arena();
+    }
+
+private:
+    FrameArena* m_arena;
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+using FrameMap = std::map<Key, Value, Compare, FrameAllocator<std::pair<const Key, Value>>>;
+
+inline void* FrameArena::allocate(size_t bytes, size_t alignment) {
+    bytes = std::max<size_t>(bytes, 1);
+    while (m_block < m_blocks.size()) {
+        Block& block {m_blocks[m_block]};
+        uintptr_t base {reinterpret_cast<uintptr_t>(block.memory.get())};
+        size_t offset {((base + m_offset + alignment - 1) & ~(alignment - 1)) - base};
+        if (offset + bytes <= block.size) {
+            m_used += offset + bytes - m_offset;
+            m_offset = offset + bytes;
+            return block.memory.get() + offset;
+        }
+        // on to the next block, the rest of this one goes unused this frame
+        m_used += block.size - m_offset;
+        ++m_block;
+        m_offset = 0;
+    }
+
+    // out of blocks, this only happens while the arena is still growing
+    size_t size {std::max(BLOCK_SIZE, bytes + alignment)};
+    m_blocks.push_back(Block {std::make_unique<std::byte[]>(size), size});
+    return allocate(bytes, alignment);
+}
+
+inline void FrameArena::reset() {
+    m_lastFrame = m_used;
+    m_highWater = std::max(m_highWater, m_used);
+    m_block = 0;
+    m_offset = 0;
+    m_used = 0;
+}
+
+inline size_t FrameArena::capacity() const {
+    size_t total {0};
+    for (const Block& block : m_blocks)
+        total += block.size;
+    return total;
+}
+
+inline void FrameArena::report() const {
+    std::cout << "FrameArena: " << m_highWater / 1024 << " KiB high-water, "
+              << m_blocks.size() << " blocks, " << capacity() / 1024 << " KiB reserved\n";
+}
+}
+#endif
@@ -0,0 +1,185 @@
+#ifndef FRAME_CLOCK_H
+#define FRAME_CLOCK_H
+
+/* FrameClock
+ * Animation time, sampled once a frame. tick() at the top of frame() reads
+ * the real clock and moves the clock on, then everything that animates uses
+ * time() and deltaTime() instead of asking sokol_time for itself, so the
+ * whole frame sees the same time and the clock can be
+ *
+ *   paused       setPaused(true), time() stops and deltaTime() is 0
+ *   scaled       setScale(0.25) for slow motion
+ *   fixed step   setFixedStep(1.0 / 60.0), every frame is that long however
+ *                long it really took
+ *   recorded     record("clock.txt") writes every frame's step
+ *   replayed     replay("clock.txt") takes the steps from a recording
+ *                rather than the real clock, then carries on from the real
+ *                clock when they run out
+ *
+ * Recordings hold the start time and the steps as hex floats, so a replay
+ * adds up to exactly the same doubles and the frames come out bit for bit
+ * the same. realDeltaTime() is the wall clock frame time whatever the clock
+ * is doing, for frame time displays and DynamicResolution.
+ *
+ * stm_setup() has to have been called before the first tick().
+ */
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <sokol/sokol_time.h>
+
+namespace sjd {
+class FrameClock {
+public:
+    // once a frame, before anything reads the time
+    void tick();
+
+    // seconds of animation time, what animations should use
+    double time() const {
+        return m_time;
+    }
+
+    // this frame's step, 0 while paused
+    float deltaTime() const {
+        return static_cast<float>(m_delta);
+    }
+
+    double realDeltaTime() const {
+        return m_realDelta;
+    }
+
+    // ticks since the clock was made
+    uint64_t frame() const {
+        return m_frame;
+    }
+
+    void setPaused(bool paused) {
+        m_paused = paused;
+    }
+
+    bool paused() const {
+        return m_paused;
+    }
+
+    void setScale(double scale) {
+        m_scale = scale;
+    }
+
+    double scale() const {
+        return m_scale;
+    }
+
+    // seconds per frame, 0 goes back to the real clock
+    void setFixedStep(double seconds) {
+        m_fixedStep = seconds > 0.0 ? seconds : 0.0;
+    }
+
+    double fixedStep() const {
+        return m_fixedStep;
+    }
+
+    // writes the steps from the next tick on, until stopRecording()
+    bool record(const std::string& path);
+    void stopRecording();
+
+    // steps through a recording from the next tick on, starting from the
+    // time it was recorded at
+    bool replay(const std::string& path);
+
+    bool replaying() const {
+        return m_replayNext < m_replay.size();
+    }
+
+private:
+    uint64_t m_last {};
+    double m_time {};
+    double m_delta {};
+    double m_realDelta {};
+    uint64_t m_frame {};
+    bool m_paused {false};
+    double m_scale {1.0};
+    double m_fixedStep {};
+    std::ofstream m_record;
+    std::vector<double> m_replay;
+    size_t m_replayNext {};
+};
+
+inline void FrameClock::tick() {
+    // 0 on the first tick, there's nothing to measure against yet
+    m_realDelta = stm_sec(stm_laptime(&m_last));
+
+    double delta {};
+    if (m_paused) {
+        delta = 0.0;
+    }
+    else if (replaying()) {
+        delta = m_replay[m_replayNext++];
+        if (!replaying())
+            std::cout << "FrameClock: replay finished after " << m_replay.size() << " frames\n";
+    }
+    else {
+        delta = (m_fixedStep > 0.0 ? m_fixedStep : m_realDelta) * m_scale;
+    }
+
+    m_delta = delta;
+    m_time += delta;
+    ++m_frame;
+    if (m_record.is_open())
+        m_record << std::hexfloat << delta << "\n";
+}
+
+inline bool FrameClock::record(const std::string& path) {
+    stopRecording();
+    m_record.open(path);
+    if (!m_record) {
+        std::cout << "WARNING::FRAME_CLOCK::RECORD: couldn't write " << path << "\n";
+        return false;
+    }
+    m_record << "# sjd::FrameClock steps\n"
+             << "start " << std::hexfloat << m_time << "\n";
+    return true;
+}
+
+inline void FrameClock::stopRecording() {
+    if (m_record.is_open())
+        m_record.close();
+}
+
+inline bool FrameClock::replay(const std::string& path) {
+    std::ifstream file {path};
+    if (!file) {
+        std::cout << "WARNING::FRAME_CLOCK::REPLAY: couldn't read " << path << "\n";
+        return false;
+    }
+
+    // strtod rather than >> since streams don't read hex floats back
+    std::vector<double> steps;
+    double start {m_time};
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#' || line[0] == '\r')
+            continue;
+        if (line.rfind("start ", 0) == 0) {
+            start = std::strtod(line.c_str() + 6, nullptr);
+            continue;
+        }
+        char* end {nullptr};
+        double step {std::strtod(line.c_str(), &end)};
+        if (end == line.c_str()) {
+            std::cout << "WARNING::FRAME_CLOCK::REPLAY: " << path << " has a bad step: " << line << "\n";
+            return false;
+        }
+        steps.push_back(step);
+    }
+
+    m_replay = std::move(steps);
+    m_replayNext = 0;
+    m_time = start;
+    return true;
+}
+}
+#endif
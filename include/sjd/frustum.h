@@ -0,0 +1,56 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+/* Frustum
+ * The six clip planes of a view-projection matrix (Gribb & Hartmann, "Fast
+ * Extraction of Viewing Frustum Planes from the World-View-Projection
+ * Matrix"), for throwing away objects a view can't see before drawing
+ * them. Planes point inwards and are normalised, so the distance to a
+ * plane is in world units and a bounding sphere is a single dot product
+ * per plane.
+ *
+ * Expects GL clip space (z from -w to w), which is what glm::perspective
+ * gives without GLM_FORCE_DEPTH_ZERO_TO_ONE.
+ */
+#include <array>
+#include <glm/glm.hpp>
+
+namespace sjd {
+struct Frustum {
+    enum Plane { PLANE_LEFT, PLANE_RIGHT, PLANE_BOTTOM, PLANE_TOP, PLANE_NEAR, PLANE_FAR };
+
+    // xyz = normal, w = distance
+    std::array<glm::vec4, 6> planes {};
+
+    static Frustum fromMatrix(const glm::mat4& viewProjection);
+
+    bool sphereVisible(const glm::vec3& centre, float radius) const;
+};
+
+inline Frustum Frustum::fromMatrix(const glm::mat4& viewProjection) {
+    // glm is column major, these are the rows
+    glm::vec4 row[4];
+    for (int i = 0; i < 4; ++i)
+        row[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+
+    Frustum frustum {};
+    frustum.planes[PLANE_LEFT] = row[3] + row[0];
+    frustum.planes[PLANE_RIGHT] = row[3] - row[0];
+    frustum.planes[PLANE_BOTTOM] = row[3] + row[1];
+    frustum.planes[PLANE_TOP] = row[3] - row[1];
+    frustum.planes[PLANE_NEAR] = row[3] + row[2];
+    frustum.planes[PLANE_FAR] = row[3] - row[2];
+    for (glm::vec4& plane : frustum.planes)
+        plane /= glm::length(glm::vec3(plane));
+    return frustum;
+}
+
+inline bool Frustum::sphereVisible(const glm::vec3& centre, float radius) const {
+    for (const glm::vec4& plane : planes) {
+        if (glm::dot(glm::vec3(plane), centre) + plane.w < -radius)
+            return false;
+    }
+    return true;
+}
+}
+#endif
@@ -0,0 +1,159 @@
+#ifndef GFX_CACHE_H
+#define GFX_CACHE_H
+
+/* GfxCache
+ * Hands out pipelines and samplers by descriptor instead of making a new one
+ * on every call. Descriptors are hashed (FNV-1a over their bytes) and an
+ * equal descriptor gets back the object that was made the first time, so
+ * e.g. two pipelines that only differ in their label share one sokol object
+ * and a sampler made in a resize callback doesn't leak a pool slot every
+ * time the window changes size.
+ *
+ * Labels are left out of the comparison, they're only for debugging. The
+ * rest is compared byte for byte, padding included. Keys are kept as byte
+ * arrays so the cache's own copies keep the padding exactly, but
+ * descriptors should still be brace initialised (which zero fills them). One
+ * that isn't just misses the cache and gets its own object.
+ *
+ * Cached objects belong to the cache, don't sg_destroy_* them yourself.
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+
+namespace sjd {
+class GfxCache {
+public:
+    struct Stats {
+        uint32_t pipelines {};
+        uint32_t samplers {};
+        uint32_t pipelineHits {};
+        uint32_t samplerHits {};
+    };
+
+    sg_pipeline pipeline(const sg_pipeline_desc& desc);
+    sg_sampler sampler(const sg_sampler_desc& desc);
+
+    // destroys everything the cache made, call before sg_shutdown() if the
+    // cache outlives the sokol context
+    void clear();
+
+    const Stats& stats() const {
+        return m_stats;
+    }
+
+    // prints cache usage against the sokol pool sizes
+    void report() const;
+
+private:
+    template <typename Desc>
+    using Key = std::array<uint8_t, sizeof(Desc)>;
+
+    template <typename Desc, typename Handle>
+    struct Entry {
+        Key<Desc> key;
+        Handle handle;
+    };
+
+    // the descriptor's bytes with the label pointer zeroed. A byte array
+    // rather than a Desc copy, copying a struct doesn't have to keep its
+    // padding.
+    template <typename Desc>
+    static Key<Desc> makeKey(const Desc& desc) {
+        Key<Desc> key;
+        std::memcpy(key.data(), &desc, sizeof(Desc));
+        std::memset(key.data() + offsetof(Desc, label), 0, sizeof(desc.label));
+        return key;
+    }
+
+    template <typename Desc>
+    static uint64_t hash(const Key<Desc>& key) {
+        uint64_t h {0xcbf29ce484222325ull};
+        for (uint8_t byte : key) {
+            h ^= byte;
+            h *= 0x100000001b3ull;
+        }
+        return h;
+    }
+
+    template <typename Desc, typename Handle, typename Make, typename Query>
+    static Handle lookup(std::unordered_map<uint64_t, std::vector<Entry<Desc, Handle>>>& entries,
+                         const Desc& desc,
+                         uint32_t& count,
+                         uint32_t& hits,
+                         Make make,
+                         Query query);
+
+    std::unordered_map<uint64_t, std::vector<Entry<sg_pipeline_desc, sg_pipeline>>> m_pipelines;
+    std::unordered_map<uint64_t, std::vector<Entry<sg_sampler_desc, sg_sampler>>> m_samplers;
+    Stats m_stats;
+};
+
+template <typename Desc, typename Handle, typename Make, typename Query>
+inline Handle GfxCache::lookup(std::unordered_map<uint64_t, std::vector<Entry<Desc, Handle>>>& entries,
+                               const Desc& desc,
+                               uint32_t& count,
+                               uint32_t& hits,
+                               Make make,
+                               Query query) {
+    Key<Desc> key {makeKey(desc)};
+    std::vector<Entry<Desc, Handle>>& bucket {entries[hash<Desc>(key)]};
+    for (Entry<Desc, Handle>& entry : bucket) {
+        if (entry.key != key)
+            continue;
+        // someone destroyed it behind our back, make it again
+        if (query(entry.handle) == SG_RESOURCESTATE_INVALID) {
+            entry.handle = make(desc);
+            return entry.handle;
+        }
+        ++hits;
+        return entry.handle;
+    }
+
+    // the object keeps the label of whoever asked for it first
+    Handle handle {make(desc)};
+    bucket.push_back(Entry<Desc, Handle> {key, handle});
+    ++count;
+    return handle;
+}
+
+inline sg_pipeline GfxCache::pipeline(const sg_pipeline_desc& desc) {
+    return lookup(m_pipelines, desc, m_stats.pipelines, m_stats.pipelineHits,
+                  sg_make_pipeline, sg_query_pipeline_state);
+}
+
+inline sg_sampler GfxCache::sampler(const sg_sampler_desc& desc) {
+    return lookup(m_samplers, desc, m_stats.samplers, m_stats.samplerHits,
+                  sg_make_sampler, sg_query_sampler_state);
+}
+
+inline void GfxCache::clear() {
+    for (auto& [key, bucket] : m_pipelines) {
+        for (auto& entry : bucket)
+            sg_destroy_pipeline(entry.handle);
+    }
+    for (auto& [key, bucket] : m_samplers) {
+        for (auto& entry : bucket)
+            sg_destroy_sampler(entry.handle);
+    }
+    m_pipelines.clear();
+    m_samplers.clear();
+    m_stats = Stats {};
+}
+
+inline void GfxCache::report() const {
+    sg_desc desc {sg_query_desc()};
+    std::cout << "GfxCache: "
+              << m_stats.pipelines << "/" << desc.pipeline_pool_size << " pipelines ("
+              << m_stats.pipelineHits << " reused), "
+              << m_stats.samplers << "/" << desc.sampler_pool_size << " samplers ("
+              << m_stats.samplerHits << " reused)\n";
+}
+}
+#endif
@@ -0,0 +1,75 @@
+// Selection outlines from an object id target, the C++ side is
+// include/sjd/outline.h
+//
+//   @include ../../include/sjd/glsl/outline.glsl
+//
+// adds the outline program: a fullscreen triangle that copies the scene
+// (binding 0) and draws outlines around the selected objects in the id
+// target (binding 1). Both are read with texelFetch at the fragment's own
+// pixel, so they have to be the size of the swapchain.
+
+@vs vs_outline
+void main() {
+    // same fullscreen triangle as vs_post in post.glsl
+    vec2 uv = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+    gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+}
+@end
+
+@fs fs_outline
+layout(binding = 0) uniform outline_params {
+    vec4 outlineColour;
+    // x = width in pixels, y = directions (8 or 16)
+    vec4 params;
+};
+
+layout(binding = 0) uniform texture2D _scene;
+layout(binding = 1) uniform texture2D _ids;
+layout(binding = 0) uniform sampler outline_smp;
+#define scene sampler2D(_scene, outline_smp)
+#define ids sampler2D(_ids, outline_smp)
+
+out vec4 FragColor;
+
+// the id is 15 bits over r and g, the top bit of g marks a selected object
+int objectId(ivec2 pixel) {
+    vec2 rg = round(texelFetch(ids, pixel, 0).rg * 255.0);
+    return int(rg.x) + int(rg.y) * 256;
+}
+
+void main() {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    ivec2 size = textureSize(ids, 0) - 1;
+    vec4 colour = texelFetch(scene, pixel, 0);
+    int centre = objectId(pixel);
+
+    // a pixel is outline when a selected object other than the one it
+    // belongs to is within `width` pixels. Walking out along a fixed number
+    // of directions keeps the cost the same however many objects are
+    // selected.
+    int width = int(params.x);
+    int directions = int(params.y);
+    float coverage = 0.0;
+    for (int d = 0; d < 16; d++) {
+        if (d >= directions) {
+            break;
+        }
+        float angle = 6.2831853 * float(d) / float(directions);
+        vec2 step = vec2(cos(angle), sin(angle));
+        for (int i = 1; i <= 8; i++) {
+            if (i > width) {
+                break;
+            }
+            ivec2 p = clamp(pixel + ivec2(round(step * float(i))), ivec2(0), size);
+            int id = objectId(p);
+            if (id >= 32768 && id != centre) {
+                coverage = 1.0;
+                break;
+            }
+        }
+    }
+    FragColor = vec4(mix(colour.rgb, outlineColour.rgb, coverage * outlineColour.a), colour.a);
+}
+@end
+
+@program outline vs_outline fs_outline
@@ -0,0 +1,196 @@
+// Post-processing shaders, the C++ side is include/sjd/post.h
+//
+//   @include ../../include/sjd/glsl/post.glsl
+//
+// adds the post_gaussian, post_kawase_down, post_kawase_up,
+// post_bloom_prefilter, post_bloom_composite, post_copy and post_upscale
+// programs. They draw a fullscreen triangle without any vertex buffers and
+// all take the same post_params block (binding 0) with the input image at
+// binding 0, post.h relies on those bindings.
+
+@vs vs_post
+out vec2 TexCoords;
+
+void main() {
+    // 0 -> (0, 0), 1 -> (2, 0), 2 -> (0, 2), covers the screen with one
+    // triangle so there's no diagonal seam running through the quad
+    TexCoords = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+    gl_Position = vec4(TexCoords * 2.0 - 1.0, 0.0, 1.0);
+}
+@end
+
+@block post_params
+layout(binding = 0) uniform post_params {
+    // xy = one texel in uv, for the Gaussian only along the blur direction
+    // z = Kawase spread, more than 1 for a wider blur
+    vec4 texel;
+    // Gaussian: bilinear tap offsets in texels and their weights
+    vec4 offsets[2];
+    vec4 weights[2];
+    // Gaussian: x = centre weight, y = tap pairs
+    // bloom:    x = threshold, y = knee, z = intensity, w = exposure (0 = no
+    //           tone mapping)
+    // upscale:  x = sharpness, 0 - 1
+    vec4 params;
+};
+
+layout(binding = 0) uniform texture2D _source;
+layout(binding = 0) uniform sampler source_smp;
+#define source sampler2D(_source, source_smp)
+@end
+
+@fs fs_gaussian
+@include_block post_params
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+// one direction of a separable Gaussian. Neighbouring taps are merged into
+// a single bilinear fetch between them, so 8 pairs cover 33 texels.
+void main() {
+    vec3 colour = texture(source, TexCoords).rgb * params.x;
+    int pairs = int(params.y);
+    for (int i = 0; i < 8; i++) {
+        if (i >= pairs) {
+            break;
+        }
+        vec2 offset = texel.xy * offsets[i / 4][i % 4];
+        float weight = weights[i / 4][i % 4];
+        colour += texture(source, TexCoords + offset).rgb * weight;
+        colour += texture(source, TexCoords - offset).rgb * weight;
+    }
+    FragColor = vec4(colour, 1.0);
+}
+@end
+
+@block kawase_down
+// dual filter downsample (Bjorge, "Bandwidth-Efficient Rendering", 2015),
+// each bilinear tap averages 2x2 texels so five taps cover 4x4
+vec3 kawaseDown(vec2 uv) {
+    vec2 halfpixel = texel.xy * texel.z;
+    vec3 sum = texture(source, uv).rgb * 4.0;
+    sum += texture(source, uv - halfpixel).rgb;
+    sum += texture(source, uv + halfpixel).rgb;
+    sum += texture(source, uv + vec2(halfpixel.x, -halfpixel.y)).rgb;
+    sum += texture(source, uv - vec2(halfpixel.x, -halfpixel.y)).rgb;
+    return sum / 8.0;
+}
+@end
+
+@fs fs_kawase_down
+@include_block post_params
+@include_block kawase_down
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+void main() {
+    FragColor = vec4(kawaseDown(TexCoords), 1.0);
+}
+@end
+
+@fs fs_kawase_up
+@include_block post_params
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+void main() {
+    vec2 halfpixel = texel.xy * 0.5 * texel.z;
+    vec3 sum = texture(source, TexCoords + vec2(-halfpixel.x * 2.0, 0.0)).rgb;
+    sum += texture(source, TexCoords + vec2(-halfpixel.x, halfpixel.y)).rgb * 2.0;
+    sum += texture(source, TexCoords + vec2(0.0, halfpixel.y * 2.0)).rgb;
+    sum += texture(source, TexCoords + vec2(halfpixel.x, halfpixel.y)).rgb * 2.0;
+    sum += texture(source, TexCoords + vec2(halfpixel.x * 2.0, 0.0)).rgb;
+    sum += texture(source, TexCoords + vec2(halfpixel.x, -halfpixel.y)).rgb * 2.0;
+    sum += texture(source, TexCoords + vec2(0.0, -halfpixel.y * 2.0)).rgb;
+    sum += texture(source, TexCoords + vec2(-halfpixel.x, -halfpixel.y)).rgb * 2.0;
+    FragColor = vec4(sum / 12.0, 1.0);
+}
+@end
+
+@fs fs_bloom_prefilter
+@include_block post_params
+@include_block kawase_down
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+// first downsample of the bloom chain, only keeps what's brighter than the
+// threshold with a soft knee so the cut off doesn't show
+void main() {
+    vec3 colour = kawaseDown(TexCoords);
+    float brightness = max(colour.r, max(colour.g, colour.b));
+    float threshold = params.x;
+    float knee = threshold * params.y + 1e-5;
+    float soft = clamp(brightness - threshold + knee, 0.0, 2.0 * knee);
+    soft = soft * soft / (4.0 * knee);
+    float contribution = max(soft, brightness - threshold) / max(brightness, 1e-5);
+    FragColor = vec4(colour * contribution, 1.0);
+}
+@end
+
+@fs fs_bloom_composite
+@include_block post_params
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+layout(binding = 1) uniform texture2D _bloom;
+#define bloom sampler2D(_bloom, source_smp)
+
+void main() {
+    vec3 colour = texture(source, TexCoords).rgb + texture(bloom, TexCoords).rgb * params.z;
+    if (params.w > 0.0) {
+        colour = vec3(1.0) - exp(-colour * params.w);
+    }
+    FragColor = vec4(colour, 1.0);
+}
+@end
+
+@fs fs_post_copy
+@include_block post_params
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+void main() {
+    FragColor = vec4(texture(source, TexCoords).rgb, 1.0);
+}
+@end
+
+@fs fs_upscale
+@include_block post_params
+in vec2 TexCoords;
+
+out vec4 FragColor;
+
+// bilinear upscale of a smaller scene target with contrast adaptive
+// sharpening (after AMD's FidelityFX CAS). The cross of source texels round
+// the pixel is sharpened less where it already has a lot of contrast, so
+// edges don't ring and flat areas don't pick up noise.
+void main() {
+    vec3 c = texture(source, TexCoords).rgb;
+    vec3 n = texture(source, TexCoords + vec2(0.0, texel.y)).rgb;
+    vec3 s = texture(source, TexCoords - vec2(0.0, texel.y)).rgb;
+    vec3 e = texture(source, TexCoords + vec2(texel.x, 0.0)).rgb;
+    vec3 w = texture(source, TexCoords - vec2(texel.x, 0.0)).rgb;
+
+    // the amount is worked out on LDR values, HDR highlights just get the
+    // least sharpening
+    vec3 mn = clamp(min(c, min(min(n, s), min(e, w))), 0.0, 1.0);
+    vec3 mx = clamp(max(c, max(max(n, s), max(e, w))), 0.0, 1.0);
+    vec3 amount = sqrt(clamp(min(mn, 1.0 - mx) / max(mx, 1e-5), 0.0, 1.0));
+    vec3 weight = amount * -mix(0.125, 0.2, params.x);
+    vec3 colour = (c + (n + s + e + w) * weight) / (1.0 + 4.0 * weight);
+    FragColor = vec4(max(colour, 0.0), 1.0);
+}
+@end
+
+@program post_gaussian vs_post fs_gaussian
+@program post_kawase_down vs_post fs_kawase_down
+@program post_kawase_up vs_post fs_kawase_up
+@program post_bloom_prefilter vs_post fs_bloom_prefilter
+@program post_bloom_composite vs_post fs_bloom_composite
+@program post_copy vs_post fs_post_copy
+@program post_upscale vs_post fs_upscale
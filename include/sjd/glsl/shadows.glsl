@@ -0,0 +1,77 @@
+// Cascaded shadow map sampling, the C++ side is include/sjd/shadows.h
+//
+//   @include ../../include/sjd/glsl/shadows.glsl
+//   ...
+//   @fs fs
+//   @include_block shadows
+//   ...
+//   float shadow = shadowFactor(FragPos, normal, viewDepth);
+//
+// Takes uniform block, image and sampler binding 7.
+@block shadows
+layout(binding = 7) uniform fs_shadows {
+    // world space -> shadow atlas uv and depth
+    mat4 shadowMatrices[4];
+    // per cascade tile of the atlas that PCF taps are clamped to
+    vec4 cascadeRects[4];
+    // view space far distance of each cascade
+    vec4 cascadeSplits;
+    // size of one shadow map texel in world units
+    vec4 texelWorldSize;
+    // x = cascade count, y = depth bias, z = normal offset in texels,
+    // w = 1 to tint the cascades
+    vec4 shadowParams;
+};
+
+@image_sample_type _shadow_map depth
+@sampler_type shadow_smp comparison
+layout(binding = 7) uniform texture2D _shadow_map;
+layout(binding = 7) uniform sampler shadow_smp;
+#define shadow_map sampler2DShadow(_shadow_map, shadow_smp)
+
+int shadowCascade(float viewDepth) {
+    int count = int(shadowParams.x);
+    for (int i = 0; i < 4; i++) {
+        if (i < count && viewDepth < cascadeSplits[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 1 = lit, 0 = in shadow
+float shadowFactor(vec3 worldPos, vec3 normal, float viewDepth) {
+    int cascade = shadowCascade(viewDepth);
+    if (cascade < 0) {
+        return 1.0;
+    }
+    // pushing the lookup out along the normal removes most acne on
+    // surfaces that face away from the light at a grazing angle
+    vec3 offsetPos = worldPos + normal * texelWorldSize[cascade] * shadowParams.z;
+    vec4 coords = shadowMatrices[cascade] * vec4(offsetPos, 1.0);
+    vec4 rect = cascadeRects[cascade];
+    vec2 texel = 1.0 / vec2(textureSize(shadow_map, 0));
+    float depth = coords.z - shadowParams.y;
+
+    // 3x3 taps, each one already a 2x2 comparison with linear filtering
+    float lit = 0.0;
+    for (int x = -1; x <= 1; x++) {
+        for (int y = -1; y <= 1; y++) {
+            vec2 uv = clamp(coords.xy + vec2(x, y) * texel, rect.xy, rect.zw);
+            lit += texture(shadow_map, vec3(uv, depth));
+        }
+    }
+    return lit / 9.0;
+}
+
+// debug colours for shadowParams.w
+vec3 cascadeTint(float viewDepth) {
+    int cascade = shadowCascade(viewDepth);
+    if (shadowParams.w < 0.5 || cascade < 0) {
+        return vec3(1.0);
+    }
+    vec3 tints[4] = vec3[4](vec3(1.0, 0.6, 0.6), vec3(0.6, 1.0, 0.6),
+                            vec3(0.6, 0.6, 1.0), vec3(1.0, 1.0, 0.6));
+    return tints[cascade];
+}
+@end
@@ -0,0 +1,424 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+/* JobSystem
+ * A work stealing scheduler for spreading a frame's CPU work over the
+ * cores. Workers are started once and kept, instead of making threads every
+ * frame, and each one (plus the thread that started the system, normally
+ * the main thread) owns a Chase-Lev deque. A thread pushes and pops its own
+ * jobs at the bottom of its deque and idle threads steal from the top of
+ * someone else's, so the work spreads out without a shared queue to fight
+ * over. After Chase & Lev, "Dynamic Circular Work-Stealing Deque" (SPAA
+ * 2005), with a fixed size ring and seq_cst on the top/bottom race rather
+ * than standalone fences, which ThreadSanitizer can follow.
+ *
+ *   sjd::JobSystem& jobs {sjd::JobSystem::instance()};
+ *   jobs.parallelFor(0, count, 64, [&](int first, int last) { ... });
+ *
+ *   sjd::JobCounter loaded;
+ *   jobs.run([&] { decode(a); }, &loaded);
+ *   jobs.run([&] { decode(b); }, &loaded);
+ *   jobs.runAfter(loaded, [&] { pack(); }, &packed);
+ *   jobs.wait(packed);
+ *
+ * A counter goes up for every job given it and down as they finish. wait()
+ * runs other jobs until it reaches zero rather than blocking, so waiting
+ * from inside a job is fine. runAfter() holds a job back until a counter
+ * reaches zero, which is how jobs depend on each other.
+ *
+ * The system starts itself the first time instance() is called, with one
+ * worker per core less the calling thread. Natively that's std::thread. On
+ * the web it needs -pthread, and -sPTHREAD_POOL_SIZE so the workers exist
+ * before main() rather than being made (asynchronously) on first use; the
+ * page also has to be cross origin isolated for SharedArrayBuffer. Without
+ * pthreads, or with no workers, run() executes the job straight away and
+ * parallelFor() is a plain loop, so code written against it works the same
+ * either way. A full deque also just runs the job inline. Finished jobs go
+ * on a free list for the next run(), so once a frame's worth of them exist
+ * running jobs doesn't allocate (as long as the task fits in std::function
+ * without allocating, a few pointers' worth of captures).
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sjd {
+class JobSystem;
+
+// counts unfinished jobs, it must outlive the jobs given it
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool done() const {
+        return m_count.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    friend class JobSystem;
+    struct Job;
+    std::atomic<int> m_count {0};
+    // jobs waiting on this counter, guarded by JobSystem::m_continuationMutex
+    std::vector<Job*> m_continuations;
+};
+
+struct JobCounter::Job {
+    std::function<void()> task;
+    JobCounter* counter {nullptr};
+};
+
+class JobSystem {
+public:
+    using Job = JobCounter::Job;
+
+    // jobs each deque holds before run() executes them inline
+    static constexpr int64_t DEQUE_SIZE {1 << 12};
+
+    static JobSystem& instance() {
+        static JobSystem jobs {defaultWorkerCount()};
+        return jobs;
+    }
+
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // workers, not counting the thread that started the system
+    unsigned workerCount() const {
+        return static_cast<unsigned>(m_workers.size());
+    }
+
+    // how many threads parallelFor() can keep busy
+    unsigned threadCount() const {
+        return workerCount() + 1;
+    }
+
+    // task runs on any thread, counter (if any) goes up now and down when
+    // it's finished
+    void run(std::function<void()> task, JobCounter* counter = nullptr);
+
+    // like run(), but task isn't started until dependency reaches zero
+    void runAfter(JobCounter& dependency, std::function<void()> task, JobCounter* counter = nullptr);
+
+    // runs jobs until counter reaches zero
+    void wait(JobCounter& counter);
+
+    // body(first, last) over [first, last) in pieces of at least grain,
+    // returns once they've all run. The calling thread takes a piece too.
+    template <typename Body>
+    void parallelFor(int first, int last, int grain, Body&& body);
+
+private:
+    // Chase-Lev deque with a fixed ring, push() and pop() by the owner only
+    class Deque {
+    public:
+        bool push(Job* job);
+        Job* pop();
+        Job* steal();
+
+    private:
+        static constexpr int64_t MASK {DEQUE_SIZE - 1};
+        alignas(64) std::atomic<int64_t> m_top {0};
+        alignas(64) std::atomic<int64_t> m_bottom {0};
+        std::array<std::atomic<Job*>, DEQUE_SIZE> m_jobs {};
+    };
+
+    explicit JobSystem(unsigned workerCount);
+    static unsigned defaultWorkerCount();
+
+    // index of the calling thread's deque, -1 for threads the system
+    // doesn't know about
+    static int& threadIndex() {
+        thread_local int index {-1};
+        return index;
+    }
+
+    Job* makeJob(std::function<void()>&& task, JobCounter* counter);
+    void freeJob(Job* job);
+    void submit(Job* job);
+    Job* take();
+    void execute(Job* job);
+    void workerLoop(int index);
+
+    std::vector<std::unique_ptr<Deque>> m_deques;
+    std::vector<std::thread> m_workers;
+
+    // jobs from threads without a deque
+    std::mutex m_injectedMutex;
+    std::deque<Job*> m_injected;
+
+    std::mutex m_continuationMutex;
+
+    std::mutex m_freeMutex;
+    std::vector<Job*> m_freeJobs;
+
+    // jobs sitting in deques or m_injected, so workers know when to sleep
+    std::atomic<int> m_queued {0};
+    std::atomic<int> m_sleeping {0};
+    std::atomic<bool> m_stopping {false};
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+};
+
+inline unsigned JobSystem::defaultWorkerCount() {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    return 0;
+#else
+    unsigned cores {std::thread::hardware_concurrency()};
+    return cores > 1 ? cores - 1 : 0;
+#endif
+}
+
+inline JobSystem::JobSystem(unsigned workerCount) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    workerCount = 0;
+#endif
+    // the thread making the system owns deque 0
+    threadIndex() = 0;
+    for (unsigned i = 0; i <= workerCount; ++i)
+        m_deques.push_back(std::make_unique<Deque>());
+    for (unsigned i = 1; i <= workerCount; ++i)
+        m_workers.emplace_back([this, i] { workerLoop(static_cast<int>(i)); });
+}
+
+inline JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock {m_sleepMutex};
+        m_stopping.store(true);
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers)
+        worker.join();
+    // anything nobody waited for is dropped
+    for (std::unique_ptr<Deque>& deque : m_deques) {
+        while (Job* job = deque->steal())
+            delete job;
+    }
+    for (Job* job : m_injected)
+        delete job;
+    for (Job* job : m_freeJobs)
+        delete job;
+}
+
+inline bool JobSystem::Deque::push(Job* job) {
+    int64_t bottom {m_bottom.load(std::memory_order_relaxed)};
+    int64_t top {m_top.load(std::memory_order_acquire)};
+    if (bottom - top >= DEQUE_SIZE)
+        return false;
+    m_jobs[bottom & MASK].store(job, std::memory_order_relaxed);
+    m_bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+}
+
+inline JobSystem::Job* JobSystem::Deque::pop() {
+    int64_t bottom {m_bottom.load(std::memory_order_relaxed) - 1};
+    // seq_cst so a thief can't miss the claim on the bottom job
+    m_bottom.store(bottom, std::memory_order_seq_cst);
+    int64_t top {m_top.load(std::memory_order_seq_cst)};
+    if (top > bottom) {
+        // empty
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    Job* job {m_jobs[bottom & MASK].load(std::memory_order_relaxed)};
+    if (top == bottom) {
+        // the last job, a thief may be after it too
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed))
+            job = nullptr;
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+inline JobSystem::Job* JobSystem::Deque::steal() {
+    int64_t top {m_top.load(std::memory_order_seq_cst)};
+    int64_t bottom {m_bottom.load(std::memory_order_seq_cst)};
+    if (top >= bottom)
+        return nullptr;
+    Job* job {m_jobs[top & MASK].load(std::memory_order_relaxed)};
+    // lost to the owner or another thief
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed))
+        return nullptr;
+    return job;
+}
+
+inline void JobSystem::run(std::function<void()> task, JobCounter* counter) {
+    if (counter)
+        counter->m_count.fetch_add(1, std::memory_order_relaxed);
+    submit(makeJob(std::move(task), counter));
+}
+
+inline void JobSystem::runAfter(JobCounter& dependency, std::function<void()> task, JobCounter* counter) {
+    if (counter)
+        counter->m_count.fetch_add(1, std::memory_order_relaxed);
+    Job* job {makeJob(std::move(task), counter)};
+    {
+        std::lock_guard<std::mutex> lock {m_continuationMutex};
+        if (!dependency.done()) {
+            dependency.m_continuations.push_back(job);
+            return;
+        }
+    }
+    submit(job);
+}
+
+inline JobSystem::Job* JobSystem::makeJob(std::function<void()>&& task, JobCounter* counter) {
+    Job* job {nullptr};
+    {
+        std::lock_guard<std::mutex> lock {m_freeMutex};
+        if (!m_freeJobs.empty()) {
+            job = m_freeJobs.back();
+            m_freeJobs.pop_back();
+        }
+    }
+    if (!job)
+        job = new Job {};
+    job->task = std::move(task);
+    job->counter = counter;
+    return job;
+}
+
+inline void JobSystem::freeJob(Job* job) {
+    // let go of the captures now rather than when the job is next used
+    job->task = nullptr;
+    std::lock_guard<std::mutex> lock {m_freeMutex};
+    m_freeJobs.push_back(job);
+}
+
+inline void JobSystem::submit(Job* job) {
+    if (m_workers.empty()) {
+        execute(job);
+        return;
+    }
+
+    int index {threadIndex()};
+    if (index >= 0) {
+        if (!m_deques[index]->push(job)) {
+            execute(job);
+            return;
+        }
+    }
+    else {
+        std::lock_guard<std::mutex> lock {m_injectedMutex};
+        m_injected.push_back(job);
+    }
+
+    // a sleeping worker either sees m_queued go up before it sleeps, or is
+    // already waiting when we take the lock to wake it
+    m_queued.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleeping.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock {m_sleepMutex};
+        m_wake.notify_one();
+    }
+}
+
+inline JobSystem::Job* JobSystem::take() {
+    int index {threadIndex()};
+    int count {static_cast<int>(m_deques.size())};
+    Job* job {nullptr};
+    if (index >= 0 && index < count)
+        job = m_deques[index]->pop();
+
+    // then everyone else's, starting from the next one along
+    for (int i = 1; !job && i <= count; ++i) {
+        int victim {(std::max(index, 0) + i) % count};
+        if (victim != index)
+            job = m_deques[victim]->steal();
+    }
+
+    if (!job) {
+        std::lock_guard<std::mutex> lock {m_injectedMutex};
+        if (!m_injected.empty()) {
+            job = m_injected.front();
+            m_injected.pop_front();
+        }
+    }
+
+    if (job)
+        m_queued.fetch_sub(1, std::memory_order_relaxed);
+    return job;
+}
+
+inline void JobSystem::execute(Job* job) {
+    job->task();
+    JobCounter* counter {job->counter};
+    freeJob(job);
+    if (!counter)
+        return;
+
+    // the continuations come off before the count drops, a waiter can
+    // destroy the counter as soon as it reads zero
+    std::vector<Job*> ready;
+    {
+        std::lock_guard<std::mutex> lock {m_continuationMutex};
+        if (counter->m_count.load(std::memory_order_relaxed) == 1)
+            ready.swap(counter->m_continuations);
+        counter->m_count.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    for (Job* next : ready)
+        submit(next);
+}
+
+inline void JobSystem::wait(JobCounter& counter) {
+    while (!counter.done()) {
+        if (Job* job = take())
+            execute(job);
+        else
+            std::this_thread::yield();
+    }
+}
+
+inline void JobSystem::workerLoop(int index) {
+    threadIndex() = index;
+    while (!m_stopping.load(std::memory_order_relaxed)) {
+        if (Job* job = take()) {
+            execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock {m_sleepMutex};
+        m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+        m_wake.wait(lock, [this] {
+            return m_stopping.load() || m_queued.load(std::memory_order_seq_cst) > 0;
+        });
+        m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename Body>
+inline void JobSystem::parallelFor(int first, int last, int grain, Body&& body) {
+    if (first >= last)
+        return;
+    int count {last - first};
+    grain = std::max(grain, 1);
+    // no more pieces than threads, and no piece smaller than grain
+    int pieces {std::min(static_cast<int>(threadCount()), (count + grain - 1) / grain)};
+    if (pieces <= 1) {
+        body(first, last);
+        return;
+    }
+
+    int perPiece {(count + pieces - 1) / pieces};
+    JobCounter counter;
+    for (int begin = first + perPiece; begin < last; begin += perPiece) {
+        int end {std::min(begin + perPiece, last)};
+        run([&body, begin, end] { body(begin, end); }, &counter);
+    }
+    body(first, std::min(first + perPiece, last));
+    wait(counter);
+}
+}
+#endif
@@ -0,0 +1,98 @@
+#ifndef NORMAL_MATRIX_H
+#define NORMAL_MATRIX_H
+
+/* Normal matrices computed on the CPU
+ * The lit shaders used to do mat3(transpose(inverse(model))) for every vertex
+ * even though the result only changes once per draw. These helpers compute it
+ * once per object instead and hand it over in the vs_params uniform block.
+ *
+ * The result is stored in a mat4 (upper 3x3, w column = 0,0,0,1) because that
+ * is what the std140 uniform blocks and glm::mat4 ctype expect; the shaders
+ * just take mat3(normalMatrix).
+ */
+#include <cstddef>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+// emscripten maps these onto wasm simd128 when built with -msse -msimd128
+#include <xmmintrin.h>
+#define SJD_NORMAL_MATRIX_SSE
+#endif
+
+namespace sjd {
+
+// transpose(inverse(M)) of the upper 3x3 is the cofactor matrix over the
+// determinant, and the cofactor columns are just cross products of M's columns
+inline glm::mat4 normalMatrix(const glm::mat4& model) {
+    glm::vec3 c0 {model[0]};
+    glm::vec3 c1 {model[1]};
+    glm::vec3 c2 {model[2]};
+
+    glm::vec3 r0 {glm::cross(c1, c2)};
+    glm::vec3 r1 {glm::cross(c2, c0)};
+    glm::vec3 r2 {glm::cross(c0, c1)};
+    float invDet {1.0f / glm::dot(c0, r0)};
+
+    return glm::mat4(glm::vec4(r0 * invDet, 0.0f),
+                     glm::vec4(r1 * invDet, 0.0f),
+                     glm::vec4(r2 * invDet, 0.0f),
+                     glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+// computes normal matrices for count models, four at a time when SSE is
+// available. models and normalMatrices must not overlap.
+inline void computeNormalMatrices(const glm::mat4* models,
+                                  glm::mat4* normalMatrices,
+                                  size_t count) {
+    size_t i {0};
+#ifdef SJD_NORMAL_MATRIX_SSE
+    for (; i + 4 <= count; i += 4) {
+        // load column j of four matrices and transpose so each register holds
+        // one component (x, y, z, w) of that column for all four matrices
+        __m128 c[3][4];
+        for (int j = 0; j < 3; ++j) {
+            c[j][0] = _mm_loadu_ps(&models[i + 0][j][0]);
+            c[j][1] = _mm_loadu_ps(&models[i + 1][j][0]);
+            c[j][2] = _mm_loadu_ps(&models[i + 2][j][0]);
+            c[j][3] = _mm_loadu_ps(&models[i + 3][j][0]);
+            _MM_TRANSPOSE4_PS(c[j][0], c[j][1], c[j][2], c[j][3]);
+        }
+
+        auto cross = [](const __m128* a, const __m128* b, __m128* out) {
+            out[0] = _mm_sub_ps(_mm_mul_ps(a[1], b[2]), _mm_mul_ps(a[2], b[1]));
+            out[1] = _mm_sub_ps(_mm_mul_ps(a[2], b[0]), _mm_mul_ps(a[0], b[2]));
+            out[2] = _mm_sub_ps(_mm_mul_ps(a[0], b[1]), _mm_mul_ps(a[1], b[0]));
+        };
+        __m128 r[3][4];
+        cross(c[1], c[2], r[0]);
+        cross(c[2], c[0], r[1]);
+        cross(c[0], c[1], r[2]);
+
+        __m128 det {_mm_add_ps(_mm_add_ps(_mm_mul_ps(c[0][0], r[0][0]),
+                                          _mm_mul_ps(c[0][1], r[0][1])),
+                               _mm_mul_ps(c[0][2], r[0][2]))};
+        __m128 invDet {_mm_div_ps(_mm_set1_ps(1.0f), det)};
+
+        for (int j = 0; j < 3; ++j) {
+            r[j][0] = _mm_mul_ps(r[j][0], invDet);
+            r[j][1] = _mm_mul_ps(r[j][1], invDet);
+            r[j][2] = _mm_mul_ps(r[j][2], invDet);
+            r[j][3] = _mm_setzero_ps();
+            // back to one column per register, one register per matrix
+            _MM_TRANSPOSE4_PS(r[j][0], r[j][1], r[j][2], r[j][3]);
+            for (int k = 0; k < 4; ++k) {
+                _mm_storeu_ps(&normalMatrices[i + k][j][0], r[j][k]);
+            }
+        }
+        for (int k = 0; k < 4; ++k) {
+            normalMatrices[i + k][3] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+    }
+#endif
+    for (; i < count; ++i) {
+        normalMatrices[i] = normalMatrix(models[i]);
+    }
+}
+
+}
+#endif
@@ -0,0 +1,388 @@
+#ifndef OCCLUSION_H
+#define OCCLUSION_H
+
+/* Masked software occlusion culling
+ * After Hasselgren, Andersson & Akenine-Moller, "Masked Software Occlusion
+ * Culling" (HPG 2016). A few big, low poly occluders (walls, floors, large
+ * crates) are rasterised on the CPU into a small depth buffer, then objects
+ * test their bounding boxes against it and only the ones that might be seen
+ * get drawn. WebGL2 has no occlusion queries that don't stall the pipeline,
+ * this doesn't need the GPU at all.
+ *
+ * The buffer is WIDTH x HEIGHT pixels in 8x4 tiles, and a tile doesn't keep
+ * per pixel depths. It has a coverage mask (one bit per pixel) and two
+ * depths: zMax0, the farthest depth anywhere in the tile, and a working
+ * layer, the farthest depth of the pixels in the mask. Once the mask is
+ * full the working layer becomes the new zMax0. A triangle much nearer than
+ * the working layer throws the layer away rather than mixing the two. Tile
+ * depths only ever move nearer and never get nearer than the geometry, so a
+ * test can wrongly say "visible" but never wrongly say "hidden".
+ *
+ * Depth is NDC z mapped to 0 - 1, larger is farther. Occluders are clipped
+ * to the near plane, and coverage is sampled at pixel centres, four pixels
+ * at a time with SSE when it's there. Tile rows don't share any state, so
+ * rasterize() hands them out to the JobSystem workers like
+ * ClusteredLights::bin(). Adding occluders roughly front to back gets
+ * the most out of the working layer.
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <glm/glm.hpp>
+#include <sjd/jobs.h>
+#include <sjd/profiler.h>
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+// emscripten maps these onto wasm simd128 when built with -msse -msimd128
+#include <xmmintrin.h>
+#define SJD_OCCLUSION_SSE
+#endif
+
+namespace sjd {
+class OcclusionCuller {
+public:
+    static constexpr int WIDTH {256};
+    static constexpr int HEIGHT {128};
+    static constexpr int TILE_WIDTH {8};
+    static constexpr int TILE_HEIGHT {4};
+    static constexpr int TILES_X {WIDTH / TILE_WIDTH};
+    static constexpr int TILES_Y {HEIGHT / TILE_HEIGHT};
+
+    // counts for the current frame, begin() resets them
+    struct Stats {
+        uint32_t occluderTriangles {};
+        uint32_t tests {};
+        uint32_t culled {};
+    };
+
+    // clears the buffer for a new frame
+    void begin(const glm::mat4& viewProjection);
+
+    // a triangle list, three vertices per triangle
+    void addOccluder(const std::vector<glm::vec3>& triangles, const glm::mat4& model);
+
+    // threadCount > 1 splits the tile rows over that many of the
+    // JobSystem's threads
+    void rasterize(unsigned threadCount = 1);
+    void rasterizeRows(int firstRow, int lastRow);
+
+    // false when the box is hidden behind the occluders or off screen.
+    // Call after rasterize().
+    bool boxVisible(const glm::vec3& min,
+                    const glm::vec3& max,
+                    const glm::mat4& model = glm::mat4(1.0f));
+
+    // the conservative depth of a tile, for debugging
+    float tileDepth(int tileX, int tileY) const {
+        return m_tiles[tileY * TILES_X + tileX].zMax0;
+    }
+
+    const Stats& stats() const {
+        return m_stats;
+    }
+
+    void report() const;
+
+private:
+    static constexpr uint32_t FULL_MASK {0xffffffffu};
+
+    struct Triangle {
+        // inside where a * x + b * y + c >= 0 for all three edges
+        float a[3];
+        float b[3];
+        float c[3];
+        // depth = dzdx * x + dzdy * y + z0
+        float dzdx;
+        float dzdy;
+        float z0;
+        float zMax;
+        int tileX0;
+        int tileY0;
+        int tileX1;
+        int tileY1;
+    };
+
+    struct Tile {
+        float zMax0;
+        float zMax1;
+        uint32_t mask;
+    };
+
+    void clipTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2);
+    void setupTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2);
+    static uint32_t coverage(const Triangle& triangle, int tileX, int tileY);
+    static float tileMaxDepth(const Triangle& triangle, int tileX, int tileY);
+    static void updateTile(Tile& tile, uint32_t mask, float zMax);
+
+    glm::mat4 m_viewProjection {1.0f};
+    std::vector<Triangle> m_triangles;
+    std::vector<Tile> m_tiles {std::vector<Tile>(TILES_X * TILES_Y)};
+    Stats m_stats {};
+};
+
+inline void OcclusionCuller::begin(const glm::mat4& viewProjection) {
+    m_viewProjection = viewProjection;
+    m_triangles.clear();
+    std::fill(m_tiles.begin(), m_tiles.end(), Tile {1.0f, 0.0f, 0u});
+    m_stats = Stats {};
+}
+
+inline void OcclusionCuller::addOccluder(const std::vector<glm::vec3>& triangles, const glm::mat4& model) {
+    glm::mat4 mvp {m_viewProjection * model};
+    for (size_t i = 0; i + 2 < triangles.size(); i += 3) {
+        clipTriangle(mvp * glm::vec4(triangles[i], 1.0f),
+                     mvp * glm::vec4(triangles[i + 1], 1.0f),
+                     mvp * glm::vec4(triangles[i + 2], 1.0f));
+    }
+}
+
+inline void OcclusionCuller::clipTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2) {
+    // distance in front of the near plane, z = -w in GL clip space
+    const glm::vec4 in[3] {v0, v1, v2};
+    float d[3] {v0.z + v0.w, v1.z + v1.w, v2.z + v2.w};
+    if (d[0] >= 0.0f && d[1] >= 0.0f && d[2] >= 0.0f) {
+        setupTriangle(v0, v1, v2);
+        return;
+    }
+    if (d[0] < 0.0f && d[1] < 0.0f && d[2] < 0.0f)
+        return;
+
+    // one plane cuts a triangle into at most a quad
+    glm::vec4 out[4];
+    int count {0};
+    for (int i = 0; i < 3; ++i) {
+        int j {(i + 1) % 3};
+        if (d[i] >= 0.0f)
+            out[count++] = in[i];
+        if ((d[i] >= 0.0f) != (d[j] >= 0.0f)) {
+            float t {d[i] / (d[i] - d[j])};
+            out[count++] = in[i] + (in[j] - in[i]) * t;
+        }
+    }
+    for (int i = 2; i < count; ++i)
+        setupTriangle(out[0], out[i - 1], out[i]);
+}
+
+inline void OcclusionCuller::setupTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2) {
+    // to pixels and 0 - 1 depth
+    glm::vec3 s[3];
+    const glm::vec4* v[3] {&v0, &v1, &v2};
+    for (int i = 0; i < 3; ++i) {
+        float w {std::max(v[i]->w, 1e-6f)};
+        s[i] = glm::vec3((v[i]->x / w * 0.5f + 0.5f) * WIDTH,
+                         (v[i]->y / w * 0.5f + 0.5f) * HEIGHT,
+                         v[i]->z / w * 0.5f + 0.5f);
+    }
+
+    float area {(s[1].x - s[0].x) * (s[2].y - s[0].y) - (s[2].x - s[0].x) * (s[1].y - s[0].y)};
+    if (std::abs(area) < 1e-6f)
+        return;
+
+    float minX {std::min({s[0].x, s[1].x, s[2].x})};
+    float maxX {std::max({s[0].x, s[1].x, s[2].x})};
+    float minY {std::min({s[0].y, s[1].y, s[2].y})};
+    float maxY {std::max({s[0].y, s[1].y, s[2].y})};
+    if (maxX < 0.0f || maxY < 0.0f || minX >= WIDTH || minY >= HEIGHT)
+        return;
+
+    Triangle triangle {};
+    // either winding works, the edges are flipped so the inside is positive
+    float flip {area > 0.0f ? -1.0f : 1.0f};
+    for (int i = 0; i < 3; ++i) {
+        const glm::vec3& p {s[i]};
+        const glm::vec3& q {s[(i + 1) % 3]};
+        triangle.a[i] = (q.y - p.y) * flip;
+        triangle.b[i] = -(q.x - p.x) * flip;
+        triangle.c[i] = -(triangle.a[i] * p.x + triangle.b[i] * p.y);
+    }
+    float dz1 {s[1].z - s[0].z};
+    float dz2 {s[2].z - s[0].z};
+    triangle.dzdx = (dz1 * (s[2].y - s[0].y) - (s[1].y - s[0].y) * dz2) / area;
+    triangle.dzdy = ((s[1].x - s[0].x) * dz2 - dz1 * (s[2].x - s[0].x)) / area;
+    triangle.z0 = s[0].z - triangle.dzdx * s[0].x - triangle.dzdy * s[0].y;
+    triangle.zMax = std::max({s[0].z, s[1].z, s[2].z});
+
+    triangle.tileX0 = std::clamp(static_cast<int>(minX), 0, WIDTH - 1) / TILE_WIDTH;
+    triangle.tileX1 = std::clamp(static_cast<int>(maxX), 0, WIDTH - 1) / TILE_WIDTH;
+    triangle.tileY0 = std::clamp(static_cast<int>(minY), 0, HEIGHT - 1) / TILE_HEIGHT;
+    triangle.tileY1 = std::clamp(static_cast<int>(maxY), 0, HEIGHT - 1) / TILE_HEIGHT;
+    m_triangles.push_back(triangle);
+    ++m_stats.occluderTriangles;
+}
+
+inline void OcclusionCuller::rasterize(unsigned threadCount) {
+    threadCount = std::clamp(threadCount, 1u, static_cast<unsigned>(TILES_Y));
+    int grain {(TILES_Y + static_cast<int>(threadCount) - 1) / static_cast<int>(threadCount)};
+    JobSystem::instance().parallelFor(0, TILES_Y, grain, [this](int firstRow, int lastRow) {
+        rasterizeRows(firstRow, lastRow);
+    });
+}
+
+inline void OcclusionCuller::rasterizeRows(int firstRow, int lastRow) {
+    SJD_PROFILE_SCOPE("occlusion-rows");
+    for (const Triangle& triangle : m_triangles) {
+        int y0 {std::max(triangle.tileY0, firstRow)};
+        int y1 {std::min(triangle.tileY1, lastRow - 1)};
+        for (int ty = y0; ty <= y1; ++ty) {
+            for (int tx = triangle.tileX0; tx <= triangle.tileX1; ++tx) {
+                uint32_t mask {coverage(triangle, tx, ty)};
+                if (mask != 0)
+                    updateTile(m_tiles[ty * TILES_X + tx], mask, tileMaxDepth(triangle, tx, ty));
+            }
+        }
+    }
+}
+
+inline uint32_t OcclusionCuller::coverage(const Triangle& triangle, int tileX, int tileY) {
+    // pixel centres at the corners of the tile
+    float x0 {tileX * TILE_WIDTH + 0.5f};
+    float x1 {x0 + TILE_WIDTH - 1.0f};
+    float y0 {tileY * TILE_HEIGHT + 0.5f};
+    float y1 {y0 + TILE_HEIGHT - 1.0f};
+
+    // an edge function is linear, so its extremes over the tile are at the
+    // corners: any edge negative at all four misses the tile, all three
+    // positive at all four covers it
+    bool inside {true};
+    for (int i = 0; i < 3; ++i) {
+        float e00 {triangle.a[i] * x0 + triangle.b[i] * y0 + triangle.c[i]};
+        float e10 {triangle.a[i] * x1 + triangle.b[i] * y0 + triangle.c[i]};
+        float e01 {triangle.a[i] * x0 + triangle.b[i] * y1 + triangle.c[i]};
+        float e11 {triangle.a[i] * x1 + triangle.b[i] * y1 + triangle.c[i]};
+        if (std::max({e00, e10, e01, e11}) < 0.0f)
+            return 0;
+        if (std::min({e00, e10, e01, e11}) < 0.0f)
+            inside = false;
+    }
+    if (inside)
+        return FULL_MASK;
+
+    uint32_t mask {0};
+#ifdef SJD_OCCLUSION_SSE
+    __m128 zero {_mm_setzero_ps()};
+    __m128 columns {_mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)};
+    __m128 a[3], b[3], c[3];
+    for (int i = 0; i < 3; ++i) {
+        a[i] = _mm_set1_ps(triangle.a[i]);
+        b[i] = _mm_set1_ps(triangle.b[i]);
+        c[i] = _mm_set1_ps(triangle.c[i]);
+    }
+    for (int row = 0; row < TILE_HEIGHT; ++row) {
+        __m128 py {_mm_set1_ps(y0 + row)};
+        for (int half = 0; half < 2; ++half) {
+            __m128 px {_mm_add_ps(_mm_set1_ps(x0 + half * 4.0f), columns)};
+            __m128 in {_mm_cmpge_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], px), _mm_mul_ps(b[0], py)), c[0]), zero)};
+            for (int i = 1; i < 3; ++i) {
+                __m128 e {_mm_add_ps(_mm_add_ps(_mm_mul_ps(a[i], px), _mm_mul_ps(b[i], py)), c[i])};
+                in = _mm_and_ps(in, _mm_cmpge_ps(e, zero));
+            }
+            mask |= static_cast<uint32_t>(_mm_movemask_ps(in)) << (row * TILE_WIDTH + half * 4);
+        }
+    }
+#else
+    for (int row = 0; row < TILE_HEIGHT; ++row) {
+        float py {y0 + row};
+        for (int column = 0; column < TILE_WIDTH; ++column) {
+            float px {x0 + column};
+            bool in {true};
+            for (int i = 0; i < 3; ++i)
+                in = in && triangle.a[i] * px + triangle.b[i] * py + triangle.c[i] >= 0.0f;
+            if (in)
+                mask |= 1u << (row * TILE_WIDTH + column);
+        }
+    }
+#endif
+    return mask;
+}
+
+inline float OcclusionCuller::tileMaxDepth(const Triangle& triangle, int tileX, int tileY) {
+    // the depth plane is linear too, the farthest point in the tile is a
+    // corner. It can't be farther than the farthest vertex.
+    float x0 {static_cast<float>(tileX * TILE_WIDTH)};
+    float x1 {x0 + TILE_WIDTH};
+    float y0 {static_cast<float>(tileY * TILE_HEIGHT)};
+    float y1 {y0 + TILE_HEIGHT};
+    float zx {triangle.dzdx * (triangle.dzdx > 0.0f ? x1 : x0)};
+    float zy {triangle.dzdy * (triangle.dzdy > 0.0f ? y1 : y0)};
+    return std::min(zx + zy + triangle.z0, triangle.zMax);
+}
+
+inline void OcclusionCuller::updateTile(Tile& tile, uint32_t mask, float zMax) {
+    // already behind everything in the tile
+    if (zMax >= tile.zMax0)
+        return;
+    // much nearer than the working layer, start a new one
+    if (tile.mask != 0 && tile.zMax1 - zMax > tile.zMax0 - tile.zMax1) {
+        tile.zMax1 = 0.0f;
+        tile.mask = 0;
+    }
+    tile.zMax1 = std::max(tile.zMax1, zMax);
+    tile.mask |= mask;
+    if (tile.mask == FULL_MASK) {
+        tile.zMax0 = tile.zMax1;
+        tile.zMax1 = 0.0f;
+        tile.mask = 0;
+    }
+}
+
+inline bool OcclusionCuller::boxVisible(const glm::vec3& min, const glm::vec3& max, const glm::mat4& model) {
+    ++m_stats.tests;
+    glm::mat4 mvp {m_viewProjection * model};
+    float minX {INFINITY}, minY {INFINITY}, minZ {INFINITY};
+    float maxX {-INFINITY}, maxY {-INFINITY};
+    for (int i = 0; i < 8; ++i) {
+        glm::vec4 corner {mvp * glm::vec4(i & 1 ? max.x : min.x,
+                                          i & 2 ? max.y : min.y,
+                                          i & 4 ? max.z : min.z,
+                                          1.0f)};
+        // crosses the near plane, can't say anything
+        if (corner.z + corner.w < 0.0f || corner.w <= 1e-6f)
+            return true;
+        float x {(corner.x / corner.w * 0.5f + 0.5f) * WIDTH};
+        float y {(corner.y / corner.w * 0.5f + 0.5f) * HEIGHT};
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+        minZ = std::min(minZ, corner.z / corner.w * 0.5f + 0.5f);
+    }
+    if (maxX < 0.0f || maxY < 0.0f || minX >= WIDTH || minY >= HEIGHT || minZ > 1.0f) {
+        ++m_stats.culled;
+        return false;
+    }
+
+    // every pixel the box's rectangle touches
+    int px0 {std::clamp(static_cast<int>(std::floor(minX)), 0, WIDTH - 1)};
+    int px1 {std::clamp(static_cast<int>(std::floor(maxX)), 0, WIDTH - 1)};
+    int py0 {std::clamp(static_cast<int>(std::floor(minY)), 0, HEIGHT - 1)};
+    int py1 {std::clamp(static_cast<int>(std::floor(maxY)), 0, HEIGHT - 1)};
+    for (int ty = py0 / TILE_HEIGHT; ty <= py1 / TILE_HEIGHT; ++ty) {
+        for (int tx = px0 / TILE_WIDTH; tx <= px1 / TILE_WIDTH; ++tx) {
+            const Tile& tile {m_tiles[ty * TILES_X + tx]};
+            if (minZ > tile.zMax0)
+                continue;
+            // the working layer only helps if it covers every pixel of the
+            // box in this tile
+            int c0 {std::max(px0 - tx * TILE_WIDTH, 0)};
+            int c1 {std::min(px1 - tx * TILE_WIDTH, TILE_WIDTH - 1)};
+            int r0 {std::max(py0 - ty * TILE_HEIGHT, 0)};
+            int r1 {std::min(py1 - ty * TILE_HEIGHT, TILE_HEIGHT - 1)};
+            uint32_t rowBits {((1u << (c1 - c0 + 1)) - 1u) << c0};
+            uint32_t query {0};
+            for (int r = r0; r <= r1; ++r)
+                query |= rowBits << (r * TILE_WIDTH);
+            if ((query & ~tile.mask) != 0 || minZ <= tile.zMax1)
+                return true;
+        }
+    }
+    ++m_stats.culled;
+    return false;
+}
+
+inline void OcclusionCuller::report() const {
+    std::cout << "OcclusionCuller: " << m_stats.occluderTriangles << " occluder triangles, "
+              << m_stats.culled << " of " << m_stats.tests << " boxes culled\n";
+}
+}
+#endif
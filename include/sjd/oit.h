@@ -0,0 +1,170 @@
+#ifndef OIT_H
+#define OIT_H
+
+/* Weighted blended order-independent transparency
+ * (McGuire & Bavoil, "Weighted Blended Order-Independent Transparency", 2013)
+ *
+ * Transparent geometry is drawn unsorted into two render targets:
+ *   accumulation: RGBA16F, rgb is the sum of premultiplied colour * weight
+ *                 (additive), alpha is the revealage, the product of
+ *                 (1 - alpha) (multiplicative)
+ *   weight:       R16F, sum of alpha * weight (additive)
+ * sharing the depth buffer of the opaque pass, with depth writes off. A
+ * fullscreen composite pass then resolves them over the opaque image.
+ *
+ * The paper keeps revealage in its own target with a different blend state,
+ * which needs independent blending per attachment. GLES3/WebGL2 doesn't have
+ * that (sg_features.mrt_independent_blend_state is false), so the revealage
+ * moves into the accumulation alpha and both targets share one blend state:
+ * rgb is added, alpha is multiplied by (1 - src alpha).
+ *
+ * Nothing gets sorted, so there's no per-frame CPU cost and intersecting
+ * quads blend correctly. The result is an approximation, it's a good fit for
+ * vegetation, windows and particles but not for strongly coloured glass.
+ */
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+namespace sjd {
+class OitTargets {
+public:
+    sg_image accum {};
+    sg_image weight {};
+    sg_sampler sampler {};
+    sg_attachments attachments {};
+
+    // both targets need float formats that can be blended into. WebGL2 only
+    // has those with EXT_color_buffer_float. An 8 bit target would clamp the
+    // weighted sums, so without them there's no OIT and callers have to fall
+    // back to ordinary alpha blending.
+    static bool supported() {
+        sg_pixelformat_info accum {sg_query_pixelformat(SG_PIXELFORMAT_RGBA16F)};
+        sg_pixelformat_info weight {sg_query_pixelformat(SG_PIXELFORMAT_R16F)};
+        return accum.render && accum.blend && weight.render && weight.blend;
+    }
+
+    // called initially and when the window size changes. depthImage is the
+    // depth attachment of the opaque pass, transparent fragments are tested
+    // against it so they don't show through opaque geometry. Does nothing
+    // when supported() is false.
+    void create(int width, int height, sg_image depthImage) {
+        if (!supported())
+            return;
+        // destroy previous resource
+        sg_destroy_attachments(attachments);
+        sg_destroy_image(accum);
+        sg_destroy_image(weight);
+        if (sampler.id == SG_INVALID_ID) {
+            sampler = sg_make_sampler(sg_sampler_desc {
+                .min_filter = SG_FILTER_NEAREST,
+                .mag_filter = SG_FILTER_NEAREST,
+                .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+                .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+                .label = "oit-sampler"
+            });
+        }
+
+        accum = sg_make_image(sg_image_desc {
+            .render_target = true,
+            .width = width,
+            .height = height,
+            .pixel_format = SG_PIXELFORMAT_RGBA16F,
+            .label = "oit-accum-image"
+        });
+        weight = sg_make_image(sg_image_desc {
+            .render_target = true,
+            .width = width,
+            .height = height,
+            .pixel_format = SG_PIXELFORMAT_R16F,
+            .label = "oit-weight-image"
+        });
+
+        attachments = sg_make_attachments(sg_attachments_desc {
+            .colors {
+                { .image = accum },
+                { .image = weight },
+            },
+            .depth_stencil {
+                .image = depthImage,
+            },
+            .label = "oit-pass"
+        });
+    }
+
+    // sums start at zero, revealage at one (nothing covered yet) and the
+    // opaque depth has to be kept
+    static sg_pass_action passAction() {
+        return sg_pass_action {
+            .colors {
+                { .load_action = SG_LOADACTION_CLEAR, .clear_value = {0.0f, 0.0f, 0.0f, 1.0f} },
+                { .load_action = SG_LOADACTION_CLEAR, .clear_value = {0.0f, 0.0f, 0.0f, 0.0f} },
+            },
+            .depth {
+                .load_action = SG_LOADACTION_LOAD,
+                .store_action = SG_STOREACTION_DONTCARE,
+            },
+        };
+    }
+
+    // pipeline preset for drawing transparent geometry into the OIT targets.
+    // The fragment shader writes (colour * alpha * weight, alpha) to location
+    // 0 and alpha * weight to location 1. Both attachments get the same blend
+    // state so it works without independent blending.
+    static sg_pipeline_desc accumulationPipelineDesc(sg_shader shader,
+                                                     const sg_vertex_layout_state& layout) {
+        sg_blend_state blend {
+            .enabled = true,
+            .src_factor_rgb = SG_BLENDFACTOR_ONE,
+            .dst_factor_rgb = SG_BLENDFACTOR_ONE,
+            .src_factor_alpha = SG_BLENDFACTOR_ZERO,
+            .dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+        };
+        sg_pipeline_desc desc {
+            .shader = shader,
+            .layout = layout,
+            .depth {
+                .pixel_format = SG_PIXELFORMAT_DEPTH,
+                .compare = SG_COMPAREFUNC_LESS,
+                .write_enabled = false,
+            },
+            .color_count = 2,
+            .label = "oit-accum-pipeline"
+        };
+        desc.colors[0] = sg_color_target_state {
+            .pixel_format = SG_PIXELFORMAT_RGBA16F,
+            .blend = blend
+        };
+        desc.colors[1] = sg_color_target_state {
+            .pixel_format = SG_PIXELFORMAT_R16F,
+            .blend = blend
+        };
+        return desc;
+    }
+
+    // pipeline preset for the fullscreen composite. The fragment shader
+    // outputs the average colour with alpha = 1 - revealage and is blended
+    // over whatever is already in the render target.
+    static sg_pipeline_desc compositePipelineDesc(sg_shader shader,
+                                                  const sg_vertex_layout_state& layout) {
+        return sg_pipeline_desc {
+            .shader = shader,
+            .layout = layout,
+            .colors = {{
+                .blend = {
+                    .enabled = true,
+                    .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+                    .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                    .src_factor_alpha = SG_BLENDFACTOR_ONE,
+                    .dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                }
+            }},
+            .label = "oit-composite-pipeline"
+        };
+    }
+};
+}
+#endif
@@ -0,0 +1,162 @@
+#ifndef OUTLINE_H
+#define OUTLINE_H
+
+/* Outline
+ * Selection outlines drawn in screen space, the shader is in
+ * include/sjd/glsl/outline.glsl. The scene pass writes an object id into a
+ * second colour attachment (idTarget()), then a single fullscreen pass
+ * copies the scene into the swapchain and draws an outline around every
+ * selected object. Drawing every outlined object again, scaled up, through
+ * a stencil test costs a second trip through the vertex shader per object
+ * and only looks right on convex meshes; this costs the same whatever is
+ * selected and follows any silhouette.
+ *
+ * Ids are 15 bits (1 - 32767, 0 is the background) and selection is the
+ * top bit, so the scene shader just writes the colour idColour() gives it
+ * for each draw. Draws with the same id are one object and get one outline.
+ *
+ * The target is RG8 rather than R16UI: sokol clears colour attachments with
+ * float values, which GL leaves undefined for integer formats.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include <sjd/render_graph.h>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+namespace sjd {
+class Outline {
+public:
+    // bindings in outline.glsl
+    static constexpr int UNIFORM_SLOT {0};
+    static constexpr int SCENE_SLOT {0};
+    static constexpr int ID_SLOT {1};
+    static constexpr int SAMPLER_SLOT {0};
+    static constexpr sg_pixel_format ID_FORMAT {SG_PIXELFORMAT_RG8};
+    static constexpr uint16_t MAX_ID {0x7fff};
+    // pixels, the shader walks at most this far
+    static constexpr int MAX_WIDTH {8};
+
+    struct Settings {
+        // alpha blends the outline over the scene
+        glm::vec4 colour {0.04f, 0.28f, 0.26f, 1.0f};
+        int width {3};
+    };
+
+    // matches the outline_params block
+    struct Params {
+        glm::vec4 colour;
+        glm::vec4 params;
+    };
+
+    // read every frame, so it can be changed while running
+    Settings settings {};
+
+    void setup(sg_shader shader);
+    void shutdown();
+
+    // the id target for the scene pass, clear it to 0
+    static RenderGraph::Target idTarget(RenderGraph& graph);
+
+    // scene with the outlines on top into the swapchain, both targets have
+    // to be the size of the swapchain
+    RenderGraph::PassId addComposite(RenderGraph& graph,
+                                     RenderGraph::Target scene,
+                                     RenderGraph::Target ids,
+                                     const sg_pass_action& action);
+
+    void select(uint16_t id, bool selected);
+
+    bool selected(uint16_t id) const {
+        return id < m_selected.size() && m_selected[id];
+    }
+
+    void clearSelection() {
+        m_selected.clear();
+    }
+
+    // what the scene shader writes into the id target for a draw of object id
+    glm::vec4 idColour(uint16_t id) const;
+
+private:
+    sg_sampler m_sampler {};
+    sg_pipeline m_pipeline {};
+    std::vector<bool> m_selected;
+};
+
+inline void Outline::setup(sg_shader shader) {
+    // ids can't be filtered, a blend of two ids is a third id
+    m_sampler = sg_make_sampler(sg_sampler_desc {
+        .min_filter = SG_FILTER_NEAREST,
+        .mag_filter = SG_FILTER_NEAREST,
+        .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+        .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+        .label = "outline-sampler"
+    });
+    m_pipeline = sg_make_pipeline(sg_pipeline_desc {
+        .shader = shader,
+        .label = "outline-pipeline"
+    });
+}
+
+inline void Outline::shutdown() {
+    sg_destroy_pipeline(m_pipeline);
+    sg_destroy_sampler(m_sampler);
+}
+
+inline RenderGraph::Target Outline::idTarget(RenderGraph& graph) {
+    return graph.createTarget(RenderGraph::TargetDesc {
+        .format = ID_FORMAT,
+        .label = "outline-ids"
+    });
+}
+
+inline RenderGraph::PassId Outline::addComposite(RenderGraph& graph,
+                                                 RenderGraph::Target scene,
+                                                 RenderGraph::Target ids,
+                                                 const sg_pass_action& action) {
+    return graph.addPass(RenderGraph::PassDesc {
+        .name = "outline-composite",
+        .reads = {scene, ids},
+        .swapchain = true,
+        .action = action,
+    }, [this, &graph, scene, ids] {
+        // thin outlines look gappy with fewer directions, thick ones need more
+        int width {std::clamp(settings.width, 0, MAX_WIDTH)};
+        Params params {
+            .colour = settings.colour,
+            .params = glm::vec4(static_cast<float>(width), width > 2 ? 16.0f : 8.0f, 0.0f, 0.0f),
+        };
+        sg_bindings bindings {};
+        bindings.images[SCENE_SLOT] = graph.image(scene);
+        bindings.images[ID_SLOT] = graph.image(ids);
+        bindings.samplers[SAMPLER_SLOT] = m_sampler;
+        sg_apply_pipeline(m_pipeline);
+        sg_apply_bindings(bindings);
+        sg_apply_uniforms(UNIFORM_SLOT, SG_RANGE(params));
+        sg_draw(0, 3, 1);
+    });
+}
+
+inline void Outline::select(uint16_t id, bool selected) {
+    if (id == 0 || id > MAX_ID)
+        return;
+    if (id >= m_selected.size())
+        m_selected.resize(id + 1, false);
+    m_selected[id] = selected;
+}
+
+inline glm::vec4 Outline::idColour(uint16_t id) const {
+    uint32_t value {std::min<uint32_t>(id, MAX_ID)};
+    if (selected(id))
+        value |= 0x8000u;
+    return glm::vec4((value & 0xffu) / 255.0f, (value >> 8) / 255.0f, 0.0f, 0.0f);
+}
+}
+#endif
@@ -0,0 +1,446 @@
+#ifndef POST_H
+#define POST_H
+
+/* PostProcess
+ * Blur and bloom passes for a RenderGraph, the shaders are in
+ * include/sjd/glsl/post.glsl. A demo includes that file in its own .glsl and
+ * passes the shaders it generates to setup().
+ *
+ * Gaussian blur: two passes (horizontal, then vertical) at a reduced
+ * resolution. The weights are worked out on the CPU for the requested sigma
+ * and neighbouring taps are merged into one bilinear fetch, so a kernel
+ * 33 texels wide costs 17 fetches per pass.
+ *
+ * Dual Kawase blur and bloom: a chain of half-size downsamples followed by
+ * the matching upsamples, 5 and 8 fetches per pixel at ever smaller sizes.
+ * Bloom thresholds the first downsample and adds the result back onto the
+ * scene in the composite pass.
+ *
+ * Upscale: draws a scene rendered below the swapchain size (see
+ * sjd/dynamic_resolution.h) into the swapchain, sharpening it on the way so
+ * the lower resolution doesn't just look blurry.
+ *
+ * Every pass gets the texel size of its input from the graph, so blurs stay
+ * the same width in pixels whatever size the window is. Shaders left out of
+ * setup() don't get a pipeline, a demo only needs the ones it uses.
+ */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <sjd/render_graph.h>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+namespace sjd {
+class PostProcess {
+public:
+    // bindings shared by every program in post.glsl
+    static constexpr int UNIFORM_SLOT {0};
+    static constexpr int SOURCE_SLOT {0};
+    static constexpr int BLOOM_SLOT {1};
+    static constexpr int SAMPLER_SLOT {0};
+    // tap pairs in the Gaussian shader
+    static constexpr int MAX_PAIRS {8};
+
+    struct Shaders {
+        sg_shader gaussian;
+        sg_shader kawaseDown;
+        sg_shader kawaseUp;
+        sg_shader bloomPrefilter;
+        sg_shader bloomComposite;
+        sg_shader copy;
+        sg_shader upscale;
+    };
+
+    // matches the post_params block
+    struct Params {
+        glm::vec4 texel;
+        glm::vec4 offsets[2];
+        glm::vec4 weights[2];
+        glm::vec4 params;
+    };
+
+    struct GaussianSettings {
+        // in texels of the blurred target, clamped to what 8 pairs can cover
+        float sigma {4.0f};
+    };
+
+    struct KawaseSettings {
+        // more than 1 spreads the taps further for a wider blur
+        float spread {1.0f};
+    };
+
+    struct BloomSettings {
+        float threshold {1.0f};
+        // how far below the threshold the soft knee starts, 0 - 1
+        float knee {0.5f};
+        float intensity {0.6f};
+        float spread {1.0f};
+        // for HDR targets, 0 leaves the colour alone
+        float exposure {1.0f};
+    };
+
+    struct UpscaleSettings {
+        // 0 - 1, how hard the upscaled image is sharpened
+        float sharpness {0.5f};
+    };
+
+    // read every frame, so they can be changed while running
+    GaussianSettings gaussian {};
+    KawaseSettings kawase {};
+    BloomSettings bloom {};
+    UpscaleSettings upscale {};
+
+    // a float target when the blend/render support is there, bloom wants
+    // values above 1
+    static sg_pixel_format hdrFormat() {
+        sg_pixelformat_info info {sg_query_pixelformat(SG_PIXELFORMAT_RGBA16F)};
+        if (info.render && info.filter)
+            return SG_PIXELFORMAT_RGBA16F;
+        return SG_PIXELFORMAT_RGBA8;
+    }
+
+    // format is the format of every target the passes create
+    void setup(const Shaders& shaders, sg_pixel_format format);
+    void shutdown();
+
+    // blurs source into a new target scale times the size of the swapchain
+    RenderGraph::Target addGaussianBlur(RenderGraph& graph,
+                                        RenderGraph::Target source,
+                                        float scale = 0.5f);
+
+    // downsamples source `iterations` times then upsamples it back to half
+    // the size of the swapchain
+    RenderGraph::Target addKawaseBlur(RenderGraph& graph,
+                                      RenderGraph::Target source,
+                                      int iterations = 4);
+
+    // the bloom target to pass to addBloomComposite, half the swapchain size
+    RenderGraph::Target addBloom(RenderGraph& graph,
+                                 RenderGraph::Target scene,
+                                 int levels = 5);
+
+    // scene + bloom (tone mapped when bloom.exposure > 0) into the swapchain
+    RenderGraph::PassId addBloomComposite(RenderGraph& graph,
+                                          RenderGraph::Target scene,
+                                          RenderGraph::Target bloomTarget,
+                                          const sg_pass_action& action);
+
+    // draws source into the swapchain
+    RenderGraph::PassId addCopy(RenderGraph& graph,
+                                RenderGraph::Target source,
+                                const sg_pass_action& action);
+
+    // draws source into the swapchain, sharpened with upscale.sharpness.
+    // Meant for a scene target that's smaller than the swapchain.
+    RenderGraph::PassId addUpscale(RenderGraph& graph,
+                                   RenderGraph::Target source,
+                                   const sg_pass_action& action);
+
+    // merged bilinear taps for a Gaussian of the given sigma (in texels)
+    static Params gaussianWeights(float sigma);
+
+private:
+    enum Direction { HORIZONTAL, VERTICAL };
+
+    void draw(const RenderGraph& graph,
+              sg_pipeline pipeline,
+              RenderGraph::Target source,
+              const Params& params) const;
+    RenderGraph::Target addTarget(RenderGraph& graph, float scale, const char* label);
+
+    sg_pixel_format m_format {SG_PIXELFORMAT_RGBA8};
+    sg_sampler m_sampler {};
+    sg_pipeline m_gaussian {};
+    sg_pipeline m_kawaseDown {};
+    sg_pipeline m_kawaseUp {};
+    sg_pipeline m_bloomPrefilter {};
+    sg_pipeline m_bloomComposite {};
+    sg_pipeline m_copy {};
+    sg_pipeline m_upscale {};
+};
+
+inline void PostProcess::setup(const Shaders& shaders, sg_pixel_format format) {
+    m_format = format;
+    m_sampler = sg_make_sampler(sg_sampler_desc {
+        .min_filter = SG_FILTER_LINEAR,
+        .mag_filter = SG_FILTER_LINEAR,
+        .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+        .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+        .label = "post-sampler"
+    });
+
+    // no vertex buffers, the vertex shader makes a fullscreen triangle from
+    // the vertex index. Offscreen passes have no depth buffer.
+    auto offscreen = [&](sg_shader shader, const char* label) {
+        if (shader.id == SG_INVALID_ID)
+            return sg_pipeline {};
+        return sg_make_pipeline(sg_pipeline_desc {
+            .shader = shader,
+            .depth {
+                .pixel_format = SG_PIXELFORMAT_NONE,
+            },
+            .colors = {{
+                .pixel_format = m_format,
+            }},
+            .label = label
+        });
+    };
+    m_gaussian = offscreen(shaders.gaussian, "post-gaussian-pipeline");
+    m_kawaseDown = offscreen(shaders.kawaseDown, "post-kawase-down-pipeline");
+    m_kawaseUp = offscreen(shaders.kawaseUp, "post-kawase-up-pipeline");
+    m_bloomPrefilter = offscreen(shaders.bloomPrefilter, "post-bloom-prefilter-pipeline");
+    auto swapchain = [](sg_shader shader, const char* label) {
+        if (shader.id == SG_INVALID_ID)
+            return sg_pipeline {};
+        return sg_make_pipeline(sg_pipeline_desc {
+            .shader = shader,
+            .label = label
+        });
+    };
+    m_bloomComposite = swapchain(shaders.bloomComposite, "post-bloom-composite-pipeline");
+    m_copy = swapchain(shaders.copy, "post-copy-pipeline");
+    m_upscale = swapchain(shaders.upscale, "post-upscale-pipeline");
+}
+
+inline void PostProcess::shutdown() {
+    sg_destroy_pipeline(m_gaussian);
+    sg_destroy_pipeline(m_kawaseDown);
+    sg_destroy_pipeline(m_kawaseUp);
+    sg_destroy_pipeline(m_bloomPrefilter);
+    sg_destroy_pipeline(m_bloomComposite);
+    sg_destroy_pipeline(m_copy);
+    sg_destroy_pipeline(m_upscale);
+    sg_destroy_sampler(m_sampler);
+}
+
+inline PostProcess::Params PostProcess::gaussianWeights(float sigma) {
+    // 3 sigma either side holds 99.7% of the curve
+    sigma = std::clamp(sigma, 0.5f, 2.0f * MAX_PAIRS / 3.0f);
+    int radius {std::min(static_cast<int>(std::ceil(sigma * 3.0f)), 2 * MAX_PAIRS)};
+
+    std::array<float, 2 * MAX_PAIRS + 1> discrete {};
+    float total {0.0f};
+    for (int i = 0; i <= radius; ++i) {
+        discrete[i] = std::exp(-0.5f * i * i / (sigma * sigma));
+        total += i == 0 ? discrete[i] : 2.0f * discrete[i];
+    }
+
+    Params params {};
+    params.params.x = discrete[0] / total;
+    // a fetch between texels i and i + 1 at the right spot returns their
+    // weighted sum, so one tap does the work of two
+    int pairs {0};
+    for (int i = 1; i <= radius; i += 2) {
+        float w0 {discrete[i] / total};
+        float w1 {i + 1 <= radius ? discrete[i + 1] / total : 0.0f};
+        float weight {w0 + w1};
+        params.offsets[pairs / 4][pairs % 4] = (i * w0 + (i + 1) * w1) / weight;
+        params.weights[pairs / 4][pairs % 4] = weight;
+        ++pairs;
+    }
+    params.params.y = static_cast<float>(pairs);
+    return params;
+}
+
+inline void PostProcess::draw(const RenderGraph& graph,
+                              sg_pipeline pipeline,
+                              RenderGraph::Target source,
+                              const Params& params) const {
+    sg_bindings bindings {};
+    bindings.images[SOURCE_SLOT] = graph.image(source);
+    bindings.samplers[SAMPLER_SLOT] = m_sampler;
+    sg_apply_pipeline(pipeline);
+    sg_apply_bindings(bindings);
+    sg_apply_uniforms(UNIFORM_SLOT, SG_RANGE(params));
+    sg_draw(0, 3, 1);
+}
+
+inline RenderGraph::Target PostProcess::addTarget(RenderGraph& graph, float scale, const char* label) {
+    return graph.createTarget(RenderGraph::TargetDesc {
+        .format = m_format,
+        .scale = scale,
+        .label = label
+    });
+}
+
+inline RenderGraph::Target PostProcess::addGaussianBlur(RenderGraph& graph,
+                                                        RenderGraph::Target source,
+                                                        float scale) {
+    RenderGraph::Target horizontal {addTarget(graph, scale, "post-gaussian-h")};
+    RenderGraph::Target vertical {addTarget(graph, scale, "post-gaussian-v")};
+
+    // taps are spaced in texels of the blurred target, the first pass reads
+    // the (bigger) source and downsamples on the way
+    auto blur = [this, &graph, horizontal](RenderGraph::Target input, Direction direction) {
+        Params params {gaussianWeights(gaussian.sigma)};
+        if (direction == HORIZONTAL)
+            params.texel = glm::vec4(1.0f / graph.width(horizontal), 0.0f, 0.0f, 0.0f);
+        else
+            params.texel = glm::vec4(0.0f, 1.0f / graph.height(horizontal), 0.0f, 0.0f);
+        draw(graph, m_gaussian, input, params);
+    };
+
+    sg_pass_action action {
+        .colors = {{ .load_action = SG_LOADACTION_DONTCARE }}
+    };
+    graph.addPass(RenderGraph::PassDesc {
+        .name = "post-gaussian-h",
+        .colors = {horizontal},
+        .reads = {source},
+        .action = action,
+    }, [blur, source] { blur(source, HORIZONTAL); });
+    graph.addPass(RenderGraph::PassDesc {
+        .name = "post-gaussian-v",
+        .colors = {vertical},
+        .reads = {horizontal},
+        .action = action,
+    }, [blur, horizontal] { blur(horizontal, VERTICAL); });
+    return vertical;
+}
+
+inline RenderGraph::Target PostProcess::addKawaseBlur(RenderGraph& graph,
+                                                      RenderGraph::Target source,
+                                                      int iterations) {
+    iterations = std::max(iterations, 1);
+    sg_pass_action action {
+        .colors = {{ .load_action = SG_LOADACTION_DONTCARE }}
+    };
+
+    auto pass = [this, &graph](sg_pipeline pipeline, RenderGraph::Target input) {
+        return [this, &graph, pipeline, input] {
+            Params params {};
+            params.texel = glm::vec4(1.0f / graph.width(input), 1.0f / graph.height(input), kawase.spread, 0.0f);
+            draw(graph, pipeline, input, params);
+        };
+    };
+
+    RenderGraph::Target input {source};
+    float scale {1.0f};
+    for (int i = 0; i < iterations; ++i) {
+        scale *= 0.5f;
+        RenderGraph::Target level {addTarget(graph, scale, "post-kawase-down")};
+        graph.addPass(RenderGraph::PassDesc {
+            .name = "post-kawase-down",
+            .colors = {level},
+            .reads = {input},
+            .action = action,
+        }, pass(m_kawaseDown, input));
+        input = level;
+    }
+    for (int i = iterations - 2; i >= 0; --i) {
+        RenderGraph::Target level {addTarget(graph, std::ldexp(1.0f, -(i + 1)), "post-kawase-up")};
+        graph.addPass(RenderGraph::PassDesc {
+            .name = "post-kawase-up",
+            .colors = {level},
+            .reads = {input},
+            .action = action,
+        }, pass(m_kawaseUp, input));
+        input = level;
+    }
+    return input;
+}
+
+inline RenderGraph::Target PostProcess::addBloom(RenderGraph& graph,
+                                                 RenderGraph::Target scene,
+                                                 int levels) {
+    levels = std::max(levels, 1);
+    sg_pass_action action {
+        .colors = {{ .load_action = SG_LOADACTION_DONTCARE }}
+    };
+
+    auto pass = [this, &graph](sg_pipeline pipeline, RenderGraph::Target input) {
+        return [this, &graph, pipeline, input] {
+            Params params {};
+            params.texel = glm::vec4(1.0f / graph.width(input), 1.0f / graph.height(input), bloom.spread, 0.0f);
+            params.params = glm::vec4(bloom.threshold, bloom.knee, 0.0f, 0.0f);
+            draw(graph, pipeline, input, params);
+        };
+    };
+
+    RenderGraph::Target input {scene};
+    float scale {1.0f};
+    for (int i = 0; i < levels; ++i) {
+        scale *= 0.5f;
+        RenderGraph::Target level {addTarget(graph, scale, "post-bloom-down")};
+        graph.addPass(RenderGraph::PassDesc {
+            .name = i == 0 ? "post-bloom-prefilter" : "post-bloom-down",
+            .colors = {level},
+            .reads = {input},
+            .action = action,
+        }, pass(i == 0 ? m_bloomPrefilter : m_kawaseDown, input));
+        input = level;
+    }
+    for (int i = levels - 2; i >= 0; --i) {
+        RenderGraph::Target level {addTarget(graph, std::ldexp(1.0f, -(i + 1)), "post-bloom-up")};
+        graph.addPass(RenderGraph::PassDesc {
+            .name = "post-bloom-up",
+            .colors = {level},
+            .reads = {input},
+            .action = action,
+        }, pass(m_kawaseUp, input));
+        input = level;
+    }
+    return input;
+}
+
+inline RenderGraph::PassId PostProcess::addBloomComposite(RenderGraph& graph,
+                                                          RenderGraph::Target scene,
+                                                          RenderGraph::Target bloomTarget,
+                                                          const sg_pass_action& action) {
+    return graph.addPass(RenderGraph::PassDesc {
+        .name = "post-bloom-composite",
+        .reads = {scene, bloomTarget},
+        .swapchain = true,
+        .action = action,
+    }, [this, &graph, scene, bloomTarget] {
+        Params params {};
+        params.params = glm::vec4(0.0f, 0.0f, bloom.intensity, bloom.exposure);
+        sg_bindings bindings {};
+        bindings.images[SOURCE_SLOT] = graph.image(scene);
+        bindings.images[BLOOM_SLOT] = graph.image(bloomTarget);
+        bindings.samplers[SAMPLER_SLOT] = m_sampler;
+        sg_apply_pipeline(m_bloomComposite);
+        sg_apply_bindings(bindings);
+        sg_apply_uniforms(UNIFORM_SLOT, SG_RANGE(params));
+        sg_draw(0, 3, 1);
+    });
+}
+
+inline RenderGraph::PassId PostProcess::addCopy(RenderGraph& graph,
+                                                RenderGraph::Target source,
+                                                const sg_pass_action& action) {
+    return graph.addPass(RenderGraph::PassDesc {
+        .name = "post-copy",
+        .reads = {source},
+        .swapchain = true,
+        .action = action,
+    }, [this, &graph, source] {
+        draw(graph, m_copy, source, Params {});
+    });
+}
+
+inline RenderGraph::PassId PostProcess::addUpscale(RenderGraph& graph,
+                                                   RenderGraph::Target source,
+                                                   const sg_pass_action& action) {
+    return graph.addPass(RenderGraph::PassDesc {
+        .name = "post-upscale",
+        .reads = {source},
+        .swapchain = true,
+        .action = action,
+    }, [this, &graph, source] {
+        // the sharpening taps are a texel of the source apart, not of the
+        // swapchain
+        Params params {};
+        params.texel = glm::vec4(1.0f / graph.width(source), 1.0f / graph.height(source), 0.0f, 0.0f);
+        params.params = glm::vec4(std::clamp(upscale.sharpness, 0.0f, 1.0f), 0.0f, 0.0f, 0.0f);
+        draw(graph, m_upscale, source, params);
+    });
+}
+}
+#endif
@@ -0,0 +1,398 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/* Profiler
+ * Scoped CPU timing markers on stm_now(), for seeing where a frame goes:
+ *
+ *   SJD_PROFILE_SCOPE("bin-lights");
+ *
+ * times the rest of the enclosing block. Every thread records into its own
+ * ring buffer, so recording takes no locks (a thread only takes one the
+ * first time it records). Markers are only kept while the profiler is
+ * enabled, when it isn't a scope costs a load and a branch.
+ *
+ * beginFrame()/endFrame() bracket a frame on the main thread. endFrame()
+ * adds up the markers recorded since the last one, per name, for report().
+ * Once every name has been seen it does that without allocating.
+ * writeTrace() saves whatever the ring buffers still hold as Chrome
+ * trace_event JSON, which chrome://tracing, Perfetto and Speedscope open.
+ * It reads the other threads' buffers, so call it between frames while the
+ * workers are idle.
+ *
+ * RenderGraph times every pass it runs and sjd::App times sfetch_dowork and
+ * sg_commit. Marker names have to outlive the profiler: string literals, or
+ * intern() anything else.
+ *
+ * stm_setup() has to have been called before enabling it.
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <sokol/sokol_time.h>
+
+namespace sjd {
+class Profiler {
+public:
+    // events each thread keeps, older ones are overwritten
+    static constexpr uint32_t RING_SIZE {1u << 14};
+    // names endFrame() adds up, any more are left out of the report
+    static constexpr uint32_t MAX_MARKERS {256};
+
+    struct Event {
+        const char* name;
+        uint64_t start;
+        uint64_t end;
+        uint32_t thread;
+    };
+
+    // one marker name added up over the frames since enable()
+    struct MarkerStats {
+        std::string name;
+        double totalMs {};
+        double maxFrameMs {};
+        uint64_t calls {};
+    };
+
+    // never destroyed. Threads give their buffers back from a thread_local
+    // destructor, and a JobSystem made before the profiler joins its workers
+    // after the profiler's static destructor would have run.
+    static Profiler& instance() {
+        static Profiler* profiler {new Profiler()};
+        return *profiler;
+    }
+
+    void enable();
+    void disable() {
+        m_enabled.store(false, std::memory_order_relaxed);
+    }
+
+    bool enabled() const {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    // a copy of name that lives as long as the profiler
+    const char* intern(const std::string& name);
+
+    void record(const char* name, uint64_t start, uint64_t end);
+
+    // main thread only
+    void beginFrame();
+    void endFrame();
+
+    uint64_t frames() const {
+        return m_frames;
+    }
+
+    // by total time, most first
+    std::vector<MarkerStats> markers() const;
+
+    // average time per frame of every marker
+    void report() const;
+
+    // Chrome trace_event JSON, returns false if the file couldn't be written
+    bool writeTrace(const std::string& path) const;
+
+    // the demos' F9: the first press starts profiling, later ones write the
+    // trace so far and print the report
+    void startOrWrite(const std::string& path);
+
+    // for cleanup: writes the trace and report if it was running
+    void finish(const std::string& path);
+
+private:
+    struct ThreadBuffer {
+        std::array<Event, RING_SIZE> events {};
+        // written by the owning thread only, read by the main thread
+        std::atomic<uint64_t> head {0};
+        // how far endFrame() has got, main thread only
+        uint64_t aggregated {0};
+        // the trace track, kept when a buffer is handed to a new thread so
+        // per frame workers don't get a new track every frame
+        uint32_t thread {};
+    };
+
+    // gives a buffer back when its thread exits, so short lived worker
+    // threads reuse buffers rather than leaving one behind each
+    struct ThreadHandle {
+        ThreadBuffer* buffer {nullptr};
+        ~ThreadHandle() {
+            if (buffer)
+                Profiler::instance().release(buffer);
+        }
+    };
+
+    Profiler() = default;
+    ThreadHandle& threadHandle();
+    void release(ThreadBuffer* buffer);
+    // index into m_markers, UINT16_MAX once they're full
+    uint16_t markerId(const char* name);
+    static void writeEscaped(std::ostream& out, const char* text);
+
+    std::atomic<bool> m_enabled {false};
+    uint64_t m_origin {};
+    uint64_t m_frameStart {};
+    uint64_t m_frames {};
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    std::vector<ThreadBuffer*> m_free;
+    std::set<std::string> m_names;
+    // ids by name address, and by text for the same name at another address
+    std::unordered_map<const char*, uint16_t> m_markerIds;
+    std::unordered_map<std::string, uint16_t> m_markerNames;
+    std::vector<MarkerStats> m_markers;
+    // this frame's time per marker id
+    std::array<double, MAX_MARKERS> m_frameMs {};
+};
+
+// times the scope it's declared in
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) {
+        if (Profiler::instance().enabled()) {
+            m_name = name;
+            m_start = stm_now();
+        }
+    }
+
+    ~ProfileScope() {
+        if (m_name)
+            Profiler::instance().record(m_name, m_start, stm_now());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name {nullptr};
+    uint64_t m_start {};
+};
+
+#define SJD_PROFILE_CONCAT_(a, b) a##b
+#define SJD_PROFILE_CONCAT(a, b) SJD_PROFILE_CONCAT_(a, b)
+#define SJD_PROFILE_SCOPE(name) sjd::ProfileScope SJD_PROFILE_CONCAT(sjd_profile_scope_, __LINE__) {name}
+
+inline void Profiler::enable() {
+    if (enabled())
+        return;
+    std::lock_guard<std::mutex> lock {m_mutex};
+    // start the counts again, events already in the rings stay for the trace
+    for (MarkerStats& marker : m_markers)
+        marker = MarkerStats {.name = marker.name};
+    m_frames = 0;
+    for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers)
+        buffer->aggregated = buffer->head.load(std::memory_order_acquire);
+    if (m_origin == 0)
+        m_origin = stm_now();
+    m_frameStart = 0;
+    m_enabled.store(true, std::memory_order_relaxed);
+}
+
+inline const char* Profiler::intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock {m_mutex};
+    return m_names.insert(name).first->c_str();
+}
+
+inline Profiler::ThreadHandle& Profiler::threadHandle() {
+    thread_local ThreadHandle handle {};
+    if (!handle.buffer) {
+        std::lock_guard<std::mutex> lock {m_mutex};
+        if (!m_free.empty()) {
+            handle.buffer = m_free.back();
+            m_free.pop_back();
+        }
+        else {
+            m_buffers.push_back(std::make_unique<ThreadBuffer>());
+            handle.buffer = m_buffers.back().get();
+            handle.buffer->thread = static_cast<uint32_t>(m_buffers.size() - 1);
+        }
+    }
+    return handle;
+}
+
+inline void Profiler::release(ThreadBuffer* buffer) {
+    std::lock_guard<std::mutex> lock {m_mutex};
+    m_free.push_back(buffer);
+}
+
+inline void Profiler::record(const char* name, uint64_t start, uint64_t end) {
+    ThreadHandle& handle {threadHandle()};
+    ThreadBuffer& buffer {*handle.buffer};
+    uint64_t head {buffer.head.load(std::memory_order_relaxed)};
+    buffer.events[head % RING_SIZE] = Event {name, start, end, buffer.thread};
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+inline uint16_t Profiler::markerId(const char* name) {
+    auto found {m_markerIds.find(name)};
+    if (found != m_markerIds.end())
+        return found->second;
+
+    // the first event with this address, the only time a name allocates
+    uint16_t id {UINT16_MAX};
+    auto named {m_markerNames.find(name)};
+    if (named != m_markerNames.end()) {
+        id = named->second;
+    }
+    else if (m_markers.size() < MAX_MARKERS) {
+        id = static_cast<uint16_t>(m_markers.size());
+        m_markers.push_back(MarkerStats {.name = name});
+        m_markerNames.emplace(name, id);
+    }
+    else {
+        std::cout << "WARNING::PROFILER::MARKERS: more than " << MAX_MARKERS
+                  << " names, " << name << " is left out of the report\n";
+    }
+    m_markerIds.emplace(name, id);
+    return id;
+}
+
+inline void Profiler::beginFrame() {
+    if (enabled())
+        m_frameStart = stm_now();
+}
+
+inline void Profiler::endFrame() {
+    if (!enabled())
+        return;
+    if (m_frameStart != 0)
+        record("frame", m_frameStart, stm_now());
+
+    // this frame's time per marker, then onto the totals
+    std::lock_guard<std::mutex> lock {m_mutex};
+    for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers) {
+        uint64_t head {buffer->head.load(std::memory_order_acquire)};
+        // anything that has been overwritten is lost to the counts
+        uint64_t first {std::max(buffer->aggregated, head > RING_SIZE ? head - RING_SIZE : 0)};
+        for (uint64_t i = first; i < head; ++i) {
+            const Event& event {buffer->events[i % RING_SIZE]};
+            uint16_t id {markerId(event.name)};
+            if (id == UINT16_MAX)
+                continue;
+            double ms {stm_ms(event.end - event.start)};
+            MarkerStats& marker {m_markers[id]};
+            marker.calls += 1;
+            marker.totalMs += ms;
+            m_frameMs[id] += ms;
+        }
+        buffer->aggregated = head;
+    }
+    for (size_t id = 0; id < m_markers.size(); ++id) {
+        m_markers[id].maxFrameMs = std::max(m_markers[id].maxFrameMs, m_frameMs[id]);
+        m_frameMs[id] = 0.0;
+    }
+    ++m_frames;
+}
+
+inline std::vector<Profiler::MarkerStats> Profiler::markers() const {
+    std::vector<MarkerStats> result;
+    {
+        std::lock_guard<std::mutex> lock {m_mutex};
+        for (const MarkerStats& marker : m_markers) {
+            if (marker.calls > 0)
+                result.push_back(marker);
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const MarkerStats& a, const MarkerStats& b) {
+        return a.totalMs > b.totalMs;
+    });
+    return result;
+}
+
+inline void Profiler::report() const {
+    if (m_frames == 0) {
+        std::cout << "Profiler: no frames recorded\n";
+        return;
+    }
+    std::cout << "Profiler: " << m_frames << " frames, ms per frame (worst frame)\n";
+    for (const MarkerStats& marker : markers()) {
+        std::cout << "    " << marker.name << ": " << marker.totalMs / m_frames
+                  << " (" << marker.maxFrameMs << ")";
+        if (marker.calls != m_frames)
+            std::cout << ", " << static_cast<double>(marker.calls) / m_frames << " calls";
+        std::cout << "\n";
+    }
+}
+
+inline void Profiler::writeEscaped(std::ostream& out, const char* text) {
+    // names can be anything intern() was given, JSON strings can't hold
+    // quotes, backslashes or control characters as they are
+    constexpr char HEX[] {"0123456789abcdef"};
+    for (const char* c = text; *c; ++c) {
+        unsigned char code {static_cast<unsigned char>(*c)};
+        if (code == '"' || code == '\\')
+            out << '\\' << *c;
+        else if (code < 0x20)
+            out << "\\u00" << HEX[code >> 4] << HEX[code & 0xf];
+        else
+            out << *c;
+    }
+}
+
+inline bool Profiler::writeTrace(const std::string& path) const {
+    std::ofstream file {path};
+    if (!file) {
+        std::cout << "WARNING::PROFILER::TRACE: couldn't write " << path << "\n";
+        return false;
+    }
+
+    std::vector<Event> events;
+    {
+        std::lock_guard<std::mutex> lock {m_mutex};
+        for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers) {
+            uint64_t head {buffer->head.load(std::memory_order_acquire)};
+            for (uint64_t i = head > RING_SIZE ? head - RING_SIZE : 0; i < head; ++i)
+                events.push_back(buffer->events[i % RING_SIZE]);
+        }
+    }
+    std::sort(events.begin(), events.end(), [](const Event& a, const Event& b) {
+        return a.start < b.start;
+    });
+
+    // complete ("X") events in microseconds, one track per thread
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first {true};
+    for (const Event& event : events) {
+        if (!first)
+            file << ",\n";
+        first = false;
+        file << "{\"name\":\"";
+        writeEscaped(file, event.name);
+        file << "\",\"cat\":\"sjd\",\"ph\":\"X\""
+             << ",\"ts\":" << stm_us(event.start - m_origin)
+             << ",\"dur\":" << stm_us(event.end - event.start)
+             << ",\"pid\":1,\"tid\":" << event.thread << "}";
+    }
+    file << "\n]}\n";
+    std::cout << "Profiler: wrote " << events.size() << " events to " << path << "\n";
+    return static_cast<bool>(file);
+}
+
+inline void Profiler::startOrWrite(const std::string& path) {
+    if (!enabled()) {
+        enable();
+        std::cout << "Profiler: on, F9 again writes " << path << "\n";
+        return;
+    }
+    report();
+    writeTrace(path);
+}
+
+inline void Profiler::finish(const std::string& path) {
+    if (!enabled())
+        return;
+    report();
+    writeTrace(path);
+    disable();
+}
+}
+#endif
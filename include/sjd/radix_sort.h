@@ -0,0 +1,85 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+/* LSD radix sort for draw/sort keys.
+ * Sorts 8 bits at a time from the least significant byte up. Every pass is
+ * stable, so items with equal keys keep the order they were submitted in.
+ * The scratch buffer is owned by the caller so it can be reused every frame
+ * without touching the heap once it has grown to the high-water mark.
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace sjd {
+
+struct SortItem64 {
+    uint64_t key;
+    uint32_t index;
+};
+
+struct SortItem32 {
+    uint32_t key;
+    uint32_t index;
+};
+
+// maps a float onto an unsigned key with the same ordering: positive floats
+// get their sign bit set, negative floats have every bit flipped
+inline uint32_t floatSortKey(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t mask {(bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u};
+    return bits ^ mask;
+}
+
+// Item is SortItem64 or SortItem32, one pass per byte of the key
+template <typename Item>
+inline void radixSort(std::vector<Item>& items, std::vector<Item>& scratch) {
+    constexpr int passes {sizeof(Item::key)};
+    const size_t count {items.size()};
+    if (count < 2)
+        return;
+    if (scratch.size() < count)
+        scratch.resize(count);
+
+    // build every histogram in one sweep over the keys
+    std::array<std::array<uint32_t, 256>, passes> histograms {};
+    for (const Item& item : items) {
+        for (int pass = 0; pass < passes; ++pass) {
+            ++histograms[pass][(item.key >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    Item* src {items.data()};
+    Item* dst {scratch.data()};
+    for (int pass = 0; pass < passes; ++pass) {
+        std::array<uint32_t, 256>& histogram {histograms[pass]};
+
+        // every key shares this byte, the pass wouldn't move anything
+        if (histogram[(src[0].key >> (pass * 8)) & 0xFF] == count)
+            continue;
+
+        uint32_t offset {0};
+        for (uint32_t& bucket : histogram) {
+            uint32_t bucketCount {bucket};
+            bucket = offset;
+            offset += bucketCount;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            dst[histogram[(src[i].key >> (pass * 8)) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    // an odd number of passes leaves the result in the scratch buffer
+    if (src != items.data()) {
+        std::copy(src, src + count, items.data());
+    }
+}
+
+}
+#endif
@@ -0,0 +1,576 @@
+#ifndef RENDER_GRAPH_H
+#define RENDER_GRAPH_H
+
+/* RenderGraph
+ * Passes declare which targets they draw into and which ones they sample,
+ * the graph works out the rest:
+ *   - passes are put in dependency order (ties keep the order they were
+ *     added in). A pass reading a target sees what the last pass added
+ *     before it wrote there, and runs before the next pass drawing over it
+ *   - passes whose output never reaches the swapchain or a persistent target
+ *     are culled
+ *   - transient targets whose lifetimes don't overlap share one sg_image, so
+ *     a chain of post effects only needs two or three images however long
+ *     it is
+ *   - images and attachments are remade when the swapchain size changes,
+ *     demos don't need their own resize code
+ *
+ * Targets are sized relative to the swapchain unless given a fixed size.
+ * A colour target with a sample count above 1 is drawn into a multisampled
+ * image and resolved into a normal one at the end of every pass writing it,
+ * readers get the resolved image. Use pickSampleCount() to find one the
+ * backend can do.
+ * Pass callbacks run between sg_begin_pass and sg_end_pass, they should
+ * fetch their input images with image() every frame because a resize
+ * replaces them. Each pass, begin to end, is a Profiler marker under its
+ * name.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sjd/profiler.h>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+namespace sjd {
+class RenderGraph {
+public:
+    struct Target {
+        uint16_t id {UINT16_MAX};
+
+        bool valid() const {
+            return id != UINT16_MAX;
+        }
+    };
+
+    struct TargetDesc {
+        sg_pixel_format format {SG_PIXELFORMAT_RGBA8};
+        // relative to the swapchain, ignored when width and height are set
+        float scale {1.0f};
+        // relative height when it isn't the same as the width, 0 = scale
+        float heightScale {0.0f};
+        int width {};
+        int height {};
+        // pipelines drawing into the target need the same sample_count
+        int sampleCount {1};
+        // persistent targets keep their contents between frames, so they're
+        // never shared and the passes writing them are never culled
+        bool persistent {false};
+        const char* label {nullptr};
+    };
+
+    struct PassDesc {
+        const char* name {nullptr};
+        std::vector<Target> colors {};
+        Target depth {};
+        std::vector<Target> reads {};
+        // draw into the swapchain instead of colors/depth
+        bool swapchain {false};
+        sg_pass_action action {};
+    };
+
+    using PassId = uint16_t;
+
+    struct Stats {
+        uint32_t passes {};
+        uint32_t culledPasses {};
+        uint32_t targets {};
+        uint32_t images {};
+        // what the images would take without sharing and what they do take
+        uint64_t unaliasedBytes {};
+        uint64_t bytes {};
+    };
+
+    Target createTarget(const TargetDesc& desc);
+    void setTargetScale(Target target, float scale, float heightScale = 0.0f);
+
+    PassId addPass(const PassDesc& desc, std::function<void()> execute);
+    void setPassAction(PassId pass, const sg_pass_action& action);
+    // a disabled pass is skipped by execute() but still counts for culling
+    // and lifetimes, for passes into persistent targets that don't have to
+    // be redrawn every frame
+    void setPassEnabled(PassId pass, bool enabled);
+
+    // compiles when it's the first call or the swapchain size or the graph
+    // changed, returns true if it did. execute() calls it, call it first to
+    // look at the images before they're drawn into.
+    bool prepare(const sg_swapchain& swapchain);
+
+    // prepares, then runs every enabled pass that survived culling
+    void execute(const sg_swapchain& swapchain);
+
+    // invalid when the target is only used by culled passes. The resolved
+    // image for a multisampled target, multisampled depth can't be read.
+    sg_image image(Target target) const {
+        const TargetRecord& record {m_targets[target.id]};
+        uint16_t index {record.resolve != UINT16_MAX ? record.resolve : record.image};
+        return index == UINT16_MAX ? sg_image {} : m_images[index].image;
+    }
+
+    int width(Target target) const {
+        return m_targets[target.id].width;
+    }
+
+    int height(Target target) const {
+        return m_targets[target.id].height;
+    }
+
+    const Stats& stats() const {
+        return m_stats;
+    }
+
+    // the most samples up to `requested` that every format can be drawn
+    // with, printing what the targets would take at each sample count
+    static int pickSampleCount(const std::vector<TargetDesc>& targets,
+                               int requested,
+                               int width,
+                               int height);
+
+    // memory for a target at the given swapchain size, resolve included
+    static uint64_t targetBytes(const TargetDesc& desc, int width, int height);
+
+    void report() const;
+    void shutdown();
+    // throws away every pass and target, for rebuilding the graph
+    void clear();
+
+private:
+    struct TargetRecord {
+        TargetDesc desc;
+        int width {};
+        int height {};
+        // first and last position in the compiled order using it
+        int firstUse {-1};
+        int lastUse {-1};
+        uint16_t image {UINT16_MAX};
+        // single sampled image a multisampled colour target resolves into
+        uint16_t resolve {UINT16_MAX};
+    };
+
+    struct PassRecord {
+        PassDesc desc;
+        std::function<void()> execute;
+        std::string label;
+        // label, interned for the profiler
+        const char* profileName {nullptr};
+        sg_attachments attachments {};
+        bool culled {false};
+        bool enabled {true};
+    };
+
+    struct ImageRecord {
+        sg_image image {};
+        sg_pixel_format format {};
+        int width {};
+        int height {};
+        int sampleCount {1};
+        // compiled position after which the image is free again
+        int freeAfter {-1};
+        bool persistent {false};
+    };
+
+    void compile(int width, int height);
+    std::vector<PassId> sortPasses() const;
+    void cullPasses(const std::vector<PassId>& order);
+    uint16_t allocate(const TargetRecord& target, int sampleCount, const char* label);
+    void release();
+    static uint64_t imageBytes(sg_pixel_format format, int width, int height);
+    static bool isDepth(sg_pixel_format format) {
+        return format == SG_PIXELFORMAT_DEPTH || format == SG_PIXELFORMAT_DEPTH_STENCIL;
+    }
+
+    std::vector<TargetRecord> m_targets;
+    std::vector<PassRecord> m_passes;
+    std::vector<ImageRecord> m_images;
+    std::vector<PassId> m_order;
+    Stats m_stats;
+    int m_width {};
+    int m_height {};
+    bool m_dirty {true};
+};
+
+inline RenderGraph::Target RenderGraph::createTarget(const TargetDesc& desc) {
+    m_targets.push_back(TargetRecord {.desc = desc});
+    m_dirty = true;
+    return Target {static_cast<uint16_t>(m_targets.size() - 1)};
+}
+
+inline void RenderGraph::setTargetScale(Target target, float scale, float heightScale) {
+    TargetDesc& desc {m_targets[target.id].desc};
+    if (desc.scale == scale && desc.heightScale == heightScale)
+        return;
+    desc.scale = scale;
+    desc.heightScale = heightScale;
+    m_dirty = true;
+}
+
+inline RenderGraph::PassId RenderGraph::addPass(const PassDesc& desc, std::function<void()> execute) {
+    m_passes.push_back(PassRecord {
+        .desc = desc,
+        .execute = std::move(execute),
+        .label = desc.name ? desc.name : "pass-" + std::to_string(m_passes.size()),
+    });
+    m_passes.back().profileName = Profiler::instance().intern(m_passes.back().label);
+    m_dirty = true;
+    return static_cast<PassId>(m_passes.size() - 1);
+}
+
+inline void RenderGraph::setPassAction(PassId pass, const sg_pass_action& action) {
+    m_passes[pass].desc.action = action;
+}
+
+inline void RenderGraph::setPassEnabled(PassId pass, bool enabled) {
+    m_passes[pass].enabled = enabled;
+}
+
+inline bool RenderGraph::prepare(const sg_swapchain& swapchain) {
+    if (!m_dirty && swapchain.width == m_width && swapchain.height == m_height)
+        return false;
+    compile(swapchain.width, swapchain.height);
+    return true;
+}
+
+inline void RenderGraph::execute(const sg_swapchain& swapchain) {
+    prepare(swapchain);
+
+    for (PassId id : m_order) {
+        PassRecord& pass {m_passes[id]};
+        if (!pass.enabled)
+            continue;
+        ProfileScope scope {pass.profileName};
+        if (pass.desc.swapchain) {
+            sg_begin_pass(sg_pass {
+                .action = pass.desc.action,
+                .swapchain = swapchain,
+                .label = pass.label.c_str()
+            });
+        }
+        else {
+            sg_begin_pass(sg_pass {
+                .action = pass.desc.action,
+                .attachments = pass.attachments,
+                .label = pass.label.c_str()
+            });
+        }
+        if (pass.execute)
+            pass.execute();
+        sg_end_pass();
+    }
+}
+
+inline std::vector<RenderGraph::PassId> RenderGraph::sortPasses() const {
+    size_t count {m_passes.size()};
+    std::vector<std::vector<PassId>> dependents(count);
+    std::vector<int> inDegree(count, 0);
+    auto addEdge = [&](PassId from, PassId to) {
+        if (from == to)
+            return;
+        dependents[from].push_back(to);
+        ++inDegree[to];
+    };
+
+    // going through the passes in the order they were added, a reader
+    // depends on the last writer of the target so far. The next writer
+    // depends on that writer (it draws over its output) and on every reader
+    // since, so it can't replace what they read before they have run.
+    std::vector<PassId> lastWriter(m_targets.size(), UINT16_MAX);
+    std::vector<std::vector<PassId>> readers(m_targets.size());
+    for (PassId p = 0; p < count; ++p) {
+        const PassDesc& desc {m_passes[p].desc};
+        for (Target t : desc.reads) {
+            if (lastWriter[t.id] != UINT16_MAX)
+                addEdge(lastWriter[t.id], p);
+            readers[t.id].push_back(p);
+        }
+        auto write = [&](Target t) {
+            if (lastWriter[t.id] != UINT16_MAX)
+                addEdge(lastWriter[t.id], p);
+            for (PassId r : readers[t.id])
+                addEdge(r, p);
+            readers[t.id].clear();
+            lastWriter[t.id] = p;
+        };
+        for (Target t : desc.colors)
+            write(t);
+        if (desc.depth.valid())
+            write(desc.depth);
+    }
+
+    // Kahn's algorithm, always taking the ready pass that was added first
+    std::vector<PassId> order;
+    std::vector<bool> done(count, false);
+    while (order.size() < count) {
+        PassId next {UINT16_MAX};
+        for (PassId p = 0; p < count; ++p) {
+            if (!done[p] && inDegree[p] == 0) {
+                next = p;
+                break;
+            }
+        }
+        if (next == UINT16_MAX) {
+            std::cout << "ERROR::RENDER_GRAPH::CYCLE: passes read each other's output, using the order they were added in\n";
+            order.clear();
+            for (PassId p = 0; p < count; ++p)
+                order.push_back(p);
+            return order;
+        }
+        done[next] = true;
+        order.push_back(next);
+        for (PassId d : dependents[next])
+            --inDegree[d];
+    }
+    return order;
+}
+
+inline void RenderGraph::cullPasses(const std::vector<PassId>& order) {
+    // walk backwards from the passes that are always wanted, a pass is
+    // needed when something needed later uses a target it writes
+    std::vector<bool> needed(m_targets.size(), false);
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        PassRecord& pass {m_passes[*it]};
+        bool keep {pass.desc.swapchain};
+        auto checkWrite = [&](Target t) {
+            if (needed[t.id] || m_targets[t.id].desc.persistent)
+                keep = true;
+        };
+        for (Target t : pass.desc.colors)
+            checkWrite(t);
+        if (pass.desc.depth.valid())
+            checkWrite(pass.desc.depth);
+
+        pass.culled = !keep;
+        if (!keep)
+            continue;
+        for (Target t : pass.desc.reads)
+            needed[t.id] = true;
+        // a pass drawing over a target needs whatever was in it before
+        for (Target t : pass.desc.colors)
+            needed[t.id] = true;
+        if (pass.desc.depth.valid())
+            needed[pass.desc.depth.id] = true;
+    }
+}
+
+inline uint64_t RenderGraph::imageBytes(sg_pixel_format format, int width, int height) {
+    int bytesPerPixel {sg_query_pixelformat(format).bytes_per_pixel};
+    // depth formats report 0, count them as 32-bit
+    if (bytesPerPixel == 0)
+        bytesPerPixel = 4;
+    return static_cast<uint64_t>(bytesPerPixel) * width * height;
+}
+
+inline uint64_t RenderGraph::targetBytes(const TargetDesc& desc, int width, int height) {
+    if (desc.width > 0 && desc.height > 0) {
+        width = desc.width;
+        height = desc.height;
+    }
+    else {
+        float heightScale {desc.heightScale > 0.0f ? desc.heightScale : desc.scale};
+        width = std::max(1, static_cast<int>(width * desc.scale + 0.5f));
+        height = std::max(1, static_cast<int>(height * heightScale + 0.5f));
+    }
+    int samples {std::max(desc.sampleCount, 1)};
+    uint64_t bytes {imageBytes(desc.format, width, height) * samples};
+    if (samples > 1 && !isDepth(desc.format))
+        bytes += imageBytes(desc.format, width, height);
+    return bytes;
+}
+
+inline int RenderGraph::pickSampleCount(const std::vector<TargetDesc>& targets,
+                                        int requested,
+                                        int width,
+                                        int height) {
+    // sokol doesn't pass on GL_MAX_SAMPLES, but GLES3/WebGL2 guarantee 4 for
+    // any format that can be multisampled at all
+    int limit {4};
+    for (const TargetDesc& desc : targets) {
+        if (!sg_query_pixelformat(desc.format).msaa)
+            limit = 1;
+    }
+
+    int chosen {1};
+    std::cout << "RenderGraph: MSAA memory at " << width << "x" << height << ":";
+    for (int samples = 1; samples <= std::max(limit, 1); samples *= 2) {
+        uint64_t bytes {};
+        for (TargetDesc desc : targets) {
+            desc.sampleCount = samples;
+            bytes += targetBytes(desc, width, height);
+        }
+        std::cout << " x" << samples << " " << bytes / 1024 << "KiB";
+        if (samples <= requested)
+            chosen = samples;
+    }
+    std::cout << " (using x" << chosen << ")\n";
+    return chosen;
+}
+
+inline uint16_t RenderGraph::allocate(const TargetRecord& target, int sampleCount, const char* label) {
+    // reuse any image of the same kind that nothing needs any more
+    if (!target.desc.persistent) {
+        for (uint16_t i = 0; i < m_images.size(); ++i) {
+            ImageRecord& image {m_images[i]};
+            if (!image.persistent
+                && image.freeAfter < target.firstUse
+                && image.format == target.desc.format
+                && image.width == target.width
+                && image.height == target.height
+                && image.sampleCount == sampleCount) {
+                image.freeAfter = target.lastUse;
+                return i;
+            }
+        }
+    }
+
+    m_images.push_back(ImageRecord {
+        .image = sg_make_image(sg_image_desc {
+            .render_target = true,
+            .width = target.width,
+            .height = target.height,
+            .pixel_format = target.desc.format,
+            .sample_count = sampleCount,
+            .label = label
+        }),
+        .format = target.desc.format,
+        .width = target.width,
+        .height = target.height,
+        .sampleCount = sampleCount,
+        .freeAfter = target.lastUse,
+        .persistent = target.desc.persistent,
+    });
+    m_stats.bytes += imageBytes(target.desc.format, target.width, target.height) * sampleCount;
+    return static_cast<uint16_t>(m_images.size() - 1);
+}
+
+inline void RenderGraph::compile(int width, int height) {
+    release();
+    m_width = width;
+    m_height = height;
+    m_dirty = false;
+    m_stats = Stats {
+        .passes = static_cast<uint32_t>(m_passes.size()),
+        .targets = static_cast<uint32_t>(m_targets.size()),
+    };
+
+    std::vector<PassId> sorted {sortPasses()};
+    cullPasses(sorted);
+    m_order.clear();
+    for (PassId p : sorted) {
+        if (m_passes[p].culled)
+            ++m_stats.culledPasses;
+        else
+            m_order.push_back(p);
+    }
+
+    for (TargetRecord& target : m_targets) {
+        target.firstUse = -1;
+        target.lastUse = -1;
+        target.image = UINT16_MAX;
+        target.resolve = UINT16_MAX;
+        if (target.desc.width > 0 && target.desc.height > 0) {
+            target.width = target.desc.width;
+            target.height = target.desc.height;
+        }
+        else {
+            float heightScale {target.desc.heightScale > 0.0f ? target.desc.heightScale : target.desc.scale};
+            target.width = std::max(1, static_cast<int>(width * target.desc.scale + 0.5f));
+            target.height = std::max(1, static_cast<int>(height * heightScale + 0.5f));
+        }
+    }
+
+    auto use = [&](Target t, int position) {
+        TargetRecord& target {m_targets[t.id]};
+        if (target.firstUse < 0)
+            target.firstUse = position;
+        target.lastUse = position;
+    };
+    for (int i = 0; i < static_cast<int>(m_order.size()); ++i) {
+        const PassDesc& desc {m_passes[m_order[i]].desc};
+        for (Target t : desc.colors)
+            use(t, i);
+        if (desc.depth.valid())
+            use(desc.depth, i);
+        for (Target t : desc.reads)
+            use(t, i);
+    }
+
+    // hand out images in order of first use, reusing any image of the same
+    // format, size and sample count that nothing needs any more
+    std::vector<uint16_t> byFirstUse;
+    for (uint16_t t = 0; t < m_targets.size(); ++t) {
+        if (m_targets[t].firstUse >= 0)
+            byFirstUse.push_back(t);
+    }
+    std::stable_sort(byFirstUse.begin(), byFirstUse.end(), [&](uint16_t a, uint16_t b) {
+        return m_targets[a].firstUse < m_targets[b].firstUse;
+    });
+
+    for (uint16_t t : byFirstUse) {
+        TargetRecord& target {m_targets[t]};
+        m_stats.unaliasedBytes += targetBytes(target.desc, width, height);
+
+        bool depth {isDepth(target.desc.format)};
+        const char* label {target.desc.label ? target.desc.label : (depth ? "graph-depth-image" : "graph-color-image")};
+        int samples {std::max(target.desc.sampleCount, 1)};
+        target.image = allocate(target, samples, label);
+        if (samples > 1 && !depth)
+            target.resolve = allocate(target, 1, label);
+    }
+    m_stats.images = static_cast<uint32_t>(m_images.size());
+
+    for (PassId p : m_order) {
+        PassRecord& pass {m_passes[p]};
+        if (pass.desc.swapchain)
+            continue;
+        sg_attachments_desc desc {.label = pass.label.c_str()};
+        for (size_t i = 0; i < pass.desc.colors.size() && i < SG_MAX_COLOR_ATTACHMENTS; ++i) {
+            const TargetRecord& target {m_targets[pass.desc.colors[i].id]};
+            desc.colors[i].image = m_images[target.image].image;
+            if (target.resolve != UINT16_MAX)
+                desc.resolves[i].image = m_images[target.resolve].image;
+        }
+        if (pass.desc.depth.valid())
+            desc.depth_stencil.image = m_images[m_targets[pass.desc.depth.id].image].image;
+        pass.attachments = sg_make_attachments(desc);
+    }
+}
+
+inline void RenderGraph::release() {
+    for (PassRecord& pass : m_passes) {
+        sg_destroy_attachments(pass.attachments);
+        pass.attachments = sg_attachments {};
+    }
+    for (ImageRecord& image : m_images)
+        sg_destroy_image(image.image);
+    m_images.clear();
+}
+
+inline void RenderGraph::shutdown() {
+    release();
+    m_dirty = true;
+}
+
+inline void RenderGraph::clear() {
+    release();
+    m_targets.clear();
+    m_passes.clear();
+    m_order.clear();
+    m_stats = Stats {};
+    m_dirty = true;
+}
+
+inline void RenderGraph::report() const {
+    std::cout << "RenderGraph: " << m_stats.passes << " passes ("
+              << m_stats.culledPasses << " culled), "
+              << m_stats.targets << " targets on " << m_stats.images << " images, "
+              << m_stats.bytes / 1024 << "KiB instead of "
+              << m_stats.unaliasedBytes / 1024 << "KiB\n";
+}
+}
+#endif
@@ -0,0 +1,282 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+/* RenderQueue
+ * Draws are submitted with a 64-bit sort key instead of being issued straight
+ * away. execute() radix-sorts the queue and walks it in key order, skipping
+ * sg_apply_pipeline/sg_apply_bindings/sg_apply_uniforms calls that wouldn't
+ * change anything.
+ *
+ * key layout (most significant bit first):
+ *   opaque:      pass:4 | translucent:1 = 0 | pipeline:16 | bindings:16 | depth:24 | 3 unused
+ *   translucent: pass:4 | translucent:1 = 1 | ~depth:24   | pipeline:16 | bindings:16 | 3 unused
+ * Opaque draws are grouped by state and then drawn front to back, translucent
+ * draws have to be drawn back to front so depth wins over state for those.
+ */
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+#include <sjd/radix_sort.h>
+
+namespace sjd {
+class RenderQueue {
+public:
+    struct Uniforms {
+        int slot;
+        sg_range data;
+    };
+
+    struct Stats {
+        uint32_t draws {};
+        uint32_t pipelineApplies {};
+        uint32_t pipelineSkips {};
+        uint32_t bindingsApplies {};
+        uint32_t bindingsSkips {};
+        uint32_t uniformApplies {};
+        uint32_t uniformSkips {};
+    };
+
+    RenderQueue() {
+        m_appliedUniforms.fill(UINT32_MAX);
+    }
+
+    // depth is expected to be normalised to [0, 1], e.g. view distance / far
+    static uint64_t makeKey(uint8_t pass,
+                            bool translucent,
+                            uint16_t pipelineId,
+                            uint16_t bindingsId,
+                            float depth);
+
+    // bindings are registered once (usually in init()) and referred to by id
+    uint16_t addBindings(const sg_bindings& bindings);
+    void setBindings(uint16_t bindingsId, const sg_bindings& bindings);
+
+    // start a new frame, throws away last frame's draws but keeps the memory
+    void begin();
+
+    void submit(uint8_t pass,
+                bool translucent,
+                sg_pipeline pipeline,
+                uint16_t bindingsId,
+                float depth,
+                std::initializer_list<Uniforms> uniforms,
+                int baseElement,
+                int numElements,
+                int numInstances = 1);
+
+    void submit(uint64_t key,
+                sg_pipeline pipeline,
+                uint16_t bindingsId,
+                std::initializer_list<Uniforms> uniforms,
+                int baseElement,
+                int numElements,
+                int numInstances = 1);
+
+    // sort and issue every draw of the given pass inside the current sg pass
+    void execute(uint8_t pass);
+
+    const Stats& stats() const {
+        return m_stats;
+    }
+
+private:
+    struct UniformRecord {
+        int slot;
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    struct DrawItem {
+        sg_pipeline pipeline;
+        uint16_t bindingsId;
+        uint32_t firstUniform;
+        uint32_t numUniforms;
+        int baseElement;
+        int numElements;
+        int numInstances;
+    };
+
+    void applyUniforms(const DrawItem& item);
+
+    std::vector<sg_bindings> m_bindings;
+    std::vector<DrawItem> m_items;
+    std::vector<UniformRecord> m_uniformRecords;
+    std::vector<uint8_t> m_uniformData;
+    std::vector<SortItem64> m_keys;
+    std::vector<SortItem64> m_scratch;
+    // last uniform record applied per slot, UINT32_MAX when nothing is cached
+    std::array<uint32_t, SG_MAX_UNIFORMBLOCK_BINDSLOTS> m_appliedUniforms;
+    Stats m_stats;
+    bool m_sorted {false};
+};
+
+inline uint64_t RenderQueue::makeKey(uint8_t pass,
+                                     bool translucent,
+                                     uint16_t pipelineId,
+                                     uint16_t bindingsId,
+                                     float depth) {
+    depth = std::clamp(depth, 0.0f, 1.0f);
+    uint64_t quantDepth {static_cast<uint64_t>(depth * 0xFFFFFF) & 0xFFFFFF};
+
+    uint64_t key {static_cast<uint64_t>(pass & 0xF) << 60};
+    if (translucent) {
+        key |= 1ull << 59;
+        key |= (~quantDepth & 0xFFFFFF) << 35;
+        key |= static_cast<uint64_t>(pipelineId) << 19;
+        key |= static_cast<uint64_t>(bindingsId) << 3;
+    }
+    else {
+        key |= static_cast<uint64_t>(pipelineId) << 43;
+        key |= static_cast<uint64_t>(bindingsId) << 27;
+        key |= quantDepth << 3;
+    }
+    return key;
+}
+
+inline uint16_t RenderQueue::addBindings(const sg_bindings& bindings) {
+    m_bindings.push_back(bindings);
+    return static_cast<uint16_t>(m_bindings.size() - 1);
+}
+
+inline void RenderQueue::setBindings(uint16_t bindingsId,
+                                     const sg_bindings& bindings) {
+    m_bindings[bindingsId] = bindings;
+}
+
+inline void RenderQueue::begin() {
+    m_items.clear();
+    m_uniformRecords.clear();
+    m_uniformData.clear();
+    m_keys.clear();
+    m_stats = Stats {};
+    m_sorted = false;
+}
+
+inline void RenderQueue::submit(uint8_t pass,
+                                bool translucent,
+                                sg_pipeline pipeline,
+                                uint16_t bindingsId,
+                                float depth,
+                                std::initializer_list<Uniforms> uniforms,
+                                int baseElement,
+                                int numElements,
+                                int numInstances) {
+    // the slot index of a sokol handle is stored in its lower 16 bits
+    uint16_t pipelineId {static_cast<uint16_t>(pipeline.id & 0xFFFF)};
+    submit(makeKey(pass, translucent, pipelineId, bindingsId, depth),
+           pipeline,
+           bindingsId,
+           uniforms,
+           baseElement,
+           numElements,
+           numInstances);
+}
+
+inline void RenderQueue::submit(uint64_t key,
+                                sg_pipeline pipeline,
+                                uint16_t bindingsId,
+                                std::initializer_list<Uniforms> uniforms,
+                                int baseElement,
+                                int numElements,
+                                int numInstances) {
+    DrawItem item {
+        .pipeline = pipeline,
+        .bindingsId = bindingsId,
+        .firstUniform = static_cast<uint32_t>(m_uniformRecords.size()),
+        .numUniforms = static_cast<uint32_t>(uniforms.size()),
+        .baseElement = baseElement,
+        .numElements = numElements,
+        .numInstances = numInstances,
+    };
+
+    // uniform data is copied so callers can reuse their structs straight away
+    for (const Uniforms& block : uniforms) {
+        UniformRecord record {
+            .slot = block.slot,
+            .offset = static_cast<uint32_t>(m_uniformData.size()),
+            .size = static_cast<uint32_t>(block.data.size),
+        };
+        const uint8_t* bytes {static_cast<const uint8_t*>(block.data.ptr)};
+        m_uniformData.insert(m_uniformData.end(), bytes, bytes + block.data.size);
+        m_uniformRecords.push_back(record);
+    }
+
+    m_keys.push_back(SortItem64 {
+        .key = key,
+        .index = static_cast<uint32_t>(m_items.size()),
+    });
+    m_items.push_back(item);
+    m_sorted = false;
+}
+
+inline void RenderQueue::execute(uint8_t pass) {
+    // the pass is the top of the key, so one sort serves every pass
+    if (!m_sorted) {
+        radixSort(m_keys, m_scratch);
+        m_sorted = true;
+    }
+
+    uint32_t currentPipeline {SG_INVALID_ID};
+    uint16_t currentBindings {UINT16_MAX};
+    for (const SortItem64& sorted : m_keys) {
+        if ((sorted.key >> 60) != (pass & 0xFu))
+            continue;
+        const DrawItem& item {m_items[sorted.index]};
+
+        if (item.pipeline.id != currentPipeline) {
+            sg_apply_pipeline(item.pipeline);
+            currentPipeline = item.pipeline.id;
+            // a new pipeline needs its bindings and uniforms applied again
+            currentBindings = UINT16_MAX;
+            m_appliedUniforms.fill(UINT32_MAX);
+            ++m_stats.pipelineApplies;
+        }
+        else {
+            ++m_stats.pipelineSkips;
+        }
+
+        if (item.bindingsId != currentBindings) {
+            sg_apply_bindings(m_bindings[item.bindingsId]);
+            currentBindings = item.bindingsId;
+            ++m_stats.bindingsApplies;
+        }
+        else {
+            ++m_stats.bindingsSkips;
+        }
+
+        applyUniforms(item);
+        sg_draw(item.baseElement, item.numElements, item.numInstances);
+        ++m_stats.draws;
+    }
+}
+
+inline void RenderQueue::applyUniforms(const DrawItem& item) {
+    for (uint32_t i = item.firstUniform; i < item.firstUniform + item.numUniforms; ++i) {
+        const UniformRecord& record {m_uniformRecords[i]};
+        uint32_t cached {m_appliedUniforms[record.slot]};
+        if (cached != UINT32_MAX) {
+            const UniformRecord& last {m_uniformRecords[cached]};
+            if (last.size == record.size &&
+                std::memcmp(&m_uniformData[last.offset],
+                            &m_uniformData[record.offset],
+                            record.size) == 0) {
+                ++m_stats.uniformSkips;
+                continue;
+            }
+        }
+        sg_apply_uniforms(record.slot, sg_range {
+            .ptr = &m_uniformData[record.offset],
+            .size = record.size,
+        });
+        m_appliedUniforms[record.slot] = i;
+        ++m_stats.uniformApplies;
+    }
+}
+
+}
+#endif
@@ -0,0 +1,151 @@
+#ifndef SECONDARY_VIEW_H
+#define SECONDARY_VIEW_H
+
+/* Views
+ * A View is everything a draw list needs to draw the scene from somewhere:
+ * the matrices, the frustum and how many pixels a unit covers. visible()
+ * tests a bounding sphere against the frustum and against a minimum size on
+ * screen, so a small low resolution view (a mirror, a security camera)
+ * drops the small detail objects the main view still draws. The same draw
+ * code can then serve every view, it just asks the view what to skip.
+ *
+ * SecondaryView decides when a view that doesn't have to be redrawn every
+ * frame needs drawing again: every updateInterval frames, when it has moved
+ * or turned more than a threshold, or when its target image has been
+ * remade (window resized). Its target should be a persistent RenderGraph
+ * target so the last picture is kept in between, and its pass switched
+ * with RenderGraph::setPassEnabled.
+ */
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <glm/glm.hpp>
+#include <sjd/frustum.h>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+
+namespace sjd {
+struct View {
+    glm::mat4 view {1.0f};
+    glm::mat4 projection {1.0f};
+    glm::vec3 position {};
+    Frustum frustum {};
+    // pixels covered by one unit at a distance of one unit
+    float pixelScale {1.0f};
+    // objects with a smaller radius on screen aren't drawn, 0 draws all
+    float minPixelRadius {0.0f};
+
+    // targetHeight is the height in pixels of what the view is drawn into
+    static View make(const glm::mat4& view,
+                     const glm::mat4& projection,
+                     const glm::vec3& position,
+                     int targetHeight,
+                     float minPixelRadius = 0.0f);
+
+    // radius of a bounding sphere on screen in pixels
+    float pixelRadius(const glm::vec3& centre, float radius) const {
+        float distance {glm::length(centre - position)};
+        if (distance <= radius)
+            return INFINITY;
+        return radius / distance * pixelScale;
+    }
+
+    bool visible(const glm::vec3& centre, float radius) const {
+        if (!frustum.sphereVisible(centre, radius))
+            return false;
+        return minPixelRadius <= 0.0f || pixelRadius(centre, radius) >= minPixelRadius;
+    }
+};
+
+inline View View::make(const glm::mat4& view,
+                       const glm::mat4& projection,
+                       const glm::vec3& position,
+                       int targetHeight,
+                       float minPixelRadius) {
+    return View {
+        .view = view,
+        .projection = projection,
+        .position = position,
+        .frustum = Frustum::fromMatrix(projection * view),
+        // projection[1][1] is cot(fovy / 2), half the target covers that
+        .pixelScale = projection[1][1] * targetHeight * 0.5f,
+        .minPixelRadius = minPixelRadius,
+    };
+}
+
+struct SecondaryViewSettings {
+    // redraw at least every this many frames, 0 = only when it moves
+    int updateInterval {4};
+    // units
+    float moveThreshold {0.1f};
+    // degrees
+    float turnThreshold {2.0f};
+};
+
+class SecondaryView {
+public:
+    struct Stats {
+        uint32_t updates {};
+        uint32_t skips {};
+    };
+
+    void setup(const SecondaryViewSettings& settings) {
+        m_settings = settings;
+        invalidate();
+    }
+
+    // call once a frame with where the view is looking from, true when it
+    // has to be drawn this frame. target is the image it draws into.
+    bool shouldUpdate(const glm::vec3& position, const glm::vec3& forward, sg_image target);
+
+    // the next shouldUpdate() returns true
+    void invalidate() {
+        m_valid = false;
+    }
+
+    const Stats& stats() const {
+        return m_stats;
+    }
+
+    void report() const;
+
+private:
+    SecondaryViewSettings m_settings {};
+    Stats m_stats {};
+    glm::vec3 m_position {};
+    glm::vec3 m_forward {0.0f, 0.0f, -1.0f};
+    uint32_t m_image {SG_INVALID_ID};
+    int m_framesSinceUpdate {};
+    bool m_valid {false};
+};
+
+inline bool SecondaryView::shouldUpdate(const glm::vec3& position, const glm::vec3& forward, sg_image target) {
+    ++m_framesSinceUpdate;
+    bool update {!m_valid || target.id != m_image};
+    if (m_settings.updateInterval > 0 && m_framesSinceUpdate >= m_settings.updateInterval)
+        update = true;
+    if (glm::length(position - m_position) > m_settings.moveThreshold)
+        update = true;
+    float turn {glm::dot(glm::normalize(forward), m_forward)};
+    if (turn < std::cos(glm::radians(m_settings.turnThreshold)))
+        update = true;
+
+    if (!update) {
+        ++m_stats.skips;
+        return false;
+    }
+    m_position = position;
+    m_forward = glm::normalize(forward);
+    m_image = target.id;
+    m_framesSinceUpdate = 0;
+    m_valid = true;
+    ++m_stats.updates;
+    return true;
+}
+
+inline void SecondaryView::report() const {
+    uint32_t frames {m_stats.updates + m_stats.skips};
+    std::cout << "SecondaryView: drawn " << m_stats.updates << " of " << frames << " frames\n";
+}
+}
+#endif
@@ -0,0 +1,293 @@
+#ifndef SHADOWS_H
+#define SHADOWS_H
+
+/* Cascaded shadow maps for a directional light
+ * The camera frustum (up to ShadowSettings::maxDistance) is split into
+ * cascades with the "practical" split scheme, a blend of logarithmic and
+ * uniform splits. Each cascade gets an orthographic light projection fitted
+ * to a bounding sphere around its slice of the frustum, so the projection
+ * doesn't change size as the camera turns, and is snapped to whole shadow
+ * map texels so the shadow edges don't crawl when the camera moves.
+ *
+ * All cascades share one depth atlas (two tiles across) and one pass, each
+ * cascade drawing into its own tile with sg_apply_viewport. Use
+ * casterVisible() to skip casters a cascade can't see.
+ *
+ * The shader side lives in include/sjd/glsl/shadows.glsl, fillUniforms()
+ * writes its fs_shadows uniform block.
+ */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#define SOKOL_DEBUG
+#include <sokol/sokol_gfx.h>
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+namespace sjd {
+
+struct ShadowSettings {
+    int cascades {3};
+    // size of one cascade's tile in texels
+    int resolution {1024};
+    // how far from the camera shadows are drawn
+    float maxDistance {40.0f};
+    // 0 = uniform splits, 1 = logarithmic splits
+    float splitLambda {0.75f};
+    // how far towards the light casters outside the cascade are still caught
+    float casterDistance {30.0f};
+    float depthBias {0.0005f};
+    // in shadow map texels
+    float normalOffset {1.5f};
+};
+
+class CascadedShadows {
+public:
+    static constexpr int MAX_CASCADES {4};
+
+    sg_image depthImage {};
+    sg_sampler sampler {};
+    sg_attachments attachments {};
+
+    // (re)creates the atlas when the cascade count or resolution changed
+    void setup(const ShadowSettings& settings);
+    void shutdown();
+
+    const ShadowSettings& settings() const {
+        return m_settings;
+    }
+
+    // fits the cascades to the camera, lightDirection points from the light
+    void update(const glm::mat4& view,
+                float fovy,
+                float aspect,
+                float zNear,
+                const glm::vec3& lightDirection);
+
+    // bounding sphere test against a cascade's light volume
+    bool casterVisible(int cascade, const glm::vec3& centre, float radius) const;
+
+    // for drawing the casters of a cascade
+    const glm::mat4& lightViewProjection(int cascade) const {
+        return m_lightViewProjection[cascade];
+    }
+
+    // restricts drawing to a cascade's tile of the atlas
+    void applyViewport(int cascade) const;
+
+    void applyBindings(sg_bindings& bindings, int imageSlot, int samplerSlot) const {
+        bindings.images[imageSlot] = depthImage;
+        bindings.samplers[samplerSlot] = sampler;
+    }
+
+    // fills in the fs_shadows block declared by shadows.glsl
+    template <typename Uniforms>
+    void fillUniforms(Uniforms& uniforms) const;
+
+    static sg_pass_action passAction();
+
+    // depth only, front faces culled so the depth stored is that of the back
+    // faces and lit surfaces don't shadow themselves. Needs geometry wound
+    // counter-clockwise.
+    static sg_pipeline_desc depthPipelineDesc(sg_shader shader,
+                                              const sg_vertex_layout_state& layout);
+
+private:
+    glm::ivec2 tileOrigin(int cascade) const {
+        return glm::ivec2(cascade % 2, cascade / 2) * m_settings.resolution;
+    }
+
+    ShadowSettings m_settings {};
+    glm::ivec2 m_atlasSize {};
+    std::array<glm::mat4, MAX_CASCADES> m_lightView {};
+    std::array<glm::mat4, MAX_CASCADES> m_lightViewProjection {};
+    std::array<glm::mat4, MAX_CASCADES> m_shadowMatrices {};
+    std::array<glm::vec4, MAX_CASCADES> m_rects {};
+    std::array<float, MAX_CASCADES> m_radius {};
+    glm::vec4 m_splits {};
+    glm::vec4 m_texelWorldSize {};
+};
+
+inline void CascadedShadows::setup(const ShadowSettings& settings) {
+    ShadowSettings clamped {settings};
+    clamped.cascades = std::clamp(settings.cascades, 1, MAX_CASCADES);
+    bool recreate {depthImage.id == SG_INVALID_ID
+                   || clamped.cascades != m_settings.cascades
+                   || clamped.resolution != m_settings.resolution};
+    m_settings = clamped;
+    if (!recreate)
+        return;
+
+    sg_destroy_attachments(attachments);
+    sg_destroy_image(depthImage);
+
+    // two tiles across keeps four 2048 cascades within WebGL2's 4096 limit
+    int columns {std::min(m_settings.cascades, 2)};
+    int rows {(m_settings.cascades + 1) / 2};
+    m_atlasSize = glm::ivec2(columns, rows) * m_settings.resolution;
+
+    depthImage = sg_make_image(sg_image_desc {
+        .render_target = true,
+        .width = m_atlasSize.x,
+        .height = m_atlasSize.y,
+        .pixel_format = SG_PIXELFORMAT_DEPTH,
+        .label = "shadow-atlas"
+    });
+    attachments = sg_make_attachments(sg_attachments_desc {
+        .depth_stencil {
+            .image = depthImage,
+        },
+        .label = "shadow-pass"
+    });
+
+    // linear filtering with a compare function gives 2x2 PCF for free on
+    // every tap
+    if (sampler.id == SG_INVALID_ID) {
+        sampler = sg_make_sampler(sg_sampler_desc {
+            .min_filter = SG_FILTER_LINEAR,
+            .mag_filter = SG_FILTER_LINEAR,
+            .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+            .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .label = "shadow-sampler"
+        });
+    }
+}
+
+inline void CascadedShadows::shutdown() {
+    sg_destroy_attachments(attachments);
+    sg_destroy_image(depthImage);
+    sg_destroy_sampler(sampler);
+}
+
+inline void CascadedShadows::update(const glm::mat4& view,
+                                    float fovy,
+                                    float aspect,
+                                    float zNear,
+                                    const glm::vec3& lightDirection) {
+    int count {m_settings.cascades};
+    float zFar {m_settings.maxDistance};
+    float tanY {std::tan(fovy * 0.5f)};
+    float tanX {tanY * aspect};
+    float kSq {tanX * tanX + tanY * tanY};
+    glm::mat4 invView {glm::inverse(view)};
+    glm::vec3 direction {glm::normalize(lightDirection)};
+    glm::vec3 up {std::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f)};
+
+    m_splits = glm::vec4(0.0f);
+    float splitNear {zNear};
+    for (int c = 0; c < count; ++c) {
+        float p {static_cast<float>(c + 1) / count};
+        float logSplit {zNear * std::pow(zFar / zNear, p)};
+        float uniformSplit {zNear + (zFar - zNear) * p};
+        float splitFar {m_settings.splitLambda * logSplit + (1.0f - m_settings.splitLambda) * uniformSplit};
+        m_splits[c] = splitFar;
+
+        // smallest sphere around the frustum slice, its centre is on the
+        // view axis where the near and far corners are equally far away
+        float centreDepth {std::min(0.5f * (1.0f + kSq) * (splitNear + splitFar), splitFar)};
+        float radius {std::sqrt(splitFar * splitFar * kSq + (splitFar - centreDepth) * (splitFar - centreDepth))};
+        // rounding the radius up stops tiny changes resizing the projection
+        radius = std::ceil(radius * 16.0f) / 16.0f;
+        glm::vec3 centre {invView * glm::vec4(0.0f, 0.0f, -centreDepth, 1.0f)};
+
+        float depthRange {2.0f * radius + m_settings.casterDistance};
+        glm::mat4 lightView {glm::lookAt(centre - direction * (radius + m_settings.casterDistance), centre, up)};
+        glm::mat4 lightProjection {glm::ortho(-radius, radius, -radius, radius, 0.0f, depthRange)};
+
+        // move the projection so the world origin lands on a whole texel,
+        // then everything else does too and the edges stay put
+        glm::vec4 origin {lightProjection * lightView * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)};
+        glm::vec2 texels {glm::vec2(origin) * (m_settings.resolution * 0.5f)};
+        glm::vec2 snap {(glm::round(texels) - texels) * (2.0f / m_settings.resolution)};
+        lightProjection[3][0] += snap.x;
+        lightProjection[3][1] += snap.y;
+
+        m_lightView[c] = lightView;
+        m_radius[c] = radius;
+        m_lightViewProjection[c] = lightProjection * lightView;
+        m_texelWorldSize[c] = 2.0f * radius / m_settings.resolution;
+
+        // clip space -> [0, 1] -> this cascade's tile of the atlas
+        glm::vec2 tileScale {glm::vec2(m_settings.resolution) / glm::vec2(m_atlasSize)};
+        glm::vec2 tileOffset {glm::vec2(tileOrigin(c)) / glm::vec2(m_atlasSize)};
+        glm::mat4 toAtlas {1.0f};
+        toAtlas[0][0] = 0.5f * tileScale.x;
+        toAtlas[1][1] = 0.5f * tileScale.y;
+        toAtlas[2][2] = 0.5f;
+        toAtlas[3] = glm::vec4(tileOffset + 0.5f * tileScale, 0.5f, 1.0f);
+        m_shadowMatrices[c] = toAtlas * m_lightViewProjection[c];
+
+        // PCF taps are kept inside the tile so they never read a neighbour
+        glm::vec2 margin {1.5f / glm::vec2(m_atlasSize)};
+        m_rects[c] = glm::vec4(tileOffset + margin, tileOffset + tileScale - margin);
+
+        splitNear = splitFar;
+    }
+}
+
+inline bool CascadedShadows::casterVisible(int cascade, const glm::vec3& centre, float radius) const {
+    glm::vec3 p {m_lightView[cascade] * glm::vec4(centre, 1.0f)};
+    float extent {m_radius[cascade] + radius};
+    if (std::abs(p.x) > extent || std::abs(p.y) > extent)
+        return false;
+    // the light looks down -z, anything past the far plane can't cast into
+    // the cascade and anything behind the near plane gets clipped anyway
+    float depthRange {2.0f * m_radius[cascade] + m_settings.casterDistance};
+    return p.z - radius <= 0.0f && p.z + radius >= -depthRange;
+}
+
+inline void CascadedShadows::applyViewport(int cascade) const {
+    glm::ivec2 origin {tileOrigin(cascade)};
+    sg_apply_viewport(origin.x, origin.y, m_settings.resolution, m_settings.resolution, false);
+}
+
+template <typename Uniforms>
+inline void CascadedShadows::fillUniforms(Uniforms& uniforms) const {
+    for (int c = 0; c < MAX_CASCADES; ++c) {
+        uniforms.shadowMatrices[c] = m_shadowMatrices[c];
+        uniforms.cascadeRects[c] = m_rects[c];
+    }
+    uniforms.cascadeSplits = m_splits;
+    uniforms.texelWorldSize = m_texelWorldSize;
+    uniforms.shadowParams = glm::vec4(static_cast<float>(m_settings.cascades),
+                                      m_settings.depthBias,
+                                      m_settings.normalOffset,
+                                      uniforms.shadowParams.w);
+}
+
+inline sg_pass_action CascadedShadows::passAction() {
+    return sg_pass_action {
+        .depth {
+            .load_action = SG_LOADACTION_CLEAR,
+            .store_action = SG_STOREACTION_STORE,
+            .clear_value = 1.0f,
+        },
+    };
+}
+
+inline sg_pipeline_desc CascadedShadows::depthPipelineDesc(sg_shader shader,
+                                                           const sg_vertex_layout_state& layout) {
+    return sg_pipeline_desc {
+        .shader = shader,
+        .layout = layout,
+        .depth {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+            .bias = 1.0f,
+            .bias_slope_scale = 1.5f,
+        },
+        .color_count = 0,
+        .cull_mode = SG_CULLMODE_FRONT,
+        .face_winding = SG_FACEWINDING_CCW,
+        .label = "shadow-pipeline"
+    };
+}
+
+}
+#endif
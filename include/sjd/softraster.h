@@ -0,0 +1,1000 @@
+#ifndef SOFTRASTER_H
+#define SOFTRASTER_H
+
+/* SoftRaster
+ * A CPU renderer for the part of the pipeline the demos use, for machines
+ * without a GPU (CI, the thumbnail builds for webdata/) where llvmpipe
+ * isn't around either. It has sokol's depth, stencil, blend and cull state
+ * and three fixed shaders in place of programmable ones: a flat colour (the
+ * light cubes and outlines), a texture (optionally mixed with a second, with
+ * an alpha cutoff for discard) and the Phong lighting of the 2-x demos.
+ *
+ *   sjd::SoftRaster raster;
+ *   raster.resize(800, 600);
+ *   raster.begin(glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+ *   raster.setViewProjection(projection * view);
+ *   raster.draw(sjd::SoftRaster::Draw {
+ *       .pipeline = &cubes, .vertices = vertices.data(), .count = 36,
+ *       .model = model, .texture = &marble});
+ *   raster.end();
+ *
+ * draw() does the vertex work straight away: transform, clip against the
+ * frustum, cull, and set up each triangle's edge functions in fixed point
+ * with 4 bits of subpixel precision. The triangles are binned into 64x64
+ * pixel tiles and end() rasterises the tiles in parallel on the JobSystem.
+ * A tile belongs to one job so nothing is shared, and its triangles are run
+ * in the order they were drawn, so depth, stencil and blending come out as
+ * they would on a GPU. Inside a tile the edge functions and depth are
+ * worked out four pixels at a time with SSE2, stepping the integer edge
+ * functions along the row rather than multiplying, and only covered pixels
+ * that pass the tests are shaded.
+ *
+ * setReference(true) switches end() to the plain version: one thread, no
+ * tiles, and each pixel's edge functions worked out on their own in 64 bit.
+ * The shading is shared and the edge functions are exact integers either
+ * way, so the two paths should make identical images, and compare() says
+ * how far apart two images are.
+ *
+ * The output is RGBA8 with the top row first, rows stride() pixels apart.
+ * Textures are sampled bilinear with no mipmaps, like the demos' samplers.
+ * Vertices are used up by draw(), but textures have to live until end().
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <sjd/jobs.h>
+#include <sjd/normal_matrix.h>
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+// emscripten maps these onto wasm simd128 when built with -msse2 -msimd128
+#include <emmintrin.h>
+#define SJD_SOFTRASTER_SSE
+#endif
+
+namespace sjd {
+// an RGBA8 image
+class SoftTexture {
+public:
+    enum class Wrap { REPEAT, CLAMP_TO_EDGE };
+
+    SoftTexture() = default;
+    // width * height * 4 bytes from stbi_load(..., 4), the first row at v = 0
+    // like an sg_image made from the same pixels
+    SoftTexture(int width, int height, const unsigned char* rgba, Wrap wrap = Wrap::REPEAT);
+
+    int width() const {
+        return m_width;
+    }
+
+    int height() const {
+        return m_height;
+    }
+
+    bool empty() const {
+        return m_texels.empty();
+    }
+
+    // bilinear, like the demos' samplers
+    glm::vec4 sample(const glm::vec2& uv) const;
+
+private:
+    int m_width {};
+    int m_height {};
+    Wrap m_wrap {Wrap::REPEAT};
+    // red in the lowest byte, a quarter of the cache that floats would take
+    std::vector<uint32_t> m_texels;
+};
+
+class SoftRaster {
+public:
+    static constexpr int TILE_SIZE {64};
+    // with 4 bits of subpixel precision the edge functions fit in 32 bits up to here
+    static constexpr int MAX_SIZE {2040};
+
+    enum class Compare { NEVER, LESS, EQUAL, LESS_EQUAL, GREATER, NOT_EQUAL, GREATER_EQUAL, ALWAYS };
+    enum class StencilOp { KEEP, ZERO, REPLACE, INCR_CLAMP, DECR_CLAMP, INVERT, INCR_WRAP, DECR_WRAP };
+    // ALPHA is src_alpha, one_minus_src_alpha and ADD is one, one, on all four channels
+    enum class Blend { NONE, ALPHA, ADD };
+    enum class Cull { NONE, FRONT, BACK };
+    // which winding faces the camera, sokol's default is clockwise
+    enum class Winding { CW, CCW };
+    enum class Shader { COLOUR, TEXTURE, LIT };
+
+    struct Vertex {
+        glm::vec3 position;
+        glm::vec3 normal;
+        glm::vec2 uv;
+    };
+
+    // the parts of sg_pipeline_desc it has, with sokol's defaults
+    struct Pipeline {
+        Shader shader {Shader::COLOUR};
+        Compare depthCompare {Compare::ALWAYS};
+        bool depthWrite {false};
+        bool stencilEnabled {false};
+        Compare stencilCompare {Compare::ALWAYS};
+        StencilOp stencilFail {StencilOp::KEEP};
+        StencilOp stencilDepthFail {StencilOp::KEEP};
+        StencilOp stencilPass {StencilOp::KEEP};
+        uint8_t stencilReadMask {0};
+        uint8_t stencilWriteMask {0};
+        uint8_t stencilRef {0};
+        Blend blend {Blend::NONE};
+        Cull cull {Cull::NONE};
+        Winding faceWinding {Winding::CW};
+    };
+
+    // one sg_draw of a triangle list
+    struct Draw {
+        const Pipeline* pipeline {nullptr};
+        const Vertex* vertices {nullptr};
+        size_t count {0};
+        glm::mat4 model {1.0f};
+        // COLOUR's colour, TEXTURE is multiplied by it and LIT uses it
+        // (rgb) when there's no texture
+        glm::vec4 colour {1.0f};
+        // TEXTURE's texture or LIT's diffuse map
+        const SoftTexture* texture {nullptr};
+        // TEXTURE mixes it in by mix, for LIT it's the specular map
+        const SoftTexture* texture2 {nullptr};
+        float mix {0.0f};
+        // TEXTURE discards fragments with less alpha than this
+        float alphaCutoff {0.0f};
+    };
+
+    // LIT's lights, the same as the multiple lights demo's uniforms
+    struct DirectionalLight {
+        glm::vec3 direction {-0.2f, -1.0f, -0.3f};
+        glm::vec3 ambient {0.0f};
+        glm::vec3 diffuse {0.0f};
+        glm::vec3 specular {0.0f};
+    };
+
+    struct PointLight {
+        glm::vec3 position {0.0f};
+        glm::vec3 ambient {0.0f};
+        glm::vec3 diffuse {0.0f};
+        glm::vec3 specular {0.0f};
+        float constant {1.0f};
+        float linear {0.09f};
+        float quadratic {0.032f};
+    };
+
+    // cutOff and outerCutOff are cosines
+    struct SpotLight {
+        bool enabled {false};
+        glm::vec3 position {0.0f};
+        glm::vec3 direction {0.0f, 0.0f, -1.0f};
+        float cutOff {};
+        float outerCutOff {};
+        glm::vec3 diffuse {0.0f};
+        glm::vec3 specular {0.0f};
+        float constant {1.0f};
+        float linear {0.09f};
+        float quadratic {0.032f};
+    };
+
+    struct Lighting {
+        glm::vec3 viewPos {0.0f};
+        float shininess {32.0f};
+        DirectionalLight directional;
+        std::vector<PointLight> points;
+        SpotLight spot;
+    };
+
+    struct Difference {
+        // pixels with a channel more than the tolerance apart
+        size_t pixels {};
+        // the biggest channel difference, 0 to 255
+        int maxError {};
+    };
+
+    void resize(int width, int height);
+
+    int width() const {
+        return m_width;
+    }
+
+    int height() const {
+        return m_height;
+    }
+
+    // pixels from one row to the next, width() rounded up to 4
+    int stride() const {
+        return m_stride;
+    }
+
+    // starts a frame, it's cleared to these as a pass with clear load actions would be
+    void begin(const glm::vec4& clearColour, float clearDepth = 1.0f, uint8_t clearStencil = 0);
+    void setViewProjection(const glm::mat4& viewProjection);
+    // LIT draws are shaded in end(), so the whole frame uses whatever was set last
+    void setLighting(const Lighting& lighting);
+    void draw(const Draw& draw);
+    // rasterises the frame with the tiles split into threadCount pieces on
+    // the JobSystem (no more than it has threads), with 1 it stays on the
+    // calling thread
+    void end(unsigned threadCount = JobSystem::instance().threadCount());
+
+    void setReference(bool reference) {
+        m_reference = reference;
+    }
+
+    bool reference() const {
+        return m_reference;
+    }
+
+    // RGBA8 with red in the lowest byte
+    const uint32_t* colour() const {
+        return m_colour.data();
+    }
+
+    const float* depth() const {
+        return m_depth.data();
+    }
+
+    const uint8_t* stencil() const {
+        return m_stencil.data();
+    }
+
+    static Difference compare(const SoftRaster& a, const SoftRaster& b, int tolerance = 0);
+
+    // the last frame's triangles, after clipping and culling
+    size_t triangleCount() const {
+        return m_triangles.size();
+    }
+
+    void report() const;
+
+private:
+    // uv, world position, normal
+    static constexpr int MAX_ATTRIBUTES {8};
+
+    // clip space position and the attributes the draw's shader interpolates
+    struct ClipVertex {
+        glm::vec4 position;
+        float attributes[MAX_ATTRIBUTES];
+    };
+
+    struct Triangle {
+        // edge function k at pixel (x, y) is base + stepX * x + stepY * y.
+        // bias has been taken off base for edges that aren't top or left,
+        // so >= 0 is inside; it's added back for interpolating
+        int64_t base[3];
+        int32_t stepX[3];
+        int32_t stepY[3];
+        int32_t bias[3];
+        int minX, minY, maxX, maxY;
+        // a value is v0 + e1 * d1 + e2 * d2, e1 and e2 being edge functions
+        // 1 and 2 (the barycentrics times twice the area)
+        float z, dz1, dz2;
+        // 1 / w and attributes / w, for perspective correct attributes
+        float w, dw1, dw2;
+        float attributes[MAX_ATTRIBUTES];
+        float d1[MAX_ATTRIBUTES];
+        float d2[MAX_ATTRIBUTES];
+        int attributeCount;
+        uint32_t draw;
+    };
+
+    struct DrawState {
+        Draw draw;
+        Pipeline pipeline;
+    };
+
+    static int attributeCount(Shader shader);
+    static int outcode(const glm::vec4& position);
+    template <typename T>
+    static bool test(Compare compare, T incoming, T stored);
+
+    void addTriangle(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, uint32_t draw);
+    void setup(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, uint32_t draw);
+    // t over the pixels in [minX, maxX] x [minY, maxY]
+    void rasterize(const Triangle& t, int minX, int minY, int maxX, int maxY);
+    void rasterizeScalar(const Triangle& t, int minX, int minY, int maxX, int maxY);
+    void clear(int minX, int minY, int maxX, int maxY);
+    void fragment(const Triangle& t, const DrawState& state, size_t index, float e1, float e2, float depth, bool depthPass);
+    // false when the fragment is discarded
+    bool shade(const Triangle& t, const DrawState& state, float e1, float e2, glm::vec4& colour) const;
+    glm::vec3 light(const DrawState& state, const glm::vec2& uv, const glm::vec3& position, const glm::vec3& normal) const;
+
+    int m_width {};
+    int m_height {};
+    int m_stride {};
+    int m_tilesX {};
+    int m_tilesY {};
+    bool m_reference {false};
+
+    std::vector<uint32_t> m_colour;
+    std::vector<float> m_depth;
+    std::vector<uint8_t> m_stencil;
+
+    uint32_t m_clearColour {};
+    float m_clearDepth {1.0f};
+    uint8_t m_clearStencil {};
+    glm::mat4 m_viewProjection {1.0f};
+    Lighting m_lighting;
+
+    // this frame's work, cleared by begin() but kept allocated
+    std::vector<DrawState> m_draws;
+    std::vector<ClipVertex> m_vertices;
+    std::vector<Triangle> m_triangles;
+    // triangle indices touching each tile, in draw order
+    std::vector<std::vector<uint32_t>> m_bins;
+};
+
+inline SoftTexture::SoftTexture(int width, int height, const unsigned char* rgba, Wrap wrap)
+: m_width {width}
+, m_height {height}
+, m_wrap {wrap}
+, m_texels(static_cast<size_t>(width) * height) {
+    for (size_t i {0}; i < m_texels.size(); ++i) {
+        const unsigned char* texel {rgba + i * 4};
+        m_texels[i] = static_cast<uint32_t>(texel[0]) | static_cast<uint32_t>(texel[1]) << 8
+                    | static_cast<uint32_t>(texel[2]) << 16 | static_cast<uint32_t>(texel[3]) << 24;
+    }
+}
+
+inline glm::vec4 SoftTexture::sample(const glm::vec2& uv) const {
+    if (m_texels.empty())
+        return glm::vec4(1.0f);
+
+    // texel centres are at halves. Truncating and stepping back for
+    // negatives is floor() without the library call
+    float x {uv.x * m_width - 0.5f};
+    float y {uv.y * m_height - 0.5f};
+    int left {static_cast<int>(x)};
+    int top {static_cast<int>(y)};
+    left -= x < static_cast<float>(left) ? 1 : 0;
+    top -= y < static_cast<float>(top) ? 1 : 0;
+    float tx {x - static_cast<float>(left)};
+    float ty {y - static_cast<float>(top)};
+
+    int x0, y0, x1, y1;
+    if (m_wrap == Wrap::REPEAT) {
+        // the modulo is slow, and only needed once the coordinates have left the texture
+        auto repeat = [](int i, int size) {
+            if (static_cast<unsigned>(i) < static_cast<unsigned>(size))
+                return i;
+            i %= size;
+            return i < 0 ? i + size : i;
+        };
+        x0 = repeat(left, m_width);
+        y0 = repeat(top, m_height);
+        x1 = x0 + 1 < m_width ? x0 + 1 : 0;
+        y1 = y0 + 1 < m_height ? y0 + 1 : 0;
+    } else {
+        x0 = std::clamp(left, 0, m_width - 1);
+        y0 = std::clamp(top, 0, m_height - 1);
+        x1 = std::clamp(left + 1, 0, m_width - 1);
+        y1 = std::clamp(top + 1, 0, m_height - 1);
+    }
+
+    const uint32_t* row0 {&m_texels[static_cast<size_t>(y0) * m_width]};
+    const uint32_t* row1 {&m_texels[static_cast<size_t>(y1) * m_width]};
+#ifdef SJD_SOFTRASTER_SSE
+    // a texel's four bytes widened to a float each
+    __m128i zero {_mm_setzero_si128()};
+    auto unpack = [zero](uint32_t texel) {
+        __m128i bytes {_mm_cvtsi32_si128(static_cast<int>(texel))};
+        return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero));
+    };
+    __m128 a {unpack(row0[x0])}, b {unpack(row0[x1])};
+    __m128 c {unpack(row1[x0])}, d {unpack(row1[x1])};
+    __m128 weightX {_mm_set1_ps(tx)};
+    __m128 upper {_mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), weightX))};
+    __m128 lower {_mm_add_ps(c, _mm_mul_ps(_mm_sub_ps(d, c), weightX))};
+    __m128 texel {_mm_add_ps(upper, _mm_mul_ps(_mm_sub_ps(lower, upper), _mm_set1_ps(ty)))};
+    glm::vec4 colour;
+    _mm_storeu_ps(&colour[0], _mm_mul_ps(texel, _mm_set1_ps(1.0f / 255.0f)));
+    return colour;
+#else
+    auto unpack = [](uint32_t texel) {
+        return glm::vec4(texel & 0xFF, (texel >> 8) & 0xFF, (texel >> 16) & 0xFF, texel >> 24);
+    };
+    glm::vec4 upper {unpack(row0[x0]) + (unpack(row0[x1]) - unpack(row0[x0])) * tx};
+    glm::vec4 lower {unpack(row1[x0]) + (unpack(row1[x1]) - unpack(row1[x0])) * tx};
+    return (upper + (lower - upper) * ty) * (1.0f / 255.0f);
+#endif
+}
+
+inline void SoftRaster::resize(int width, int height) {
+    if (width > MAX_SIZE || height > MAX_SIZE)
+        std::cout << "WARNING::SOFTRASTER::RESIZE: " << width << "x" << height
+                  << " is too big, clamping to " << MAX_SIZE << "\n";
+    m_width = std::clamp(width, 1, MAX_SIZE);
+    m_height = std::clamp(height, 1, MAX_SIZE);
+    // rows are whole groups of four so a group never reads into the next row
+    m_stride = (m_width + 3) & ~3;
+    size_t pixels {static_cast<size_t>(m_stride) * m_height};
+    m_colour.assign(pixels, 0);
+    m_depth.assign(pixels, 1.0f);
+    m_stencil.assign(pixels, 0);
+
+    m_tilesX = (m_width + TILE_SIZE - 1) / TILE_SIZE;
+    m_tilesY = (m_height + TILE_SIZE - 1) / TILE_SIZE;
+    m_bins.resize(static_cast<size_t>(m_tilesX) * m_tilesY);
+}
+
+inline void SoftRaster::begin(const glm::vec4& clearColour, float clearDepth, uint8_t clearStencil) {
+    uint32_t packed {0};
+    for (int channel {0}; channel < 4; ++channel)
+        packed |= static_cast<uint32_t>(std::clamp(clearColour[channel], 0.0f, 1.0f) * 255.0f + 0.5f) << (channel * 8);
+    m_clearColour = packed;
+    m_clearDepth = clearDepth;
+    m_clearStencil = clearStencil;
+
+    m_draws.clear();
+    m_triangles.clear();
+    for (std::vector<uint32_t>& bin : m_bins)
+        bin.clear();
+}
+
+inline void SoftRaster::setViewProjection(const glm::mat4& viewProjection) {
+    m_viewProjection = viewProjection;
+}
+
+inline void SoftRaster::setLighting(const Lighting& lighting) {
+    m_lighting = lighting;
+}
+
+inline int SoftRaster::attributeCount(Shader shader) {
+    switch (shader) {
+        case Shader::TEXTURE:
+            return 2;
+        case Shader::LIT:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+inline void SoftRaster::draw(const Draw& draw) {
+    if (draw.pipeline == nullptr || draw.vertices == nullptr || draw.count < 3)
+        return;
+
+    uint32_t drawIndex {static_cast<uint32_t>(m_draws.size())};
+    m_draws.push_back(DrawState {draw, *draw.pipeline});
+    Shader shader {draw.pipeline->shader};
+
+    glm::mat4 mvp {m_viewProjection * draw.model};
+    glm::mat4 normal {shader == Shader::LIT ? normalMatrix(draw.model) : glm::mat4(1.0f)};
+    m_vertices.resize(draw.count);
+    for (size_t i {0}; i < draw.count; ++i) {
+        const Vertex& in {draw.vertices[i]};
+        ClipVertex& out {m_vertices[i]};
+        out.position = mvp * glm::vec4(in.position, 1.0f);
+        if (shader == Shader::COLOUR)
+            continue;
+        out.attributes[0] = in.uv.x;
+        out.attributes[1] = in.uv.y;
+        if (shader != Shader::LIT)
+            continue;
+        glm::vec4 world {draw.model * glm::vec4(in.position, 1.0f)};
+        glm::vec4 n {normal * glm::vec4(in.normal, 0.0f)};
+        for (int k {0}; k < 3; ++k) {
+            out.attributes[2 + k] = world[k];
+            out.attributes[5 + k] = n[k];
+        }
+    }
+
+    for (size_t i {0}; i + 2 < draw.count; i += 3)
+        addTriangle(m_vertices[i], m_vertices[i + 1], m_vertices[i + 2], drawIndex);
+}
+
+// a bit for each clip plane the position is outside of
+inline int SoftRaster::outcode(const glm::vec4& position) {
+    int code {0};
+    for (int axis {0}; axis < 3; ++axis) {
+        if (position[axis] < -position.w)
+            code |= 1 << (axis * 2);
+        if (position[axis] > position.w)
+            code |= 2 << (axis * 2);
+    }
+    return code;
+}
+
+inline void SoftRaster::addTriangle(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, uint32_t draw) {
+    int codeA {outcode(a.position)};
+    int codeB {outcode(b.position)};
+    int codeC {outcode(c.position)};
+    // all outside the same plane
+    if (codeA & codeB & codeC)
+        return;
+    int crossed {codeA | codeB | codeC};
+    if (crossed == 0) {
+        setup(a, b, c, draw);
+        return;
+    }
+
+    // Sutherland-Hodgman, only against the planes something is outside of.
+    // Each plane can add one vertex, so a triangle ends up with at most 9
+    int count {attributeCount(m_draws[draw].pipeline.shader)};
+    ClipVertex polygon[2][9] {{a, b, c}};
+    int size {3};
+    int current {0};
+    for (int plane {0}; plane < 6; ++plane) {
+        if (!(crossed & (1 << plane)))
+            continue;
+        int axis {plane / 2};
+        float sign {plane % 2 == 0 ? 1.0f : -1.0f};
+        const ClipVertex* in {polygon[current]};
+        ClipVertex* out {polygon[current ^ 1]};
+        int outSize {0};
+        for (int i {0}; i < size; ++i) {
+            const ClipVertex& p {in[i]};
+            const ClipVertex& q {in[(i + 1) % size]};
+            // distance inside the plane, w + x for x >= -w, w - x for x <= w
+            float dp {p.position.w + sign * p.position[axis]};
+            float dq {q.position.w + sign * q.position[axis]};
+            if (dp >= 0.0f)
+                out[outSize++] = p;
+            if ((dp >= 0.0f) != (dq >= 0.0f)) {
+                float t {dp / (dp - dq)};
+                ClipVertex& v {out[outSize++]};
+                v.position = p.position + (q.position - p.position) * t;
+                for (int k {0}; k < count; ++k)
+                    v.attributes[k] = p.attributes[k] + (q.attributes[k] - p.attributes[k]) * t;
+            }
+        }
+        size = outSize;
+        current ^= 1;
+        if (size < 3)
+            return;
+    }
+
+    for (int i {1}; i + 1 < size; ++i)
+        setup(polygon[current][0], polygon[current][i], polygon[current][i + 1], draw);
+}
+
+inline void SoftRaster::setup(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, uint32_t draw) {
+    const ClipVertex* v[3] {&a, &b, &c};
+    int32_t x[3], y[3];
+    float z[3], w[3];
+    for (int k {0}; k < 3; ++k) {
+        const glm::vec4& p {v[k]->position};
+        float invW {1.0f / p.w};
+        // top row first, so y is flipped
+        float sx {(p.x * invW * 0.5f + 0.5f) * m_width};
+        float sy {(0.5f - p.y * invW * 0.5f) * m_height};
+        x[k] = std::clamp(static_cast<int32_t>(std::lround(sx * 16.0f)), 0, m_width * 16);
+        y[k] = std::clamp(static_cast<int32_t>(std::lround(sy * 16.0f)), 0, m_height * 16);
+        z[k] = p.z * invW * 0.5f + 0.5f;
+        w[k] = invW;
+    }
+
+    int64_t area {static_cast<int64_t>(x[1] - x[0]) * (y[2] - y[0]) - static_cast<int64_t>(y[1] - y[0]) * (x[2] - x[0])};
+    if (area == 0)
+        return;
+    // y points down, so counter-clockwise faces have a negative area
+    bool ccw {area < 0};
+    const Pipeline& pipeline {m_draws[draw].pipeline};
+    bool front {ccw == (pipeline.faceWinding == Winding::CCW)};
+    if ((pipeline.cull == Cull::BACK && !front) || (pipeline.cull == Cull::FRONT && front))
+        return;
+    // the edge functions are set up for a positive area
+    if (ccw) {
+        std::swap(v[1], v[2]);
+        std::swap(x[1], x[2]);
+        std::swap(y[1], y[2]);
+        std::swap(z[1], z[2]);
+        std::swap(w[1], w[2]);
+        area = -area;
+    }
+
+    Triangle t {};
+    t.minX = std::max(std::min({x[0], x[1], x[2]}) >> 4, 0);
+    t.minY = std::max(std::min({y[0], y[1], y[2]}) >> 4, 0);
+    t.maxX = std::min(std::max({x[0], x[1], x[2]}) >> 4, m_width - 1);
+    t.maxY = std::min(std::max({y[0], y[1], y[2]}) >> 4, m_height - 1);
+    if (t.minX > t.maxX || t.minY > t.maxY)
+        return;
+
+    // edge k is the one opposite vertex k and is positive inside. It's
+    // sampled at pixel centres, (x * 16 + 8, y * 16 + 8) in fixed point
+    for (int k {0}; k < 3; ++k) {
+        int from {(k + 1) % 3};
+        int to {(k + 2) % 3};
+        int32_t edgeA {y[from] - y[to]};
+        int32_t edgeB {x[to] - x[from]};
+        int64_t edgeC {-(static_cast<int64_t>(edgeA) * x[from] + static_cast<int64_t>(edgeB) * y[from])};
+        bool topLeft {edgeA > 0 || (edgeA == 0 && edgeB > 0)};
+        t.bias[k] = topLeft ? 0 : 1;
+        t.base[k] = edgeA * 8 + edgeB * 8 + edgeC - t.bias[k];
+        t.stepX[k] = edgeA * 16;
+        t.stepY[k] = edgeB * 16;
+    }
+
+    float invArea {1.0f / static_cast<float>(area)};
+    t.z = z[0];
+    t.dz1 = (z[1] - z[0]) * invArea;
+    t.dz2 = (z[2] - z[0]) * invArea;
+    t.w = w[0];
+    t.dw1 = (w[1] - w[0]) * invArea;
+    t.dw2 = (w[2] - w[0]) * invArea;
+    t.attributeCount = attributeCount(m_draws[draw].pipeline.shader);
+    for (int k {0}; k < t.attributeCount; ++k) {
+        float a0 {v[0]->attributes[k] * w[0]};
+        t.attributes[k] = a0;
+        t.d1[k] = (v[1]->attributes[k] * w[1] - a0) * invArea;
+        t.d2[k] = (v[2]->attributes[k] * w[2] - a0) * invArea;
+    }
+    t.draw = draw;
+
+    uint32_t index {static_cast<uint32_t>(m_triangles.size())};
+    m_triangles.push_back(t);
+    if (m_reference)
+        return;
+
+    // into every tile its bounds touch, unless one edge has the whole tile
+    // outside, tested at the tile's corner furthest along that edge
+    for (int tileY {t.minY / TILE_SIZE}; tileY <= t.maxY / TILE_SIZE; ++tileY) {
+        for (int tileX {t.minX / TILE_SIZE}; tileX <= t.maxX / TILE_SIZE; ++tileX) {
+            int left {tileX * TILE_SIZE};
+            int top {tileY * TILE_SIZE};
+            bool outside {false};
+            for (int k {0}; k < 3 && !outside; ++k) {
+                int cornerX {t.stepX[k] > 0 ? left + TILE_SIZE - 1 : left};
+                int cornerY {t.stepY[k] > 0 ? top + TILE_SIZE - 1 : top};
+                outside = t.base[k] + static_cast<int64_t>(t.stepX[k]) * cornerX + static_cast<int64_t>(t.stepY[k]) * cornerY < 0;
+            }
+            if (!outside)
+                m_bins[static_cast<size_t>(tileY) * m_tilesX + tileX].push_back(index);
+        }
+    }
+}
+
+inline void SoftRaster::end(unsigned threadCount) {
+    if (m_reference) {
+        clear(0, 0, m_width - 1, m_height - 1);
+        for (const Triangle& t : m_triangles)
+            rasterizeScalar(t, t.minX, t.minY, t.maxX, t.maxY);
+        return;
+    }
+
+    auto tiles = [this](int first, int last) {
+        for (int tile {first}; tile < last; ++tile) {
+            int minX {(tile % m_tilesX) * TILE_SIZE};
+            int minY {(tile / m_tilesX) * TILE_SIZE};
+            int maxX {std::min(minX + TILE_SIZE, m_width) - 1};
+            int maxY {std::min(minY + TILE_SIZE, m_height) - 1};
+            clear(minX, minY, maxX, maxY);
+            for (uint32_t index : m_bins[tile])
+                rasterize(m_triangles[index], minX, minY, maxX, maxY);
+        }
+    };
+    int count {static_cast<int>(m_bins.size())};
+    if (threadCount <= 1) {
+        tiles(0, count);
+        return;
+    }
+    // a grain of count / threadCount keeps it to threadCount pieces
+    int grain {(count + static_cast<int>(threadCount) - 1) / static_cast<int>(threadCount)};
+    JobSystem::instance().parallelFor(0, count, grain, tiles);
+}
+
+inline void SoftRaster::clear(int minX, int minY, int maxX, int maxY) {
+    for (int y {minY}; y <= maxY; ++y) {
+        size_t first {static_cast<size_t>(y) * m_stride + minX};
+        size_t last {static_cast<size_t>(y) * m_stride + maxX + 1};
+        std::fill(m_colour.begin() + first, m_colour.begin() + last, m_clearColour);
+        std::fill(m_depth.begin() + first, m_depth.begin() + last, m_clearDepth);
+        std::fill(m_stencil.begin() + first, m_stencil.begin() + last, m_clearStencil);
+    }
+}
+
+template <typename T>
+inline bool SoftRaster::test(Compare compare, T incoming, T stored) {
+    switch (compare) {
+        case Compare::NEVER:
+            return false;
+        case Compare::LESS:
+            return incoming < stored;
+        case Compare::EQUAL:
+            return incoming == stored;
+        case Compare::LESS_EQUAL:
+            return incoming <= stored;
+        case Compare::GREATER:
+            return incoming > stored;
+        case Compare::NOT_EQUAL:
+            return incoming != stored;
+        case Compare::GREATER_EQUAL:
+            return incoming >= stored;
+        default:
+            return true;
+    }
+}
+
+inline void SoftRaster::rasterizeScalar(const Triangle& t, int minX, int minY, int maxX, int maxY) {
+    const DrawState& state {m_draws[t.draw]};
+    Compare depthCompare {state.pipeline.depthCompare};
+    minX = std::max(minX, t.minX);
+    minY = std::max(minY, t.minY);
+    maxX = std::min(maxX, t.maxX);
+    maxY = std::min(maxY, t.maxY);
+    for (int y {minY}; y <= maxY; ++y) {
+        for (int x {minX}; x <= maxX; ++x) {
+            int64_t e[3];
+            for (int k {0}; k < 3; ++k)
+                e[k] = t.base[k] + static_cast<int64_t>(t.stepX[k]) * x + static_cast<int64_t>(t.stepY[k]) * y;
+            if ((e[0] | e[1] | e[2]) < 0)
+                continue;
+            size_t index {static_cast<size_t>(y) * m_stride + x};
+            float e1 {static_cast<float>(e[1] + t.bias[1])};
+            float e2 {static_cast<float>(e[2] + t.bias[2])};
+            float depth {t.z + e1 * t.dz1 + e2 * t.dz2};
+            fragment(t, state, index, e1, e2, depth, test(depthCompare, depth, m_depth[index]));
+        }
+    }
+}
+
+#ifdef SJD_SOFTRASTER_SSE
+inline void SoftRaster::rasterize(const Triangle& t, int minX, int minY, int maxX, int maxY) {
+    const DrawState& state {m_draws[t.draw]};
+    Compare depthCompare {state.pipeline.depthCompare};
+    bool stencil {state.pipeline.stencilEnabled};
+    minX = std::max(minX, t.minX);
+    minY = std::max(minY, t.minY);
+    maxX = std::min(maxX, t.maxX);
+    maxY = std::min(maxY, t.maxY);
+    if (minX > maxX || minY > maxY)
+        return;
+
+    // groups of four start on multiples of four, like the tiles and rows
+    int startX {minX & ~3};
+    __m128i bias1 {_mm_set1_epi32(t.bias[1])};
+    __m128i bias2 {_mm_set1_epi32(t.bias[2])};
+    __m128 z0 {_mm_set1_ps(t.z)};
+    __m128 dz1 {_mm_set1_ps(t.dz1)};
+    __m128 dz2 {_mm_set1_ps(t.dz2)};
+    __m128i step[3];
+    for (int k {0}; k < 3; ++k)
+        step[k] = _mm_set1_epi32(t.stepX[k] * 4);
+
+    for (int y {minY}; y <= maxY; ++y) {
+        __m128i edge[3];
+        for (int k {0}; k < 3; ++k) {
+            int32_t e {static_cast<int32_t>(t.base[k] + static_cast<int64_t>(t.stepX[k]) * startX + static_cast<int64_t>(t.stepY[k]) * y)};
+            edge[k] = _mm_setr_epi32(e, e + t.stepX[k], e + t.stepX[k] * 2, e + t.stepX[k] * 3);
+        }
+        size_t row {static_cast<size_t>(y) * m_stride};
+
+        for (int x {startX}; x <= maxX; x += 4) {
+            // a lane's inside when none of its edge functions has the sign bit set
+            __m128i signs {_mm_or_si128(_mm_or_si128(edge[0], edge[1]), edge[2])};
+            int mask {~_mm_movemask_ps(_mm_castsi128_ps(signs)) & 0xF};
+            if (x < minX)
+                mask &= 0xF << (minX - x);
+            if (x + 3 > maxX)
+                mask &= 0xF >> (x + 3 - maxX);
+
+            if (mask) {
+                __m128 e1 {_mm_cvtepi32_ps(_mm_add_epi32(edge[1], bias1))};
+                __m128 e2 {_mm_cvtepi32_ps(_mm_add_epi32(edge[2], bias2))};
+                __m128 depth {_mm_add_ps(_mm_add_ps(z0, _mm_mul_ps(e1, dz1)), _mm_mul_ps(e2, dz2))};
+                __m128 stored {_mm_loadu_ps(&m_depth[row + x])};
+                __m128 pass;
+                switch (depthCompare) {
+                    case Compare::NEVER:
+                        pass = _mm_setzero_ps();
+                        break;
+                    case Compare::LESS:
+                        pass = _mm_cmplt_ps(depth, stored);
+                        break;
+                    case Compare::EQUAL:
+                        pass = _mm_cmpeq_ps(depth, stored);
+                        break;
+                    case Compare::LESS_EQUAL:
+                        pass = _mm_cmple_ps(depth, stored);
+                        break;
+                    case Compare::GREATER:
+                        pass = _mm_cmpgt_ps(depth, stored);
+                        break;
+                    case Compare::NOT_EQUAL:
+                        pass = _mm_cmpneq_ps(depth, stored);
+                        break;
+                    case Compare::GREATER_EQUAL:
+                        pass = _mm_cmpge_ps(depth, stored);
+                        break;
+                    default:
+                        pass = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                        break;
+                }
+                int depthMask {_mm_movemask_ps(pass)};
+                // failing depth still runs the stencil's depth fail op
+                int lanes {stencil ? mask : mask & depthMask};
+                if (lanes) {
+                    alignas(16) float e1s[4], e2s[4], depths[4];
+                    _mm_store_ps(e1s, e1);
+                    _mm_store_ps(e2s, e2);
+                    _mm_store_ps(depths, depth);
+                    for (int lane {0}; lane < 4; ++lane) {
+                        if (lanes & (1 << lane))
+                            fragment(t, state, row + x + lane, e1s[lane], e2s[lane], depths[lane], (depthMask & (1 << lane)) != 0);
+                    }
+                }
+            }
+
+            for (int k {0}; k < 3; ++k)
+                edge[k] = _mm_add_epi32(edge[k], step[k]);
+        }
+    }
+}
+#else
+inline void SoftRaster::rasterize(const Triangle& t, int minX, int minY, int maxX, int maxY) {
+    rasterizeScalar(t, minX, minY, maxX, maxY);
+}
+#endif
+
+inline void SoftRaster::fragment(const Triangle& t, const DrawState& state, size_t index, float e1, float e2, float depth, bool depthPass) {
+    const Pipeline& pipeline {state.pipeline};
+    glm::vec4 colour;
+    if (pipeline.stencilEnabled) {
+        uint8_t& stencil {m_stencil[index]};
+        bool stencilPass {test<int>(pipeline.stencilCompare, pipeline.stencilRef & pipeline.stencilReadMask, stencil & pipeline.stencilReadMask)};
+        StencilOp op {!stencilPass ? pipeline.stencilFail : !depthPass ? pipeline.stencilDepthFail : pipeline.stencilPass};
+        if (stencilPass && depthPass) {
+            if (!shade(t, state, e1, e2, colour))
+                return;
+        } else if (op == StencilOp::KEEP || (state.draw.alphaCutoff > 0.0f && !shade(t, state, e1, e2, colour))) {
+            // a discarded fragment leaves the stencil alone too
+            return;
+        }
+
+        int value {stencil};
+        switch (op) {
+            case StencilOp::ZERO:
+                value = 0;
+                break;
+            case StencilOp::REPLACE:
+                value = pipeline.stencilRef;
+                break;
+            case StencilOp::INCR_CLAMP:
+                value = std::min(value + 1, 255);
+                break;
+            case StencilOp::DECR_CLAMP:
+                value = std::max(value - 1, 0);
+                break;
+            case StencilOp::INVERT:
+                value = ~value;
+                break;
+            case StencilOp::INCR_WRAP:
+                value = value + 1;
+                break;
+            case StencilOp::DECR_WRAP:
+                value = value - 1;
+                break;
+            default:
+                break;
+        }
+        stencil = static_cast<uint8_t>((stencil & ~pipeline.stencilWriteMask) | (value & pipeline.stencilWriteMask));
+        if (!stencilPass || !depthPass)
+            return;
+    } else if (!depthPass || !shade(t, state, e1, e2, colour)) {
+        return;
+    }
+
+    if (pipeline.depthWrite)
+        m_depth[index] = depth;
+
+    uint32_t& target {m_colour[index]};
+    colour = glm::clamp(colour, 0.0f, 1.0f);
+    if (pipeline.blend != Blend::NONE) {
+        glm::vec4 destination;
+        for (int channel {0}; channel < 4; ++channel)
+            destination[channel] = static_cast<float>((target >> (channel * 8)) & 0xFF) * (1.0f / 255.0f);
+        float alpha {colour.w};
+        if (pipeline.blend == Blend::ALPHA)
+            colour = colour * alpha + destination * (1.0f - alpha);
+        else
+            colour = glm::min(colour + destination, glm::vec4(1.0f));
+    }
+    uint32_t packed {0};
+    for (int channel {0}; channel < 4; ++channel)
+        packed |= static_cast<uint32_t>(colour[channel] * 255.0f + 0.5f) << (channel * 8);
+    target = packed;
+}
+
+inline bool SoftRaster::shade(const Triangle& t, const DrawState& state, float e1, float e2, glm::vec4& colour) const {
+    const Draw& draw {state.draw};
+    if (state.pipeline.shader == Shader::COLOUR) {
+        colour = draw.colour;
+        return true;
+    }
+
+    float w {1.0f / (t.w + e1 * t.dw1 + e2 * t.dw2)};
+    float a[MAX_ATTRIBUTES];
+    for (int k {0}; k < t.attributeCount; ++k)
+        a[k] = (t.attributes[k] + e1 * t.d1[k] + e2 * t.d2[k]) * w;
+    glm::vec2 uv {a[0], a[1]};
+
+    if (state.pipeline.shader == Shader::TEXTURE) {
+        colour = draw.texture ? draw.texture->sample(uv) : glm::vec4(1.0f);
+        if (draw.texture2)
+            colour = glm::mix(colour, draw.texture2->sample(uv), draw.mix);
+        colour = colour * draw.colour;
+        return colour.w >= draw.alphaCutoff;
+    }
+
+    colour = glm::vec4(light(state, uv, glm::vec3(a[2], a[3], a[4]), glm::vec3(a[5], a[6], a[7])), 1.0f);
+    return true;
+}
+
+// calcDirLight, calcPointLight and calcSpotLight from the multiple lights demo
+inline glm::vec3 SoftRaster::light(const DrawState& state, const glm::vec2& uv, const glm::vec3& position, const glm::vec3& normal) const {
+    const Draw& draw {state.draw};
+    glm::vec3 diffuseColour {draw.texture ? glm::vec3(draw.texture->sample(uv)) : glm::vec3(draw.colour)};
+    glm::vec3 specularColour {draw.texture2 ? glm::vec3(draw.texture2->sample(uv)) : glm::vec3(0.0f)};
+    glm::vec3 norm {glm::normalize(normal)};
+    glm::vec3 viewDir {glm::normalize(m_lighting.viewPos - position)};
+
+    // the diffuse and specular parts for light arriving along lightDir
+    auto phong = [&](const glm::vec3& lightDir, const glm::vec3& diffuse, const glm::vec3& specular) {
+        float diff {std::max(glm::dot(norm, lightDir), 0.0f)};
+        glm::vec3 reflectDir {glm::reflect(-lightDir, norm)};
+        float spec {std::pow(std::max(glm::dot(viewDir, reflectDir), 0.0f), m_lighting.shininess)};
+        return diffuse * diff * diffuseColour + specular * spec * specularColour;
+    };
+    auto attenuation = [&](float distance, float constant, float linear, float quadratic) {
+        return 1.0f / (constant + linear * distance + quadratic * (distance * distance));
+    };
+
+    const DirectionalLight& directional {m_lighting.directional};
+    glm::vec3 result {directional.ambient * diffuseColour
+                      + phong(glm::normalize(-directional.direction), directional.diffuse, directional.specular)};
+
+    for (const PointLight& point : m_lighting.points) {
+        glm::vec3 lightDir {glm::normalize(point.position - position)};
+        float distance {glm::length(point.position - position)};
+        result += (point.ambient * diffuseColour + phong(lightDir, point.diffuse, point.specular))
+                  * attenuation(distance, point.constant, point.linear, point.quadratic);
+    }
+
+    const SpotLight& spot {m_lighting.spot};
+    if (spot.enabled) {
+        glm::vec3 lightDir {glm::normalize(spot.position - position)};
+        float theta {glm::dot(lightDir, glm::normalize(-spot.direction))};
+        float intensity {std::clamp((theta - spot.outerCutOff) / (spot.cutOff - spot.outerCutOff), 0.0f, 1.0f)};
+        float distance {glm::length(spot.position - position)};
+        result += phong(lightDir, spot.diffuse, spot.specular)
+                  * attenuation(distance, spot.constant, spot.linear, spot.quadratic) * intensity;
+    }
+    return result;
+}
+
+inline SoftRaster::Difference SoftRaster::compare(const SoftRaster& a, const SoftRaster& b, int tolerance) {
+    if (a.m_width != b.m_width || a.m_height != b.m_height)
+        return Difference {static_cast<size_t>(std::max(a.m_width * a.m_height, b.m_width * b.m_height)), 255};
+
+    Difference difference {};
+    for (int y {0}; y < a.m_height; ++y) {
+        for (int x {0}; x < a.m_width; ++x) {
+            size_t index {static_cast<size_t>(y) * a.m_stride + x};
+            int error {0};
+            for (int channel {0}; channel < 4; ++channel) {
+                int pa {static_cast<int>((a.m_colour[index] >> (channel * 8)) & 0xFF)};
+                int pb {static_cast<int>((b.m_colour[index] >> (channel * 8)) & 0xFF)};
+                error = std::max(error, std::abs(pa - pb));
+            }
+            difference.maxError = std::max(difference.maxError, error);
+            if (error > tolerance)
+                ++difference.pixels;
+        }
+    }
+    return difference;
+}
+
+inline void SoftRaster::report() const {
+    size_t binned {0};
+    for (const std::vector<uint32_t>& bin : m_bins)
+        binned += bin.size();
+    std::cout << "SoftRaster: " << m_width << "x" << m_height << ", " << m_draws.size() << " draws, "
+              << m_triangles.size() << " triangles, " << binned << " in " << m_bins.size() << " tiles"
+              << (m_reference ? " (reference)" : "") << "\n";
+}
+}
+#endif
@@ -0,0 +1,222 @@
+#ifndef TRANSFORMS_H
+#define TRANSFORMS_H
+
+/* Batched object transforms
+ * Position, rotation and scale for a lot of objects, kept as one array per
+ * component (structure of arrays) so four objects can be worked on at once
+ * in SSE registers. update() turns them into model and model-view-projection
+ * matrices in a single pass, instead of a translate/rotate/scale chain per
+ * object in the draw loop, and writes them into instances(), which is laid
+ * out to be uploaded as per instance vertex data:
+ *
+ *   offset  0: model, 4 x float4 columns
+ *   offset 64: mvp,   4 x float4 columns
+ *
+ * model = translate(position) * rotate(rotation) * scale(scale), the same
+ * order as the glm chain it replaces. Rotations are kept as quaternions, so
+ * the batch is only multiplies and adds and the sin/cos happens once in
+ * setRotation() rather than every frame. Big batches can be split over the
+ * JobSystem with update()'s threadCount, like ClusteredLights::bin().
+ */
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <sjd/jobs.h>
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+// emscripten maps these onto wasm simd128 when built with -msse -msimd128
+#include <xmmintrin.h>
+#define SJD_TRANSFORMS_SSE
+#endif
+
+namespace sjd {
+class Transforms {
+public:
+    struct Instance {
+        glm::mat4 model;
+        glm::mat4 mvp;
+    };
+
+    // returns the new object's index
+    size_t add(const glm::vec3& position,
+               const glm::quat& rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f),
+               const glm::vec3& scale = glm::vec3(1.0f));
+    void clear();
+
+    size_t size() const {
+        return m_count;
+    }
+
+    void setPosition(size_t index, const glm::vec3& position);
+    void setRotation(size_t index, const glm::quat& rotation);
+    // same as glm::rotate, the axis doesn't have to be normalised
+    void setRotation(size_t index, float angle, const glm::vec3& axis);
+    void setScale(size_t index, const glm::vec3& scale);
+
+    glm::vec3 position(size_t index) const {
+        return glm::vec3(m_px[index], m_py[index], m_pz[index]);
+    }
+
+    // fills instances() for this frame's camera
+    void update(const glm::mat4& viewProjection, unsigned threadCount = 1);
+
+    const std::vector<Instance>& instances() const {
+        return m_instances;
+    }
+
+    // for sg_update_buffer, size() instances
+    const void* data() const {
+        return m_instances.data();
+    }
+
+    size_t bytes() const {
+        return m_count * sizeof(Instance);
+    }
+
+private:
+    // objects [first, last), both multiples of 4. The padding after the
+    // last object gets worked out too, it's cheaper than a scalar tail.
+    void updateRange(const glm::mat4& viewProjection, size_t first, size_t last);
+    void updateOne(const glm::mat4& viewProjection, size_t index);
+
+    size_t m_count {};
+    // padded to a multiple of 4 so the last group can be loaded whole
+    std::vector<float> m_px, m_py, m_pz;
+    std::vector<float> m_qx, m_qy, m_qz, m_qw;
+    std::vector<float> m_sx, m_sy, m_sz;
+    std::vector<Instance> m_instances;
+};
+
+inline size_t Transforms::add(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale) {
+    size_t index {m_count++};
+    size_t padded {(m_count + 3) & ~static_cast<size_t>(3)};
+    for (std::vector<float>* component : {&m_px, &m_py, &m_pz, &m_qx, &m_qy, &m_qz, &m_qw, &m_sx, &m_sy, &m_sz})
+        component->resize(padded, 0.0f);
+    m_instances.resize(padded);
+    setPosition(index, position);
+    setRotation(index, rotation);
+    setScale(index, scale);
+    return index;
+}
+
+inline void Transforms::clear() {
+    m_count = 0;
+    for (std::vector<float>* component : {&m_px, &m_py, &m_pz, &m_qx, &m_qy, &m_qz, &m_qw, &m_sx, &m_sy, &m_sz})
+        component->clear();
+    m_instances.clear();
+}
+
+inline void Transforms::setPosition(size_t index, const glm::vec3& position) {
+    m_px[index] = position.x;
+    m_py[index] = position.y;
+    m_pz[index] = position.z;
+}
+
+inline void Transforms::setRotation(size_t index, const glm::quat& rotation) {
+    m_qx[index] = rotation.x;
+    m_qy[index] = rotation.y;
+    m_qz[index] = rotation.z;
+    m_qw[index] = rotation.w;
+}
+
+inline void Transforms::setRotation(size_t index, float angle, const glm::vec3& axis) {
+    setRotation(index, glm::angleAxis(angle, glm::normalize(axis)));
+}
+
+inline void Transforms::setScale(size_t index, const glm::vec3& scale) {
+    m_sx[index] = scale.x;
+    m_sy[index] = scale.y;
+    m_sz[index] = scale.z;
+}
+
+inline void Transforms::update(const glm::mat4& viewProjection, unsigned threadCount) {
+    size_t groups {(m_count + 3) / 4};
+    if (groups == 0)
+        return;
+    threadCount = std::clamp(threadCount, 1u, static_cast<unsigned>(groups));
+    int grain {static_cast<int>((groups + threadCount - 1) / threadCount)};
+    JobSystem::instance().parallelFor(0, static_cast<int>(groups), grain, [&](int first, int last) {
+        updateRange(viewProjection, static_cast<size_t>(first) * 4, static_cast<size_t>(last) * 4);
+    });
+}
+
+inline void Transforms::updateOne(const glm::mat4& viewProjection, size_t index) {
+    glm::quat rotation {m_qw[index], m_qx[index], m_qy[index], m_qz[index]};
+    glm::mat4 model {glm::mat4_cast(rotation)};
+    model[0] *= m_sx[index];
+    model[1] *= m_sy[index];
+    model[2] *= m_sz[index];
+    model[3] = glm::vec4(position(index), 1.0f);
+    m_instances[index] = Instance {model, viewProjection * model};
+}
+
+inline void Transforms::updateRange(const glm::mat4& viewProjection, size_t first, size_t last) {
+    size_t i {first};
+#ifdef SJD_TRANSFORMS_SSE
+    // every register holds one matrix element for four objects
+    __m128 one {_mm_set1_ps(1.0f)};
+    __m128 two {_mm_set1_ps(2.0f)};
+    for (; i + 4 <= last; i += 4) {
+        __m128 qx {_mm_loadu_ps(&m_qx[i])};
+        __m128 qy {_mm_loadu_ps(&m_qy[i])};
+        __m128 qz {_mm_loadu_ps(&m_qz[i])};
+        __m128 qw {_mm_loadu_ps(&m_qw[i])};
+        __m128 xx {_mm_mul_ps(qx, qx)}, yy {_mm_mul_ps(qy, qy)}, zz {_mm_mul_ps(qz, qz)};
+        __m128 xy {_mm_mul_ps(qx, qy)}, xz {_mm_mul_ps(qx, qz)}, yz {_mm_mul_ps(qy, qz)};
+        __m128 wx {_mm_mul_ps(qw, qx)}, wy {_mm_mul_ps(qw, qy)}, wz {_mm_mul_ps(qw, qz)};
+
+        // m[column][row], the rotation the same as glm::mat4_cast
+        __m128 m[4][4];
+        m[0][0] = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz)));
+        m[0][1] = _mm_mul_ps(two, _mm_add_ps(xy, wz));
+        m[0][2] = _mm_mul_ps(two, _mm_sub_ps(xz, wy));
+        m[1][0] = _mm_mul_ps(two, _mm_sub_ps(xy, wz));
+        m[1][1] = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz)));
+        m[1][2] = _mm_mul_ps(two, _mm_add_ps(yz, wx));
+        m[2][0] = _mm_mul_ps(two, _mm_add_ps(xz, wy));
+        m[2][1] = _mm_mul_ps(two, _mm_sub_ps(yz, wx));
+        m[2][2] = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy)));
+
+        __m128 scale[3] {_mm_loadu_ps(&m_sx[i]), _mm_loadu_ps(&m_sy[i]), _mm_loadu_ps(&m_sz[i])};
+        for (int c = 0; c < 3; ++c) {
+            m[c][0] = _mm_mul_ps(m[c][0], scale[c]);
+            m[c][1] = _mm_mul_ps(m[c][1], scale[c]);
+            m[c][2] = _mm_mul_ps(m[c][2], scale[c]);
+            m[c][3] = _mm_setzero_ps();
+        }
+        m[3][0] = _mm_loadu_ps(&m_px[i]);
+        m[3][1] = _mm_loadu_ps(&m_py[i]);
+        m[3][2] = _mm_loadu_ps(&m_pz[i]);
+        m[3][3] = one;
+
+        // mvp column c = viewProjection * model column c, viewProjection is
+        // the same for every object so its elements are just broadcast
+        __m128 mvp[4][4];
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                __m128 sum {_mm_mul_ps(_mm_set1_ps(viewProjection[0][r]), m[c][0])};
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(viewProjection[1][r]), m[c][1]));
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(viewProjection[2][r]), m[c][2]));
+                if (c == 3)
+                    sum = _mm_add_ps(sum, _mm_set1_ps(viewProjection[3][r]));
+                mvp[c][r] = sum;
+            }
+        }
+
+        // back to one column per register for each object
+        for (int c = 0; c < 4; ++c) {
+            _MM_TRANSPOSE4_PS(m[c][0], m[c][1], m[c][2], m[c][3]);
+            _MM_TRANSPOSE4_PS(mvp[c][0], mvp[c][1], mvp[c][2], mvp[c][3]);
+            for (int k = 0; k < 4; ++k) {
+                _mm_storeu_ps(&m_instances[i + k].model[c][0], m[c][k]);
+                _mm_storeu_ps(&m_instances[i + k].mvp[c][0], mvp[c][k]);
+            }
+        }
+    }
+#endif
+    for (; i < last; ++i)
+        updateOne(viewProjection, i);
+}
+}
+#endif
@@ -0,0 +1,11 @@
+@echo off
+
+:: builds the shared demo runtime (sokol, stb_image and sjd::App) into
+:: build\sjd_app.lib, demos using sjd/app.h link it
+SET CODEDIR="%cd%"
+mkdir ..\build
+pushd ..\build
+cl /c %CODEDIR%/sjd_app.cpp -I%HOME%/OpenGL/include /I../include -std:c++20 -EHsc
+lib sjd_app.obj /OUT:sjd_app.lib
+popd
+
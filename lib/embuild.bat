@@ -0,0 +1,11 @@
+@echo off
+
+:: builds the shared demo runtime (sokol, stb_image and sjd::App) into
+:: embuild\libsjd_app.a, demos using sjd/app.h link it
+SET CODEDIR="%cd%"
+mkdir ..\embuild
+pushd ..\embuild
+em++ -c %CODEDIR%/sjd_app.cpp -o sjd_app.o -I%HOME%/myprojects/learn-sokol/sokol -I%HOME%/OpenGL/include -I../include -std=c++20
+emar rcs libsjd_app.a sjd_app.o
+popd
+
@@ -0,0 +1,152 @@
+/* The one translation unit with the sokol and stb_image implementations,
+ * plus sjd::App. Built once into a static library that the demos using
+ * sjd/app.h link against, see build.bat and embuild.bat.
+ */
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb/stb_image.h>
+#include <algorithm>
+#include <sjd/app.h>
+#include <sjd/frame_arena.h>
+#include <sjd/profiler.h>
+
+#define SOKOL_DEBUG
+#define SOKOL_IMPL
+#ifndef __EMSCRIPTEN__
+#define SOKOL_GLCORE
+#else
+#define SOKOL_GLES3
+#endif
+#include <sokol/sokol_app.h>
+#include <sokol/sokol_args.h>
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_log.h>
+#include <sokol/sokol_fetch.h>
+#include <sokol/sokol_glue.h>
+#include <sokol/sokol_time.h>
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+namespace sjd {
+void App::init() {
+    sg_setup(sg_desc {
+        .logger {
+            .func = slog_func
+        },
+        .environment = sglue_environment(),
+    });
+
+    sfetch_setup(sfetch_desc_t {
+        .max_requests = static_cast<uint32_t>(std::max(m_desc.fetchRequests, 1)),
+        .num_channels = 1,
+        .num_lanes = 1,
+        .logger {
+            .func = slog_func
+        },
+    });
+
+    stm_setup();
+    m_clock.setFixedStep(m_desc.fixedStep);
+    if (m_desc.replayPath)
+        m_clock.replay(m_desc.replayPath);
+    if (m_desc.recordPath)
+        m_clock.record(m_desc.recordPath);
+    if (m_desc.profile)
+        Profiler::instance().enable();
+    m_scene->init(*this);
+    // whatever init() built on the arena has been uploaded by now
+    FrameArena::instance().reset();
+}
+
+void App::frame() {
+    Profiler& profiler {Profiler::instance()};
+    profiler.beginFrame();
+    {
+        SJD_PROFILE_SCOPE("sfetch_dowork");
+        sfetch_dowork();
+    }
+
+    m_clock.tick();
+    float deltaTime {m_clock.deltaTime()};
+
+    for (FrameHook& hook : m_frameBegin)
+        hook(*this);
+
+    if (m_desc.lockMouse && !sapp_mouse_locked())
+        sapp_lock_mouse(true);
+    // the camera runs on real time, so a paused scene can still be looked
+    // around
+    if (m_camera)
+        m_camera->moveCamera(static_cast<float>(m_clock.realDeltaTime()));
+
+    {
+        SJD_PROFILE_SCOPE("update");
+        m_scene->update(*this, deltaTime);
+    }
+    {
+        SJD_PROFILE_SCOPE("render");
+        m_scene->render(*this);
+    }
+
+    for (FrameHook& hook : m_frameEnd)
+        hook(*this);
+
+    {
+        SJD_PROFILE_SCOPE("sg_commit");
+        sg_commit();
+    }
+    FrameArena::instance().reset();
+    profiler.endFrame();
+    ++m_frameCount;
+}
+
+void App::event(const sapp_event& event) {
+    if (event.type == SAPP_EVENTTYPE_KEY_DOWN && event.key_code == SAPP_KEYCODE_ESCAPE)
+        quit();
+    if (event.type == SAPP_EVENTTYPE_KEY_DOWN && event.key_code == SAPP_KEYCODE_F9)
+        Profiler::instance().startOrWrite(m_desc.tracePath);
+    if (m_camera)
+        m_input.handle(event, *m_camera);
+    m_scene->onEvent(*this, event);
+}
+
+void App::cleanup() {
+    m_scene->cleanup(*this);
+    m_clock.stopRecording();
+    Profiler::instance().finish(m_desc.tracePath);
+    sfetch_shutdown();
+    sg_shutdown();
+}
+
+void App::quit() {
+    sapp_request_quit();
+}
+
+// sokol only ever runs one app
+static App app;
+
+sapp_desc run(Scene& scene, const AppDesc& desc) {
+    app.m_scene = &scene;
+    app.m_desc = desc;
+    return sapp_desc {
+        .user_data = &app,
+        .init_userdata_cb = [](void* data) { static_cast<App*>(data)->init(); },
+        .frame_userdata_cb = [](void* data) { static_cast<App*>(data)->frame(); },
+        .cleanup_userdata_cb = [](void* data) { static_cast<App*>(data)->cleanup(); },
+        .event_userdata_cb = [](const sapp_event* e, void* data) { static_cast<App*>(data)->event(*e); },
+        .width = desc.width,
+        .height = desc.height,
+        .high_dpi = true,
+        .window_title = desc.title,
+        .logger {
+            .func = slog_func
+        },
+#ifdef _WIN32
+        .win32_console_utf8 = true,
+        .win32_console_attach = true,
+#endif
+    };
+}
+}
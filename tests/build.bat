@@ -0,0 +1,14 @@
+@echo off
+
+:: builds and runs the checks into build\, on the dummy backend so no window
+:: or GL context is needed. Fails when a check does.
+SET CODEDIR="%cd%"
+mkdir ..\build
+pushd ..\build
+cl %CODEDIR%/render_graph.cpp -I%HOME%/OpenGL/include /I../include -std:c++20 -EHsc /Fe:render_graph.exe || goto :fail
+render_graph.exe || goto :fail
+popd
+exit /b 0
+:fail
+popd
+exit /b 1
@@ -0,0 +1,8 @@
+#!/bin/sh
+# builds and runs the checks on sokol's dummy backend, they need no GL or
+# X11 libraries. Exits non-zero when a check fails.
+CODEDIR="$(cd "$(dirname "$0")" && pwd)"
+mkdir -p "$CODEDIR/../build"
+cd "$CODEDIR/../build" || exit 1
+${CXX:-c++} "$CODEDIR/render_graph.cpp" -I"$HOME/OpenGL/include" -I../include -std=c++20 -pthread -o render_graph || exit 1
+./render_graph
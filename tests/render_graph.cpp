@@ -0,0 +1,149 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sjd/render_graph.h>
+
+#define SOKOL_IMPL
+#define SOKOL_DUMMY_BACKEND
+#include <sokol/sokol_gfx.h>
+#include <sokol/sokol_log.h>
+#include <sokol/sokol_time.h>
+
+#ifdef __clang__
+// clangd doesn't like leaving struct elements value-initialised
+#pragma clang diagnostic ignored "-Wmissing-designated-field-initializers"
+#endif
+
+/* RenderGraph checks
+ * Builds small graphs on sokol's dummy backend and checks the order their
+ * passes run in and which targets end up sharing an image. Prints a line
+ * per check and returns 1 when any of them fails:
+ *
+ *   render_graph
+ */
+
+namespace check {
+using Target = sjd::RenderGraph::Target;
+using PassDesc = sjd::RenderGraph::PassDesc;
+
+int failures {0};
+
+void expect(bool passed, const std::string& name, const std::string& detail = "") {
+    if (passed) {
+        std::cout << "ok   " << name << "\n";
+        return;
+    }
+    std::cout << "FAIL " << name << (detail.empty() ? "" : ": " + detail) << "\n";
+    ++failures;
+}
+
+// adds passes that note their name when they run
+struct Graph {
+    sjd::RenderGraph graph;
+    std::string ran;
+
+    Target target() {
+        return graph.createTarget(sjd::RenderGraph::TargetDesc {});
+    }
+
+    void pass(const char* name, std::vector<Target> colors, std::vector<Target> reads) {
+        graph.addPass(PassDesc {
+            .name = name,
+            .colors = colors,
+            .reads = reads,
+            .swapchain = colors.empty(),
+        }, [this, name] { ran += name; });
+    }
+
+    // runs a frame, returning the order the passes ran in and whatever the
+    // graph printed while it compiled
+    std::string execute(std::string& printed) {
+        std::ostringstream output;
+        std::streambuf* previous {std::cout.rdbuf(output.rdbuf())};
+        ran.clear();
+        graph.execute(sg_swapchain {.width = 64, .height = 64});
+        std::cout.rdbuf(previous);
+        printed = output.str();
+        return ran;
+    }
+};
+
+bool shared(const Graph& g, Target a, Target b) {
+    return g.graph.image(a).id == g.graph.image(b).id;
+}
+
+// B reads what A wrote into t before C draws over it, D reads C's output
+void writeReadWrite() {
+    Graph g;
+    Target t {g.target()};
+    Target u {g.target()};
+    g.pass("A", {t}, {});
+    g.pass("B", {u}, {t});
+    g.pass("C", {t}, {});
+    g.pass("D", {}, {t, u});
+
+    std::string printed;
+    std::string order {g.execute(printed)};
+    expect(order == "ABCD", "write/read/write order", "ran " + order);
+    expect(printed.find("CYCLE") == std::string::npos, "write/read/write has no cycle", printed);
+    // t is alive from A to D and u from B to D
+    expect(!shared(g, t, u), "write/read/write keeps both targets");
+}
+
+// C draws over t from what B made of A's output, so it reads B as well
+void writeReadWriteDependent() {
+    Graph g;
+    Target t {g.target()};
+    Target u {g.target()};
+    g.pass("A", {t}, {});
+    g.pass("B", {u}, {t});
+    g.pass("C", {t}, {u});
+    g.pass("D", {}, {t});
+
+    std::string printed;
+    std::string order {g.execute(printed)};
+    expect(order == "ABCD", "write/read/write through a second target order", "ran " + order);
+    expect(printed.find("CYCLE") == std::string::npos, "write/read/write through a second target has no cycle", printed);
+}
+
+// a blur bouncing between two targets, then a third one after them
+void pingPong() {
+    Graph g;
+    Target ping {g.target()};
+    Target pong {g.target()};
+    Target after {g.target()};
+    g.pass("A", {ping}, {});
+    g.pass("B", {pong}, {ping});
+    g.pass("C", {ping}, {pong});
+    g.pass("D", {pong}, {ping});
+    g.pass("E", {ping}, {pong});
+    g.pass("F", {after}, {ping});
+    g.pass("G", {}, {after});
+
+    std::string printed;
+    std::string order {g.execute(printed)};
+    expect(order == "ABCDEFG", "ping-pong order", "ran " + order);
+    expect(printed.find("CYCLE") == std::string::npos, "ping-pong has no cycle", printed);
+    expect(!shared(g, ping, pong), "ping-pong keeps both targets");
+    // pong's last use is D, so F can draw into its image
+    expect(shared(g, after, pong), "ping-pong reuses the free image");
+    expect(g.graph.stats().images == 2, "ping-pong uses two images",
+           std::to_string(g.graph.stats().images) + " images");
+}
+}
+
+int main() {
+    sg_setup(sg_desc {
+        .logger {
+            .func = slog_func
+        },
+    });
+
+    check::writeReadWrite();
+    check::writeReadWriteDependent();
+    check::pingPong();
+
+    sg_shutdown();
+    return check::failures == 0 ? 0 : 1;
+}